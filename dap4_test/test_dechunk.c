@@ -0,0 +1,247 @@
+/*********************************************************************
+ *   Copyright 2018, UCAR/Unidata
+ *   See netcdf/COPYRIGHT file for copying and redistribution conditions.
+ *********************************************************************/
+
+/**
+Test the incremental dechunker (NCD4_dechunkerfeed) against
+NCD4_dechunk. A recorded DAP4 response is fed to the dechunker a few
+bytes at a time, so that chunk headers and chunk boundaries are split
+across feeds, and the DMR and data must be the same as when the whole
+response is dechunked at once. The same is done for the response cut
+into small chunks, and for responses ending in an error chunk.
+*/
+
+#include "d4includes.h"
+
+#define ERRMSG "<Error httpcode=\"404\"><Message>no such variable</Message></Error>"
+
+/* Number of bytes per feed */
+static const size_t steps[] = {1, 3, 7, 0};
+
+static int failures = 0;
+
+#define MISMATCH(name,step,msg) {fprintf(stderr,"***Fail: %s: step=%lu: %s\n",(name),(unsigned long)(step),(msg)); failures++; return;}
+
+static void
+writeheader(NCbytes* buf, unsigned int flags, size_t count)
+{
+    unsigned char hdr[CHUNKHDRSIZE];
+    /* Header is in network order with the flags in the high byte */
+    hdr[0] = (unsigned char)flags;
+    hdr[1] = (unsigned char)((count >> 16) & 0xff);
+    hdr[2] = (unsigned char)((count >> 8) & 0xff);
+    hdr[3] = (unsigned char)(count & 0xff);
+    ncbytesappendn(buf,hdr,CHUNKHDRSIZE);
+}
+
+static NCbytes*
+readresponse(const char* filename)
+{
+    FILE* f = NULL;
+    NCbytes* buf = ncbytesnew();
+    char block[1024];
+    size_t count;
+
+    if((f = fopen(filename,"rb")) == NULL) {
+	fprintf(stderr,"Cannot open: %s\n",filename);
+	exit(1);
+    }
+    while((count = fread(block,1,sizeof(block),f)) > 0)
+	ncbytesappendn(buf,block,count);
+    fclose(f);
+    return buf;
+}
+
+/* Dechunk a whole response with NCD4_dechunk */
+static int
+dechunkwhole(NCbytes* response, NCD4meta* meta)
+{
+    void* raw = malloc(ncbyteslength(response));
+    memcpy(raw,ncbytescontents(response),ncbyteslength(response));
+    meta->mode = NCD4_DAP;
+    NCD4_resetSerial(&meta->serial,ncbyteslength(response),raw);
+    return NCD4_dechunk(meta);
+}
+
+/* Dechunk a response fed step bytes at a time; 0 => all at once */
+static int
+dechunkstep(NCbytes* response, size_t step, NCD4meta* meta)
+{
+    int stat = NC_NOERR;
+    NCD4dechunker dechunker;
+    const char* p = ncbytescontents(response);
+    size_t len = ncbyteslength(response);
+
+    if(step == 0) step = len;
+    NCD4_dechunkerinit(&dechunker);
+    while(len > 0) {
+	size_t n = (step < len ? step : len);
+	if((stat = NCD4_dechunkerfeed(&dechunker,p,n))) {
+	    NCD4_dechunkerclear(&dechunker);
+	    return stat;
+	}
+	p += n; len -= n;
+    }
+    return NCD4_dechunkerfinish(&dechunker,meta);
+}
+
+static int
+samestring(const char* s1, const char* s2)
+{
+    if(s1 == NULL || s2 == NULL) return (s1 == s2);
+    return (strcmp(s1,s2) == 0);
+}
+
+/* Compare the dechunked response with the expected one at each step */
+static void
+testresponse(const char* name, NCbytes* response, NCD4meta* expected, int expectedstat)
+{
+    const size_t* step;
+
+    for(step=steps;;step++) {
+	int stat;
+	NCD4meta meta;
+	memset(&meta,0,sizeof(meta));
+	stat = dechunkstep(response,*step,&meta);
+	if(stat != expectedstat)
+	    MISMATCH(name,*step,nc_strerror(stat));
+	if(!samestring(meta.serial.dmr,expected->serial.dmr))
+	    MISMATCH(name,*step,"DMR differs");
+	if(meta.serial.dapsize != expected->serial.dapsize)
+	    MISMATCH(name,*step,"data size differs");
+	if(meta.serial.dapsize > 0
+	   && memcmp(meta.serial.dap,expected->serial.dap,meta.serial.dapsize) != 0)
+	    MISMATCH(name,*step,"data differs");
+	if(meta.serial.remotelittleendian != expected->serial.remotelittleendian)
+	    MISMATCH(name,*step,"byte order differs");
+	if(!samestring(meta.serial.errdata,expected->serial.errdata))
+	    MISMATCH(name,*step,"error chunk differs");
+	if(!samestring(meta.error.message,expected->error.message))
+	    MISMATCH(name,*step,"error message differs");
+	if(meta.serial.rawsize != ncbyteslength(response))
+	    MISMATCH(name,*step,"raw size differs");
+	NCD4_resetMeta(&meta);
+	if(*step == 0) break;
+    }
+}
+
+/* Rebuild a response with the data in chunks of at most size bytes,
+   optionally followed by an error chunk in place of the last chunk */
+static NCbytes*
+rechunk(NCD4meta* expected, size_t size, int witherror)
+{
+    NCbytes* buf = ncbytesnew();
+    size_t dmrlen = strlen(expected->serial.dmr)+1;
+    unsigned int order = (expected->serial.remotelittleendian ? NCD4_LITTLE_ENDIAN_CHUNK : 0);
+    const char* p = expected->serial.dap;
+    size_t len = expected->serial.dapsize;
+
+    writeheader(buf,order,dmrlen);
+    ncbytesappendn(buf,expected->serial.dmr,dmrlen);
+    while(len > 0) {
+	size_t n = (size < len ? size : len);
+	unsigned int flags = order;
+	if(n == len && !witherror) flags |= NCD4_LAST_CHUNK;
+	writeheader(buf,flags,n);
+	ncbytesappendn(buf,p,n);
+	p += n; len -= n;
+    }
+    if(witherror) {
+	writeheader(buf,NCD4_ERR_CHUNK|NCD4_LAST_CHUNK,strlen(ERRMSG));
+	ncbytesappendn(buf,ERRMSG,strlen(ERRMSG));
+    }
+    return buf;
+}
+
+static void
+testfile(const char* filename)
+{
+    int stat;
+    NCbytes* response = readresponse(filename);
+    NCbytes* chunked = NULL;
+    NCD4meta whole;
+    NCD4meta err;
+    char name[4096];
+
+    memset(&whole,0,sizeof(whole));
+    if((stat = dechunkwhole(response,&whole))) {
+	fprintf(stderr,"***Fail: %s: NCD4_dechunk: %s\n",filename,nc_strerror(stat));
+	exit(1);
+    }
+    testresponse(filename,response,&whole,NC_NOERR);
+
+    /* The same data in small chunks */
+    snprintf(name,sizeof(name),"%s rechunked",filename);
+    chunked = rechunk(&whole,5,0);
+    testresponse(name,chunked,&whole,NC_NOERR);
+    ncbytesfree(chunked);
+
+    /* The same data cut short by an error chunk */
+    snprintf(name,sizeof(name),"%s with error chunk",filename);
+    chunked = rechunk(&whole,5,1);
+    memset(&err,0,sizeof(err));
+    if(dechunkwhole(chunked,&err) != NC_ENODATA
+       || !samestring(err.serial.errdata,ERRMSG)) {
+	fprintf(stderr,"***Fail: %s: NCD4_dechunk\n",name);
+	failures++;
+    } else {
+	/* Only the error chunk is kept by the dechunker */
+	nullfree(err.serial.dmr); err.serial.dmr = NULL;
+	nullfree(err.serial.dap); err.serial.dap = NULL;
+	err.serial.dapsize = 0;
+	err.serial.remotelittleendian = 0;
+	testresponse(name,chunked,&err,NC_ENODATA);
+    }
+    NCD4_resetMeta(&err);
+    ncbytesfree(chunked);
+
+    NCD4_resetMeta(&whole);
+    ncbytesfree(response);
+}
+
+/* Test responses that have no data */
+static void
+testerrors(void)
+{
+    NCbytes* response = ncbytesnew();
+    NCD4meta expected;
+
+    /* An error chunk in place of the DMR */
+    memset(&expected,0,sizeof(expected));
+    writeheader(response,NCD4_ERR_CHUNK|NCD4_LAST_CHUNK,strlen(ERRMSG));
+    ncbytesappendn(response,ERRMSG,strlen(ERRMSG));
+    expected.serial.errdata = strdup(ERRMSG);
+    testresponse("error chunk",response,&expected,NC_ENODATA);
+    NCD4_resetMeta(&expected);
+
+    /* A response that is not chunked at all */
+    memset(&expected,0,sizeof(expected));
+    ncbytesclear(response);
+    ncbytescat(response,"<?xml version=\"1.0\"?>" ERRMSG);
+    expected.error.message = strdup("<?xml version=\"1.0\"?>" ERRMSG);
+    testresponse("unchunked error",response,&expected,NC_ENODATA);
+    NCD4_resetMeta(&expected);
+
+    ncbytesfree(response);
+}
+
+int
+main(int argc, char** argv)
+{
+    int i;
+
+    if(argc < 2) {
+	fprintf(stderr,"usage: test_dechunk <file.dap>...\n");
+	exit(1);
+    }
+    for(i=1;i<argc;i++)
+	testfile(argv[i]);
+    testerrors();
+    if(failures > 0) {
+	fprintf(stderr,"***Fail: %d failures\n",failures);
+	exit(1);
+    }
+    printf("*** test_dechunk passed\n");
+    exit(0);
+}
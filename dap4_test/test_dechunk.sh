@@ -0,0 +1,18 @@
+#!/bin/sh
+
+if test "x$srcdir" = x ; then srcdir=`pwd`; fi
+. ../test_common.sh
+
+set -e
+
+. ${srcdir}/d4test_common.sh
+
+echo "test_dechunk.sh:"
+
+computetestablefiles
+
+FILES=
+for f in $F ; do
+    FILES="$FILES ${RAWTESTFILES}/${f}.dap"
+done
+${VG} ${execdir}/test_dechunk $FILES
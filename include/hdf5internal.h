@@ -62,6 +62,19 @@ typedef struct NC_HDF5_FILE_INFO {
    hid_t hdfid;
    unsigned transientid; /* counter for transient ids */
    NCURI* uri; /* Parse of the incoming path, if url */
+   int write_index; /* Write the metadata index at close; see hdf5index.c */
+   size_t att_cache_limit; /* Att values bigger than this are not kept in memory; 0 => no limit */
+   size_t pool_limit; /* Max # of datasets held open by the dataset pool; 0 => no pool */
+   size_t pool_count; /* # of datasets in the pool */
+   struct NC_VAR_INFO *pool_head; /* Most recently used var in the pool */
+   struct NC_VAR_INFO *pool_tail; /* Least recently used var in the pool */
+   size_t cache_budget; /* Bytes of chunk cache shared by all vars; 0 => no budget; see hdf5cache.c */
+   size_t cache_minimum; /* Bytes of chunk cache each var may keep */
+   size_t cache_used; /* Bytes of chunk cache granted to vars on the cache list */
+   size_t cache_count; /* # of vars on the cache list */
+   size_t cache_clock; /* Counts uses of vars on the cache list */
+   struct NC_VAR_INFO *cache_head; /* Most recently used var with a chunk cache grant */
+   struct NC_VAR_INFO *cache_tail; /* Least recently used var with a chunk cache grant */
 #if defined(ENABLE_BYTERANGE)
    int byterange;
 #endif
@@ -81,6 +94,8 @@ typedef struct NC_HDF5_DIM_INFO
 typedef struct  NC_HDF5_ATT_INFO
 {
     hid_t native_hdf_typeid;     /* Native HDF5 datatype for attribute's data */
+    size_t fixed_size;           /* Size of a fixed-length string att in the file, else 0 */
+    nc_bool_t data_pending;      /* Value is in the file, but not read yet */
 } NC_HDF5_ATT_INFO_T;
 
 /* Struct to hold HDF5-specific info for a group. */
@@ -98,6 +113,12 @@ typedef struct NC_HDF5_VAR_INFO
     nc_bool_t *dimscale_attached;  /**< Array of flags that are true if dimscale is attached for that dim index. */
     int flags;
 #       define NC_HDF5_VAR_FILTER_MISSING 1 /* if any filter is missing */
+    nc_bool_t in_pool;           /**< True if the dataset is in the dataset pool. */
+    struct NC_VAR_INFO *pool_prev, *pool_next; /**< Dataset pool LRU list links. */
+    nc_bool_t in_cache;          /**< True if the var is on the chunk cache budget list. */
+    size_t cache_grant;          /**< Chunk cache size the dataset was opened with, if in_cache. */
+    size_t cache_tick;           /**< Value of the file's cache_clock when the var was last used. */
+    struct NC_VAR_INFO *cache_prev, *cache_next; /**< Chunk cache budget LRU list links. */
 } NC_HDF5_VAR_INFO_T;
 
 /* Struct to hold HDF5-specific info for a field. */
@@ -175,6 +196,21 @@ int nc4_HDF5_close_att(NC_ATT_INFO_T *att);
 
 /* Perform lazy read of the rest of the metadata for a var. */
 int nc4_get_var_meta(NC_VAR_INFO_T *var);
+int nc4_hdf5_read_att_data(NC_ATT_INFO_T *att);
+int nc4_hdf5_evict_att_data(NC_FILE_INFO_T *h5, NC_ATT_INFO_T *att);
+
+/* Pool of open datasets, for read-only files. */
+int nc4_hdf5_pool_add(NC_FILE_INFO_T *h5, NC_VAR_INFO_T *var);
+int nc4_hdf5_pool_trim(NC_FILE_INFO_T *h5);
+
+/* Chunk cache budget shared by the vars of a file. */
+size_t nc4_hdf5_cache_size(NC_VAR_INFO_T *var);
+int nc4_hdf5_cache_touch(NC_FILE_INFO_T *h5, NC_VAR_INFO_T *var);
+void nc4_hdf5_cache_release(NC_FILE_INFO_T *h5, NC_VAR_INFO_T *var);
+
+/* Persistent metadata index. */
+int NC4_hdf5_read_index(NC_FILE_INFO_T *h5, int *loadedp);
+int NC4_hdf5_write_index(NC_FILE_INFO_T *h5);
 
 /* Get the file chunk cache settings from HDF5. */
 int nc4_hdf5_get_chunk_cache(int ncid, size_t *sizep, size_t *nelemsp,
@@ -185,6 +221,10 @@ int NC4_hdf5_inq_var_filter_ids(int ncid, int varid, size_t* nfiltersp, unsigned
 int NC4_hdf5_inq_var_filter_info(int ncid, int varid, unsigned int filterid, size_t* nparamsp, unsigned int *params);
 int NC4_hdf5_inq_filter_avail(int ncid, unsigned id);
 
+/* Raw chunk dispatch entries */
+int NC4_hdf5_get_var_chunk_raw(int ncid, int varid, const size_t *startp, size_t *sizep, void *data);
+int NC4_hdf5_put_var_chunk_raw(int ncid, int varid, const size_t *startp, size_t size, const void *data);
+
 /* Filterlist management */
 
 /* The NC_VAR_INFO_T->filters field is an NClist of this struct */
@@ -127,6 +127,18 @@ Should work for any netcdf format.
 EXTERNL int NC_copy_data(NC* nc, nc_type xtypeid, const void* memory, size_t count, void* copy);
 EXTERNL int NC_copy_data_all(NC* nc, nc_type xtypeid, const void* memory, size_t count, void** copyp);
 
+/**
+Fill a vector with count instances of a fill value.  For fixed size
+types, one instance is stored and then replicated by doubling
+memcpy's; variable sized types are copied one instance at a time.
+
+NC_fill_replicate does the same for an arbitrary byte pattern of
+the given size, e.g. a fill value in external representation.
+*/
+
+EXTERNL int NC_fill_data(NC* nc, nc_type xtypeid, const void* fillvalue, size_t count, void* memory);
+EXTERNL void NC_fill_replicate(void* memory, const void* value, size_t size, size_t count);
+
 /* Macros to map NC_FORMAT_XX to metadata structure (e.g. NC_FILE_INFO_T) */
 /* Fast test for what file structure is used */
 #define NC3INFOFLAGS ((1<<NC_FORMATX_NC3)|(1<<NC_FORMATX_PNETCDF)|(1<<NC_FORMATX_DAP2))
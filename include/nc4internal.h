@@ -22,6 +22,7 @@
 #include "ncindex.h"
 #include "nc_provenance.h"
 #include "nchashmap.h"
+#include "ncarena.h"
 
 #include "netcdf_f.h"
 #include "netcdf_mem.h"
@@ -132,6 +133,7 @@ typedef struct NC_OBJ
     NC_SORT sort; /**< Type of object. */
     char* name;   /**< Name, assumed to be null terminated. */
     size_t id;    /**< This objects ID. */
+    nchashkey_t hashkey; /**< Hash of name; set when added to an NCindex. */
 } NC_OBJ;
 
 /**
@@ -306,6 +308,7 @@ typedef struct NC_FILE_INFO
     NClist *alldims;   /**< List of all dims. */
     NClist *alltypes;  /**< List of all types. */
     NClist *allgroups; /**< List of all groups, including root group. */
+    NCarena *arena;    /**< Storage for var, dim and att structs and their names; released at close. */
     void *format_file_info; /**< Pointer to binary format info for file. */
     NC4_Provenance provenance; /**< File provenence info. */
     struct NC4_Memio
@@ -331,6 +334,7 @@ typedef struct NCglobalstate {
     struct NCRCinfo* rcinfo; /* Currently only one rc file per session */
     struct GlobalZarr { /* Zarr specific parameters */
 	char dimension_separator;
+	size_t shard_chunks; /* inner chunks per shard per dimension; 0 => no sharding */
     } zarr;
     struct Alignment { /* H5Pset_alignment parameters */
         int defined; /* 1 => threshold and alignment explicitly set */
@@ -338,6 +342,10 @@ typedef struct NCglobalstate {
 	int alignment;
     } alignment;
     struct ChunkCache chunkcache;
+    struct ChunkCacheBudget { /* see nc_set_chunk_cache_budget() */
+	size_t size; /* bytes of chunk cache shared by the vars of a file; 0 => no budget */
+	size_t minimum; /* bytes of chunk cache each var may keep */
+    } chunkcachebudget;
 } NCglobalstate;
 
 /** Variable Length Datatype struct in memory. Must be identical to
@@ -416,7 +424,7 @@ extern int nc4_type_free(NC_TYPE_INFO_T *type);
 extern int nc4_field_list_add(NC_TYPE_INFO_T* parent, const char *name,
                        size_t offset, nc_type xtype, int ndims,
                        const int *dim_sizesp);
-extern int nc4_att_list_add(NCindex *list, const char *name, NC_ATT_INFO_T **att);
+extern int nc4_att_list_add(NCindex *list, NC_OBJ *container, const char *name, NC_ATT_INFO_T **att);
 extern int nc4_att_list_del(NCindex *list, NC_ATT_INFO_T *att);
 extern int nc4_grp_list_add(NC_FILE_INFO_T *h5, NC_GRP_INFO_T *parent, char *name,
                      NC_GRP_INFO_T **grp);
@@ -425,6 +433,7 @@ extern int nc4_rec_grp_del(NC_GRP_INFO_T *grp);
 extern int nc4_enum_member_add(NC_TYPE_INFO_T *type, size_t size, const char *name,
                         const void *value);
 extern int nc4_att_free(NC_ATT_INFO_T *att);
+extern int nc4_rename_obj(NC_FILE_INFO_T *h5, NC_OBJ *obj, const char *name);
 
 /* Check and normalize names. */
 extern int NC_check_name(const char *name);
@@ -0,0 +1,41 @@
+/* Copyright 2018, UCAR/Unidata and OPeNDAP, Inc.
+   See the COPYRIGHT file for more information. */
+#ifndef NCARENA_H
+#define NCARENA_H 1
+
+#include <stddef.h>
+#include "ncexternl.h"
+
+/*
+An NCarena hands out zeroed memory carved from large blocks, so
+that many small objects with the same lifetime cost a handful of
+mallocs. Objects are never freed individually; all the memory of
+an arena is released at once by ncarenafree().
+*/
+
+#if defined(_CPLUSPLUS_) || defined(__CPLUSPLUS__)
+extern "C" {
+#endif
+
+struct NCarenablock;
+
+typedef struct NCarena {
+  size_t blocksize; /* Size of each ordinary block */
+  size_t used; /* Bytes used in the current block */
+  struct NCarenablock* blocks; /* Current block; chained to older blocks */
+} NCarena;
+
+/* Create an arena; blocksize 0 => use the default */
+EXTERNL NCarena* ncarenanew(size_t blocksize);
+/* Release the arena and all memory allocated from it */
+EXTERNL void ncarenafree(NCarena*);
+/* Allocate size zeroed bytes, suitably aligned for any object */
+EXTERNL void* ncarenaalloc(NCarena*, size_t size);
+/* Copy a null terminated string into the arena */
+EXTERNL char* ncarenastrdup(NCarena*, const char*);
+
+#if defined(_CPLUSPLUS_) || defined(__CPLUSPLUS__)
+}
+#endif
+
+#endif /*NCARENA_H*/
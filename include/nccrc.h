@@ -10,7 +10,26 @@ CRC32 and CRC64 implementations from Mark Adler
 #ifndef NCCRC_H
 #define NCCRC_H 1
 
+#include <stddef.h>
+
 EXTERNL unsigned int NC_crc32(unsigned int crc, const void* buf, unsigned int len);
 EXTERNL unsigned long long NC_crc64(unsigned long long crc, void* buf, unsigned int len);
 
+/* CPU instructions for CRCs (dcrchw.c) */
+
+/* Constants folding 128-bit blocks of a reflected CRC by 128, 256, 384,
+   512, and 2048 bits: bit-reflected x^(D+63) mod P and x^(D-1) mod P */
+typedef struct NCcrcfold {
+    unsigned long long k128[2];
+    unsigned long long k256[2];
+    unsigned long long k384[2];
+    unsigned long long k512[2];
+    unsigned long long k2048[2];
+} NCcrcfold;
+
+extern size_t NC_crc_fold(const NCcrcfold* k, unsigned long long crc, const void* buf, size_t len, unsigned char* out);
+extern int NC_crc32_hw(unsigned int* crcp, const void* buf, size_t len);
+EXTERNL int NC_crc_usehardware(int use);
+EXTERNL const char* NC_crc_hwname(void);
+
 #endif /*NCCRC_H*/
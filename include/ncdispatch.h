@@ -144,6 +144,13 @@ extern int NCZ_initialize(void);
 extern int NCZ_finalize(void);
 #endif
 
+/* Aggregations of files, described by a text file starting with the
+   magic word */
+#define NCAGG_MAGIC "ncagg"
+extern const NC_Dispatch* NCAGG_dispatch_table;
+extern int NCAGG_initialize(void);
+extern int NCAGG_finalize(void);
+
 /* User-defined formats.*/
 extern NC_Dispatch* UDF0_dispatch_table;
 extern char UDF0_magic_number[NC_MAX_MAGIC_NUMBER_LEN + 1];
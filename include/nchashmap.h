@@ -10,6 +10,7 @@
 #include "config.h"
 #endif
 #include <stdint.h>
+#include "ncexternl.h"
 
 /*
 This hashmap is optimized to assume null-terminated strings as the
@@ -19,20 +20,25 @@ Data is presumed to be an index into some other table Assume it
 can be compared using simple == The key is some hash of some
 null terminated string.
 
-One problem here is that we need to do a final equality check on
-the name string to avoid an accidental hash collision. It would
-be nice if we had a large enough hashkey that was known to have
-an extremely low probability of collisions so we could compare
-the hashkeys to determine exact match. A quick internet search
-indicates that this is rather more tricky than just using
-e.g. crc64 or such.  Needs some thought.
+The table is a flat array of entries plus one control byte per
+entry, in the style of the "Swiss" tables: the control byte holds
+7 bits of the hashkey of an active entry, or marks the entry as
+empty or deleted. A lookup compares the control bytes of a group
+of entries at once (with SSE2 where available) and only touches
+the entries whose control byte matches. Short keys are stored in
+the entry itself, so most lookups read no memory outside the
+table.
+
+Since the hashkey of each entry is kept, a final string comparison
+is done only when the hashkeys match, and growing the table never
+rehashes the keys.
 */
 
 /*! Hashmap-related structs.
   NOTES:
   1. 'data' is the an arbitrary uintptr_t integer or void* pointer.
-  2. hashkey is a crc32 hash of key
-    
+  2. hashkey is a hash of key; see NC_hashmapkey.
+
   WARNINGS:
   1. It is critical that |uintptr_t| == |void*|
 */
@@ -43,21 +49,30 @@ e.g. crc64 or such.  Needs some thought.
 #define NCHASHKEYBITS (sizeof(nchashkey_t)*8)
 #endif
 
+/* Keys shorter than this are stored in the entry */
+#define NCHASHINLINE 16
+
 typedef struct NC_hentry {
-    int flags;
     uintptr_t data;
-    nchashkey_t hashkey; /* Hash id (crc)*/
-    size_t keysize;
-    char* key; /* copy of the key string; kept as unsigned char */
+    nchashkey_t hashkey; /* Hash id */
+    unsigned keysize;
+    union {
+        char inline_key[NCHASHINLINE]; /* keysize < NCHASHINLINE */
+        char* ptr; /* otherwise, a malloc'd copy of the key */
+    } key; /* null terminated; use NC_hentrykey */
 } NC_hentry;
 
+#define NC_hentrykey(e) ((e)->keysize < NCHASHINLINE ? (e)->key.inline_key : (e)->key.ptr)
+
 /*
 The hashmap object must give us the hash table (table),
 the |table| size, and the # of defined entries in the table
 */
 typedef struct NC_hashmap {
-  size_t alloc; /* allocated # of entries */
+  size_t alloc; /* allocated # of entries; a power of 2 */
   size_t active; /* # of active entries */
+  size_t deleted; /* # of deleted entries still occupying a slot */
+  unsigned char* ctrl; /* alloc control bytes, + a copy of the first group */
   NC_hentry* table;
 } NC_hashmap;
 
@@ -70,35 +85,43 @@ There are two "kinds" of functions:
 */
 
 /** Creates a new hashmap near the given size. */
-extern NC_hashmap* NC_hashmapnew(size_t startsize);
+EXTERNL NC_hashmap* NC_hashmapnew(size_t startsize);
 
 /** Inserts a new element into the hashmap; takes key+size */
 /* key points to size bytes to convert to hash key */
-extern int NC_hashmapadd(NC_hashmap*, uintptr_t data, const char* key, size_t keysize);
+EXTERNL int NC_hashmapadd(NC_hashmap*, uintptr_t data, const char* key, size_t keysize);
 
 /** Removes the storage for the element of the key; takes key+size.
     Return 1 if found, 0 otherwise; returns the data in datap if !null
 */
-extern int NC_hashmapremove(NC_hashmap*, const char* key, size_t keysize, uintptr_t* datap);
+EXTERNL int NC_hashmapremove(NC_hashmap*, const char* key, size_t keysize, uintptr_t* datap);
 
 /** Returns the data for the key; takes key+size.
     Return 1 if found, 0 otherwise; returns the data in datap if !null
 */
-extern int NC_hashmapget(NC_hashmap*, const char* key, size_t keysize, uintptr_t* datap);
+EXTERNL int NC_hashmapget(NC_hashmap*, const char* key, size_t keysize, uintptr_t* datap);
+
+/** Same as NC_hashmapadd, NC_hashmapremove and NC_hashmapget,
+    but also take the hashkey of the key, as computed by
+    NC_hashmapkey, for callers that keep it.
+*/
+EXTERNL int NC_hashmapaddkey(NC_hashmap*, uintptr_t data, const char* key, size_t keysize, nchashkey_t hashkey);
+EXTERNL int NC_hashmapremovekey(NC_hashmap*, const char* key, size_t keysize, nchashkey_t hashkey, uintptr_t* datap);
+EXTERNL int NC_hashmapgetkey(NC_hashmap*, const char* key, size_t keysize, nchashkey_t hashkey, uintptr_t* datap);
 
 /** Change the data for the specified key; takes hashkey.
     Return 1 if found, 0 otherwise
 */
-extern int NC_hashmapsetdata(NC_hashmap*, const char* key, size_t keylen, uintptr_t newdata);
+EXTERNL int NC_hashmapsetdata(NC_hashmap*, const char* key, size_t keylen, uintptr_t newdata);
 
 /** Returns the number of active elements. */
-extern size_t NC_hashmapcount(NC_hashmap*);
+EXTERNL size_t NC_hashmapcount(NC_hashmap*);
 
 /** Reclaims the hashmap structure. */
-extern int NC_hashmapfree(NC_hashmap*);
+EXTERNL int NC_hashmapfree(NC_hashmap*);
 
 /* Return the hash key for specified key; takes key+size*/
-extern nchashkey_t NC_hashmapkey(const char* key, size_t size);
+EXTERNL nchashkey_t NC_hashmapkey(const char* key, size_t size);
 
 /* Return the ith entry info:
 @param map
@@ -107,7 +130,7 @@ extern nchashkey_t NC_hashmapkey(const char* key, size_t size);
 @param keyp contains null if not active, otherwise the key
 @return NC_EINVAL if no more entries
 */
-extern int NC_hashmapith(NC_hashmap* map, size_t i, uintptr_t* datap, const char** keyp);
+EXTERNL int NC_hashmapith(NC_hashmap* map, size_t i, uintptr_t* datap, const char** keyp);
 
 #endif /*NCHASHMAP_H*/
 
@@ -165,6 +165,7 @@ Use this in mode flags for both nc_create() and nc_open(). */
 /* Upper 16 bits */
 #define NC_NOATTCREORD  0x20000 /**< Disable the netcdf-4 (hdf5) attribute creation order tracking */
 #define NC_NODIMSCALE_ATTACH 0x40000 /**< Disable the netcdf-4 (hdf5) attaching of dimscales to variables (#2128) */
+#define NC_LAZYOPEN     0x80000 /**< Defer opening netcdf-4 (hdf5) datasets until first access. Mode flag for read-only nc_open() */
 
 #define NC_MAX_MAGIC_NUMBER_LEN 8 /**< Max len of user-defined format magic number. */
 
@@ -223,6 +224,7 @@ Use this in mode flags for both nc_create() and nc_open(). */
 #define NC_FORMATX_UDF0      (8)
 #define NC_FORMATX_UDF1      (9)
 #define NC_FORMATX_NCZARR    (10)
+#define NC_FORMATX_NCAGG     (11) /**< aggregation of files */
 #define NC_FORMATX_UNDEFINED (0)
 
   /* To avoid breaking compatibility (such as in the python library),
@@ -972,6 +974,14 @@ nc_set_chunk_cache(size_t size, size_t nelems, float preemption);
 EXTERNL int
 nc_get_chunk_cache(size_t *sizep, size_t *nelemsp, float *preemptionp);
 
+/* Set the chunk cache budget shared by the variables of each file. */
+EXTERNL int
+nc_set_chunk_cache_budget(size_t size, size_t minimum);
+
+/* Get the chunk cache budget shared by the variables of each file. */
+EXTERNL int
+nc_get_chunk_cache_budget(size_t *sizep, size_t *minimump);
+
 /* Set the per-variable cache size, nelems, and preemption policy. */
 EXTERNL int
 nc_set_var_chunk_cache(int ncid, int varid, size_t size, size_t nelems,
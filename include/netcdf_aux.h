@@ -96,6 +96,35 @@ EXTERNL int ncaux_abort_compound(void* tag);
 EXTERNL int ncaux_add_field(void* tag,  const char *name, nc_type field_type,
 			   int ndims, const int* dimsizes);
 
+/**************************************************/
+/* Advise chunk sizes from the expected accesses to a variable */
+
+/* An access pattern: the counts of the slabs accessed and how often,
+   relative to the other patterns, they are accessed. */
+typedef struct NC_Access_Pattern {
+    double weight;
+    const size_t* counts;
+} NC_Access_Pattern;
+
+EXTERNL int ncaux_advise_chunking(int ndims, const size_t* dimlens, size_t typesize, size_t target, size_t npatterns, const NC_Access_Pattern* patterns, size_t* chunksizes);
+
+/**************************************************/
+/* Checksums of the contents of variables */
+
+/* Attributes holding the checksums of a variable */
+#define NC_CHECKSUM_ATT "checksum_crc64"
+#define NC_CHUNK_CHECKSUMS_ATT "chunk_checksums_crc32"
+
+/* Results of ncaux_verify_checksums */
+#define NC_CHECKSUM_NONE 0 /* no checksums stored */
+#define NC_CHECKSUM_OK 1
+#define NC_CHECKSUM_BAD 2
+
+EXTERNL int ncaux_var_checksum(int ncid, int varid, unsigned long long* crcp);
+EXTERNL int ncaux_var_chunk_checksums(int ncid, int varid, size_t* nchunksp, unsigned int* crcs);
+EXTERNL int ncaux_put_checksums(int ncid, int varid, unsigned long long crc, size_t nchunks, const unsigned int* crcs);
+EXTERNL int ncaux_verify_checksums(int ncid, int varid, int* statusp, size_t* badchunkp);
+
 #if defined(__cplusplus)
 }
 #endif
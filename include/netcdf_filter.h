@@ -97,6 +97,12 @@ EXTERNL int nc_inq_var_filter_info(int ncid, int varid, unsigned int id, size_t*
 /* See if filter is available */
 EXTERNL int nc_inq_filter_avail(int ncid, unsigned id);
 
+/**************************************************/
+/* Read and write chunks as they are stored, with the filters applied */
+
+EXTERNL int nc_get_var_chunk_raw(int ncid, int varid, const size_t* startp, size_t* sizep, void* data);
+EXTERNL int nc_put_var_chunk_raw(int ncid, int varid, const size_t* startp, size_t size, const void* data);
+
 /**************************************************/
 /* Functions for accessing standardized filters */
 
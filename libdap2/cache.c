@@ -83,6 +83,56 @@ else
     return found;
 }
 
+/* Return 1 if some partial-variable cache node (typically
+   one built by a batched fetch) was fetched using a projection
+   identical to proj; return 0 otherwise.
+   Proj must have been built the same way as the fetch projections
+   in nc3d_getvarx (i.e. merged with the url projections
+   and with pseudo dimensions removed).
+*/
+int
+isslabcached(NCDAPCOMMON* nccomm, DCEprojection* proj, NCcachenode** cachenodep)
+{
+    int i,j,found,index;
+    NCcache* cache;
+    NCcachenode* cachenode = NULL;
+    char* target = NULL;
+
+    found = 0;
+    index = 0;
+    if(proj == NULL) goto done;
+    cache = nccomm->cdf.cache;
+    target = dcetostring((DCEnode*)proj);
+    for(i=nclistlength(cache->nodes)-1;i>=0;i--) {
+        cachenode = (NCcachenode*)nclistget(cache->nodes,i);
+	if(cachenode->wholevariable || cachenode->constraint == NULL) continue;
+	for(j=0;j<nclistlength(cachenode->constraint->projections);j++) {
+	    DCEprojection* p = (DCEprojection*)nclistget(cachenode->constraint->projections,j);
+	    char* s = dcetostring((DCEnode*)p);
+	    found = (strcmp(s,target) == 0);
+	    nullfree(s);
+	    if(found) {index=i; break;}
+	}
+	if(found) break;
+    }
+
+    if(found) {
+        if(nclistlength(cache->nodes) > 1) {
+	    /* Manage the cache nodes as LRU */
+	    nclistremove(cache->nodes,index);
+	    nclistpush(cache->nodes,(void*)cachenode);
+	}
+        if(cachenodep) *cachenodep = cachenode;
+    }
+
+done:
+#ifdef DEBUG
+fprintf(stderr,"isslabcached: %s: %s\n",target,(found?"found":"notfound"));
+#endif
+    nullfree(target);
+    return found;
+}
+
 /* Compute the set of prefetched data.
    Notes:
    1. All prefetches are whole variable fetches.
@@ -348,6 +398,12 @@ freenccache(NCDAPCOMMON* nccomm, NCcache* cache)
 	freenccachenode(nccomm,(NCcachenode*)nclistget(cache->nodes,i));
     }
     nclistfree(cache->nodes);
+    for(i=0;i<nclistlength(cache->history);i++) {
+	NCaccess* access = (NCaccess*)nclistget(cache->history,i);
+	nullfree(access->slab);
+	nullfree(access);
+    }
+    nclistfree(cache->history);
     nullfree(cache);
 }
 
@@ -361,6 +417,8 @@ createnccache(void)
     c->cachesize = 0;
     c->nodes = nclistnew();
     c->cachecount = DFALTCACHECOUNT;
+    c->batchlimit = 0;
+    c->history = nclistnew();
     return c;
 }
 
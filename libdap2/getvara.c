@@ -32,6 +32,9 @@ static NCerror movetofield(NCDAPCOMMON*, OCdatanode,
 
 static int findfield(CDFnode* node, CDFnode* subnode);
 static NCerror removepseudodims(DCEprojection* proj);
+static NCerror batchfetch(NCDAPCOMMON*, CDFnode* var,
+			  const size_t* startp, const size_t* countp, const ptrdiff_t* stridep,
+			  DCEprojection* fetchprojection, NCcachenode** cachenodep);
 
 static int extract(NCDAPCOMMON*, Getvara*, CDFnode*, DCEsegment*, size_t dimindex, OClink, OCdatanode, struct NCMEMORY*);
 static int extractstring(NCDAPCOMMON*, Getvara*, CDFnode*, DCEsegment*, size_t dimindex, OClink, OCdatanode, struct NCMEMORY*);
@@ -359,6 +362,21 @@ fprintf(stderr,"getvarx: FETCHVAR: fetchconstraint: %s\n",dumpconstraint(fetchco
 	walkprojection = (DCEprojection*)dceclone((DCEnode*)varaprojection);
         dapshiftprojection(walkprojection);
 
+	if(dapcomm->cdf.cache->batchlimit > 0) {
+	    /* The slab may already be present from an earlier batch;
+	       otherwise, see if this read should start a new batch */
+	    if(!isslabcached(dapcomm,fetchprojection,&cachenode)) {
+	        ncstat = batchfetch(dapcomm,cdfvar,startp,countp,stridep,
+				    fetchprojection,&cachenode);
+	        if(ncstat != NC_NOERR) {THROWCHK(ncstat); goto fail;}
+	    }
+	    if(cachenode != NULL) {
+		dcefree((DCEnode*)fetchprojection);
+		fetchprojection = NULL;
+		break;
+	    }
+	}
+
 #ifdef DEBUG
         fprintf(stderr,"getvarx: FETCHPART: fetchprojection: |%s|\n",dumpprojection(fetchprojection));
 #endif
@@ -422,6 +440,163 @@ fail:
     return THROW(ncstat);
 }
 
+/* Build the signature of a hyperslab: start:count:stride for each dimension */
+static char*
+slabsignature(size_t rank, const size_t* startp, const size_t* countp, const ptrdiff_t* stridep)
+{
+    size_t i;
+    char tmp[128];
+    char* signature = NULL;
+    NCbytes* buf = ncbytesnew();
+    for(i=0;i<rank;i++) {
+	snprintf(tmp,sizeof(tmp),"[%lu:%lu:%ld]",
+		(unsigned long)startp[i],(unsigned long)countp[i],(long)stridep[i]);
+	ncbytescat(buf,tmp);
+    }
+    ncbytesnull(buf);
+    signature = ncbytesextract(buf);
+    ncbytesfree(buf);
+    return signature;
+}
+
+/* Return 1 if var has the same dimension sizes as target, so
+   that the target hyperslab can be applied to var as well. */
+static int
+isconformant(CDFnode* target, CDFnode* var)
+{
+    int i;
+    NClist* tdims = target->array.dimsetall;
+    NClist* vdims = var->array.dimsetall;
+    if(nclistlength(tdims) != nclistlength(vdims)) return 0;
+    for(i=0;i<nclistlength(tdims);i++) {
+	CDFnode* tdim = (CDFnode*)nclistget(tdims,i);
+	CDFnode* vdim = (CDFnode*)nclistget(vdims,i);
+	if(tdim->dim.declsize != vdim->dim.declsize) return 0;
+    }
+    return 1;
+}
+
+/*
+Remember a partial read of var in the access history and,
+if the history shows the same hyperslab being read from another
+conformant variable, assume that the client is walking the variables
+over a common region. In that case, fetch the hyperslab for var
+together with the same hyperslab of up to batchlimit-1 other
+conformant variables using a single constraint. The resulting
+cache node is partial-variable, so later reads are matched
+using isslabcached(). If no batch is warranted,
+then *cachenodep is set to NULL.
+*/
+static NCerror
+batchfetch(NCDAPCOMMON* nccomm, CDFnode* var,
+	   const size_t* startp, const size_t* countp, const ptrdiff_t* stridep,
+	   DCEprojection* fetchprojection, NCcachenode** cachenodep)
+{
+    NCerror ncstat = NC_NOERR;
+    int i;
+    size_t j, rank, nelems, total;
+    NCcache* cache = nccomm->cdf.cache;
+    NClist* allvars = nccomm->cdf.ddsroot->tree->varnodes;
+    NCaccess* access = NULL;
+    char* slab = NULL;
+    int predicted = 0;
+    NClist* vars = NULL;
+    DCEconstraint* batchconstraint = NULL;
+    DCEprojection* varaprojection = NULL;
+    DCEprojection* projection = NULL;
+    NCcachenode* cachenode = NULL;
+
+    *cachenodep = NULL;
+
+    rank = nclistlength(var->array.dimsetall);
+    slab = slabsignature(rank,startp,countp,stridep);
+
+    /* Look for the same slab read from some other conformant variable */
+    for(i=0;i<nclistlength(cache->history);i++) {
+	NCaccess* prev = (NCaccess*)nclistget(cache->history,i);
+	if(prev->var != var && strcmp(prev->slab,slab) == 0
+	   && isconformant(var,prev->var)) {predicted = 1; break;}
+    }
+
+    /* Record this access, discarding the oldest if necessary */
+    if(nclistlength(cache->history) >= BATCHHISTORY) {
+	NCaccess* oldest = (NCaccess*)nclistremove(cache->history,0);
+	nullfree(oldest->slab);
+	nullfree(oldest);
+    }
+    if((access = (NCaccess*)calloc(1,sizeof(NCaccess))) == NULL)
+	{ncstat = NC_ENOMEM; goto done;}
+    access->var = var;
+    access->slab = slab; slab = NULL;
+    nclistpush(cache->history,(void*)access);
+
+    if(!predicted) goto done;
+
+    for(nelems=1,j=0;j<rank;j++) nelems *= countp[j];
+
+    batchconstraint = (DCEconstraint*)dcecreate(CES_CONSTRAINT);
+    batchconstraint->selections = dceclonelist(nccomm->oc.dapconstraint->selections);
+    batchconstraint->projections = nclistnew();
+    nclistpush(batchconstraint->projections,dceclone((DCEnode*)fetchprojection));
+    vars = nclistnew();
+    nclistpush(vars,(void*)var);
+    total = nelems * nctypesizeof(var->etype);
+
+    for(i=0;i<nclistlength(allvars);i++) {
+	CDFnode* candidate = (CDFnode*)nclistget(allvars,i);
+	size_t size;
+	if(nclistlength(vars) >= cache->batchlimit) break;
+	if(candidate == var || candidate->invisible
+	   || candidate->nctype != NC_Atomic
+	   || candidate->array.basevar != NULL
+	   || dapinsequence(candidate)
+	   || !isconformant(var,candidate))
+	    continue;
+	/* Stay within the cache limit */
+	size = nelems * nctypesizeof(candidate->etype);
+	if(total + size > cache->cachelimit) continue;
+	/* Skip anything already available from the cache */
+	if(iscached(nccomm,candidate,NULL)) continue;
+	ncstat = dapbuildvaraprojection(candidate,startp,countp,stridep,&varaprojection);
+	if(ncstat != NC_NOERR) {THROWCHK(ncstat); goto done;}
+	ncstat = daprestrictprojection(nccomm->oc.dapconstraint->projections,
+				       varaprojection,&projection);
+	if(ncstat != NC_NOERR) {THROWCHK(ncstat); goto done;}
+	dcefree((DCEnode*)varaprojection); varaprojection = NULL;
+	ncstat = removepseudodims(projection);
+	if(ncstat != NC_NOERR) {THROWCHK(ncstat); goto done;}
+	if(isslabcached(nccomm,projection,NULL)) {
+	    dcefree((DCEnode*)projection); projection = NULL;
+	    continue;
+	}
+	nclistpush(batchconstraint->projections,(void*)projection);
+	projection = NULL;
+	nclistpush(vars,(void*)candidate);
+	total += size;
+    }
+
+    /* Nothing worth batching with */
+    if(nclistlength(vars) < 2) goto done;
+
+if(SHOWFETCH) {
+char* s = dumpprojections(batchconstraint->projections);
+LOG1(NCLOGNOTE,"batch: %s",s);
+nullfree(s);
+}
+    ncstat = buildcachenode(nccomm,batchconstraint,vars,&cachenode,0);
+    batchconstraint = NULL; /* buildcachenode takes control of batchconstraint */
+    if(ncstat != NC_NOERR) {THROWCHK(ncstat); goto done;}
+    *cachenodep = cachenode;
+
+done:
+    nullfree(slab);
+    nclistfree(vars);
+    dcefree((DCEnode*)varaprojection);
+    dcefree((DCEnode*)projection);
+    dcefree((DCEnode*)batchconstraint);
+    return THROW(ncstat);
+}
+
 /* Remove any pseudodimensions (sequence and string)*/
 static NCerror
 removepseudodims(DCEprojection* proj)
@@ -26,6 +26,11 @@ and the per-retrieval maximum size
 /* Max number of cache nodes */
 #define DFALTCACHECOUNT (100)
 
+/* Max number of variables in one batched fetch */
+#define DFALTBATCHLIMIT (32)
+/* Number of recent partial reads remembered for batch prediction */
+#define BATCHHISTORY (16)
+
 typedef struct Getvara {
     void* memory; /* where result is put*/
     struct NCcachenode* cache;
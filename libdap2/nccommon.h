@@ -80,13 +80,21 @@ typedef struct NCcachenode {
 } NCcachenode;
 
 
+/* Record of a recent partial-variable read; used to predict batches */
+typedef struct NCaccess {
+    struct CDFnode* var;
+    char* slab; /* start:count:stride for each dimension */
+} NCaccess;
+
 /* All cache info */
 typedef struct NCcache {
     size_t cachelimit; /* max total size for all cached entries */
     size_t cachesize; /* current size */
     size_t cachecount; /* max # nodes in cache */
+    size_t batchlimit; /* max # vars in one batched fetch; 0 => no batching */
     NCcachenode* prefetch;
     NClist* nodes; /* cache nodes other than prefetch */
+    NClist* history; /* recent partial-variable reads (NCaccess*) */
 } NCcache;
 
 /**************************************************/
@@ -287,6 +295,7 @@ extern NCerror definedimsettrans(NCDAPCOMMON*,CDFtree*);
 
 /* From cache.c */
 extern int iscached(NCDAPCOMMON*, CDFnode* target, NCcachenode** cachenodep);
+extern int isslabcached(NCDAPCOMMON*, DCEprojection* proj, NCcachenode** cachenodep);
 extern NCerror prefetchdata(NCDAPCOMMON*);
 extern NCerror markprefetch(NCDAPCOMMON*);
 extern NCerror buildcachenode(NCDAPCOMMON*,
@@ -183,6 +183,9 @@ NC_NOTNC4_def_var_quantize,
 NC_NOTNC4_inq_var_quantize,
 
 NC_NOOP_inq_filter_avail,
+
+NC_NOTNC4_get_var_chunk_raw,
+NC_NOTNC4_put_var_chunk_raw,
 };
 
 const NC_Dispatch* NCD2_dispatch_table = NULL; /* moved here from ddispatch.c */
@@ -1281,6 +1284,15 @@ applyclientparams(NCDAPCOMMON* nccomm)
     if(!FLAGSET(nccomm->controls,NCF_CACHE))
         nccomm->cdf.cache->cachecount = 0;
 
+    /* Batching of partial reads is off unless requested */
+    nccomm->cdf.cache->batchlimit = 0;
+    value = paramlookup(nccomm,"batch");
+    if(value != NULL && paramlookup(nccomm,"nobatch") == NULL) {
+        nccomm->cdf.cache->batchlimit = DFALTBATCHLIMIT;
+        limit = getlimitnumber(value);
+        if(limit > 1) nccomm->cdf.cache->batchlimit = limit;
+    }
+
     if(paramlookup(nccomm,"nolimit") != NULL)
 	dfaltseqlim = 0;
     value = paramlookup(nccomm,"limit");
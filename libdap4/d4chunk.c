@@ -152,6 +152,235 @@ processerrchunk(NCD4meta* metadata, void* errchunk, unsigned int count)
     return THROW(NC_ENODATA); /* slight lie */
 }
 
+/**************************************************/
+/* Incremental de-chunking */
+
+/*
+The following functions perform the same conversion as
+NCD4_dechunk, but incrementally: the bytes of a DAP response are
+fed in as they arrive (e.g. from a curl write callback), and the
+chunk headers are stripped as each chunk is seen. So the DMR and
+the data are separated while the transfer is in progress, and the
+complete raw packet is never held in memory.
+*/
+
+/* Dechunker states */
+#define DCHK_PREFIX 0 /* collecting the start of the response */
+#define DCHK_HDR 1 /* collecting a chunk header */
+#define DCHK_BODY 2 /* collecting the body of a chunk */
+#define DCHK_RAW 3 /* response is not chunked; collect it as an error */
+#define DCHK_DONE 4 /* last chunk seen; ignore anything further */
+
+/* Enough to hold a chunk header plus the start of the DMR */
+#define PREFIXSIZE (CHUNKHDRSIZE+5)
+
+/* Append to a buffer, growing it geometrically */
+static void
+appendbytes(NCbytes* buf, const void* p, size_t len, d4size_t expected)
+{
+    if(!ncbytesavail(buf,len)) {
+	size_t newalloc = 2*ncbytesalloc(buf);
+	if(newalloc < ncbyteslength(buf)+len) newalloc = ncbyteslength(buf)+len;
+	if(expected > newalloc) newalloc = expected; /* avoid repeated growth */
+	ncbytessetalloc(buf,newalloc);
+    }
+    ncbytesappendn(buf,p,len);
+}
+
+void
+NCD4_dechunkerinit(NCD4dechunker* dechunker)
+{
+    memset(dechunker,0,sizeof(NCD4dechunker));
+    dechunker->state = DCHK_PREFIX;
+    dechunker->hostlittleendian = NCD4_isLittleEndian();
+    dechunker->isdmr = 1;
+    dechunker->dmr = ncbytesnew();
+    dechunker->dap = ncbytesnew();
+    dechunker->err = ncbytesnew();
+}
+
+void
+NCD4_dechunkerclear(NCD4dechunker* dechunker)
+{
+    ncbytesfree(dechunker->dmr);
+    ncbytesfree(dechunker->dap);
+    ncbytesfree(dechunker->err);
+    memset(dechunker,0,sizeof(NCD4dechunker));
+}
+
+static void
+chunkdone(NCD4dechunker* d)
+{
+    d->lastflags = d->hdr.flags;
+    if(d->hdr.flags & (NCD4_LAST_CHUNK|NCD4_ERR_CHUNK))
+	d->state = DCHK_DONE;
+    else {
+	d->state = DCHK_HDR;
+	d->isdmr = 0;
+    }
+}
+
+static int
+dechunkbytes(NCD4dechunker* d, const unsigned char* p, size_t len)
+{
+    while(len > 0) {
+	size_t n;
+	switch (d->state) {
+	case DCHK_HDR:
+	    n = CHUNKHDRSIZE - d->nprefix;
+	    if(n > len) n = len;
+	    memcpy(d->prefix+d->nprefix,p,n);
+	    d->nprefix += n; p += n; len -= n;
+	    if(d->nprefix < CHUNKHDRSIZE) break;
+	    d->nprefix = 0;
+	    (void)NCD4_getheader(d->prefix,&d->hdr,d->hostlittleendian);
+	    if(d->isdmr) {
+		if(d->hdr.count == 0 && !(d->hdr.flags & NCD4_ERR_CHUNK))
+		    return THROW(NC_EDMR);
+		d->remotelittleendian = ((d->hdr.flags & NCD4_LITTLE_ENDIAN_CHUNK) ? 1 : 0);
+	    } else if(!(d->hdr.flags & NCD4_ERR_CHUNK))
+		d->sawdata = 1;
+	    d->remaining = d->hdr.count;
+	    d->state = DCHK_BODY;
+	    if(d->remaining == 0) chunkdone(d);
+	    break;
+	case DCHK_BODY: {
+	    NCbytes* dst;
+	    n = (size_t)(d->remaining < len ? d->remaining : len);
+	    if(d->hdr.flags & NCD4_ERR_CHUNK)
+		dst = d->err;
+	    else if(d->isdmr)
+		dst = d->dmr;
+	    else
+		dst = d->dap;
+	    appendbytes(dst,p,n,(dst == d->dap ? d->expected : 0));
+	    d->remaining -= n; p += n; len -= n;
+	    if(d->remaining == 0) chunkdone(d);
+	    } break;
+	case DCHK_RAW:
+	    appendbytes(d->err,p,len,0);
+	    len = 0;
+	    break;
+	case DCHK_DONE:
+	default: /* ignore anything after the last chunk */
+	    len = 0;
+	    break;
+	}
+    }
+    return NC_NOERR;
+}
+
+/**
+Feed the next part of a DAP response to the dechunker.
+@param dechunker the dechunker state
+@param buf the bytes
+@param len |buf|
+@return NC_NOERR | NC_EDMR
+*/
+int
+NCD4_dechunkerfeed(NCD4dechunker* d, const void* buf, size_t len)
+{
+    int stat = NC_NOERR;
+    const unsigned char* p = (const unsigned char*)buf;
+
+    d->rawsize += len;
+    if(d->state == DCHK_PREFIX) {
+	unsigned char prefix[PREFIXSIZE];
+	const char* dmrstart;
+	size_t n = PREFIXSIZE - d->nprefix;
+	if(n > len) n = len;
+	memcpy(d->prefix+d->nprefix,p,n);
+	d->nprefix += n; p += n; len -= n;
+	if(d->nprefix < PREFIXSIZE) return NC_NOERR;
+	/* A chunked response must start with a header followed by the DMR,
+	   or with an error chunk; anything else (e.g. an xml or html error
+	   page) is an error */
+	memcpy(prefix,d->prefix,PREFIXSIZE);
+	d->nprefix = 0;
+	dmrstart = (const char*)prefix+CHUNKHDRSIZE;
+	if(memcmp(dmrstart,"<?xml",5)==0 || memcmp(dmrstart,"<Data",5)==0
+	   || (prefix[0] & NCD4_ERR_CHUNK)) {
+	    d->state = DCHK_HDR;
+	    if((stat = dechunkbytes(d,prefix,PREFIXSIZE))) return THROW(stat);
+	} else {
+	    d->state = DCHK_RAW;
+	    appendbytes(d->err,prefix,PREFIXSIZE,0);
+	}
+    }
+    return dechunkbytes(d,p,len);
+}
+
+/**
+Complete the de-chunking and transfer the results to metadata->serial
+in the same form as produced by NCD4_dechunk.
+@param dechunker the dechunker state; cleared on return
+@param metadata the metadata to receive the dmr and data
+@return NC_NOERR | NC_EDMR | NC_ENODATA | NC_EDATADDS
+*/
+int
+NCD4_dechunkerfinish(NCD4dechunker* d, NCD4meta* metadata)
+{
+    int stat = NC_NOERR;
+    NCD4serial* serial = &metadata->serial;
+
+    NCD4_resetSerial(serial,0,NULL);
+    serial->rawsize = (size_t)d->rawsize;
+
+    if(d->state == DCHK_PREFIX) {
+	/* Too short to be a chunked response */
+	appendbytes(d->err,d->prefix,d->nprefix,0);
+	d->state = DCHK_RAW;
+    }
+    if(d->state == DCHK_RAW) {
+	stat = NCD4_seterrormessage(metadata, ncbyteslength(d->err), ncbytescontents(d->err));
+	goto done;
+    }
+    if(d->lastflags & NCD4_ERR_CHUNK) {
+	ncbytesnull(d->err);
+	serial->errdata = ncbytesextract(d->err);
+	stat = THROW(NC_ENODATA); /* slight lie */
+	goto done;
+    }
+    if(ncbyteslength(d->dmr) == 0 || (d->isdmr && d->state != DCHK_DONE)) {
+	stat = THROW(NC_EDMR); /* DMR chunk is missing or incomplete */
+	goto done;
+    }
+    /* Again, avoid strxxx operations on dmr */
+    {
+	size_t len = ncbyteslength(d->dmr);
+	ncbytesnull(d->dmr);
+	serial->dmr = ncbytesextract(d->dmr);
+	serial->dmr[len-1] = '\0';
+	/* Suppress nuls */
+	(void)NCD4_elidenuls(serial->dmr,len);
+    }
+    serial->remotelittleendian = d->remotelittleendian;
+    if(d->isdmr) {/* The DMR chunk was also the last chunk */
+	stat = THROW(NC_ENODATA);
+	goto done;
+    }
+    if(!d->sawdata || d->state != DCHK_DONE) {
+	/* Server only sent the DMR part or the response was truncated */
+	serial->dapsize = 0;
+	stat = THROW(NC_EDATADDS);
+	goto done;
+    }
+    serial->dapsize = ncbyteslength(d->dap);
+    ncbytesnull(d->dap); /* make sure serial->dap is never NULL */
+    serial->dap = ncbytesextract(d->dap);
+
+#ifdef D4DUMPDMR
+    fprintf(stderr,"%s\n",serial->dmr);
+    fflush(stderr);
+#endif
+#ifdef D4DUMPDAP
+    NCD4_tagdump(serial->dapsize,serial->dap,0,"DAP");
+#endif
+done:
+    NCD4_dechunkerclear(d);
+    return THROW(stat);
+}
+
 /**
 Given a raw response, attempt to infer the mode: DMR, DAP, DSR.
 Since DSR is not standardizes, it becomes the default.
@@ -8,6 +8,8 @@
 
 static size_t WriteFileCallback(void*, size_t, size_t, void*);
 static size_t WriteMemoryCallback(void*, size_t, size_t, void*);
+static size_t WriteDechunkCallback(void*, size_t, size_t, void*);
+static int fetchurl(CURL* curl, const char* url, size_t (*writer)(void*,size_t,size_t,void*), void* data, long* filetime, int* httpcodep);
 static int curlerrtoncerr(CURLcode cstat);
 
 struct Fetchdata {
@@ -15,6 +17,12 @@ struct Fetchdata {
         size_t size;
 };
 
+struct Dechunkdata {
+        CURL* curl;
+        NCD4dechunker* dechunker;
+        int ret; /* error, if any, from the dechunker */
+};
+
 long
 NCD4_fetchhttpcode(CURL* curl)
 {
@@ -90,17 +98,53 @@ int
 NCD4_fetchurl(CURL* curl, const char* url, NCbytes* buf, long* filetime, int* httpcodep)
 {
     int ret = NC_NOERR;
-    CURLcode cstat = CURLE_OK;
     size_t len;
+
+    ret = fetchurl(curl,url,WriteMemoryCallback,(void*)buf,filetime,httpcodep);
+
+    /* Null terminate the buffer*/
+    len = ncbyteslength(buf);
+    ncbytesappend(buf, '\0');
+    ncbytessetlength(buf, len); /* don't count null in buffer size*/
+#ifdef D4DEBUG
+    nclog(NCLOGNOTE,"buffersize: %lu bytes",(d4size_t)ncbyteslength(buf));
+#endif
+    return THROW(ret);
+}
+
+/**
+Fetch a DAP response and de-chunk it as it arrives.
+The caller must have initialized the dechunker and
+must call NCD4_dechunkerfinish afterwards.
+*/
+int
+NCD4_fetchurl_dechunk(CURL* curl, const char* url, NCD4dechunker* dechunker, long* filetime, int* httpcodep)
+{
+    int ret = NC_NOERR;
+    struct Dechunkdata dechunkdata;
+
+    dechunkdata.curl = curl;
+    dechunkdata.dechunker = dechunker;
+    dechunkdata.ret = NC_NOERR;
+    ret = fetchurl(curl,url,WriteDechunkCallback,(void*)&dechunkdata,filetime,httpcodep);
+    if(dechunkdata.ret != NC_NOERR) ret = dechunkdata.ret; /* transfer was aborted */
+    return THROW(ret);
+}
+
+static int
+fetchurl(CURL* curl, const char* url, size_t (*writer)(void*,size_t,size_t,void*), void* data, long* filetime, int* httpcodep)
+{
+    int ret = NC_NOERR;
+    CURLcode cstat = CURLE_OK;
     long httpcode = 0;
 
     /* send all data to this function  */
-    cstat = curl_easy_setopt(curl, CURLOPT_WRITEFUNCTION, WriteMemoryCallback);
+    cstat = curl_easy_setopt(curl, CURLOPT_WRITEFUNCTION, writer);
     if (cstat != CURLE_OK)
         goto done;
 
-    /* we pass our file to the callback function */
-    cstat = curl_easy_setopt(curl, CURLOPT_WRITEDATA, (void*)buf);
+    /* we pass our buffer to the callback function */
+    cstat = curl_easy_setopt(curl, CURLOPT_WRITEDATA, data);
     if (cstat != CURLE_OK)
         goto done;
 
@@ -131,14 +175,6 @@ NCD4_fetchurl(CURL* curl, const char* url, NCbytes* buf, long* filetime, int* ht
         cstat = curl_easy_getinfo(curl,CURLINFO_FILETIME,filetime);
     if(cstat != CURLE_OK) goto done;
 
-    /* Null terminate the buffer*/
-    len = ncbyteslength(buf);
-    ncbytesappend(buf, '\0');
-    ncbytessetlength(buf, len); /* don't count null in buffer size*/
-#ifdef D4DEBUG
-    nclog(NCLOGNOTE,"buffersize: %lu bytes",(d4size_t)ncbyteslength(buf));
-#endif
-
 done:
     if(cstat != CURLE_OK) {
         nclog(NCLOGERR, "curl error: %s", curl_easy_strerror(cstat));
@@ -195,6 +231,30 @@ WriteMemoryCallback(void *ptr, size_t size, size_t nmemb, void *data)
     return realsize;
 }
 
+static size_t
+WriteDechunkCallback(void *ptr, size_t size, size_t nmemb, void *data)
+{
+    size_t realsize = size * nmemb;
+    struct Dechunkdata* dechunkdata = (struct Dechunkdata*)data;
+    NCD4dechunker* dechunker = dechunkdata->dechunker;
+    if(realsize == 0)
+        nclog(NCLOGWARN,"WriteDechunkCallback: zero sized chunk");
+#ifdef HAVE_LIBCURL_766
+    if(dechunker->rawsize == 0) {
+        /* Use the content length, if known, to size the data buffer once */
+        curl_off_t clen = -1;
+        if(curl_easy_getinfo(dechunkdata->curl,CURLINFO_CONTENT_LENGTH_DOWNLOAD_T,&clen) == CURLE_OK && clen > 0)
+            dechunker->expected = (d4size_t)clen;
+    }
+#endif
+    if((dechunkdata->ret = NCD4_dechunkerfeed(dechunker,ptr,realsize)))
+        return 0; /* abort the transfer */
+#ifdef PROGRESS
+    nclog(NCLOGNOTE,"callback: %lu bytes",(d4size_t)realsize);
+#endif
+    return realsize;
+}
+
 int
 NCD4_curlopen(CURL** curlp)
 {
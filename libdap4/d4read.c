@@ -19,8 +19,9 @@ See \ref copyright file for more info.
 /* Do conversion if this code was compiled via Vis. Studio or Mingw */
 
 /*Forward*/
-static int readpacket(NCD4INFO* state, NCURI*, NCbytes*, NCD4mode, NCD4format, long*);
-static int readfile(NCD4INFO* state, const NCURI* uri, NCD4mode dxx, NCD4format fxx, NCbytes* packet);
+static int readpacket(NCD4INFO* state, NCURI*, NCbytes*, NCD4dechunker*, NCD4mode, NCD4format, long*);
+static int readfile(NCD4INFO* state, const NCURI* uri, NCD4mode dxx, NCD4format fxx, NCbytes* packet, NCD4dechunker* dechunker);
+static int readfilestream(const char* filename, NCD4dechunker* dechunker);
 static int readfiletofile(NCD4INFO* state, const NCURI* uri, NCD4mode dxx, NCD4format fxx, FILE* stream, d4size_t* sizep);
 static int readfileDAPDMR(NCD4INFO* state, const NCURI* uri, NCbytes* packet);
 
@@ -45,7 +46,7 @@ NCD4_readDMR(NCD4INFO* state, int flags)
 
     if((flags & NCF_ONDISK) == 0) {
 	ncbytesclear(state->curl->packet);
-        stat = readpacket(state,state->uri,state->curl->packet,NCD4_DMR,NCD4_FORMAT_XML,&lastmod);
+        stat = readpacket(state,state->uri,state->curl->packet,NULL,NCD4_DMR,NCD4_FORMAT_XML,&lastmod);
         if(stat == NC_NOERR)
             state->data.dmrlastmodified = lastmod;
     } else { /*((flags & NCF_ONDISK) != 0) */
@@ -82,13 +83,18 @@ NCD4_readDAP(NCD4INFO* state, int flags)
     long lastmod = -1;
 
     if((flags & NCF_ONDISK) == 0) {
-	ncbytesclear(state->curl->packet);
-        stat = readpacket(state,state->uri,state->curl->packet,NCD4_DAP,NCD4_FORMAT_NONE,&lastmod);
+	/* De-chunk the response as it arrives; this
+	   sets the dmr and data in metadata->serial */
+	NCD4dechunker dechunker;
+	NCD4_dechunkerinit(&dechunker);
+        stat = readpacket(state,state->uri,NULL,&dechunker,NCD4_DAP,NCD4_FORMAT_NONE,&lastmod);
 	if(stat) {
-	    NCD4_seterrormessage(state->substrate.metadata, nclistlength(state->curl->packet), nclistcontents(state->curl->packet));
+	    /* Capture any error response */
+	    (void)NCD4_dechunkerfinish(&dechunker,state->substrate.metadata);
 	    goto done;
-	} else
-            state->data.daplastmodified = lastmod;
+	}
+        state->data.daplastmodified = lastmod;
+	stat = NCD4_dechunkerfinish(&dechunker,state->substrate.metadata);
     } else { /*((flags & NCF_ONDISK) != 0) */
         NCURI* url = state->uri;
         int fileprotocol = (strcmp(url->protocol,"file")==0);
@@ -149,8 +155,9 @@ dxxformat(int fxx, int dxx)
     return NULL;
 }
 
+/* Exactly one of packet and dechunker must be non-null */
 static int
-readpacket(NCD4INFO* state, NCURI* url, NCbytes* packet, NCD4mode dxx, NCD4format fxx, long* lastmodified)
+readpacket(NCD4INFO* state, NCURI* url, NCbytes* packet, NCD4dechunker* dechunker, NCD4mode dxx, NCD4format fxx, long* lastmodified)
 {
     int stat = NC_NOERR;
     int fileprotocol = 0;
@@ -170,7 +177,7 @@ readpacket(NCD4INFO* state, NCURI* url, NCbytes* packet, NCD4mode dxx, NCD4forma
     if(fileprotocol) {
 	/* Short circuit file://... urls*/
 	/* We do this because the test code always needs to read files*/
-	stat = readfile(state, url, dxx, fxx, packet);
+	stat = readfile(state, url, dxx, fxx, packet, dechunker);
     } else {
         char* fetchurl = NULL;
 	int flags = NCURIBASE;
@@ -185,7 +192,10 @@ readpacket(NCD4INFO* state, NCURI* url, NCbytes* packet, NCD4mode dxx, NCD4forma
    	    gettimeofday(&time0,NULL);
 #endif
 	}
-        stat = NCD4_fetchurl(curl,fetchurl,packet,lastmodified,&state->substrate.metadata->error.httpcode);
+	if(dechunker != NULL)
+            stat = NCD4_fetchurl_dechunk(curl,fetchurl,dechunker,lastmodified,&state->substrate.metadata->error.httpcode);
+	else
+            stat = NCD4_fetchurl(curl,fetchurl,packet,lastmodified,&state->substrate.metadata->error.httpcode);
         nullfree(fetchurl);
 	if(stat) goto fail;
 	if(FLAGSET(state->controls.flags,NCF_SHOWFETCH)) {
@@ -200,7 +210,7 @@ readpacket(NCD4INFO* state, NCURI* url, NCbytes* packet, NCD4mode dxx, NCD4forma
 #ifdef D4DEBUG
   {
 fprintf(stderr,"readpacket: packet.size=%lu\n",
-		(unsigned long)ncbyteslength(packet));
+		(unsigned long)(packet != NULL ? ncbyteslength(packet) : dechunker->rawsize));
   }
 #endif
 fail:
@@ -214,7 +224,7 @@ readfiletofile(NCD4INFO* state, const NCURI* uri, NCD4mode dxx, NCD4format fxx,
     NCbytes* packet = ncbytesnew();
     size_t len;
 
-    stat = readfile(state, uri, dxx, fxx, packet);
+    stat = readfile(state, uri, dxx, fxx, packet, NULL);
 #ifdef D4DEBUG
 fprintf(stderr,"readfiletofile: packet.size=%lu\n",
 		(unsigned long)ncbyteslength(packet));
@@ -240,7 +250,7 @@ unwind:
 }
 
 static int
-readfile(NCD4INFO* state, const NCURI* uri, NCD4mode dxx, NCD4format fxx, NCbytes* packet)
+readfile(NCD4INFO* state, const NCURI* uri, NCD4mode dxx, NCD4format fxx, NCbytes* packet, NCD4dechunker* dechunker)
 {
     int stat = NC_NOERR;
     NCbytes* tmp = ncbytesnew();
@@ -282,7 +292,10 @@ readfile(NCD4INFO* state, const NCURI* uri, NCD4mode dxx, NCD4format fxx, NCbyte
 	break;
     case NCD4_DAP:
     case NCD4_DSR:
-        stat = NC_readfile(filename,packet);
+	if(dechunker != NULL)
+	    stat = readfilestream(filename,dechunker);
+	else
+            stat = NC_readfile(filename,packet);
 	break;
     default: stat = NC_EDAP; break;
     }
@@ -298,6 +311,35 @@ readfile(NCD4INFO* state, const NCURI* uri, NCD4mode dxx, NCD4format fxx, NCbyte
     return THROW(stat);
 }
 
+/* Feed a file to a dechunker a block at a time */
+static int
+readfilestream(const char* filename, NCD4dechunker* dechunker)
+{
+#define READ_BLOCK_SIZE 1048576
+    int stat = NC_NOERR;
+    FILE* stream = NULL;
+    char* block = NULL;
+    long filesize;
+
+    stream = NCfopen(filename,"r");
+    if(stream == NULL) {stat = errno; goto done;}
+    /* Tell the dechunker how big the data will be */
+    if(fseek(stream,0,SEEK_END) == 0 && (filesize = ftell(stream)) > 0)
+	dechunker->expected = (d4size_t)filesize;
+    rewind(stream);
+    if((block = (char*)malloc(READ_BLOCK_SIZE)) == NULL) {stat = NC_ENOMEM; goto done;}
+    for(;;) {
+	size_t count = fread(block, 1, READ_BLOCK_SIZE, stream);
+	if(ferror(stream)) {stat = NC_EIO; goto done;}
+	if(count > 0 && (stat = NCD4_dechunkerfeed(dechunker,block,count))) goto done;
+	if(feof(stream)) break;
+    }
+done:
+    nullfree(block);
+    if(stream) fclose(stream);
+    return THROW(stat);
+}
+
 /* Extract the DMR from a DAP file */
 static int
 readfileDAPDMR(NCD4INFO* state, const NCURI* uri, NCbytes* packet)
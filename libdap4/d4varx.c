@@ -153,19 +153,14 @@ getvarx(int ncid, int varid, NCD4INFO** infop, NCD4node** varp,
 
     /* If the data has not already been read and processed, then do so. */
     if(meta->serial.dap == NULL) {
-	size_t len = 0;
-	void* content = NULL;
-        /* (Re)Build the meta data; sets serial.rawdata */
+        /* (Re)Build the meta data */
         NCD4_resetMeta(info->substrate.metadata);
         meta->controller = info;
         meta->ncid = info->substrate.nc4id; /* Transfer netcdf ncid */
 
+        /* Read and de-chunk the data; sets serial.dmr and serial.dap */
         if((ret=NCD4_readDAP(info, info->controls.flags.flags))) goto done;
-	len = ncbyteslength(info->curl->packet);
-	content = ncbytesextract(info->curl->packet);
-	NCD4_resetSerial(&meta->serial, len, content);
         /* Process the data part */
-        if((ret=NCD4_dechunk(meta))) goto done;
         if((ret = NCD4_processdata(info->substrate.metadata))) goto done;
     }
 
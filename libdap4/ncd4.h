@@ -79,6 +79,7 @@ EXTERNL int dsp_open(const char* path, ND4dsp** dspp);
 EXTERNL long NCD4_fetchhttpcode(CURL* curl);
 EXTERNL int NCD4_fetchurl_file(CURL* curl, const char* url, FILE* stream, d4size_t* sizep, long* filetime);
 EXTERNL int NCD4_fetchurl(CURL* curl, const char* url, NCbytes* buf, long* filetime, int* httpcode);
+EXTERNL int NCD4_fetchurl_dechunk(CURL* curl, const char* url, NCD4dechunker* dechunker, long* filetime, int* httpcode);
 EXTERNL int NCD4_curlopen(CURL** curlp);
 EXTERNL void NCD4_curlclose(CURL* curl);
 EXTERNL int NCD4_fetchlastmodified(CURL* curl, char* url, long* filetime);
@@ -111,6 +112,10 @@ EXTERNL int NCD4_findvar(NC* ncp, int ncid, int varid, NCD4node** varp, NCD4node
 
 /* From d4chunk.c */
 EXTERNL int NCD4_dechunk(NCD4meta*);
+EXTERNL void NCD4_dechunkerinit(NCD4dechunker*);
+EXTERNL void NCD4_dechunkerclear(NCD4dechunker*);
+EXTERNL int NCD4_dechunkerfeed(NCD4dechunker*, const void* buf, size_t len);
+EXTERNL int NCD4_dechunkerfinish(NCD4dechunker*, NCD4meta* metadata);
 EXTERNL int NCD4_infermode(NCD4meta* meta);
 struct NCD4serial;
 EXTERNL void NCD4_resetSerial(struct NCD4serial* serial, size_t rawsize, void* rawdata);
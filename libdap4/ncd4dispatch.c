@@ -1024,4 +1024,7 @@ NC_NOTNC4_def_var_quantize,
 NCD4_inq_var_quantize,
 
 NCD4_inq_filter_avail,
+
+NC_NOTNC4_get_var_chunk_raw,
+NC_NOTNC4_put_var_chunk_raw,
 };
@@ -266,6 +266,25 @@ typedef struct NCD4serial {
     int remotelittleendian; /* 1 if the packet says data is little endian */
 } NCD4serial;
 
+/* Incremental state for de-chunking a DAP response as it arrives */
+typedef struct NCD4dechunker {
+    int state; /* see d4chunk.c */
+    int hostlittleendian; /* 1 if the host is little endian */
+    int remotelittleendian; /* 1 if the DMR chunk says data is little endian */
+    int isdmr; /* 1 => current chunk is the DMR chunk */
+    int sawdata; /* 1 => at least one data chunk header was seen */
+    unsigned int lastflags; /* flags of the last completed chunk */
+    size_t nprefix; /* |prefix| */
+    unsigned char prefix[16]; /* start of response or partial chunk header */
+    NCD4HDR hdr; /* current chunk header */
+    d4size_t remaining; /* bytes remaining in current chunk */
+    d4size_t rawsize; /* total bytes received so far */
+    d4size_t expected; /* expected total size if known, else 0 */
+    NCbytes* dmr; /* DMR chunk */
+    NCbytes* dap; /* concatenated data chunks */
+    NCbytes* err; /* error chunk or unchunked error response */
+} NCD4dechunker;
+
 /* This will be passed out of the parse */
 struct NCD4meta {
     NCD4INFO* controller;
@@ -0,0 +1,1432 @@
+/* Copyright 2018, University Corporation for Atmospheric
+ * Research. See COPYRIGHT file for copying and redistribution
+ * conditions. */
+/**
+ * @file
+ * @internal The aggregation dispatch layer, which presents a set of
+ * files with the same variables as one dataset, joined along a
+ * dimension.
+ *
+ * An aggregation is described by a text file whose first word is
+ * "ncagg", followed by lines such as
+ *
+ * @code
+ * dimension time
+ * maxopen 16
+ * file day001.nc 24
+ * file day002.nc
+ * @endcode
+ *
+ * If the dimension is a dimension of the root group of the first
+ * file, the files are joined along it: a variable that uses it reads
+ * from each file in turn, and its length is the sum of its lengths in
+ * the files. Otherwise the dimension is new, with one index per file,
+ * and becomes the first dimension of the root group variables named
+ * by "variable name" lines, or of all the root group variables but
+ * the coordinate variables if there are none.
+ *
+ * Member files are named relative to the directory of the
+ * description. The length of a file along an existing dimension may
+ * follow its name, so that the file need not be opened to find it.
+ * The metadata of the aggregation is that of the first file, which
+ * stays open; the others are opened as their data is read, with at
+ * most maxopen files open at once, counting the first, closing the
+ * least recently read. So maxopen must be at least 2. Lines starting
+ * with '#' are comments. Aggregations are read-only.
+ *
+ * A variable is found in each member by its name and the full name of
+ * its group, so the members may define their groups and variables in
+ * any order. It must have the same type and rank in each, and the
+ * same lengths of all but the joined dimension; otherwise reading it
+ * fails with NC_EINVAL.
+ *
+ * A read that spans several members is done one member after
+ * another. The members could be read concurrently, but the library
+ * is not thread-safe, so reads of them in threads would only be
+ * serialized on its lock.
+ */
+
+#include "config.h"
+#include <stdlib.h>
+#include <string.h>
+#include "ncdispatch.h"
+#include "fbits.h"
+#include "nc4internal.h"
+#include "ncrc.h"
+#include "ncbytes.h"
+#include "nclist.h"
+#include "nclog.h"
+#include "ncpathmgr.h"
+
+/** Default most member files open at once. */
+#define NCAGG_MAXOPEN 32
+
+/** Least maxopen, as the first member stays open. */
+#define NCAGG_MINOPEN 2
+
+/** @internal A member file of an aggregation. */
+typedef struct NCAGGmember {
+    char* path;
+    size_t start;     /* index of its first element along the dimension */
+    size_t len;       /* its length along the dimension */
+    int haslen;       /* len was given in the description */
+    int ncid;         /* -1 if not open */
+    size_t lastuse;   /* when data was last read from it */
+    int tgrpid;       /* group of the first member of the variable last read */
+    int tvarid;       /* and its varid there, or -1 */
+    int grpid;        /* the group of that variable in this member */
+    int varid;        /* and its varid */
+} NCAGGmember;
+
+/** @internal The dispatch data of an aggregation. */
+typedef struct NCAGG {
+    char* dimname;
+    int dimid;        /* of the dimension joined along */
+    size_t dimlen;
+    int joinnew;      /* the dimension is not in the files */
+    int nvars;        /* join new: variables in the root group */
+    char* joined;     /* join new: whether each has the new dimension */
+    size_t nmembers;
+    NCAGGmember* members;
+    size_t maxopen;
+    size_t nopen;
+    size_t clock;
+} NCAGG;
+
+/* Convert an aggregation group id to that of the same group in the
+ * first member, and back. */
+#define maketemplateid(agg,aggid) (((aggid) & GRP_ID_MASK) | (agg)->members[0].ncid)
+#define makeaggid(ncp,id) (((id) & GRP_ID_MASK) | (ncp)->ext_ncid)
+
+static const NC_Dispatch NCAGG_dispatch_base;
+
+const NC_Dispatch* NCAGG_dispatch_table = NULL;
+
+int
+NCAGG_initialize(void)
+{
+    NCAGG_dispatch_table = &NCAGG_dispatch_base;
+    return NC_NOERR;
+}
+
+int
+NCAGG_finalize(void)
+{
+    return NC_NOERR;
+}
+
+/**
+ * @internal Get the NC of the first member of an aggregation, which
+ * holds its metadata.
+ *
+ * @param nc The aggregation.
+ *
+ * @return The NC of the first member.
+ */
+NC*
+NCAGG_get_substrate(NC* nc)
+{
+    NCAGG* agg = (NCAGG*)nc->dispatchdata;
+    NC* sub = NULL;
+    if(agg == NULL || NC_check_id(agg->members[0].ncid, &sub))
+        return nc;
+    return sub;
+}
+
+/**
+ * @internal Get the aggregation of a group id, and the NC of the
+ * first member and the id of the same group in it.
+ */
+static int
+getagg(int ncid, NC** ncpp, NCAGG** aggp, NC** tncp, int* tidp)
+{
+    NC* ncp;
+    NCAGG* agg;
+    int stat = NC_check_id(ncid, &ncp);
+    if(stat != NC_NOERR) return stat;
+    agg = (NCAGG*)ncp->dispatchdata;
+    if(tncp && (stat = NC_check_id(agg->members[0].ncid, tncp))) return stat;
+    if(ncpp) *ncpp = ncp;
+    if(aggp) *aggp = agg;
+    if(tidp) *tidp = maketemplateid(agg, ncid);
+    return NC_NOERR;
+}
+
+/**
+ * @internal Get the id of a member file, opening it if need be. If
+ * there are already maxopen members open, the least recently used
+ * member other than the first is closed; as maxopen is at least 2,
+ * there is one.
+ */
+static int
+openmember(NCAGG* agg, size_t m, int* ncidp)
+{
+    int stat = NC_NOERR;
+    NCAGGmember* member = &agg->members[m];
+
+    if(member->ncid < 0) {
+        if(agg->nopen >= agg->maxopen) {
+            size_t i, lru = 0;
+            for(i = 1; i < agg->nmembers; i++) {
+                if(agg->members[i].ncid >= 0
+                   && (lru == 0 || agg->members[i].lastuse < agg->members[lru].lastuse))
+                    lru = i;
+            }
+            if(lru > 0) {
+                stat = nc_close(agg->members[lru].ncid);
+                agg->members[lru].ncid = -1;
+                agg->nopen--;
+                if(stat) goto done;
+            }
+        }
+        if((stat = nc_open(member->path, NC_NOWRITE, &member->ncid))) {
+            nclog(NCLOGERR, "aggregation member %s: %s", member->path, nc_strerror(stat));
+            member->ncid = -1;
+            goto done;
+        }
+        agg->nopen++;
+        member->tvarid = -1;
+    }
+    member->lastuse = ++agg->clock;
+    *ncidp = member->ncid;
+done:
+    return stat;
+}
+
+/** @internal Log that a variable of a member does not match the first. */
+static int
+mismatch(NCAGGmember* member, const char* name, const char* what)
+{
+    nclog(NCLOGERR, "aggregation member %s: variable %s %s", member->path, name, what);
+    return NC_EINVAL;
+}
+
+/**
+ * @internal Get the ids in a member of a variable of the first
+ * member, opening the member if need be. The variable is found by its
+ * name and the full name of its group, and must have the same type
+ * and rank as in the first member, and the same lengths of all but
+ * the joined dimension.
+ *
+ * @param agg The aggregation.
+ * @param m The member.
+ * @param tid Group of the variable in the first member.
+ * @param varid Id of the variable in the first member.
+ * @param grpidp Gets the group of the variable in the member.
+ * @param varidp Gets the id of the variable in the member.
+ *
+ * @return ::NC_NOERR No error.
+ * @return ::NC_EINVAL The variable is missing or different.
+ */
+static int
+openmembervar(NCAGG* agg, size_t m, int tid, int varid, int* grpidp, int* varidp)
+{
+    int stat = NC_NOERR;
+    NCAGGmember* member = &agg->members[m];
+    int mid, grpid, mvarid, ndims, mndims, d, equal;
+    int dimids[NC_MAX_VAR_DIMS], mdimids[NC_MAX_VAR_DIMS];
+    nc_type xtype, mxtype;
+    char name[NC_MAX_NAME + 1];
+    char dimname[NC_MAX_NAME + 1];
+    char* grpname = NULL;
+    size_t len, mlen;
+
+    if((stat = openmember(agg, m, &mid))) goto done;
+    if(m == 0) {
+        /* The first member is the template */
+        *grpidp = tid;
+        *varidp = varid;
+        goto done;
+    }
+    if(member->tvarid == varid && member->tgrpid == tid)
+        goto found;
+
+    if((stat = nc_inq_varname(tid, varid, name))) goto done;
+    grpid = mid;
+    if((tid & GRP_ID_MASK) != 0) {
+        if((stat = nc_inq_grpname_full(tid, &len, NULL))) goto done;
+        if((grpname = (char*)malloc(len + 1)) == NULL) {stat = NC_ENOMEM; goto done;}
+        if((stat = nc_inq_grpname_full(tid, NULL, grpname))) goto done;
+        if(nc_inq_grp_full_ncid(mid, grpname, &grpid))
+            {stat = mismatch(member, name, "has no group there"); goto done;}
+    }
+    if(nc_inq_varid(grpid, name, &mvarid))
+        {stat = mismatch(member, name, "is missing"); goto done;}
+    if((stat = nc_inq_var(tid, varid, NULL, &xtype, &ndims, dimids, NULL))) goto done;
+    if((stat = nc_inq_var(grpid, mvarid, NULL, &mxtype, &mndims, mdimids, NULL))) goto done;
+    if(mxtype != xtype) {
+        if(xtype <= NC_MAX_ATOMIC_TYPE || mxtype <= NC_MAX_ATOMIC_TYPE
+           || nc_inq_type_equal(tid, xtype, grpid, mxtype, &equal) || !equal)
+            {stat = mismatch(member, name, "has another type"); goto done;}
+    }
+    if(mndims != ndims)
+        {stat = mismatch(member, name, "has another rank"); goto done;}
+    for(d = 0; d < ndims; d++) {
+        if(!agg->joinnew && dimids[d] == agg->dimid) {
+            if((stat = nc_inq_dimname(grpid, mdimids[d], dimname))) goto done;
+            if(strcmp(dimname, agg->dimname) != 0)
+                {stat = mismatch(member, name, "is joined along another dimension"); goto done;}
+            continue;
+        }
+        if((stat = nc_inq_dimlen(tid, dimids[d], &len))) goto done;
+        if((stat = nc_inq_dimlen(grpid, mdimids[d], &mlen))) goto done;
+        if(mlen != len)
+            {stat = mismatch(member, name, "has other dimension lengths"); goto done;}
+    }
+    member->tgrpid = tid;
+    member->tvarid = varid;
+    member->grpid = grpid;
+    member->varid = mvarid;
+found:
+    *grpidp = member->grpid;
+    *varidp = member->varid;
+done:
+    nullfree(grpname);
+    return stat;
+}
+
+/** @internal Close the open members and free an aggregation. */
+static int
+freeagg(NCAGG* agg)
+{
+    int stat = NC_NOERR;
+    size_t m;
+
+    if(agg == NULL) return NC_NOERR;
+    for(m = 0; m < agg->nmembers; m++) {
+        if(agg->members[m].ncid >= 0) {
+            int ret = nc_close(agg->members[m].ncid);
+            if(ret && !stat) stat = ret;
+        }
+        nullfree(agg->members[m].path);
+    }
+    nullfree(agg->members);
+    nullfree(agg->dimname);
+    nullfree(agg->joined);
+    free(agg);
+    return stat;
+}
+
+/** @internal Get the next word of a line, or NULL at its end. */
+static char*
+nextword(char** linep)
+{
+    char* p = *linep;
+    char* word;
+
+    while(*p == ' ' || *p == '\t' || *p == '\r') p++;
+    if(*p == '\0') {*linep = p; return NULL;}
+    word = p;
+    while(*p != '\0' && *p != ' ' && *p != '\t' && *p != '\r') p++;
+    if(*p != '\0') *p++ = '\0';
+    *linep = p;
+    return word;
+}
+
+/** @internal Parse a count, returning 0 if it is not a number. */
+static int
+parsecount(const char* word, size_t* countp)
+{
+    char* end = NULL;
+    unsigned long long count = strtoull(word, &end, 10);
+    if(word[0] == '-' || end == word || *end != '\0')
+        return 0;
+    *countp = (size_t)count;
+    return 1;
+}
+
+/**
+ * @internal Get the path of a member file, relative to the directory
+ * of the description unless it is absolute or a URL.
+ */
+static char*
+memberpath(const char* aggpath, const char* path)
+{
+    const char* p;
+    size_t dirlen = 0;
+    char* full;
+
+    if(path[0] == '/' || path[0] == '\\' || NChasdriveletter(path)
+       || strstr(path, "://") != NULL)
+        return strdup(path);
+    for(p = aggpath; *p; p++)
+        if(*p == '/' || *p == '\\') dirlen = (size_t)(p - aggpath) + 1;
+    if((full = malloc(dirlen + strlen(path) + 1)) == NULL)
+        return NULL;
+    memcpy(full, aggpath, dirlen);
+    strcpy(full + dirlen, path);
+    return full;
+}
+
+/** @internal Read the description of an aggregation. */
+static int
+parseagg(const char* path, NCAGG* agg, NClist* varnames)
+{
+    int stat = NC_NOERR;
+    NCbytes* buf = ncbytesnew();
+    NClist* members = nclistnew();
+    char* line;
+    char* next;
+    int lineno = 0;
+    size_t m;
+
+    if((stat = NC_readfile(path, buf))) goto done;
+    ncbytesnull(buf);
+    for(line = ncbytescontents(buf); line != NULL; line = next) {
+        char* key;
+        char* arg;
+        if((next = strchr(line, '\n')) != NULL) *next++ = '\0';
+        lineno++;
+        if((key = nextword(&line)) == NULL || key[0] == '#')
+            continue;
+        if(lineno == 1 || strcmp(key, NCAGG_MAGIC) == 0) {
+            if(lineno > 1 || strcmp(key, NCAGG_MAGIC) != 0) goto syntax;
+            continue;
+        }
+        if((arg = nextword(&line)) == NULL) goto syntax;
+        if(strcmp(key, "dimension") == 0) {
+            if(agg->dimname != NULL) goto syntax;
+            if((agg->dimname = strdup(arg)) == NULL) {stat = NC_ENOMEM; goto done;}
+        } else if(strcmp(key, "variable") == 0) {
+            nclistpush(varnames, strdup(arg));
+        } else if(strcmp(key, "maxopen") == 0) {
+            if(!parsecount(arg, &agg->maxopen) || agg->maxopen < NCAGG_MINOPEN) goto syntax;
+        } else if(strcmp(key, "file") == 0) {
+            NCAGGmember* member = (NCAGGmember*)calloc(1, sizeof(NCAGGmember));
+            char* len;
+            if(member == NULL) {stat = NC_ENOMEM; goto done;}
+            nclistpush(members, member);
+            member->ncid = -1;
+            if((member->path = memberpath(path, arg)) == NULL) {stat = NC_ENOMEM; goto done;}
+            if((len = nextword(&line)) != NULL) {
+                if(!parsecount(len, &member->len)) goto syntax;
+                member->haslen = 1;
+            }
+        } else
+            goto syntax;
+        if(nextword(&line) != NULL) goto syntax;
+    }
+    if(agg->dimname == NULL || nclistlength(members) == 0) {
+        nclog(NCLOGERR, "aggregation %s: needs a dimension and files", path);
+        stat = NC_EINVAL;
+        goto done;
+    }
+    agg->nmembers = nclistlength(members);
+    if((agg->members = (NCAGGmember*)malloc(agg->nmembers * sizeof(NCAGGmember))) == NULL)
+        {stat = NC_ENOMEM; goto done;}
+    for(m = 0; m < agg->nmembers; m++)
+        agg->members[m] = *(NCAGGmember*)nclistget(members, m);
+    nclistfreeall(members);
+    members = NULL;
+    goto done;
+
+syntax:
+    nclog(NCLOGERR, "aggregation %s: syntax error at line %d", path, lineno);
+    stat = NC_EINVAL;
+done:
+    if(members != NULL) {
+        for(m = 0; m < nclistlength(members); m++)
+            nullfree(((NCAGGmember*)nclistget(members, m))->path);
+        nclistfreeall(members);
+    }
+    ncbytesfree(buf);
+    return stat;
+}
+
+/**
+ * @internal Join the members along a dimension of the first. Members
+ * whose lengths are not given are opened to find them.
+ */
+static int
+joinexisting(NCAGG* agg)
+{
+    int stat = NC_NOERR;
+    size_t m;
+
+    for(m = 0; m < agg->nmembers; m++) {
+        NCAGGmember* member = &agg->members[m];
+        if(m == 0 || !member->haslen) {
+            int mid, dimid;
+            if((stat = openmember(agg, m, &mid))) goto done;
+            if((stat = nc_inq_dimid(mid, agg->dimname, &dimid))) goto done;
+            if((stat = nc_inq_dimlen(mid, dimid, &member->len))) goto done;
+        }
+        member->start = agg->dimlen;
+        agg->dimlen += member->len;
+    }
+done:
+    return stat;
+}
+
+/** @internal Count the dimensions of a group and its subgroups. */
+static int
+countdims(NC* tnc, int ncid, int* ndimsp)
+{
+    int stat = NC_NOERR;
+    int ndims, ngrps, g;
+    int* grpids = NULL;
+
+    if((stat = nc_inq_ndims(ncid, &ndims))) goto done;
+    *ndimsp += ndims;
+    if((stat = tnc->dispatch->inq_grps(ncid, &ngrps, NULL))) goto done;
+    if(ngrps == 0) goto done;
+    if((grpids = (int*)malloc((size_t)ngrps * sizeof(int))) == NULL) {stat = NC_ENOMEM; goto done;}
+    if((stat = tnc->dispatch->inq_grps(ncid, NULL, grpids))) goto done;
+    for(g = 0; g < ngrps; g++)
+        if((stat = countdims(tnc, grpids[g], ndimsp))) goto done;
+done:
+    nullfree(grpids);
+    return stat;
+}
+
+/**
+ * @internal Join the members along a new dimension, with the next
+ * dimension id of the first member.
+ */
+static int
+joinnew(NCAGG* agg, int tid, NClist* varnames)
+{
+    int stat = NC_NOERR;
+    NC* tnc;
+    int varid, ndims;
+    size_t i, m;
+
+    agg->joinnew = 1;
+    agg->dimid = 0;
+    if((stat = NC_check_id(tid, &tnc))) goto done;
+    if((stat = countdims(tnc, tid, &agg->dimid))) goto done;
+    if((stat = nc_inq_nvars(tid, &agg->nvars))) goto done;
+    if((agg->joined = (char*)calloc((size_t)agg->nvars + 1, 1)) == NULL) {stat = NC_ENOMEM; goto done;}
+    for(i = 0; i < nclistlength(varnames); i++) {
+        if((stat = tnc->dispatch->inq_varid(tid, (const char*)nclistget(varnames, i), &varid))) goto done;
+        agg->joined[varid] = 1;
+    }
+    for(varid = 0; varid < agg->nvars; varid++) {
+        char name[NC_MAX_NAME + 1];
+        char dimname[NC_MAX_NAME + 1];
+        int dimid;
+        if((stat = nc_inq_var(tid, varid, name, NULL, &ndims, NULL, NULL))) goto done;
+        if(nclistlength(varnames) == 0) {
+            /* All but the coordinate variables */
+            agg->joined[varid] = 1;
+            if(ndims == 1) {
+                if((stat = nc_inq_vardimid(tid, varid, &dimid))) goto done;
+                if((stat = nc_inq_dimname(tid, dimid, dimname))) goto done;
+                if(strcmp(name, dimname) == 0) agg->joined[varid] = 0;
+            }
+        }
+        if(agg->joined[varid] && ndims >= NC_MAX_VAR_DIMS) {stat = NC_EMAXDIMS; goto done;}
+    }
+    for(m = 0; m < agg->nmembers; m++) {
+        agg->members[m].start = m;
+        agg->members[m].len = 1;
+    }
+    agg->dimlen = agg->nmembers;
+done:
+    return stat;
+}
+
+static int
+NCAGG_open(const char* path, int mode, int basepe, size_t* chunksizehintp,
+           void* parameters, const NC_Dispatch* dispatch, int ncid)
+{
+    int stat = NC_NOERR;
+    NC* ncp = NULL;
+    NCAGG* agg = NULL;
+    NClist* varnames = nclistnew();
+    int tid;
+
+    if(fIsSet(mode, NC_WRITE)) {stat = NC_EPERM; goto done;}
+    if(fIsSet(mode, NC_INMEMORY)) {stat = NC_EINMEMORY; goto done;}
+    if((stat = NC_check_id(ncid, &ncp))) goto done;
+    if((agg = (NCAGG*)calloc(1, sizeof(NCAGG))) == NULL) {stat = NC_ENOMEM; goto done;}
+    agg->maxopen = NCAGG_MAXOPEN;
+    if((stat = parseagg(path, agg, varnames))) goto done;
+
+    /* The first member holds the metadata */
+    if((stat = openmember(agg, 0, &tid))) goto done;
+    if(nc_inq_dimid(tid, agg->dimname, &agg->dimid) == NC_NOERR)
+        stat = joinexisting(agg);
+    else
+        stat = joinnew(agg, tid, varnames);
+    if(stat) goto done;
+    ncp->dispatchdata = agg;
+    agg = NULL;
+done:
+    nclistfreeall(varnames);
+    (void)freeagg(agg);
+    return stat;
+}
+
+static int
+NCAGG_close(int ncid, void* ignore)
+{
+    NC* ncp;
+    int stat = NC_check_id(ncid, &ncp);
+    if(stat != NC_NOERR) return stat;
+    stat = freeagg((NCAGG*)ncp->dispatchdata);
+    ncp->dispatchdata = NULL;
+    return stat;
+}
+
+static int
+NCAGG_abort(int ncid)
+{
+    return NCAGG_close(ncid, NULL);
+}
+
+static int
+NCAGG_inq_format(int ncid, int* formatp)
+{
+    NC* tnc;
+    int stat, tid;
+    if((stat = getagg(ncid, NULL, NULL, &tnc, &tid))) return stat;
+    return tnc->dispatch->inq_format(tid, formatp);
+}
+
+static int
+NCAGG_inq_format_extended(int ncid, int* formatp, int* modep)
+{
+    NC* ncp;
+    int stat = NC_check_id(ncid, &ncp);
+    if(stat != NC_NOERR) return stat;
+    if(modep) *modep = ncp->mode;
+    if(formatp) *formatp = NC_FORMATX_NCAGG;
+    return NC_NOERR;
+}
+
+/**
+ * @internal Whether a variable is joined along a new dimension, which
+ * it does not have in the files.
+ */
+static int
+isjoined(NCAGG* agg, int ncid, int varid)
+{
+    return agg->joinnew && (ncid & GRP_ID_MASK) == 0
+           && varid >= 0 && varid < agg->nvars && agg->joined[varid];
+}
+
+/*
+The following functions return the metadata of the first member,
+adding the new dimension of a join along one.
+*/
+
+static int
+NCAGG_inq(int ncid, int* ndimsp, int* nvarsp, int* nattsp, int* unlimdimidp)
+{
+    NC* tnc;
+    NCAGG* agg;
+    int stat, tid;
+    if((stat = getagg(ncid, NULL, &agg, &tnc, &tid))) return stat;
+    if((stat = tnc->dispatch->inq(tid, ndimsp, nvarsp, nattsp, unlimdimidp))) return stat;
+    if(ndimsp && agg->joinnew && (ncid & GRP_ID_MASK) == 0)
+        (*ndimsp)++;
+    return NC_NOERR;
+}
+
+static int
+NCAGG_inq_type(int ncid, nc_type xtype, char* name, size_t* sizep)
+{
+    NC* tnc;
+    int stat, tid;
+    if((stat = getagg(ncid, NULL, NULL, &tnc, &tid))) return stat;
+    return tnc->dispatch->inq_type(tid, xtype, name, sizep);
+}
+
+static int
+NCAGG_inq_dimid(int ncid, const char* name, int* idp)
+{
+    NC* tnc;
+    NCAGG* agg;
+    int stat, tid;
+    if((stat = getagg(ncid, NULL, &agg, &tnc, &tid))) return stat;
+    if(agg->joinnew && name != NULL && strcmp(name, agg->dimname) == 0) {
+        if(idp) *idp = agg->dimid;
+        return NC_NOERR;
+    }
+    return tnc->dispatch->inq_dimid(tid, name, idp);
+}
+
+static int
+NCAGG_inq_dim(int ncid, int dimid, char* name, size_t* lenp)
+{
+    NC* tnc;
+    NCAGG* agg;
+    int stat, tid;
+    if((stat = getagg(ncid, NULL, &agg, &tnc, &tid))) return stat;
+    if(dimid == agg->dimid) {
+        if(name) strcpy(name, agg->dimname);
+        if(lenp) *lenp = agg->dimlen;
+        return NC_NOERR;
+    }
+    return tnc->dispatch->inq_dim(tid, dimid, name, lenp);
+}
+
+static int
+NCAGG_inq_unlimdim(int ncid, int* unlimdimidp)
+{
+    NC* tnc;
+    int stat, tid;
+    if((stat = getagg(ncid, NULL, NULL, &tnc, &tid))) return stat;
+    return tnc->dispatch->inq_unlimdim(tid, unlimdimidp);
+}
+
+static int
+NCAGG_inq_att(int ncid, int varid, const char* name, nc_type* xtypep, size_t* lenp)
+{
+    NC* tnc;
+    int stat, tid;
+    if((stat = getagg(ncid, NULL, NULL, &tnc, &tid))) return stat;
+    return tnc->dispatch->inq_att(tid, varid, name, xtypep, lenp);
+}
+
+static int
+NCAGG_inq_attid(int ncid, int varid, const char* name, int* idp)
+{
+    NC* tnc;
+    int stat, tid;
+    if((stat = getagg(ncid, NULL, NULL, &tnc, &tid))) return stat;
+    return tnc->dispatch->inq_attid(tid, varid, name, idp);
+}
+
+static int
+NCAGG_inq_attname(int ncid, int varid, int attnum, char* name)
+{
+    NC* tnc;
+    int stat, tid;
+    if((stat = getagg(ncid, NULL, NULL, &tnc, &tid))) return stat;
+    return tnc->dispatch->inq_attname(tid, varid, attnum, name);
+}
+
+static int
+NCAGG_get_att(int ncid, int varid, const char* name, void* value, nc_type memtype)
+{
+    NC* tnc;
+    int stat, tid;
+    if((stat = getagg(ncid, NULL, NULL, &tnc, &tid))) return stat;
+    return tnc->dispatch->get_att(tid, varid, name, value, memtype);
+}
+
+static int
+NCAGG_inq_varid(int ncid, const char* name, int* varidp)
+{
+    NC* tnc;
+    int stat, tid;
+    if((stat = getagg(ncid, NULL, NULL, &tnc, &tid))) return stat;
+    return tnc->dispatch->inq_varid(tid, name, varidp);
+}
+
+static int
+NCAGG_inq_var_all(int ncid, int varid, char* name, nc_type* xtypep,
+                  int* ndimsp, int* dimidsp, int* nattsp,
+                  int* shufflep, int* deflatep, int* deflate_levelp,
+                  int* fletcher32p, int* contiguousp, size_t* chunksizesp,
+                  int* no_fill, void* fill_valuep, int* endiannessp,
+                  unsigned int* idp, size_t* nparamsp, unsigned int* params)
+{
+    NC* tnc;
+    NCAGG* agg;
+    int stat, tid, ndims;
+    int dimids[NC_MAX_VAR_DIMS];
+    size_t chunksizes[NC_MAX_VAR_DIMS];
+
+    if((stat = getagg(ncid, NULL, &agg, &tnc, &tid))) return stat;
+    if(!isjoined(agg, ncid, varid))
+        return tnc->dispatch->inq_var_all(tid, varid, name, xtypep, ndimsp, dimidsp, nattsp,
+                                      shufflep, deflatep, deflate_levelp, fletcher32p,
+                                      contiguousp, chunksizesp, no_fill, fill_valuep,
+                                      endiannessp, idp, nparamsp, params);
+    /* Put the new dimension first */
+    if((stat = tnc->dispatch->inq_var_all(tid, varid, name, xtypep, &ndims, dimids, nattsp,
+                                      shufflep, deflatep, deflate_levelp, fletcher32p,
+                                      contiguousp, (chunksizesp ? chunksizes : NULL),
+                                      no_fill, fill_valuep, endiannessp, idp, nparamsp,
+                                      params)))
+        return stat;
+    if(ndimsp) *ndimsp = ndims + 1;
+    if(dimidsp) {
+        dimidsp[0] = agg->dimid;
+        memcpy(dimidsp + 1, dimids, (size_t)ndims * sizeof(int));
+    }
+    if(chunksizesp) {
+        chunksizesp[0] = 1;
+        memcpy(chunksizesp + 1, chunksizes, (size_t)ndims * sizeof(size_t));
+    }
+    return NC_NOERR;
+}
+
+/**
+ * @internal Get the position of the joined dimension among the
+ * dimensions of a variable, or -1 if the variable does not have it.
+ */
+static int
+joinedpos(NCAGG* agg, int ncid, int tid, int varid, int* posp)
+{
+    int stat, ndims, d;
+    int dimids[NC_MAX_VAR_DIMS];
+
+    *posp = -1;
+    if(agg->joinnew) {
+        if(isjoined(agg, ncid, varid)) *posp = 0;
+        return NC_NOERR;
+    }
+    if((stat = nc_inq_varndims(tid, varid, &ndims))) return stat;
+    if((stat = nc_inq_vardimid(tid, varid, dimids))) return stat;
+    for(d = 0; d < ndims; d++) {
+        if(dimids[d] == agg->dimid) {*posp = d; break;}
+    }
+    return NC_NOERR;
+}
+
+/** @internal Find the last member starting at or before index. */
+static size_t
+findmember(NCAGG* agg, size_t index)
+{
+    size_t lo = 0, hi = agg->nmembers;
+    while(hi - lo > 1) {
+        size_t mid = (lo + hi) / 2;
+        if(agg->members[mid].start <= index) lo = mid; else hi = mid;
+    }
+    return lo;
+}
+
+/** @internal Get data from a variable of a member. */
+static int
+getmemberdata(int mid, int varid, const size_t* start, const size_t* edges,
+              const ptrdiff_t* stride, void* value, nc_type memtype)
+{
+    NC* mnc;
+    int stat = NC_check_id(mid, &mnc);
+    if(stat != NC_NOERR) return stat;
+    return mnc->dispatch->get_vars(mid, varid, start, edges, stride, value, memtype);
+}
+
+/**
+ * @internal Get a slab of a variable. The part of the slab in each
+ * member is read with one call to it; when the joined dimension is
+ * not the first, the part is read to a buffer and spread out to the
+ * slab.
+ */
+static int
+NCAGG_get_vars(int ncid, int varid, const size_t* start, const size_t* edges,
+               const ptrdiff_t* stride, void* value, nc_type memtype)
+{
+    NC* tnc;
+    int stat = NC_NOERR;
+    int erange = 0;
+    NCAGG* agg;
+    int tid, pos, ndims, d;
+    size_t typesize, outer = 1, inner, count, last, m;
+    size_t mstart[NC_MAX_VAR_DIMS], medges[NC_MAX_VAR_DIMS];
+    ptrdiff_t mstride[NC_MAX_VAR_DIMS];
+    ptrdiff_t step;
+    char* buf = NULL;
+
+    if((stat = getagg(ncid, NULL, &agg, &tnc, &tid))) goto done;
+    if((stat = joinedpos(agg, ncid, tid, varid, &pos))) goto done;
+    if(pos < 0) {
+        stat = tnc->dispatch->get_vars(tid, varid, start, edges, stride, value, memtype);
+        goto done;
+    }
+    if(memtype == NC_NAT && (stat = nc_inq_vartype(tid, varid, &memtype))) goto done;
+    if(memtype <= NC_MAX_ATOMIC_TYPE)
+        typesize = NC_atomictypelen(memtype);
+    else if((stat = tnc->dispatch->inq_type(tid, memtype, NULL, &typesize)))
+        goto done;
+    if((stat = nc_inq_varndims(tid, varid, &ndims))) goto done;
+    if(agg->joinnew) ndims++;
+
+    count = edges[pos];
+    step = stride[pos];
+    if(step <= 0) {stat = NC_ESTRIDE; goto done;}
+    if(start[pos] > agg->dimlen) {stat = NC_EINVALCOORDS; goto done;}
+    if(count > 0 && (start[pos] == agg->dimlen
+                     || count - 1 > (agg->dimlen - 1 - start[pos]) / (size_t)step))
+        {stat = NC_EEDGE; goto done;}
+    inner = typesize;
+    for(d = 0; d < ndims; d++) {
+        if(d < pos) outer *= edges[d];
+        else if(d > pos) inner *= edges[d];
+    }
+    if(count == 0 || outer == 0 || inner == 0)
+        goto done;
+    last = start[pos] + (count - 1) * (size_t)step;
+
+    for(m = findmember(agg, start[pos]); m < agg->nmembers && agg->members[m].start <= last; m++) {
+        NCAGGmember* member = &agg->members[m];
+        size_t i0, i1, n;
+        int mid, mvarid;
+        char* dst = (char*)value;
+
+        if(member->len == 0) continue;
+        /* The slab indices i with start + i*stride in this member */
+        if(member->start + member->len <= start[pos]) continue;
+        i0 = (member->start <= start[pos]) ? 0
+             : (member->start - start[pos] + (size_t)step - 1) / (size_t)step;
+        i1 = (member->start + member->len - 1 - start[pos]) / (size_t)step + 1;
+        if(i1 > count) i1 = count;
+        if(i0 >= i1) continue;
+        n = i1 - i0;
+
+        if(agg->joinnew) {
+            /* The files do not have the first dimension */
+            for(d = 1; d < ndims; d++) {
+                mstart[d-1] = start[d];
+                medges[d-1] = edges[d];
+                mstride[d-1] = stride[d];
+            }
+        } else {
+            for(d = 0; d < ndims; d++) {
+                mstart[d] = start[d];
+                medges[d] = edges[d];
+                mstride[d] = stride[d];
+            }
+            mstart[pos] = start[pos] + i0 * (size_t)step - member->start;
+            medges[pos] = n;
+        }
+
+        if((stat = openmembervar(agg, m, tid, varid, &mid, &mvarid))) goto done;
+        if(outer == 1) {
+            stat = getmemberdata(mid, mvarid, mstart, medges, mstride, dst + i0 * inner, memtype);
+        } else {
+            size_t o;
+            nullfree(buf);
+            if((buf = (char*)malloc(outer * n * inner)) == NULL) {stat = NC_ENOMEM; goto done;}
+            stat = getmemberdata(mid, mvarid, mstart, medges, mstride, buf, memtype);
+            if(stat == NC_NOERR || stat == NC_ERANGE) {
+                for(o = 0; o < outer; o++)
+                    memcpy(dst + (o * count + i0) * inner, buf + o * n * inner, n * inner);
+            }
+        }
+        /* As for one file, convert all the values despite range errors */
+        if(stat == NC_ERANGE) {erange = 1; stat = NC_NOERR;}
+        if(stat) goto done;
+    }
+done:
+    nullfree(buf);
+    if(stat == NC_NOERR && erange) stat = NC_ERANGE;
+    return stat;
+}
+
+static int
+NCAGG_get_vara(int ncid, int varid, const size_t* start, const size_t* edges,
+               void* value, nc_type memtype)
+{
+    return NCAGG_get_vars(ncid, varid, start, edges, NC_stride_one, value, memtype);
+}
+
+static int
+NCAGG_show_metadata(int ncid)
+{
+    NC* tnc;
+    int stat, tid;
+    if((stat = getagg(ncid, NULL, NULL, &tnc, &tid))) return stat;
+    return tnc->dispatch->show_metadata(tid);
+}
+
+static int
+NCAGG_inq_unlimdims(int ncid, int* nunlimdimsp, int* unlimdimidsp)
+{
+    NC* tnc;
+    int stat, tid;
+    if((stat = getagg(ncid, NULL, NULL, &tnc, &tid))) return stat;
+    return tnc->dispatch->inq_unlimdims(tid, nunlimdimsp, unlimdimidsp);
+}
+
+static int
+NCAGG_inq_ncid(int ncid, const char* name, int* grp_ncid)
+{
+    NC* tnc;
+    NC* ncp;
+    int stat, tid, id;
+    if((stat = getagg(ncid, &ncp, NULL, &tnc, &tid))) return stat;
+    if((stat = tnc->dispatch->inq_ncid(tid, name, &id))) return stat;
+    if(grp_ncid) *grp_ncid = makeaggid(ncp, id);
+    return NC_NOERR;
+}
+
+static int
+NCAGG_inq_grps(int ncid, int* numgrps, int* ncids)
+{
+    NC* tnc;
+    NC* ncp;
+    int stat, tid, n, i;
+    if((stat = getagg(ncid, &ncp, NULL, &tnc, &tid))) return stat;
+    if((stat = tnc->dispatch->inq_grps(tid, &n, ncids))) return stat;
+    if(numgrps) *numgrps = n;
+    if(ncids) {
+        for(i = 0; i < n; i++)
+            ncids[i] = makeaggid(ncp, ncids[i]);
+    }
+    return NC_NOERR;
+}
+
+static int
+NCAGG_inq_grpname(int ncid, char* name)
+{
+    NC* tnc;
+    int stat, tid;
+    if((stat = getagg(ncid, NULL, NULL, &tnc, &tid))) return stat;
+    return tnc->dispatch->inq_grpname(tid, name);
+}
+
+static int
+NCAGG_inq_grpname_full(int ncid, size_t* lenp, char* full_name)
+{
+    NC* tnc;
+    int stat, tid;
+    if((stat = getagg(ncid, NULL, NULL, &tnc, &tid))) return stat;
+    return tnc->dispatch->inq_grpname_full(tid, lenp, full_name);
+}
+
+static int
+NCAGG_inq_grp_parent(int ncid, int* parent_ncid)
+{
+    NC* tnc;
+    NC* ncp;
+    int stat, tid, id;
+    if((stat = getagg(ncid, &ncp, NULL, &tnc, &tid))) return stat;
+    if((stat = tnc->dispatch->inq_grp_parent(tid, &id))) return stat;
+    if(parent_ncid) *parent_ncid = makeaggid(ncp, id);
+    return NC_NOERR;
+}
+
+static int
+NCAGG_inq_grp_full_ncid(int ncid, const char* full_name, int* grp_ncid)
+{
+    NC* tnc;
+    NC* ncp;
+    int stat, tid, id;
+    if((stat = getagg(ncid, &ncp, NULL, &tnc, &tid))) return stat;
+    if((stat = tnc->dispatch->inq_grp_full_ncid(tid, full_name, &id))) return stat;
+    if(grp_ncid) *grp_ncid = makeaggid(ncp, id);
+    return NC_NOERR;
+}
+
+static int
+NCAGG_inq_varids(int ncid, int* nvars, int* varids)
+{
+    NC* tnc;
+    int stat, tid;
+    if((stat = getagg(ncid, NULL, NULL, &tnc, &tid))) return stat;
+    return tnc->dispatch->inq_varids(tid, nvars, varids);
+}
+
+static int
+NCAGG_inq_dimids(int ncid, int* ndims, int* dimids, int include_parents)
+{
+    NC* tnc;
+    NCAGG* agg;
+    int stat, tid, n;
+    if((stat = getagg(ncid, NULL, &agg, &tnc, &tid))) return stat;
+    if((stat = tnc->dispatch->inq_dimids(tid, &n, dimids, include_parents))) return stat;
+    if(agg->joinnew && ((ncid & GRP_ID_MASK) == 0 || include_parents)) {
+        if(dimids) dimids[n] = agg->dimid;
+        n++;
+    }
+    if(ndims) *ndims = n;
+    return NC_NOERR;
+}
+
+static int
+NCAGG_inq_typeids(int ncid, int* ntypes, int* typeids)
+{
+    NC* tnc;
+    int stat, tid;
+    if((stat = getagg(ncid, NULL, NULL, &tnc, &tid))) return stat;
+    return tnc->dispatch->inq_typeids(tid, ntypes, typeids);
+}
+
+static int
+NCAGG_inq_type_equal(int ncid1, nc_type typeid1, int ncid2, nc_type typeid2, int* equalp)
+{
+    NC* tnc;
+    NC* nc2;
+    int stat, tid1, tid2 = ncid2;
+    if((stat = getagg(ncid1, NULL, NULL, &tnc, &tid1))) return stat;
+    if(NC_check_id(ncid2, &nc2) == NC_NOERR && nc2->dispatch == NCAGG_dispatch_table)
+        tid2 = maketemplateid((NCAGG*)nc2->dispatchdata, ncid2);
+    return tnc->dispatch->inq_type_equal(tid1, typeid1, tid2, typeid2, equalp);
+}
+
+static int
+NCAGG_inq_user_type(int ncid, nc_type xtype, char* name, size_t* size,
+                    nc_type* base_typep, size_t* nfieldsp, int* classp)
+{
+    NC* tnc;
+    int stat, tid;
+    if((stat = getagg(ncid, NULL, NULL, &tnc, &tid))) return stat;
+    return tnc->dispatch->inq_user_type(tid, xtype, name, size, base_typep, nfieldsp, classp);
+}
+
+static int
+NCAGG_inq_typeid(int ncid, const char* name, nc_type* typeidp)
+{
+    NC* tnc;
+    int stat, tid;
+    if((stat = getagg(ncid, NULL, NULL, &tnc, &tid))) return stat;
+    return tnc->dispatch->inq_typeid(tid, name, typeidp);
+}
+
+static int
+NCAGG_inq_compound_field(int ncid, nc_type xtype, int fieldid, char* name,
+                         size_t* offsetp, nc_type* field_typeidp, int* ndimsp,
+                         int* dim_sizesp)
+{
+    NC* tnc;
+    int stat, tid;
+    if((stat = getagg(ncid, NULL, NULL, &tnc, &tid))) return stat;
+    return tnc->dispatch->inq_compound_field(tid, xtype, fieldid, name, offsetp, field_typeidp,
+                                 ndimsp, dim_sizesp);
+}
+
+static int
+NCAGG_inq_compound_fieldindex(int ncid, nc_type xtype, const char* name, int* fieldidp)
+{
+    NC* tnc;
+    int stat, tid;
+    if((stat = getagg(ncid, NULL, NULL, &tnc, &tid))) return stat;
+    return tnc->dispatch->inq_compound_fieldindex(tid, xtype, name, fieldidp);
+}
+
+static int
+NCAGG_get_vlen_element(int ncid, int xtype, const void* vlen_element, size_t* lenp,
+                       void* data)
+{
+    NC* tnc;
+    int stat, tid;
+    if((stat = getagg(ncid, NULL, NULL, &tnc, &tid))) return stat;
+    return tnc->dispatch->get_vlen_element(tid, xtype, vlen_element, lenp, data);
+}
+
+static int
+NCAGG_inq_enum_member(int ncid, nc_type xtype, int idx, char* identifier, void* value)
+{
+    NC* tnc;
+    int stat, tid;
+    if((stat = getagg(ncid, NULL, NULL, &tnc, &tid))) return stat;
+    return tnc->dispatch->inq_enum_member(tid, xtype, idx, identifier, value);
+}
+
+static int
+NCAGG_inq_enum_ident(int ncid, nc_type xtype, long long value, char* identifier)
+{
+    NC* tnc;
+    int stat, tid;
+    if((stat = getagg(ncid, NULL, NULL, &tnc, &tid))) return stat;
+    return tnc->dispatch->inq_enum_ident(tid, xtype, value, identifier);
+}
+
+static int
+NCAGG_set_var_chunk_cache(int ncid, int varid, size_t size, size_t nelems,
+                          float preemption)
+{
+    NC* tnc;
+    int stat, tid;
+    if((stat = getagg(ncid, NULL, NULL, &tnc, &tid))) return stat;
+    return tnc->dispatch->set_var_chunk_cache(tid, varid, size, nelems, preemption);
+}
+
+static int
+NCAGG_get_var_chunk_cache(int ncid, int varid, size_t* sizep, size_t* nelemsp,
+                          float* preemptionp)
+{
+    NC* tnc;
+    int stat, tid;
+    if((stat = getagg(ncid, NULL, NULL, &tnc, &tid))) return stat;
+    return tnc->dispatch->get_var_chunk_cache(tid, varid, sizep, nelemsp, preemptionp);
+}
+
+static int
+NCAGG_inq_var_filter_ids(int ncid, int varid, size_t* nfilters, unsigned int* filterids)
+{
+    NC* tnc;
+    int stat, tid;
+    if((stat = getagg(ncid, NULL, NULL, &tnc, &tid))) return stat;
+    return tnc->dispatch->inq_var_filter_ids(tid, varid, nfilters, filterids);
+}
+
+static int
+NCAGG_inq_var_filter_info(int ncid, int varid, unsigned int id, size_t* nparams,
+                          unsigned int* params)
+{
+    NC* tnc;
+    int stat, tid;
+    if((stat = getagg(ncid, NULL, NULL, &tnc, &tid))) return stat;
+    return tnc->dispatch->inq_var_filter_info(tid, varid, id, nparams, params);
+}
+
+static int
+NCAGG_inq_var_quantize(int ncid, int varid, int* quantize_modep, int* nsdp)
+{
+    NC* tnc;
+    int stat, tid;
+    if((stat = getagg(ncid, NULL, NULL, &tnc, &tid))) return stat;
+    return tnc->dispatch->inq_var_quantize(tid, varid, quantize_modep, nsdp);
+}
+
+static int
+NCAGG_inq_filter_avail(int ncid, unsigned id)
+{
+    NC* tnc;
+    int stat, tid;
+    if((stat = getagg(ncid, NULL, NULL, &tnc, &tid))) return stat;
+    return tnc->dispatch->inq_filter_avail(tid, id);
+}
+
+/**
+ * @internal Get a chunk from the member that holds it, as chunks do
+ * not span member files.
+ */
+static int
+NCAGG_get_var_chunk_raw(int ncid, int varid, const size_t* startp, size_t* sizep,
+                        void* data)
+{
+    NC* tnc;
+    NCAGG* agg;
+    int stat, tid, pos, ndims, d, mid, mvarid;
+    size_t m;
+    size_t mstart[NC_MAX_VAR_DIMS];
+
+    if((stat = getagg(ncid, NULL, &agg, &tnc, &tid))) return stat;
+    if((stat = joinedpos(agg, ncid, tid, varid, &pos))) return stat;
+    if(pos < 0)
+        return tnc->dispatch->get_var_chunk_raw(tid, varid, startp, sizep, data);
+    if(startp == NULL) return NC_EINVAL;
+    if(startp[pos] >= agg->dimlen) return NC_EINVALCOORDS;
+    if((stat = nc_inq_varndims(tid, varid, &ndims))) return stat;
+    m = findmember(agg, startp[pos]);
+    if(agg->joinnew) {
+        for(d = 0; d < ndims; d++)
+            mstart[d] = startp[d+1];
+    } else {
+        for(d = 0; d < ndims; d++)
+            mstart[d] = startp[d];
+        mstart[pos] -= agg->members[m].start;
+    }
+    if((stat = openmembervar(agg, m, tid, varid, &mid, &mvarid))) return stat;
+    return nc_get_var_chunk_raw(mid, mvarid, mstart, sizep, data);
+}
+
+/*
+The remaining functions would change the dataset, which is read-only.
+*/
+
+static int
+NCAGG_put_vars(int ncid, int varid, const size_t* start, const size_t* edges,
+               const ptrdiff_t* stride, const void* value, nc_type memtype)
+{
+    return NC_EPERM;
+}
+
+static int
+NCAGG_var_par_access(int ncid, int varid, int par_access)
+{
+    return NC_EPERM;
+}
+
+static int
+NCAGG_def_grp(int parent_ncid, const char* name, int* new_ncid)
+{
+    return NC_EPERM;
+}
+
+static int
+NCAGG_rename_grp(int grpid, const char* name)
+{
+    return NC_EPERM;
+}
+
+static int
+NCAGG_def_compound(int ncid, size_t size, const char* name, nc_type* typeidp)
+{
+    return NC_EPERM;
+}
+
+static int
+NCAGG_insert_compound(int ncid, nc_type xtype, const char* name, size_t offset,
+                      nc_type field_typeid)
+{
+    return NC_EPERM;
+}
+
+static int
+NCAGG_insert_array_compound(int ncid, nc_type xtype, const char* name, size_t offset,
+                            nc_type field_typeid, int ndims, const int* dim_sizes)
+{
+    return NC_EPERM;
+}
+
+static int
+NCAGG_def_vlen(int ncid, const char* name, nc_type base_typeid, nc_type* xtypep)
+{
+    return NC_EPERM;
+}
+
+static int
+NCAGG_put_vlen_element(int ncid, int xtype, void* vlen_element, size_t len,
+                       const void* data)
+{
+    return NC_EPERM;
+}
+
+static int
+NCAGG_def_enum(int ncid, nc_type base_typeid, const char* name, nc_type* typeidp)
+{
+    return NC_EPERM;
+}
+
+static int
+NCAGG_insert_enum(int ncid, nc_type xtype, const char* identifier, const void* value)
+{
+    return NC_EPERM;
+}
+
+static int
+NCAGG_def_opaque(int ncid, size_t size, const char* name, nc_type* xtypep)
+{
+    return NC_EPERM;
+}
+
+static int
+NCAGG_def_var_deflate(int ncid, int varid, int shuffle, int deflate, int deflate_level)
+{
+    return NC_EPERM;
+}
+
+static int
+NCAGG_def_var_fletcher32(int ncid, int varid, int fletcher32)
+{
+    return NC_EPERM;
+}
+
+static int
+NCAGG_def_var_chunking(int ncid, int varid, int storage, const size_t* chunksizesp)
+{
+    return NC_EPERM;
+}
+
+static int
+NCAGG_def_var_endian(int ncid, int varid, int endianness)
+{
+    return NC_EPERM;
+}
+
+static int
+NCAGG_def_var_filter(int ncid, int varid, unsigned int id, size_t nparams,
+                     const unsigned int* params)
+{
+    return NC_EPERM;
+}
+
+static int
+NCAGG_def_var_quantize(int ncid, int varid, int quantize_mode, int nsd)
+{
+    return NC_EPERM;
+}
+
+static int
+NCAGG_put_var_chunk_raw(int ncid, int varid, const size_t* startp, size_t size,
+                        const void* data)
+{
+    return NC_EPERM;
+}
+
+static const NC_Dispatch NCAGG_dispatch_base = {
+
+NC_FORMATX_NCAGG,
+NC_DISPATCH_VERSION,
+
+NC_RO_create,
+NCAGG_open,
+
+NC_RO_redef,
+NC_RO__enddef,
+NC_RO_sync,
+NCAGG_abort,
+NCAGG_close,
+NC_RO_set_fill,
+NCAGG_inq_format,
+NCAGG_inq_format_extended,
+
+NCAGG_inq,
+NCAGG_inq_type,
+
+NC_RO_def_dim,
+NCAGG_inq_dimid,
+NCAGG_inq_dim,
+NCAGG_inq_unlimdim,
+NC_RO_rename_dim,
+
+NCAGG_inq_att,
+NCAGG_inq_attid,
+NCAGG_inq_attname,
+NC_RO_rename_att,
+NC_RO_del_att,
+NCAGG_get_att,
+NC_RO_put_att,
+
+NC_RO_def_var,
+NCAGG_inq_varid,
+NC_RO_rename_var,
+NCAGG_get_vara,
+NC_RO_put_vara,
+NCAGG_get_vars,
+NCAGG_put_vars,
+NCDEFAULT_get_varm,
+NCDEFAULT_put_varm,
+
+NCAGG_inq_var_all,
+
+NCAGG_var_par_access,
+NC_RO_def_var_fill,
+
+NCAGG_show_metadata,
+NCAGG_inq_unlimdims,
+NCAGG_inq_ncid,
+NCAGG_inq_grps,
+NCAGG_inq_grpname,
+NCAGG_inq_grpname_full,
+NCAGG_inq_grp_parent,
+NCAGG_inq_grp_full_ncid,
+NCAGG_inq_varids,
+NCAGG_inq_dimids,
+NCAGG_inq_typeids,
+NCAGG_inq_type_equal,
+NCAGG_def_grp,
+NCAGG_rename_grp,
+NCAGG_inq_user_type,
+NCAGG_inq_typeid,
+
+NCAGG_def_compound,
+NCAGG_insert_compound,
+NCAGG_insert_array_compound,
+NCAGG_inq_compound_field,
+NCAGG_inq_compound_fieldindex,
+NCAGG_def_vlen,
+NCAGG_put_vlen_element,
+NCAGG_get_vlen_element,
+NCAGG_def_enum,
+NCAGG_insert_enum,
+NCAGG_inq_enum_member,
+NCAGG_inq_enum_ident,
+NCAGG_def_opaque,
+NCAGG_def_var_deflate,
+NCAGG_def_var_fletcher32,
+NCAGG_def_var_chunking,
+NCAGG_def_var_endian,
+NCAGG_def_var_filter,
+NCAGG_set_var_chunk_cache,
+NCAGG_get_var_chunk_cache,
+
+NCAGG_inq_var_filter_ids,
+NCAGG_inq_var_filter_info,
+
+NCAGG_def_var_quantize,
+NCAGG_inq_var_quantize,
+
+NCAGG_inq_filter_avail,
+
+NCAGG_get_var_chunk_raw,
+NCAGG_put_var_chunk_raw,
+};
@@ -0,0 +1,506 @@
+/* Copyright 2018, University Corporation for Atmospheric
+ * Research. See COPYRIGHT file for copying and redistribution
+ * conditions. */
+/**
+ * @file
+ * Checksums of the contents of variables, for checking the integrity
+ * of archived files.
+ *
+ * The checksum of a variable is the CRC-64 (as in xz) of its values
+ * in row-major order and little-endian byte order, so it does not
+ * depend on the format of the file or on how the variable is stored
+ * or compressed. A string value counts as its characters followed by
+ * a NUL.
+ *
+ * The chunk checksums of a chunked variable are the CRC-32s (as in
+ * zlib) of its chunks as they are stored, with the filters applied,
+ * in row-major order of the chunks. They change when the file is
+ * rewritten with other filters, but are checked without
+ * decompressing anything.
+ *
+ * Checksums may be kept in the NC_CHECKSUM_ATT and
+ * NC_CHUNK_CHECKSUMS_ATT attributes of the variable.
+ */
+
+#include "config.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "netcdf.h"
+#include "netcdf_aux.h"
+#include "netcdf_filter.h"
+#include "nccrc.h"
+
+/** Variables are read in blocks of at most this many bytes, unless
+ * a single value is larger. */
+#define CHECKSUM_BLOCK 4194304
+
+/** Most bytes passed to the CRC functions at once. */
+#define CRC_STEP 1073741824
+
+/** Length of the text of a CRC-64 in NC_CHECKSUM_ATT. */
+#define CRC64_HEX_LEN 16
+
+/**
+ * @internal Get the size of a value of a type, and the size of the
+ * units to byte swap, which is 0 for strings.
+ *
+ * @return ::NC_NOERR No error.
+ * @return ::NC_EBADTYPE Values of the type are not fixed-size bytes,
+ * as for vlens and compounds.
+ */
+static int
+checksum_type(int ncid, nc_type xtype, size_t *sizep, size_t *swapp)
+{
+    int stat = NC_NOERR;
+    nc_type base;
+    int class;
+
+    if ((stat = nc_inq_type(ncid, xtype, NULL, sizep)))
+        return stat;
+    if (xtype == NC_STRING)
+        *swapp = 0;
+    else if (xtype <= NC_MAX_ATOMIC_TYPE)
+        *swapp = *sizep;
+    else
+    {
+        if ((stat = nc_inq_user_type(ncid, xtype, NULL, NULL, &base, NULL, &class)))
+            return stat;
+        if (class == NC_ENUM)
+            return checksum_type(ncid, base, sizep, swapp);
+        if (class != NC_OPAQUE)
+            return NC_EBADTYPE;
+        *swapp = 1;
+    }
+    return stat;
+}
+
+/** @internal CRC-64 of any number of bytes. */
+static unsigned long long
+crc64_bytes(unsigned long long crc, void *buf, size_t nbytes)
+{
+    char *p = (char *)buf;
+    while (nbytes > 0)
+    {
+        size_t n = nbytes < CRC_STEP ? nbytes : CRC_STEP;
+        crc = NC_crc64(crc, p, (unsigned int)n);
+        p += n;
+        nbytes -= n;
+    }
+    return crc;
+}
+
+/** @internal CRC-32 of any number of bytes. */
+static unsigned int
+crc32_bytes(unsigned int crc, const void *buf, size_t nbytes)
+{
+    const char *p = (const char *)buf;
+    while (nbytes > 0)
+    {
+        size_t n = nbytes < CRC_STEP ? nbytes : CRC_STEP;
+        crc = NC_crc32(crc, p, (unsigned int)n);
+        p += n;
+        nbytes -= n;
+    }
+    return crc;
+}
+
+/**
+ * @internal Add nvals values in buf to a variable checksum. Values
+ * are byte swapped in place to little-endian, and strings are freed.
+ */
+static unsigned long long
+checksum_values(unsigned long long crc, void *buf, size_t nvals,
+                size_t typesize, size_t swapsize)
+{
+    static char empty[1];
+    size_t i;
+
+    if (swapsize == 0)
+    {
+        char **strings = (char **)buf;
+        for (i = 0; i < nvals; i++)
+        {
+            char *s = strings[i] ? strings[i] : empty;
+            crc = crc64_bytes(crc, s, strlen(s) + 1);
+        }
+        (void)nc_free_string(nvals, strings);
+        return crc;
+    }
+#ifdef WORDS_BIGENDIAN
+    if (swapsize > 1)
+    {
+        unsigned char *p = (unsigned char *)buf;
+        size_t nbytes = nvals * typesize, j;
+        for (i = 0; i < nbytes; i += swapsize)
+        {
+            for (j = 0; j < swapsize / 2; j++)
+            {
+                unsigned char c = p[i + j];
+                p[i + j] = p[i + swapsize - 1 - j];
+                p[i + swapsize - 1 - j] = c;
+            }
+        }
+    }
+#endif
+    return crc64_bytes(crc, buf, nvals * typesize);
+}
+
+/**
+ * Compute the checksum of the values of a variable: the CRC-64 of
+ * its values in row-major order, in little-endian byte order, which
+ * is the same whatever the format of the file and the storage and
+ * filters of the variable. Strings count as their characters
+ * followed by a NUL; variables of vlen or compound types have no
+ * checksum.
+ *
+ * The variable is read a few megabytes at a time.
+ *
+ * @param ncid File and group ID.
+ * @param varid Variable ID.
+ * @param crcp Gets the checksum.
+ *
+ * @return ::NC_NOERR No error.
+ * @return ::NC_EINVAL crcp is NULL.
+ * @return ::NC_EBADTYPE The variable has a vlen or compound type.
+ */
+int
+ncaux_var_checksum(int ncid, int varid, unsigned long long *crcp)
+{
+    int stat = NC_NOERR;
+    nc_type xtype;
+    int ndims, d, split;
+    int dimids[NC_MAX_VAR_DIMS];
+    size_t dimlens[NC_MAX_VAR_DIMS];
+    size_t start[NC_MAX_VAR_DIMS];
+    size_t count[NC_MAX_VAR_DIMS];
+    size_t typesize, swapsize, inner, slices = 1, nvals = 1;
+    unsigned long long crc = 0;
+    void *buf = NULL;
+
+    if (!crcp)
+        return NC_EINVAL;
+    if ((stat = nc_inq_var(ncid, varid, NULL, &xtype, &ndims, dimids, NULL)))
+        goto done;
+    if ((stat = checksum_type(ncid, xtype, &typesize, &swapsize)))
+        goto done;
+    for (d = 0; d < ndims; d++)
+    {
+        if ((stat = nc_inq_dimlen(ncid, dimids[d], &dimlens[d])))
+            goto done;
+        nvals *= dimlens[d];
+    }
+    if (nvals == 0)
+        goto done;
+
+    /* Read the innermost dimensions that fit in a block whole, and
+     * dimension split-1 as many slices at a time as fit. */
+    inner = typesize;
+    for (split = ndims; split > 0 && dimlens[split - 1] <= CHECKSUM_BLOCK / inner; split--)
+        inner *= dimlens[split - 1];
+    if (split > 0)
+    {
+        slices = CHECKSUM_BLOCK / inner;
+        if (slices == 0)
+            slices = 1;
+        if (slices > dimlens[split - 1])
+            slices = dimlens[split - 1];
+    }
+    if (!(buf = malloc(slices * inner)))
+    {
+        stat = NC_ENOMEM;
+        goto done;
+    }
+    for (d = 0; d < ndims; d++)
+    {
+        start[d] = 0;
+        count[d] = (d < split - 1 ? 1 : dimlens[d]);
+    }
+    for (;;)
+    {
+        size_t n = 1;
+        if (split > 0)
+        {
+            n = dimlens[split - 1] - start[split - 1];
+            if (n > slices)
+                n = slices;
+            count[split - 1] = n;
+        }
+        if ((stat = nc_get_vara(ncid, varid, start, count, buf)))
+            goto done;
+        crc = checksum_values(crc, buf, n * (inner / typesize), typesize, swapsize);
+        if (split == 0)
+            break;
+
+        /* Step to the next block */
+        start[split - 1] += n;
+        if (start[split - 1] < dimlens[split - 1])
+            continue;
+        start[split - 1] = 0;
+        for (d = split - 2; d >= 0; d--)
+        {
+            if (++start[d] < dimlens[d])
+                break;
+            start[d] = 0;
+        }
+        if (d < 0)
+            break;
+    }
+
+done:
+    free(buf);
+    if (!stat)
+        *crcp = crc;
+    return stat;
+}
+
+/**
+ * Compute the chunk checksums of a variable: the CRC-32 of each of
+ * its chunks as stored in the file, with the filters applied, in
+ * row-major order of the chunks. A chunk that has not been written
+ * has checksum 0. The chunks are not decompressed.
+ *
+ * Call with crcs NULL to get the number of chunks, then allocate
+ * that many unsigned ints and call again to get the checksums.
+ *
+ * @param ncid File and group ID.
+ * @param varid Variable ID.
+ * @param nchunksp Gets the number of chunks, 0 if the variable is
+ * not chunked or the format does not store chunks.
+ * @param crcs Gets the checksums of the chunks. Ignored if NULL.
+ *
+ * @return ::NC_NOERR No error.
+ * @return ::NC_EINVAL nchunksp is NULL.
+ * @return ::NC_EBADTYPE The variable has a variable length type.
+ * @return ::NC_ENOTBUILT Stored chunks cannot be read with this
+ * version of HDF5.
+ */
+int
+ncaux_var_chunk_checksums(int ncid, int varid, size_t *nchunksp, unsigned int *crcs)
+{
+    int stat = NC_NOERR;
+    int storage, ndims, d;
+    int dimids[NC_MAX_VAR_DIMS];
+    size_t chunksizes[NC_MAX_VAR_DIMS];
+    size_t nchunks[NC_MAX_VAR_DIMS];
+    size_t index[NC_MAX_VAR_DIMS];
+    size_t start[NC_MAX_VAR_DIMS];
+    size_t total = 1, bufsize = 0, c;
+    void *buf = NULL;
+
+    if (!nchunksp)
+        return NC_EINVAL;
+    *nchunksp = 0;
+    if ((stat = nc_inq_varndims(ncid, varid, &ndims)))
+        return stat;
+    stat = nc_inq_var_chunking(ncid, varid, &storage, chunksizes);
+    if (stat == NC_ENOTNC4 || (stat == NC_NOERR && storage != NC_CHUNKED) || ndims == 0)
+        return NC_NOERR;
+    if (stat)
+        return stat;
+    if ((stat = nc_inq_vardimid(ncid, varid, dimids)))
+        return stat;
+    for (d = 0; d < ndims; d++)
+    {
+        size_t len;
+        if ((stat = nc_inq_dimlen(ncid, dimids[d], &len)))
+            return stat;
+        nchunks[d] = (len + chunksizes[d] - 1) / chunksizes[d];
+        total *= nchunks[d];
+        index[d] = 0;
+    }
+    *nchunksp = total;
+    if (!crcs)
+        return NC_NOERR;
+
+    for (c = 0; c < total; c++)
+    {
+        size_t size;
+
+        for (d = 0; d < ndims; d++)
+            start[d] = index[d] * chunksizes[d];
+        if ((stat = nc_get_var_chunk_raw(ncid, varid, start, &size, NULL)))
+            goto done;
+        if (size > bufsize)
+        {
+            free(buf);
+            if (!(buf = malloc(size)))
+            {
+                stat = NC_ENOMEM;
+                goto done;
+            }
+            bufsize = size;
+        }
+        if (size > 0 && (stat = nc_get_var_chunk_raw(ncid, varid, start, &size, buf)))
+            goto done;
+        crcs[c] = crc32_bytes(0, buf, size);
+
+        /* Step to the next chunk */
+        for (d = ndims - 1; d >= 0; d--)
+        {
+            if (++index[d] < nchunks[d])
+                break;
+            index[d] = 0;
+        }
+    }
+
+done:
+    free(buf);
+    return stat;
+}
+
+/**
+ * Store the checksums of a variable in its NC_CHECKSUM_ATT and
+ * NC_CHUNK_CHECKSUMS_ATT attributes, to be checked later with
+ * ncaux_verify_checksums(). The checksum of the values is stored as
+ * text, 16 hexadecimal digits; the chunk checksums as an NC_UINT
+ * array, or, in a netCDF-4 classic model file, which has no NC_UINT,
+ * an NC_INT array with the same bits. If there are no chunk
+ * checksums, an old NC_CHUNK_CHECKSUMS_ATT attribute is deleted. The
+ * chunk checksums are stored first, so that a variable does not get
+ * only NC_CHECKSUM_ATT if they cannot be stored.
+ *
+ * The file must be writable. The file is put in define mode and
+ * taken out again if it is not in define mode already; call
+ * nc_redef() first when storing the checksums of many variables of
+ * a classic file, so the header is written only once.
+ *
+ * @param ncid File and group ID.
+ * @param varid Variable ID.
+ * @param crc Checksum of the values, from ncaux_var_checksum().
+ * @param nchunks Number of chunk checksums.
+ * @param crcs Chunk checksums, from ncaux_var_chunk_checksums().
+ *
+ * @return ::NC_NOERR No error.
+ * @return ::NC_EINVAL crcs is NULL and nchunks is not 0.
+ * @return ::NC_EPERM The file is read-only.
+ */
+int
+ncaux_put_checksums(int ncid, int varid, unsigned long long crc,
+                    size_t nchunks, const unsigned int *crcs)
+{
+    int stat = NC_NOERR;
+    int redef = 0;
+    int format;
+    char text[CRC64_HEX_LEN + 1];
+
+    if (nchunks > 0 && !crcs)
+        return NC_EINVAL;
+    if ((stat = nc_inq_format(ncid, &format)))
+        return stat;
+    stat = nc_redef(ncid);
+    if (stat == NC_NOERR)
+        redef = 1;
+    else if (stat != NC_EINDEFINE)
+        return stat;
+    stat = NC_NOERR;
+
+    if (nchunks > 0 && format == NC_FORMAT_NETCDF4_CLASSIC)
+        stat = nc_put_att_int(ncid, varid, NC_CHUNK_CHECKSUMS_ATT, NC_INT, nchunks,
+                              (const int *)crcs);
+    else if (nchunks > 0)
+        stat = nc_put_att_uint(ncid, varid, NC_CHUNK_CHECKSUMS_ATT, NC_UINT, nchunks, crcs);
+    else if ((stat = nc_del_att(ncid, varid, NC_CHUNK_CHECKSUMS_ATT)) == NC_ENOTATT)
+        stat = NC_NOERR;
+    if (stat)
+        goto done;
+    snprintf(text, sizeof(text), "%016llx", crc);
+    stat = nc_put_att_text(ncid, varid, NC_CHECKSUM_ATT, CRC64_HEX_LEN, text);
+
+done:
+    if (redef)
+    {
+        int stat2 = nc_enddef(ncid);
+        if (!stat)
+            stat = stat2;
+    }
+    return stat;
+}
+
+/**
+ * Check the contents of a variable against the checksums stored in
+ * its attributes by ncaux_put_checksums(). If there are chunk
+ * checksums, the stored chunks are checked, without decompressing
+ * them; otherwise the values are read and checked against
+ * NC_CHECKSUM_ATT.
+ *
+ * @param ncid File and group ID.
+ * @param varid Variable ID.
+ * @param statusp Gets ::NC_CHECKSUM_OK if the checksums match,
+ * ::NC_CHECKSUM_BAD if they do not, or ::NC_CHECKSUM_NONE if the
+ * variable has no stored checksums.
+ * @param badchunkp Gets the index, in row-major order, of the first
+ * chunk whose checksum does not match, or the number of stored
+ * chunk checksums if the variable now has another number of chunks.
+ * Set only for a bad chunk checksum. Ignored if NULL.
+ *
+ * @return ::NC_NOERR No error.
+ * @return ::NC_EINVAL statusp is NULL.
+ * @return ::NC_EBADTYPE The variable has a vlen or compound type.
+ */
+int
+ncaux_verify_checksums(int ncid, int varid, int *statusp, size_t *badchunkp)
+{
+    int stat = NC_NOERR;
+    nc_type atype;
+    size_t alen, nchunks, c;
+    unsigned int *expected = NULL, *crcs = NULL;
+
+    if (!statusp)
+        return NC_EINVAL;
+    *statusp = NC_CHECKSUM_NONE;
+
+    if (nc_inq_att(ncid, varid, NC_CHUNK_CHECKSUMS_ATT, &atype, &alen) == NC_NOERR &&
+        (atype == NC_UINT || atype == NC_INT) && alen > 0)
+    {
+        if ((stat = ncaux_var_chunk_checksums(ncid, varid, &nchunks, NULL)))
+            goto done;
+        *statusp = NC_CHECKSUM_BAD;
+        if (nchunks != alen)
+        {
+            if (badchunkp)
+                *badchunkp = alen;
+            goto done;
+        }
+        expected = (unsigned int *)malloc(alen * sizeof(unsigned int));
+        crcs = (unsigned int *)malloc(alen * sizeof(unsigned int));
+        if (!expected || !crcs)
+        {
+            stat = NC_ENOMEM;
+            goto done;
+        }
+        /* Get the bits of NC_INT checksums unconverted */
+        if ((stat = nc_get_att(ncid, varid, NC_CHUNK_CHECKSUMS_ATT, expected)))
+            goto done;
+        if ((stat = ncaux_var_chunk_checksums(ncid, varid, &nchunks, crcs)))
+            goto done;
+        for (c = 0; c < nchunks; c++)
+            if (crcs[c] != expected[c])
+                break;
+        if (c < nchunks)
+        {
+            if (badchunkp)
+                *badchunkp = c;
+            goto done;
+        }
+        *statusp = NC_CHECKSUM_OK;
+    }
+    else if (nc_inq_att(ncid, varid, NC_CHECKSUM_ATT, &atype, &alen) == NC_NOERR &&
+             atype == NC_CHAR && alen == CRC64_HEX_LEN)
+    {
+        char text[CRC64_HEX_LEN + 1];
+        unsigned long long crc;
+
+        if ((stat = nc_get_att_text(ncid, varid, NC_CHECKSUM_ATT, text)))
+            goto done;
+        text[CRC64_HEX_LEN] = '\0';
+        if ((stat = ncaux_var_checksum(ncid, varid, &crc)))
+            goto done;
+        *statusp = (crc == strtoull(text, NULL, 16) ? NC_CHECKSUM_OK : NC_CHECKSUM_BAD);
+    }
+
+done:
+    free(expected);
+    free(crcs);
+    return stat;
+}
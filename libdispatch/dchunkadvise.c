@@ -0,0 +1,221 @@
+/* Copyright 2018, University Corporation for Atmospheric
+ * Research. See COPYRIGHT file for copying and redistribution
+ * conditions. */
+/**
+ * @file
+ * Advise chunk sizes for a variable from the accesses expected to
+ * its data.
+ *
+ * An access reads or writes a slab of the variable, whose shape (the
+ * counts) is known and whose start is not. The cost of a chunk shape
+ * is the expected number of chunks each access touches, weighted
+ * over the accesses. Along a dimension of length N, with chunk size k,
+ * an access of count c that starts anywhere touches on average 1 +
+ * (c-1)/k chunks, and never more than the ceil(N/k) chunks there
+ * are. Chunks are grown one dimension at a time, taking the step
+ * that cuts the cost most for the growth in chunk size, until the
+ * chunk is as big as the target; then chunk size is moved between
+ * dimensions while that cuts the cost further.
+ */
+
+#include "config.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+#include "netcdf.h"
+#include "netcdf_aux.h"
+
+/** Most rounds of moving chunk size between dimensions. */
+#define MAX_ROUNDS 64
+
+/**
+ * @internal The expected number of chunks touched by the accesses, a
+ * chunk being chunks[d] long in each dimension.
+ */
+static double
+advise_cost(int ndims, const size_t *dimlens, size_t npatterns,
+            const NC_Access_Pattern *patterns, const size_t *chunks)
+{
+    double cost = 0;
+    size_t p;
+    int d;
+
+    for (p = 0; p < npatterns; p++)
+    {
+        double touched = patterns[p].weight;
+        for (d = 0; d < ndims; d++)
+        {
+            double count = (double)patterns[p].counts[d];
+            double per = 1.0 + (count - 1.0) / (double)chunks[d];
+            if (dimlens[d] > 0)
+            {
+                double nchunks = ceil((double)dimlens[d] / (double)chunks[d]);
+                if (per > nchunks)
+                    per = nchunks;
+            }
+            touched *= per;
+        }
+        cost += touched;
+    }
+    return cost;
+}
+
+/**
+ * Advise chunk sizes for a variable, from the shapes of the accesses
+ * expected to its data, such as time series, map slices, or cubes.
+ * The chunk sizes minimize the expected number of chunks an access
+ * reads or writes, weighted over the accesses, for chunks of at most
+ * target bytes. Chunks are grown to the target even when that does
+ * not cut the number of chunks accessed, innermost dimension first,
+ * so that there are not more chunks than needed. The chunk sizes
+ * may be passed to nc_def_var_chunking().
+ *
+ * For example, a variable (time, lat, lon) read both as time series
+ * and as maps has two patterns, with counts {ntime, 1, 1} and {1,
+ * nlat, nlon}, weighted by how often each is read.
+ *
+ * @param ndims Number of dimensions of the variable.
+ * @param dimlens Lengths of the dimensions. A length of 0, as for an
+ * unlimited dimension with no records yet, means the dimension does
+ * not limit the chunk size.
+ * @param typesize Size in bytes of a value.
+ * @param target Most bytes in a chunk; 0 for the default chunk size
+ * of the library.
+ * @param npatterns Number of access patterns.
+ * @param patterns The access patterns. The counts of each must be at
+ * least 1, and the weights not negative.
+ * @param chunksizes Gets the chunk sizes of the ndims dimensions.
+ *
+ * @return ::NC_NOERR No error.
+ * @return ::NC_EINVAL Bad parameter.
+ */
+int
+ncaux_advise_chunking(int ndims, const size_t *dimlens, size_t typesize,
+                      size_t target, size_t npatterns,
+                      const NC_Access_Pattern *patterns, size_t *chunksizes)
+{
+    size_t maxchunk[NC_MAX_VAR_DIMS];
+    size_t chunks[NC_MAX_VAR_DIMS];
+    size_t nvalues = 1; /* values in a chunk */
+    size_t limit;       /* most values in a chunk */
+    double cost;
+    size_t p;
+    int d, round;
+
+    if (ndims <= 0 || ndims > NC_MAX_VAR_DIMS || !dimlens || !typesize ||
+        !npatterns || !patterns || !chunksizes)
+        return NC_EINVAL;
+    for (p = 0; p < npatterns; p++)
+    {
+        if (!patterns[p].counts || !(patterns[p].weight >= 0))
+            return NC_EINVAL;
+        for (d = 0; d < ndims; d++)
+            if (patterns[p].counts[d] == 0)
+                return NC_EINVAL;
+    }
+
+    if (target == 0)
+        target = DEFAULT_CHUNK_SIZE;
+    limit = target / typesize;
+    if (limit == 0)
+        limit = 1;
+    for (d = 0; d < ndims; d++)
+    {
+        chunks[d] = 1;
+        maxchunk[d] = dimlens[d] ? dimlens[d] : limit;
+    }
+    cost = advise_cost(ndims, dimlens, npatterns, patterns, chunks);
+
+    /* Grow the dimension whose growth cuts the cost most for the
+     * growth in chunk size, doubling it or growing it to fit. */
+    for (;;)
+    {
+        int best = -1;
+        size_t bestlen = 0;
+        double bestcost = cost, bestgain = 0;
+
+        for (d = 0; d < ndims; d++)
+        {
+            size_t others = nvalues / chunks[d];
+            size_t len = chunks[d] * 2;
+            double newcost, gain;
+
+            if (len > maxchunk[d])
+                len = maxchunk[d];
+            if (len > limit / others)
+                len = limit / others;
+            if (len <= chunks[d])
+                continue;
+            chunks[d] = len;
+            newcost = advise_cost(ndims, dimlens, npatterns, patterns, chunks);
+            chunks[d] = nvalues / others;
+            gain = (cost - newcost) / log((double)len / (double)chunks[d]);
+            if (newcost < cost && gain > bestgain)
+            {
+                best = d;
+                bestlen = len;
+                bestcost = newcost;
+                bestgain = gain;
+            }
+        }
+        if (best < 0)
+            break;
+        nvalues = nvalues / chunks[best] * bestlen;
+        chunks[best] = bestlen;
+        cost = bestcost;
+    }
+
+    /* Move a factor of 2 of chunk size from one dimension to another
+     * while that cuts the cost. */
+    for (round = 0; round < MAX_ROUNDS; round++)
+    {
+        int from, to, moved = 0;
+
+        for (from = 0; from < ndims && !moved; from++)
+        {
+            if (chunks[from] < 2)
+                continue;
+            for (to = 0; to < ndims && !moved; to++)
+            {
+                size_t oldfrom = chunks[from], oldto = chunks[to];
+                double newcost;
+
+                if (to == from || oldto * 2 > maxchunk[to])
+                    continue;
+                chunks[from] = oldfrom / 2;
+                chunks[to] = oldto * 2;
+                newcost = advise_cost(ndims, dimlens, npatterns, patterns, chunks);
+                if (newcost < cost * (1.0 - 1e-9))
+                {
+                    cost = newcost;
+                    nvalues = nvalues / oldfrom * chunks[from] / oldto * chunks[to];
+                    moved = 1;
+                }
+                else
+                {
+                    chunks[from] = oldfrom;
+                    chunks[to] = oldto;
+                }
+            }
+        }
+        if (!moved)
+            break;
+    }
+
+    /* Fill the chunk up to the target, innermost dimension first. */
+    for (d = ndims - 1; d >= 0; d--)
+    {
+        size_t others = nvalues / chunks[d];
+        size_t len = limit / others;
+        if (len > maxchunk[d])
+            len = maxchunk[d];
+        if (len > chunks[d])
+        {
+            chunks[d] = len;
+            nvalues = others * len;
+        }
+    }
+
+    memcpy(chunksizes, chunks, (size_t)ndims * sizeof(size_t));
+    return NC_NOERR;
+}
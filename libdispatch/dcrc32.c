@@ -93,6 +93,7 @@ UCAR
 #endif /* MAKECRCH */
 
 #include "ncexternl.h"
+#include "nccrc.h"
 
 /* Definitions for doing the crc four data bytes at a time. */
 #if !defined(NOBYFOUR) && defined(Z_U4)
@@ -294,12 +295,34 @@ local unsigned long ZEXPORT crc32_z(crc, buf, len)
     return crc ^ 0xffffffffUL;
 }
 
+/* ========================================================================= */
+/* Constants folding the CRC-32 with carry-less multiplication (dcrchw.c) */
+local const NCcrcfold crc32_fold = {
+    {0x65673b4600000000ULL, 0x9ba54c6f00000000ULL}, /* 128 */
+    {0x9570d49500000000ULL, 0x01b5fd1d00000000ULL}, /* 256 */
+    {0x69ccfc0d00000000ULL, 0x2a28386200000000ULL}, /* 384 */
+    {0x653d982200000000ULL, 0xcad38e8f00000000ULL}, /* 512 */
+    {0x7cc8e1e700000000ULL, 0x03f9f86300000000ULL}, /* 2048 */
+};
+
 /* ========================================================================= */
 EXTERNL unsigned int ZEXPORT
 NC_crc32(unsigned int crc, const void* buf, unsigned int len)
 {
     unsigned long value = (unsigned long)crc;
     unsigned char* cbuf = (unsigned char*)buf;
+    unsigned char folded[16];
+    size_t n;
+
+    /* Use the CPU's CRC instructions if it has them */
+    if (NC_crc32_hw(&crc, buf, len))
+        return crc;
+    n = NC_crc_fold(&crc32_fold, ~crc & 0xFFFFFFFFUL, buf, len, folded);
+    if (n > 0) {
+        value = crc32_z(0xFFFFFFFFUL, folded, sizeof(folded));
+        cbuf += n;
+        len -= (unsigned int)n;
+    }
     value = crc32_z(value, cbuf, len);
     return (unsigned int)(value & 0xFFFFFFFF); /* in case |long| is 64 bits */
 }
@@ -43,6 +43,7 @@
 #include <assert.h>
 
 #include "ncexternl.h"
+#include "nccrc.h"
 
 /* The include of pthread.h below can be commented out in order to not use the
    pthread library for table initialization.  In that case, the initialization
@@ -216,9 +217,21 @@ static inline uint64 crc64_big(uint64 crc, void *buf, size_t len)
 
 static int littleendian = -1;
 
+/* Constants folding the CRC-64 with carry-less multiplication (dcrchw.c) */
+static const NCcrcfold crc64_fold = {
+    {0xe05dd497ca393ae4ULL, 0xdabe95afc7875f40ULL}, /* 128 */
+    {0x60095b008a9efa44ULL, 0x3be653a30fe1af51ULL}, /* 256 */
+    {0xb5ea1af9c013aca4ULL, 0x69a35d91c3730254ULL}, /* 384 */
+    {0x6ae3efbb9dd441f3ULL, 0x081f6054a7842df4ULL}, /* 512 */
+    {0x8260adf2381ad81cULL, 0xf31fd9271e228b79ULL}, /* 2048 */
+};
+
 EXTERNL uint64
 NC_crc64(uint64 crc, void *buf, unsigned int len)
 {
+    unsigned char folded[16];
+    size_t n;
+
     /* Is this machine big vs little endian? */
     if(littleendian < 0) {
 	unsigned char* p = (void*)&littleendian;
@@ -226,6 +239,15 @@ NC_crc64(uint64 crc, void *buf, unsigned int len)
 	if(*p == 0) littleendian = 0; /* big endian */
     }
 
+    /* Fold all but the end of the buffer with the CPU's carry-less
+       multiplication if it has it, and finish with the tables */
+    n = NC_crc_fold(&crc64_fold, ~crc, buf, len, folded);
+    if(n > 0) {
+	crc = crc64_little(~(uint64)0, folded, sizeof(folded));
+	buf = (unsigned char*)buf + n;
+	len -= (unsigned int)n;
+    }
+
     return littleendian ? crc64_little(crc, buf, (size_t)len) :
                           crc64_big(crc, buf, (size_t)len);
 }
@@ -0,0 +1,359 @@
+/* Copyright 2018, University Corporation for Atmospheric
+ * Research. See COPYRIGHT file for copying and redistribution
+ * conditions. */
+/**
+ * @file
+ * CRCs computed with CPU instructions, for NC_crc32() and NC_crc64(),
+ * which fall back to their tables where these are not available.
+ *
+ * On x86, a reflected CRC is folded with carry-less multiplication
+ * (PCLMULQDQ, or VPCLMULQDQ on 512-bit vectors), as described in
+ * Gopal et al., "Fast CRC Computation for Generic Polynomials Using
+ * PCLMULQDQ Instruction", Intel, 2009. A 128-bit block of the message
+ * that is followed by D more bits adds the same to the CRC as the
+ * block times x^D; so with the block split into 64-bit halves H
+ * (first) and L, it may be replaced by H * (x^(D+64) mod P) + L * (x^D
+ * mod P), which is again 128 bits, and added into the block D bits
+ * further on. Folding stops at the last block, whose CRC is then
+ * taken with the tables. The constants are bit-reflected like the
+ * data, and are x^(D+63) and x^(D-1) mod P, since the product of two
+ * reflected 64-bit values is shifted by one bit.
+ *
+ * On 64-bit ARM, the CRC-32 instructions of ARMv8 compute the CRC-32
+ * of zlib directly. There is no such instruction for the CRC-64.
+ *
+ * The x86 instructions are found at run time, so a library built for
+ * any x86 CPU uses them where it runs on a CPU that has them. The ARM
+ * instructions are used through the ACLE intrinsics, only when the
+ * build found that the compiler targets them (HAVE_ARM_ACLE_CRC32,
+ * e.g. with -march=armv8-a+crc), so every CPU the library runs on
+ * has them.
+ */
+
+#include "config.h"
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+#include "ncexternl.h"
+#include "nccrc.h"
+
+#if (defined(__x86_64__) || defined(__i386__)) && \
+    ((defined(__clang__) && __clang_major__ >= 8) || \
+     (!defined(__clang__) && defined(__GNUC__) && __GNUC__ >= 8))
+#define CRC_X86
+#include <cpuid.h>
+#include <immintrin.h>
+#endif
+
+#if defined(HAVE_ARM_ACLE_CRC32) && defined(__aarch64__) && defined(__AARCH64EL__)
+#define CRC_ARM
+#include <arm_acle.h>
+#endif
+
+/** Instructions found for CRCs. */
+#define CRC_HW_NONE 0
+#define CRC_HW_PCLMUL 1   /**< x86 PCLMULQDQ */
+#define CRC_HW_VPCLMUL 2  /**< x86 AVX-512 VPCLMULQDQ */
+#define CRC_HW_ARMV8 3    /**< ARMv8 CRC32 */
+
+/** Shortest buffers folded with each of the x86 instructions. */
+#define FOLD_MIN 64
+#define FOLD512_MIN 1024
+
+/** Instructions to use, or -1 before they are found. */
+static volatile int crc_hw = -1;
+
+/** False if NC_crc_usehardware() turned the instructions off. */
+static int crc_hw_use = 1;
+
+/** @internal Find the CPU instructions for CRCs. */
+static int
+crc_detect(void)
+{
+    int hw = CRC_HW_NONE;
+#ifdef CRC_X86
+    unsigned int eax, ebx, ecx, edx;
+
+    if (__get_cpuid(1, &eax, &ebx, &ecx, &edx) && (ecx & (1u << 1))) /* PCLMULQDQ */
+    {
+        hw = CRC_HW_PCLMUL;
+        /* AVX-512F and VPCLMULQDQ, and the OS saves the zmm registers
+         * (OSXSAVE, then XCR0 bits for SSE, AVX and the AVX-512 state) */
+        if ((ecx & (1u << 27)) && __get_cpuid_max(0, NULL) >= 7)
+        {
+            unsigned int xcr0, xcr0hi;
+            __cpuid_count(7, 0, eax, ebx, ecx, edx);
+            __asm__ volatile("xgetbv" : "=a"(xcr0), "=d"(xcr0hi) : "c"(0));
+            if ((ebx & (1u << 16)) && (ecx & (1u << 10)) && (xcr0 & 0xe6) == 0xe6)
+                hw = CRC_HW_VPCLMUL;
+        }
+    }
+#endif
+#ifdef CRC_ARM
+    hw = CRC_HW_ARMV8;
+#endif
+    return hw;
+}
+
+/** @internal Get the CPU instructions to use for CRCs. */
+static int
+crc_hardware(void)
+{
+    if (crc_hw < 0)
+        crc_hw = crc_detect();
+    return crc_hw_use ? crc_hw : CRC_HW_NONE;
+}
+
+/**
+ * @internal Select whether NC_crc32() and NC_crc64() may use CPU
+ * instructions, for testing and benchmarking.
+ *
+ * @param use Zero to compute CRCs with tables only.
+ *
+ * @return The previous setting.
+ */
+int
+NC_crc_usehardware(int use)
+{
+    int old = crc_hw_use;
+    crc_hw_use = (use != 0);
+    return old;
+}
+
+/**
+ * @internal Name the CPU instructions that NC_crc32() and NC_crc64()
+ * use, for benchmarks.
+ *
+ * @return "pclmul", "vpclmul" or "armv8-crc32", or "none" if CRCs are
+ * computed with tables only.
+ */
+const char *
+NC_crc_hwname(void)
+{
+    switch (crc_hardware())
+    {
+    case CRC_HW_PCLMUL: return "pclmul";
+    case CRC_HW_VPCLMUL: return "vpclmul";
+    case CRC_HW_ARMV8: return "armv8-crc32";
+    default: return "none";
+    }
+}
+
+#ifdef CRC_X86
+
+/** @internal Fold a 128-bit block by the distance of constants k. */
+__attribute__((target("pclmul,sse2"))) static inline __m128i
+fold128(__m128i x, __m128i k)
+{
+    return _mm_xor_si128(_mm_clmulepi64_si128(x, k, 0x00),
+                         _mm_clmulepi64_si128(x, k, 0x11));
+}
+
+/** @internal Load a pair of folding constants. */
+__attribute__((target("pclmul,sse2"))) static inline __m128i
+fold_consts(const unsigned long long *k)
+{
+    return _mm_set_epi64x((long long)k[1], (long long)k[0]);
+}
+
+/**
+ * @internal Fold len bytes, len at least FOLD_MIN and a multiple of
+ * 16, with PCLMULQDQ, four blocks at a time.
+ */
+__attribute__((target("pclmul,sse2"))) static void
+fold_pclmul(const NCcrcfold *k, unsigned long long crc,
+            const unsigned char *buf, size_t len, unsigned char *out)
+{
+    __m128i k512, k128, x1, x2, x3, x4;
+
+    x1 = _mm_loadu_si128((const __m128i *)(buf + 0x00));
+    x2 = _mm_loadu_si128((const __m128i *)(buf + 0x10));
+    x3 = _mm_loadu_si128((const __m128i *)(buf + 0x20));
+    x4 = _mm_loadu_si128((const __m128i *)(buf + 0x30));
+    x1 = _mm_xor_si128(x1, _mm_set_epi64x(0, (long long)crc));
+    buf += 64;
+    len -= 64;
+
+    k512 = fold_consts(k->k512);
+    while (len >= 64)
+    {
+        x1 = _mm_xor_si128(fold128(x1, k512), _mm_loadu_si128((const __m128i *)(buf + 0x00)));
+        x2 = _mm_xor_si128(fold128(x2, k512), _mm_loadu_si128((const __m128i *)(buf + 0x10)));
+        x3 = _mm_xor_si128(fold128(x3, k512), _mm_loadu_si128((const __m128i *)(buf + 0x20)));
+        x4 = _mm_xor_si128(fold128(x4, k512), _mm_loadu_si128((const __m128i *)(buf + 0x30)));
+        buf += 64;
+        len -= 64;
+    }
+
+    k128 = fold_consts(k->k128);
+    x1 = _mm_xor_si128(fold128(x1, k128), x2);
+    x1 = _mm_xor_si128(fold128(x1, k128), x3);
+    x1 = _mm_xor_si128(fold128(x1, k128), x4);
+    while (len >= 16)
+    {
+        x1 = _mm_xor_si128(fold128(x1, k128), _mm_loadu_si128((const __m128i *)buf));
+        buf += 16;
+        len -= 16;
+    }
+    _mm_storeu_si128((__m128i *)out, x1);
+}
+
+/** @internal Fold the four 128-bit blocks of a zmm register at once. */
+__attribute__((target("avx512f,vpclmulqdq"))) static inline __m512i
+fold512(__m512i z, __m512i k)
+{
+    return _mm512_xor_si512(_mm512_clmulepi64_epi128(z, k, 0x00),
+                            _mm512_clmulepi64_epi128(z, k, 0x11));
+}
+
+/**
+ * @internal Fold len bytes, len at least FOLD512_MIN and a multiple
+ * of 16, with VPCLMULQDQ, sixteen blocks at a time.
+ */
+__attribute__((target("avx512f,vpclmulqdq,pclmul"))) static void
+fold_vpclmul(const NCcrcfold *k, unsigned long long crc,
+             const unsigned char *buf, size_t len, unsigned char *out)
+{
+    __m512i k2048, k512, z1, z2, z3, z4;
+    __m128i k128, x1;
+
+    z1 = _mm512_loadu_si512((const void *)(buf + 0x00));
+    z2 = _mm512_loadu_si512((const void *)(buf + 0x40));
+    z3 = _mm512_loadu_si512((const void *)(buf + 0x80));
+    z4 = _mm512_loadu_si512((const void *)(buf + 0xc0));
+    z1 = _mm512_xor_si512(z1, _mm512_inserti32x4(_mm512_setzero_si512(),
+                                                 _mm_set_epi64x(0, (long long)crc), 0));
+    buf += 256;
+    len -= 256;
+
+    k2048 = _mm512_broadcast_i32x4(fold_consts(k->k2048));
+    while (len >= 256)
+    {
+        z1 = _mm512_xor_si512(fold512(z1, k2048), _mm512_loadu_si512((const void *)(buf + 0x00)));
+        z2 = _mm512_xor_si512(fold512(z2, k2048), _mm512_loadu_si512((const void *)(buf + 0x40)));
+        z3 = _mm512_xor_si512(fold512(z3, k2048), _mm512_loadu_si512((const void *)(buf + 0x80)));
+        z4 = _mm512_xor_si512(fold512(z4, k2048), _mm512_loadu_si512((const void *)(buf + 0xc0)));
+        buf += 256;
+        len -= 256;
+    }
+
+    k512 = _mm512_broadcast_i32x4(fold_consts(k->k512));
+    z1 = _mm512_xor_si512(fold512(z1, k512), z2);
+    z1 = _mm512_xor_si512(fold512(z1, k512), z3);
+    z1 = _mm512_xor_si512(fold512(z1, k512), z4);
+
+    /* Fold the four blocks of z1 into the last */
+    k128 = fold_consts(k->k128);
+    x1 = _mm_xor_si128(fold128(_mm512_extracti32x4_epi32(z1, 0), fold_consts(k->k384)),
+                       fold128(_mm512_extracti32x4_epi32(z1, 1), fold_consts(k->k256)));
+    x1 = _mm_xor_si128(x1, fold128(_mm512_extracti32x4_epi32(z1, 2), k128));
+    x1 = _mm_xor_si128(x1, _mm512_extracti32x4_epi32(z1, 3));
+    while (len >= 16)
+    {
+        x1 = _mm_xor_si128(fold128(x1, k128), _mm_loadu_si128((const __m128i *)buf));
+        buf += 16;
+        len -= 16;
+    }
+    _mm_storeu_si128((__m128i *)out, x1);
+}
+
+#endif /*CRC_X86*/
+
+/**
+ * @internal Fold a buffer for a reflected CRC of up to 64 bits, if
+ * the CPU can. All but the last 16 bytes of the folded part of the
+ * buffer are folded into those 16 bytes, which have the same CRC,
+ * with a CRC register of zero before them, as the folded part with
+ * CRC register crc before it.
+ *
+ * @param k Folding constants of the CRC.
+ * @param crc CRC register before the buffer, that is, without the
+ * final complement of the CRC.
+ * @param buf Buffer.
+ * @param len Length of buffer.
+ * @param out Gets the 16 folded bytes.
+ *
+ * @return Number of bytes folded, a multiple of 16, or 0 if nothing
+ * was folded.
+ */
+size_t
+NC_crc_fold(const NCcrcfold *k, unsigned long long crc, const void *buf,
+            size_t len, unsigned char *out)
+{
+#ifdef CRC_X86
+    size_t n = len & ~(size_t)15;
+    if (len < FOLD_MIN || buf == NULL)
+        return 0;
+    switch (crc_hardware())
+    {
+    case CRC_HW_VPCLMUL:
+        if (len >= FOLD512_MIN)
+        {
+            fold_vpclmul(k, crc, (const unsigned char *)buf, n, out);
+            return n;
+        }
+        /* fall through */
+    case CRC_HW_PCLMUL:
+        fold_pclmul(k, crc, (const unsigned char *)buf, n, out);
+        return n;
+    default:
+        break;
+    }
+#else
+    (void)k;
+    (void)crc;
+    (void)buf;
+    (void)len;
+    (void)out;
+#endif
+    return 0;
+}
+
+/**
+ * @internal Compute a CRC-32 with CRC-32 instructions, if the CPU has
+ * them.
+ *
+ * @param crcp The CRC-32 of the preceding data, which gets the
+ * CRC-32 including the buffer.
+ * @param buf Buffer.
+ * @param len Length of buffer.
+ *
+ * @return 1 if the CRC was computed, 0 if not.
+ */
+int
+NC_crc32_hw(unsigned int *crcp, const void *buf, size_t len)
+{
+#ifdef CRC_ARM
+    const unsigned char *p = (const unsigned char *)buf;
+    uint32_t c;
+
+    if (buf == NULL || crc_hardware() != CRC_HW_ARMV8)
+        return 0;
+    c = ~(uint32_t)*crcp;
+    while (len > 0 && ((uintptr_t)p & 7) != 0)
+    {
+        c = __crc32b(c, *p++);
+        len--;
+    }
+    while (len >= 8)
+    {
+        uint64_t v;
+        memcpy(&v, p, sizeof(v));
+        c = __crc32d(c, v);
+        p += 8;
+        len -= 8;
+    }
+    while (len > 0)
+    {
+        c = __crc32b(c, *p++);
+        len--;
+    }
+    *crcp = ~c;
+    return 1;
+#else
+    (void)crcp;
+    (void)buf;
+    (void)len;
+    return 0;
+#endif
+}
@@ -616,6 +616,16 @@ nc__create_mp(const char *path, int cmode, size_t initialsz,
  * will read the whole file into memory on nc_open. Thus, MMAP will
  * provide some performance improvement in this case.
  *
+ * For read-only opens of netCDF-4 files, the NC_LAZYOPEN flag may be
+ * added to the omode argument. The HDF5 dataset of each
+ * non-coordinate variable is then closed again as soon as its name,
+ * type and dimensions have been read, and is only reopened when the
+ * variable is first accessed. Its chunking, filter, fill value and
+ * attribute information is read at that time. This makes opening a
+ * file with very many variables, of which only a few are used, much
+ * cheaper. NC_LAZYOPEN is ignored for other formats, for writable
+ * opens and for parallel opens.
+ *
  * It is not necessary to pass any information about the format of the
  * file being opened. The file type will be detected automatically by
  * the netCDF library.
@@ -2075,6 +2085,7 @@ NC_open(const char *path0, int omode, int basepe, size_t *chunksizehintp,
     {
 	unsigned built = 0 /* leave off the trailing semicolon so we can build constant */
 		| (1<<NC_FORMATX_NC3) /* NC3 always supported */
+		| (1<<NC_FORMATX_NCAGG) /* as are aggregations */
 #ifdef USE_HDF5
 		| (1<<NC_FORMATX_NC_HDF5)
 #endif
@@ -2152,6 +2163,9 @@ NC_open(const char *path0, int omode, int basepe, size_t *chunksizehintp,
         case NC_FORMATX_NC3:
             dispatcher = NC3_dispatch_table;
             break;
+        case NC_FORMATX_NCAGG:
+            dispatcher = NCAGG_dispatch_table;
+            break;
         default:
             stat = NC_ENOTNC;
 	    goto done;
@@ -218,6 +218,94 @@ done:
     return stat;
 }
 
+/**
+ * Read a chunk of a variable as it is stored in the file, with the
+ * variable's filters (e.g. compression) applied, without decoding
+ * it. This allows a chunk to be copied to a variable with the same
+ * type, chunk sizes and filters in another file of the same format
+ * with nc_put_var_chunk_raw(), without decompressing and
+ * recompressing it.
+ *
+ * Call with data NULL to get the size of the chunk, then allocate
+ * that many bytes and call again to get the chunk.
+ *
+ * Only netCDF-4/HDF5 (with HDF5 1.10.3 or later) and NCZarr files
+ * support this.
+ *
+ * @param ncid File and group ID.
+ * @param varid Variable ID.
+ * @param startp Index of the first element of the chunk; each index
+ * must be a multiple of the chunk size in that dimension.
+ * @param sizep Pointer that gets the size in bytes of the stored
+ * chunk, 0 if the chunk has not been written. Ignored if NULL.
+ * @param data Pointer that gets the stored chunk. Ignored if NULL.
+ *
+ * @return ::NC_NOERR No error.
+ * @return ::NC_EBADID Bad ncid.
+ * @return ::NC_ENOTNC4 File format does not store chunks.
+ * @return ::NC_EINVAL Variable is not chunked.
+ * @return ::NC_EBADTYPE Variable has a variable length type.
+ * @return ::NC_EINVALCOORDS Start is not on a chunk boundary.
+ * @return ::NC_EEDGE Chunk is outside the extent of the variable.
+ * @return ::NC_EFILTER A filter was skipped when the chunk was
+ * written.
+ */
+EXTERNL int
+nc_get_var_chunk_raw(int ncid, int varid, const size_t* startp, size_t* sizep, void* data)
+{
+    int stat = NC_NOERR;
+    NC* ncp;
+
+    stat = NC_check_id(ncid,&ncp);
+    if(stat != NC_NOERR) return stat;
+    if(startp == NULL) {stat = NC_EINVALCOORDS; goto done;}
+    if((stat = ncp->dispatch->get_var_chunk_raw(ncid,varid,startp,sizep,data))) goto done;
+done:
+    return stat;
+}
+
+/**
+ * Write a chunk of a variable as it is to be stored in the file,
+ * with the variable's filters already applied, e.g. as read with
+ * nc_get_var_chunk_raw() from a variable with the same type, chunk
+ * sizes and filters. The chunk must be inside the current extent of
+ * the variable; write (with nc_put_vara()) the last element of a
+ * variable with unlimited dimensions first, to extend it.
+ *
+ * Only netCDF-4/HDF5 (with HDF5 1.10.3 or later) and NCZarr files
+ * support this.
+ *
+ * @param ncid File and group ID.
+ * @param varid Variable ID.
+ * @param startp Index of the first element of the chunk; each index
+ * must be a multiple of the chunk size in that dimension.
+ * @param size Size in bytes of the stored chunk.
+ * @param data The stored chunk.
+ *
+ * @return ::NC_NOERR No error.
+ * @return ::NC_EBADID Bad ncid.
+ * @return ::NC_EPERM File is read-only.
+ * @return ::NC_ENOTNC4 File format does not store chunks.
+ * @return ::NC_EINVAL Variable is not chunked.
+ * @return ::NC_EBADTYPE Variable has a variable length type.
+ * @return ::NC_EINVALCOORDS Start is not on a chunk boundary.
+ * @return ::NC_EEDGE Chunk is outside the extent of the variable.
+ */
+EXTERNL int
+nc_put_var_chunk_raw(int ncid, int varid, const size_t* startp, size_t size, const void* data)
+{
+    int stat = NC_NOERR;
+    NC* ncp;
+
+    stat = NC_check_id(ncid,&ncp);
+    if(stat != NC_NOERR) return stat;
+    if(startp == NULL) {stat = NC_EINVALCOORDS; goto done;}
+    if(size > 0 && data == NULL) {stat = NC_EINVAL; goto done;}
+    if((stat = ncp->dispatch->put_var_chunk_raw(ncid,varid,startp,size,data))) goto done;
+done:
+    return stat;
+}
+
 /**************************************************/
 /* Support direct user defined filters */
 
@@ -10,6 +10,7 @@
 
 #include "config.h"
 #include <stdlib.h>
+#include <ctype.h>
 #ifdef HAVE_UNISTD_H
 #include <unistd.h>
 #endif
@@ -182,6 +183,7 @@ static struct Readable {
 {NC_FORMATX_UDF0,1},
 {NC_FORMATX_UDF1,1},
 {NC_FORMATX_NCZARR,0}, /* eventually make readable */
+{NC_FORMATX_NCAGG,1},
 {0,0},
 };
 
@@ -1015,6 +1017,8 @@ NC_infermodel(const char* path, int* omodep, int iscreate, int useparallel, void
     case NC_FORMATX_DAP2:
 	omode &= ~(NC_NETCDF4|NC_64BIT_OFFSET|NC_64BIT_DATA|NC_CLASSIC_MODEL);
 	break;
+    case NC_FORMATX_NCAGG:
+	break; /* the members have their own modes */
     case NC_FORMATX_UDF0:
     case NC_FORMATX_UDF1:
         if(model->format == NC_FORMAT_64BIT_OFFSET) 
@@ -1546,6 +1550,13 @@ NC_interpret_magic_number(char* magic, NCmodel* model)
 	  goto done;
 	}
      }
+    /* An aggregation description; its format is that of its members */
+    if(memcmp(magic,NCAGG_MAGIC,strlen(NCAGG_MAGIC))==0
+       && isspace((unsigned char)magic[strlen(NCAGG_MAGIC)])) {
+	model->impl = NC_FORMATX_NCAGG;
+	model->format = NC_FORMAT_CLASSIC;
+	goto done;
+    }
      /* No match  */
      if (!tmpimpl) 
          status = NC_ENOTNC;         
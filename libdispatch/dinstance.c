@@ -25,26 +25,29 @@ Currently two operations are defined:
 #undef REPORT
 #undef DEBUG
 
-/* DAP2 and DAP4 currently defer most of their API to a substrate NC
-   that hold the true metadata. So there is a level of indirection
-   necessary in order to get to the right NC* instance.
+/* DAP2, DAP4, and aggregations currently defer most of their API to
+   a substrate NC that hold the true metadata. So there is a level of
+   indirection necessary in order to get to the right NC* instance.
 */
 
+EXTERNL NC* NCAGG_get_substrate(NC* nc);
 #if defined(ENABLE_DAP4) || defined(ENABLE_DAP2)
 EXTERNL NC* NCD4_get_substrate(NC* nc);
 EXTERNL NC* NCD2_get_substrate(NC* nc);
+#endif
 static NC*
 DAPSUBSTRATE(NC* nc)
 {
+    if(nc->dispatch->model == NC_FORMATX_NCAGG)
+        return NCAGG_get_substrate(nc);
+#if defined(ENABLE_DAP4) || defined(ENABLE_DAP2)
     if(USED2INFO(nc) != 0)
         return NCD2_get_substrate(nc);
     else if(USED4INFO(nc) != 0)
         return NCD4_get_substrate(nc);
+#endif
     return nc;
 }
-#else
-#define DAPSUBSTRATE(nc) (nc)
-#endif
 
 /* It is helpful to have a structure that contains memory and an offset */
 typedef struct Position{char* memory; ptrdiff_t offset;} Position;
@@ -537,6 +537,119 @@ Why was this here?
 
 /**************************************************/
 
+/**************************************************/
+/* Fill value replication */
+
+/* Once this many bytes of the pattern have been laid down,
+   keep copying the same block rather than doubling further,
+   so that the source of each memcpy stays in cache. */
+#define FILLBLOCKSIZE 65536
+
+/**
+\internal
+
+Store count copies of a size byte value into memory.  The first
+instance is copied in and then the filled prefix is doubled until
+it reaches FILLBLOCKSIZE, after which that block is copied
+repeatedly.  Single byte and all zero values use memset.
+
+@param memory space for count instances of size bytes
+@param value the pattern to replicate
+@param size size of the pattern in bytes
+@param count number of instances to store
+*/
+
+void
+NC_fill_replicate(void* memory, const void* value, size_t size, size_t count)
+{
+    char* dst = (char*)memory;
+    const unsigned char* src = (const unsigned char*)value;
+    size_t total, filled, n, i;
+
+    if(memory == NULL || value == NULL || size == 0 || count == 0)
+        return;
+    total = size * count;
+    for(i=1;i<size;i++) {if(src[i] != src[0]) break;}
+    if(i == size) { /* every byte of the value is the same */
+        memset(dst,src[0],total);
+        return;
+    }
+    memcpy(dst,src,size);
+    /* Double the filled prefix */
+    for(filled=size;filled < total && filled < FILLBLOCKSIZE;filled += n) {
+        n = (filled < total - filled ? filled : total - filled);
+        memcpy(dst+filled,dst,n);
+    }
+    /* Keep whole instances in each block so they stay aligned */
+    n = (filled / size) * size;
+    for(;filled < total;filled += n) {
+        if(n > total - filled) n = total - filled;
+        memcpy(dst+filled,dst,n);
+    }
+}
+
+/**
+\internal
+
+Fill a vector with count instances of fillvalue, where the
+vector is assumed to be of type xtype. Fixed size types are
+replicated with NC_fill_replicate; strings, vlens and variable
+sized compound types are deep copied with NC_copy_data.
+
+@param nc NC* structure
+@param xtype type id
+@param fillvalue ptr to one instance of the fill value
+@param count number of instances to store
+@param memory top-level space for count instances
+@return error code
+*/
+
+int
+NC_fill_data(NC* nc, nc_type xtype, const void* fillvalue, size_t count, void* memory)
+{
+    int stat = NC_NOERR;
+    size_t i, typesize = 0;
+#ifdef USE_NETCDF4
+    NC_FILE_INFO_T* file = NULL;
+    NC_TYPE_INFO_T* utype = NULL;
+#endif
+
+    if(fillvalue == NULL || count == 0)
+        goto done; /* ok, do nothing */
+
+    assert(nc != NULL);
+    assert(memory != NULL);
+
+    if(xtype < NC_STRING) {
+        typesize = NC_atomictypelen(xtype);
+    }
+#ifdef USE_NETCDF4
+    else if(xtype == NC_STRING) {
+        typesize = sizeof(char*);
+    } else {
+        assert(USEFILEINFO(nc) != 0);
+        file = (NC_FILE_INFO_T*)(nc)->dispatchdata;
+        if((stat = nc4_find_type(file,xtype,&utype))) goto done;
+        typesize = utype->size;
+        if(!utype->varsized) xtype = NC_NAT; /* mark as fixed size */
+    }
+#else
+    else {stat = NC_EBADTYPE; goto done;}
+#endif
+
+    if(xtype < NC_STRING) {
+        NC_fill_replicate(memory,fillvalue,typesize,count);
+        goto done;
+    }
+    /* Variable sized: every instance needs its own copy */
+    for(i=0;i<count;i++) {
+        if((stat = NC_copy_data(nc,xtype,fillvalue,1,((char*)memory)+(i*typesize)))) goto done;
+    }
+
+done:
+    return stat;
+}
+
 /* Internal versions of the XX_all functions */
 
 /* Alternate entry point: includes recovering the top-level memory */
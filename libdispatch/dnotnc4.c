@@ -104,6 +104,40 @@ NC_NOOP_inq_filter_avail(int ncid, unsigned id)
     return NC_ENOFILTER;
 }
 
+/**
+ * @internal Not allowed for classic model.
+ *
+ * @param ncid Ignored.
+ * @param varid Ignored.
+ * @param startp Ignored.
+ * @param sizep Ignored.
+ * @param data Ignored.
+ *
+ * @return ::NC_ENOTNC4 Not allowed.
+ */
+int
+NC_NOTNC4_get_var_chunk_raw(int ncid, int varid, const size_t *startp, size_t *sizep, void *data)
+{
+    return NC_ENOTNC4;
+}
+
+/**
+ * @internal Not allowed for classic model.
+ *
+ * @param ncid Ignored.
+ * @param varid Ignored.
+ * @param startp Ignored.
+ * @param size Ignored.
+ * @param data Ignored.
+ *
+ * @return ::NC_ENOTNC4 Not allowed.
+ */
+int
+NC_NOTNC4_put_var_chunk_raw(int ncid, int varid, const size_t *startp, size_t size, const void *data)
+{
+    return NC_ENOTNC4;
+}
+
 /**
  * @internal Not allowed for classic model.
  *
@@ -0,0 +1,99 @@
+/* Copyright 2018, UCAR/Unidata and OPeNDAP, Inc.
+   See the COPYRIGHT file for more information. */
+#include <stdlib.h>
+#include <string.h>
+
+#include "ncarena.h"
+
+#define DEFAULTBLOCKSIZE (64*1024)
+
+/* Alignment of every allocation; enough for any scalar type */
+#define ARENAALIGN 16
+#define ARENAROUND(n) (((n) + (ARENAALIGN-1)) & ~((size_t)ARENAALIGN-1))
+
+typedef struct NCarenablock {
+  struct NCarenablock* prev;
+  size_t size; /* Usable bytes in this block */
+} NCarenablock;
+
+/* Start of the usable part of a block */
+#define BLOCKDATA(b) (((char*)(b)) + ARENAROUND(sizeof(NCarenablock)))
+
+static NCarenablock*
+newblock(size_t size)
+{
+  NCarenablock* b = (NCarenablock*)malloc(ARENAROUND(sizeof(NCarenablock)) + size);
+  if(b == NULL) return NULL;
+  b->prev = NULL;
+  b->size = size;
+  return b;
+}
+
+NCarena*
+ncarenanew(size_t blocksize)
+{
+  NCarena* arena = (NCarena*)calloc(1,sizeof(NCarena));
+  if(arena == NULL) return NULL;
+  arena->blocksize = (blocksize == 0 ? DEFAULTBLOCKSIZE : ARENAROUND(blocksize));
+  return arena;
+}
+
+void
+ncarenafree(NCarena* arena)
+{
+  NCarenablock* b;
+  if(arena == NULL) return;
+  b = arena->blocks;
+  while(b != NULL) {
+    NCarenablock* prev = b->prev;
+    free(b);
+    b = prev;
+  }
+  free(arena);
+}
+
+void*
+ncarenaalloc(NCarena* arena, size_t size)
+{
+  NCarenablock* b;
+  void* p;
+
+  if(arena == NULL) return NULL;
+  size = ARENAROUND(size == 0 ? 1 : size);
+  if(size > arena->blocksize / 4) {
+    /* Large objects get a block of their own, which is chained
+       behind the current block so the current block stays in use. */
+    if((b = newblock(size)) == NULL) return NULL;
+    if(arena->blocks == NULL) {
+      arena->blocks = b;
+      arena->used = size;
+    } else {
+      b->prev = arena->blocks->prev;
+      arena->blocks->prev = b;
+    }
+    p = BLOCKDATA(b);
+  } else {
+    if(arena->blocks == NULL || arena->blocks->size - arena->used < size) {
+      if((b = newblock(arena->blocksize)) == NULL) return NULL;
+      b->prev = arena->blocks;
+      arena->blocks = b;
+      arena->used = 0;
+    }
+    p = BLOCKDATA(arena->blocks) + arena->used;
+    arena->used += size;
+  }
+  memset(p,0,size);
+  return p;
+}
+
+char*
+ncarenastrdup(NCarena* arena, const char* s)
+{
+  size_t len;
+  char* dup;
+  if(s == NULL) return NULL;
+  len = strlen(s);
+  if((dup = (char*)ncarenaalloc(arena,len+1)) == NULL) return NULL;
+  memcpy(dup,s,len+1);
+  return dup;
+}
@@ -112,6 +112,9 @@ static const NC_Dispatch HDF4_dispatcher = {
     NC_NOTNC4_inq_var_quantize,
 
     NC_NOOP_inq_filter_avail,
+
+    NC_NOTNC4_get_var_chunk_raw,
+    NC_NOTNC4_put_var_chunk_raw,
 };
 
 const NC_Dispatch *HDF4_dispatch_table = NULL;
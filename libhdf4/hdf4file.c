@@ -308,7 +308,8 @@ hdf4_read_att(NC_FILE_INFO_T *h5, NC_VAR_INFO_T *var, int a)
         return retval;
 
     /* Add to the end of the list of atts for this var. */
-    if ((retval = nc4_att_list_add(att_list, name, &att)))
+    if ((retval = nc4_att_list_add(att_list, (var ? (NC_OBJ *)var : (NC_OBJ *)h5->root_grp),
+                                   name, &att)))
         return retval;
     att->nc_typeid = xtype;
     att->created = NC_TRUE;
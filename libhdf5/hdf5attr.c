@@ -201,6 +201,11 @@ NC4_HDF5_rename_att(int ncid, int varid, const char *name, const char *newname)
     if (!att)
         return NC_ENOTATT;
 
+    /* The value must be in memory, since it will be rewritten under
+     * the new name. */
+    if ((retval = nc4_hdf5_read_att_data(att)))
+        return retval;
+
     /* If we're not in define mode, new name must be of equal or
        less size, if complying with strict NC3 rules. */
     if (!(h5->flags & NC_INDEF) && strlen(norm_newname) > strlen(att->hdr.name) &&
@@ -227,9 +232,8 @@ NC4_HDF5_rename_att(int ncid, int varid, const char *name, const char *newname)
     }
 
     /* Copy the new name into our metadata. */
-    if(att->hdr.name) free(att->hdr.name);
-    if (!(att->hdr.name = strdup(norm_newname)))
-        return NC_ENOMEM;
+    if ((retval = nc4_rename_obj(h5, (NC_OBJ *)att, norm_newname)))
+        return retval;
 
     att->dirty = NC_TRUE;
 
@@ -496,6 +500,11 @@ nc4_put_att(NC_GRP_INFO_T* grp, int varid, const char *name, nc_type file_type,
     }
     else
     {
+        /* Read the old value, if it is still in the file, so that it
+         * can be restored if the put fails. */
+        if ((retval = nc4_hdf5_read_att_data(att)))
+            BAIL(retval);
+
         /* For an existing att, if we're not in define mode, the len
            must not be greater than the existing len for classic model. */
         if (!(h5->flags & NC_INDEF) &&
@@ -528,17 +537,13 @@ nc4_put_att(NC_GRP_INFO_T* grp, int varid, const char *name, nc_type file_type,
     if (new_att)
     {
         LOG((3, "adding attribute %s to the list...", norm_name));
-        if ((ret = nc4_att_list_add(attlist, norm_name, &att)))
+        if ((ret = nc4_att_list_add(attlist, (varid == NC_GLOBAL ? (NC_OBJ*)grp : (NC_OBJ*)var),
+                                    norm_name, &att)))
             BAIL(ret);
 
         /* Allocate storage for the HDF5 specific att info. */
         if (!(att->format_att_info = calloc(1, sizeof(NC_HDF5_ATT_INFO_T))))
             BAIL(NC_ENOMEM);
-
-	if(varid == NC_GLOBAL)
-	    att->container = (NC_OBJ*)grp;
-	else
-	    att->container = (NC_OBJ*)var;
     }
 
     /* Now fill in the metadata. */
@@ -883,6 +888,7 @@ NC4_HDF5_get_att(int ncid, int varid, const char *name, void *value,
     NC_FILE_INFO_T *h5;
     NC_GRP_INFO_T *grp;
     NC_VAR_INFO_T *var = NULL;
+    NC_ATT_INFO_T *att;
     char norm_name[NC_MAX_NAME + 1];
     int retval;
 
@@ -903,6 +909,21 @@ NC4_HDF5_get_att(int ncid, int varid, const char *name, void *value,
                                        value);
     }
 
-    return nc4_get_att_ptrs(h5, grp, var, norm_name, NULL, memtype,
-                            NULL, NULL, value);
+    /* Read the value from the file, if this is its first use. */
+    att = (NC_ATT_INFO_T *)ncindexlookup(var ? var->att : grp->att, norm_name);
+    if (att && value)
+        if ((retval = nc4_hdf5_read_att_data(att)))
+            return retval;
+
+    retval = nc4_get_att_ptrs(h5, grp, var, norm_name, NULL, memtype,
+                              NULL, NULL, value);
+
+    /* Don't hold on to big values. */
+    if (att && value)
+    {
+        int stat;
+        if ((stat = nc4_hdf5_evict_att_data(h5, att)) && !retval)
+            retval = stat;
+    }
+    return retval;
 }
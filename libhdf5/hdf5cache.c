@@ -0,0 +1,208 @@
+/* Copyright 2018, University Corporation for Atmospheric
+ * Research. See COPYRIGHT file for copying and redistribution
+ * conditions. */
+/**
+ * @file
+ * @internal The chunk cache budget shared by the vars of a
+ * netCDF-4/HDF5 file, set up with nc_set_chunk_cache_budget().
+ *
+ * HDF5 keeps a chunk cache for each open dataset, whose size is fixed
+ * when the dataset is opened. The vars whose data have been read or
+ * written are kept on a list in least recently used order, each with
+ * the cache size (the grant) its dataset was opened with. When a var
+ * is used it is granted its own cache size (see
+ * nc_set_var_chunk_cache()), as far as the budget allows. To make
+ * room, the least recently used vars are shrunk: vars that have not
+ * been used during the last round of uses of all listed vars down to
+ * the minimum, the others down to a fair share of the budget. A
+ * dataset is reopened to change its grant, which drops the chunks in
+ * its cache.
+ */
+
+#include "config.h"
+#include "hdf5internal.h"
+
+/** Get the HDF5-specific info of a var. */
+#define HDF5_VAR(v) ((NC_HDF5_VAR_INFO_T *)(v)->format_var_info)
+
+/**
+ * @internal Take a var off the cache list.
+ *
+ * @param hdf5_info Pointer to HDF5 file info.
+ * @param var Pointer to var info.
+ */
+static void
+cache_unlink(NC_HDF5_FILE_INFO_T *hdf5_info, NC_VAR_INFO_T *var)
+{
+    NC_HDF5_VAR_INFO_T *hdf5_var = HDF5_VAR(var);
+
+    if (hdf5_var->cache_prev)
+        HDF5_VAR(hdf5_var->cache_prev)->cache_next = hdf5_var->cache_next;
+    else
+        hdf5_info->cache_head = hdf5_var->cache_next;
+    if (hdf5_var->cache_next)
+        HDF5_VAR(hdf5_var->cache_next)->cache_prev = hdf5_var->cache_prev;
+    else
+        hdf5_info->cache_tail = hdf5_var->cache_prev;
+    hdf5_var->cache_prev = hdf5_var->cache_next = NULL;
+    hdf5_var->in_cache = NC_FALSE;
+    hdf5_info->cache_count--;
+}
+
+/**
+ * @internal Put a var at the head of the cache list.
+ *
+ * @param hdf5_info Pointer to HDF5 file info.
+ * @param var Pointer to var info.
+ */
+static void
+cache_push(NC_HDF5_FILE_INFO_T *hdf5_info, NC_VAR_INFO_T *var)
+{
+    NC_HDF5_VAR_INFO_T *hdf5_var = HDF5_VAR(var);
+
+    hdf5_var->cache_prev = NULL;
+    hdf5_var->cache_next = hdf5_info->cache_head;
+    if (hdf5_info->cache_head)
+        HDF5_VAR(hdf5_info->cache_head)->cache_prev = var;
+    hdf5_info->cache_head = var;
+    if (!hdf5_info->cache_tail)
+        hdf5_info->cache_tail = var;
+    hdf5_var->in_cache = NC_TRUE;
+    hdf5_info->cache_count++;
+}
+
+/**
+ * @internal Change the grant of a var on the cache list, and reopen
+ * its dataset with the new chunk cache size.
+ *
+ * @param hdf5_info Pointer to HDF5 file info.
+ * @param var Pointer to var info.
+ * @param grant New chunk cache size.
+ *
+ * @return ::NC_NOERR No error.
+ * @return ::NC_EHDFERR HDF5 error.
+ */
+static int
+cache_regrant(NC_HDF5_FILE_INFO_T *hdf5_info, NC_VAR_INFO_T *var, size_t grant)
+{
+    NC_HDF5_VAR_INFO_T *hdf5_var = HDF5_VAR(var);
+
+    LOG((4, "%s: var %s chunk cache %ld -> %ld", __func__, var->hdr.name,
+         (long)hdf5_var->cache_grant, (long)grant));
+    hdf5_info->cache_used -= hdf5_var->cache_grant;
+    hdf5_var->cache_grant = grant;
+    hdf5_info->cache_used += grant;
+    return nc4_reopen_dataset(var->container, var);
+}
+
+/**
+ * @internal Get the chunk cache size to open the dataset of a var
+ * with: its grant, if it is on the cache list, else its own chunk
+ * cache size.
+ *
+ * @param var Pointer to var info.
+ *
+ * @return Chunk cache size in bytes.
+ */
+size_t
+nc4_hdf5_cache_size(NC_VAR_INFO_T *var)
+{
+    NC_HDF5_VAR_INFO_T *hdf5_var = HDF5_VAR(var);
+    return hdf5_var->in_cache ? hdf5_var->cache_grant : var->chunkcache.size;
+}
+
+/**
+ * @internal Note the use of the data of a var, and grant it as much
+ * of the file's chunk cache budget as it wants and the budget
+ * allows, shrinking the chunk caches of other vars to make room. Does
+ * nothing if the file has no budget, is open for parallel I/O, or the
+ * var is not chunked or its dataset is not open.
+ *
+ * @param h5 Pointer to file info.
+ * @param var Pointer to var info.
+ *
+ * @return ::NC_NOERR No error.
+ * @return ::NC_EHDFERR HDF5 error.
+ */
+int
+nc4_hdf5_cache_touch(NC_FILE_INFO_T *h5, NC_VAR_INFO_T *var)
+{
+    NC_HDF5_FILE_INFO_T *hdf5_info = (NC_HDF5_FILE_INFO_T *)h5->format_file_info;
+    NC_HDF5_VAR_INFO_T *hdf5_var = HDF5_VAR(var);
+    NC_VAR_INFO_T *v, *prev;
+    size_t want = var->chunkcache.size;
+    size_t fair, others, room, grant;
+    int retval;
+
+    if (!hdf5_info->cache_budget || h5->parallel || var->storage != NC_CHUNKED ||
+        !hdf5_var->hdf_datasetid)
+        return NC_NOERR;
+
+    if (hdf5_var->in_cache)
+        cache_unlink(hdf5_info, var);
+    else
+    {
+        /* The dataset was opened with the var's own cache size. */
+        hdf5_var->cache_grant = var->chunkcache.size;
+        hdf5_info->cache_used += hdf5_var->cache_grant;
+    }
+    cache_push(hdf5_info, var);
+    hdf5_var->cache_tick = ++hdf5_info->cache_clock;
+
+    fair = hdf5_info->cache_budget / hdf5_info->cache_count;
+    if (fair < hdf5_info->cache_minimum)
+        fair = hdf5_info->cache_minimum;
+
+    /* Shrink the least recently used vars until this one fits. */
+    for (v = hdf5_info->cache_tail; v != var; v = prev)
+    {
+        NC_HDF5_VAR_INFO_T *victim = HDF5_VAR(v);
+        size_t need, floor;
+
+        prev = victim->cache_prev;
+        if (hdf5_info->cache_used - hdf5_var->cache_grant + want <= hdf5_info->cache_budget)
+            break;
+        need = hdf5_info->cache_used - hdf5_var->cache_grant + want - hdf5_info->cache_budget;
+        if (hdf5_info->cache_clock - victim->cache_tick > hdf5_info->cache_count)
+            floor = hdf5_info->cache_minimum;
+        else
+            floor = fair;
+        if (victim->cache_grant <= floor)
+            continue;
+        if ((retval = cache_regrant(hdf5_info, v, victim->cache_grant - floor > need ?
+                                    victim->cache_grant - need : floor)))
+            return retval;
+    }
+
+    /* Grant this var what it wants, as far as the budget allows. */
+    others = hdf5_info->cache_used - hdf5_var->cache_grant;
+    room = hdf5_info->cache_budget > others ? hdf5_info->cache_budget - others : 0;
+    if (room < hdf5_info->cache_minimum)
+        room = hdf5_info->cache_minimum;
+    grant = want < room ? want : room;
+    if (grant != hdf5_var->cache_grant)
+        if ((retval = cache_regrant(hdf5_info, var, grant)))
+            return retval;
+
+    return NC_NOERR;
+}
+
+/**
+ * @internal Take a var whose dataset is closed off the cache list,
+ * giving its grant back to the budget.
+ *
+ * @param h5 Pointer to file info.
+ * @param var Pointer to var info.
+ */
+void
+nc4_hdf5_cache_release(NC_FILE_INFO_T *h5, NC_VAR_INFO_T *var)
+{
+    NC_HDF5_FILE_INFO_T *hdf5_info = (NC_HDF5_FILE_INFO_T *)h5->format_file_info;
+    NC_HDF5_VAR_INFO_T *hdf5_var = HDF5_VAR(var);
+
+    if (!hdf5_var->in_cache)
+        return;
+    cache_unlink(hdf5_info, var);
+    hdf5_info->cache_used -= hdf5_var->cache_grant;
+    hdf5_var->cache_grant = 0;
+}
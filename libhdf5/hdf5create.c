@@ -159,6 +159,10 @@ nc4_create_file(const char *path, int cmode, size_t initialsz,
 	LOG((4, "%s: set HDF raw chunk cache to size %d nelems %d preemption %f",
 	     __func__, gs->chunkcache.size, gs->chunkcache.nelems,
 	     gs->chunkcache.preemption));
+
+	/* The chunk caches of all vars share this budget. */
+	hdf5_info->cache_budget = gs->chunkcachebudget.size;
+	hdf5_info->cache_minimum = gs->chunkcachebudget.minimum;
     }
 
     {
@@ -267,9 +267,8 @@ HDF5_rename_dim(int ncid, int dimid, const char *name)
     /* Give the dimension its new name in metadata. UTF8 normalization
      * has been done. */
     assert(dim->hdr.name);
-    free(dim->hdr.name);
-    if (!(dim->hdr.name = strdup(norm_name)))
-        return NC_ENOMEM;
+    if ((retval = nc4_rename_obj(h5, (NC_OBJ *)dim, norm_name)))
+        return retval;
     LOG((3, "dim is now named %s", dim->hdr.name));
 
     /* rebuild index. */
@@ -110,6 +110,9 @@ static const NC_Dispatch HDF5_dispatcher = {
     NC4_inq_var_quantize,
     
     NC4_hdf5_inq_filter_avail,
+
+    NC4_hdf5_get_var_chunk_raw,
+    NC4_hdf5_put_var_chunk_raw,
 };
 
 const NC_Dispatch* HDF5_dispatch_table = NULL; /* moved here from ddispatch.c */
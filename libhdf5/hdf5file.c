@@ -302,6 +302,11 @@ nc4_close_hdf5_file(NC_FILE_INFO_T *h5, int abort,  NC_memio *memio)
         if ((retval = sync_netcdf4_file(h5)))
             return retval;
 
+    /* Save the metadata index for the next open, if it was asked
+     * for. Failure to write it is not an error. */
+    if (!abort)
+        (void)NC4_hdf5_write_index(h5);
+
     /* Close all open HDF5 objects within the file. */
     if ((retval = nc4_rec_grp_HDF5_del(h5->root_grp)))
         return retval;
@@ -0,0 +1,754 @@
+/* Copyright 2018, University Corporation for Atmospheric
+ * Research. See COPYRIGHT file for copying and redistribution
+ * conditions. */
+/**
+ * @file
+ * @internal Persistent metadata index for netCDF-4/HDF5 files.
+ *
+ * Opening a netCDF-4 file normally iterates over every HDF5 object in
+ * the file to rebuild the group/dim/var tree. When the rc key
+ * HDF5.METADATA_INDEX is set to a true value, a read-only open first
+ * looks for a sidecar file named <path>.ncidx. If the sidecar matches
+ * the size, inode, modification and change times, HDF5 end of
+ * allocation and leading bytes of the HDF5 file, the group/dim/var
+ * tree is built straight from it and no HDF5 object is opened until it
+ * is used, just as with NC_LAZYOPEN. If there is no valid sidecar, or
+ * it does not describe the objects in the file, the file is opened as
+ * usual and the sidecar is written when the file is closed.
+ *
+ * Only files whose variables all have atomic types and carry the
+ * hidden coordinates attribute (i.e. files written by netCDF-4) are
+ * indexed; attributes are not stored in the index, but are read
+ * lazily from the HDF5 file.
+ *
+ * The sidecar is a fixed header followed by a payload:
+ *
+ * header: magic[8] version(u32) byteorder(u32) filesize(u64)
+ *         mtime(u64) mtimensec(u32) headcrc(u32) ctime(u64)
+ *         ctimensec(u32) reserved(u32) inode(u64) eoa(u64)
+ *         payloadlen(u64) payloadcrc(u64)
+ *
+ * group:  name ndims {name id(i32) len(u64) unlimited(u8) too_long(u8)}*
+ *         nvars {name hdf5name xtype(i32) endianness(i32)
+ *                dimscale(u8) ndims(u32) dimid(i32)*}*
+ *         nchildren group*
+ *
+ * Strings are a u32 length followed by the bytes, counts are u32, and
+ * all values are in native byte order; an index written on a machine
+ * with a different byte order is ignored. The nanoseconds of the
+ * times are 0 where struct stat lacks st_mtim and st_ctim, and the end
+ * of allocation is 0 with HDF5 before 1.10.2.
+ */
+
+#include "config.h"
+#include <stdio.h>
+#include <sys/stat.h>
+#include "hdf5internal.h"
+#include "ncrc.h"
+#include "nccrc.h"
+#include "ncbytes.h"
+#include "ncpathmgr.h"
+
+#define NCIDX_EXT ".ncidx"
+#define NCIDX_MAGIC "NC4INDEX"
+#define NCIDX_VERSION 2
+#define NCIDX_BYTEORDER 0x01020304
+#define NCIDX_HEADSIZE 4096 /* Bytes at the start of the file covered by headcrc */
+#define NCIDX_RCKEY "HDF5.METADATA_INDEX"
+#define NCIDX_CRCSTEP 1073741824 /* Most bytes passed to NC_crc64 at once */
+
+/** @internal Fixed size header of the index file. */
+typedef struct NCindexheader {
+    char magic[8];
+    unsigned int version;
+    unsigned int byteorder;
+    unsigned long long filesize;
+    unsigned long long mtime;
+    unsigned int mtimensec;
+    unsigned int headcrc;
+    unsigned long long ctime;
+    unsigned int ctimensec;
+    unsigned int reserved;
+    unsigned long long inode;
+    unsigned long long eoa;
+    unsigned long long payloadlen;
+    unsigned long long payloadcrc;
+} NCindexheader;
+
+/** @internal Cursor over the index payload. */
+typedef struct NCindexreader {
+    const char *pos;
+    const char *end;
+} NCindexreader;
+
+/**************************************************/
+/* Utilities */
+
+/** @internal CRC-64 of any number of bytes. */
+static unsigned long long
+index_crc64(const char *buf, size_t nbytes)
+{
+    unsigned long long crc = 0;
+    while (nbytes > 0)
+    {
+        size_t n = nbytes < NCIDX_CRCSTEP ? nbytes : NCIDX_CRCSTEP;
+        crc = NC_crc64(crc, (void *)buf, (unsigned int)n);
+        buf += n;
+        nbytes -= n;
+    }
+    return crc;
+}
+
+/**
+ * @internal Is the metadata index enabled for this file?  Only
+ * read-only, non-parallel opens of local files use it.
+ *
+ * @param h5 Pointer to file info.
+ *
+ * @return 1 if enabled, 0 otherwise.
+ */
+static int
+index_enabled(NC_FILE_INFO_T *h5)
+{
+    NC_HDF5_FILE_INFO_T *hdf5_info = (NC_HDF5_FILE_INFO_T *)h5->format_file_info;
+    const char *value;
+
+    if (!h5->no_write || h5->parallel || h5->mem.inmemory || h5->mem.diskless)
+        return 0;
+    if (hdf5_info->uri != NULL)
+        return 0;
+    if ((value = NC_rclookup(NCIDX_RCKEY, NULL, NULL)) == NULL)
+        return 0;
+    return (strcmp(value, "1") == 0 || strcasecmp(value, "true") == 0 ||
+            strcasecmp(value, "yes") == 0 || strcasecmp(value, "on") == 0);
+}
+
+/**
+ * @internal Compute the validation fields of the index header for
+ * the open HDF5 file at path: its size, inode, modification and change
+ * times, the HDF5 end of allocation and a crc32 of its first
+ * NCIDX_HEADSIZE bytes (which hold the superblock). The change time
+ * cannot be set back, so a file rewritten within the same second as
+ * the index, or with its modification time restored, is still seen
+ * to be changed.
+ *
+ * @param h5 Pointer to file info.
+ * @param path Path of the HDF5 file.
+ * @param hdr Pointer to header that gets the fields.
+ *
+ * @return ::NC_NOERR No error.
+ * @return ::NC_EACCESS File could not be read.
+ * @return ::NC_EHDFERR HDF5 error.
+ */
+static int
+file_signature(NC_FILE_INFO_T *h5, const char *path, NCindexheader *hdr)
+{
+    struct stat buf;
+    char head[NCIDX_HEADSIZE];
+    size_t n;
+    FILE *f;
+
+    if (NCstat(path, &buf) < 0)
+        return NC_EACCESS;
+    if ((f = NCfopen(path, "rb")) == NULL)
+        return NC_EACCESS;
+    n = fread(head, 1, sizeof(head), f);
+    fclose(f);
+    hdr->filesize = (unsigned long long)buf.st_size;
+    hdr->mtime = (unsigned long long)buf.st_mtime;
+    hdr->ctime = (unsigned long long)buf.st_ctime;
+    hdr->inode = (unsigned long long)buf.st_ino;
+#ifdef HAVE_STRUCT_STAT_ST_MTIM_TV_NSEC
+    hdr->mtimensec = (unsigned int)buf.st_mtim.tv_nsec;
+    hdr->ctimensec = (unsigned int)buf.st_ctim.tv_nsec;
+#else
+    hdr->mtimensec = 0;
+    hdr->ctimensec = 0;
+#endif
+    hdr->headcrc = NC_crc32(0, head, (unsigned int)n);
+    hdr->eoa = 0;
+#if H5_VERSION_GE(1,10,2)
+    {
+        NC_HDF5_FILE_INFO_T *hdf5_info = (NC_HDF5_FILE_INFO_T *)h5->format_file_info;
+        haddr_t eoa;
+        if (H5Fget_eoa(hdf5_info->hdfid, &eoa) < 0)
+            return NC_EHDFERR;
+        hdr->eoa = (unsigned long long)eoa;
+    }
+#endif
+    return NC_NOERR;
+}
+
+/**
+ * @internal Build the name of the index file for path.
+ *
+ * @param path Path of the HDF5 file.
+ *
+ * @return The malloc'd name, or NULL if out of memory.
+ */
+static char *
+index_path(const char *path)
+{
+    size_t len = strlen(path) + strlen(NCIDX_EXT) + 1;
+    char *ipath;
+
+    if ((ipath = malloc(len)) == NULL)
+        return NULL;
+    snprintf(ipath, len, "%s%s", path, NCIDX_EXT);
+    return ipath;
+}
+
+/**************************************************/
+/* Writing */
+
+/* ncbytesappendn() grows the buffer only by what is appended, so
+ * grow it geometrically here to keep writing the index linear. */
+static void
+put_bytes(NCbytes *buf, const void *v, size_t n)
+{
+    if (!ncbytesavail(buf, n))
+        ncbytessetalloc(buf, 2 * ncbytesalloc(buf) + n);
+    ncbytesappendn(buf, v, n);
+}
+
+static void
+put_u8(NCbytes *buf, unsigned char v)
+{
+    put_bytes(buf, &v, sizeof(v));
+}
+
+static void
+put_u32(NCbytes *buf, unsigned int v)
+{
+    put_bytes(buf, &v, sizeof(v));
+}
+
+static void
+put_i32(NCbytes *buf, int v)
+{
+    put_bytes(buf, &v, sizeof(v));
+}
+
+static void
+put_u64(NCbytes *buf, unsigned long long v)
+{
+    put_bytes(buf, &v, sizeof(v));
+}
+
+static void
+put_str(NCbytes *buf, const char *s)
+{
+    size_t len = (s ? strlen(s) : 0);
+    put_u32(buf, (unsigned int)len);
+    if (len)
+        put_bytes(buf, s, len);
+}
+
+/**
+ * @internal Can this group and its children be described by the
+ * index?
+ *
+ * @param grp Pointer to group info.
+ *
+ * @return 1 if so, 0 otherwise.
+ */
+static int
+grp_indexable(NC_GRP_INFO_T *grp)
+{
+    size_t i;
+
+    if (ncindexsize(grp->type) > 0)
+        return 0;
+    for (i = 0; i < ncindexsize(grp->vars); i++)
+    {
+        NC_VAR_INFO_T *var = (NC_VAR_INFO_T *)ncindexith(grp->vars, i);
+        NC_HDF5_VAR_INFO_T *hdf5_var = (NC_HDF5_VAR_INFO_T *)var->format_var_info;
+        if (var->type_info == NULL || var->type_info->hdr.id > NC_MAX_ATOMIC_TYPE)
+            return 0;
+        if (var->ndims && !var->coords_read && !hdf5_var->dimscale)
+            return 0;
+    }
+    for (i = 0; i < ncindexsize(grp->children); i++)
+        if (!grp_indexable((NC_GRP_INFO_T *)ncindexith(grp->children, i)))
+            return 0;
+    return 1;
+}
+
+/**
+ * @internal Append the description of a group and its children to
+ * the index payload.
+ *
+ * @param grp Pointer to group info.
+ * @param buf Buffer that gets the payload.
+ */
+static void
+put_grp(NC_GRP_INFO_T *grp, NCbytes *buf)
+{
+    size_t i;
+    int d;
+
+    put_str(buf, grp->hdr.name);
+    put_u32(buf, (unsigned int)ncindexsize(grp->dim));
+    for (i = 0; i < ncindexsize(grp->dim); i++)
+    {
+        NC_DIM_INFO_T *dim = (NC_DIM_INFO_T *)ncindexith(grp->dim, i);
+        put_str(buf, dim->hdr.name);
+        put_i32(buf, (int)dim->hdr.id);
+        put_u64(buf, (unsigned long long)dim->len);
+        put_u8(buf, (unsigned char)(dim->unlimited ? 1 : 0));
+        put_u8(buf, (unsigned char)(dim->too_long ? 1 : 0));
+    }
+    put_u32(buf, (unsigned int)ncindexsize(grp->vars));
+    for (i = 0; i < ncindexsize(grp->vars); i++)
+    {
+        NC_VAR_INFO_T *var = (NC_VAR_INFO_T *)ncindexith(grp->vars, i);
+        NC_HDF5_VAR_INFO_T *hdf5_var = (NC_HDF5_VAR_INFO_T *)var->format_var_info;
+        put_str(buf, var->hdr.name);
+        put_str(buf, var->alt_name);
+        put_i32(buf, (int)var->type_info->hdr.id);
+        put_i32(buf, var->type_info->endianness);
+        put_u8(buf, (unsigned char)(hdf5_var->dimscale ? 1 : 0));
+        put_u32(buf, (unsigned int)var->ndims);
+        for (d = 0; d < (int)var->ndims; d++)
+            put_i32(buf, var->dimids[d]);
+    }
+    put_u32(buf, (unsigned int)ncindexsize(grp->children));
+    for (i = 0; i < ncindexsize(grp->children); i++)
+        put_grp((NC_GRP_INFO_T *)ncindexith(grp->children, i), buf);
+}
+
+/**
+ * @internal Write the metadata index of a file, if it was requested
+ * when the file was opened. The index is written to a temporary file
+ * which is then renamed, so readers never see a partial index.
+ * Failure to write the index is not an error for the caller.
+ *
+ * @param h5 Pointer to file info.
+ *
+ * @return ::NC_NOERR No error.
+ * @return ::NC_ENOMEM Out of memory.
+ * @return ::NC_EACCESS Index could not be written.
+ */
+int
+NC4_hdf5_write_index(NC_FILE_INFO_T *h5)
+{
+    NC_HDF5_FILE_INFO_T *hdf5_info = (NC_HDF5_FILE_INFO_T *)h5->format_file_info;
+    const char *path = h5->controller->path;
+    NCindexheader hdr;
+    NCbytes *payload = NULL;
+    char *ipath = NULL, *tmppath = NULL;
+    FILE *f = NULL;
+    int stat = NC_NOERR;
+
+    if (!hdf5_info->write_index)
+        goto done;
+    if (!grp_indexable(h5->root_grp))
+        goto done;
+
+    memset(&hdr, 0, sizeof(hdr));
+    memcpy(hdr.magic, NCIDX_MAGIC, sizeof(hdr.magic));
+    hdr.version = NCIDX_VERSION;
+    hdr.byteorder = NCIDX_BYTEORDER;
+    if ((stat = file_signature(h5, path, &hdr)))
+        goto done;
+
+    if ((payload = ncbytesnew()) == NULL)
+        {stat = NC_ENOMEM; goto done;}
+    put_grp(h5->root_grp, payload);
+    hdr.payloadlen = ncbyteslength(payload);
+    hdr.payloadcrc = index_crc64(ncbytescontents(payload), ncbyteslength(payload));
+
+    if ((ipath = index_path(path)) == NULL || (tmppath = index_path(ipath)) == NULL)
+        {stat = NC_ENOMEM; goto done;}
+    if ((f = NCfopen(tmppath, "wb")) == NULL)
+        {stat = NC_EACCESS; goto done;}
+    if (fwrite(&hdr, sizeof(hdr), 1, f) != 1 ||
+        fwrite(ncbytescontents(payload), 1, ncbyteslength(payload), f) != ncbyteslength(payload))
+        stat = NC_EACCESS;
+    if (fclose(f) != 0)
+        stat = NC_EACCESS;
+    f = NULL;
+    if (stat == NC_NOERR && rename(tmppath, ipath) != 0)
+        stat = NC_EACCESS;
+    if (stat)
+        (void)NCremove(tmppath);
+
+done:
+    ncbytesfree(payload);
+    nullfree(ipath);
+    nullfree(tmppath);
+    return stat;
+}
+
+/**************************************************/
+/* Reading */
+
+static int
+get_bytes(NCindexreader *rd, void *v, size_t len)
+{
+    if ((size_t)(rd->end - rd->pos) < len)
+        return NC_EINVAL;
+    memcpy(v, rd->pos, len);
+    rd->pos += len;
+    return NC_NOERR;
+}
+
+static int
+get_str(NCindexreader *rd, char **sp)
+{
+    unsigned int len;
+    int stat;
+
+    *sp = NULL;
+    if ((stat = get_bytes(rd, &len, sizeof(len))))
+        return stat;
+    if (len == 0)
+        return NC_NOERR;
+    if (len > NC_MAX_HDF5_NAME || (size_t)(rd->end - rd->pos) < len)
+        return NC_EINVAL;
+    if ((*sp = malloc(len + 1)) == NULL)
+        return NC_ENOMEM;
+    memcpy(*sp, rd->pos, len);
+    (*sp)[len] = '\0';
+    rd->pos += len;
+    return NC_NOERR;
+}
+
+/**
+ * @internal Create the type info of an atomic type for a var read
+ * from the index. The HDF5 type ids are filled in by
+ * nc4_get_var_meta() when the dataset is opened.
+ *
+ * @param xtype The atomic type.
+ * @param endianness Endianness of the type in the file.
+ * @param typep Pointer that gets the type info.
+ *
+ * @return ::NC_NOERR No error.
+ * @return ::NC_EBADTYPE Not an atomic type.
+ * @return ::NC_ENOMEM Out of memory.
+ */
+static int
+index_type_info(nc_type xtype, int endianness, NC_TYPE_INFO_T **typep)
+{
+    NC_TYPE_INFO_T *type;
+    char name[NC_MAX_NAME + 1];
+    size_t size;
+    int stat;
+
+    if (xtype <= NC_NAT || xtype > NC_MAX_ATOMIC_TYPE)
+        return NC_EBADTYPE;
+    if ((stat = NC4_inq_atomic_type(xtype, name, &size)))
+        return stat;
+    if (!(type = calloc(1, sizeof(NC_TYPE_INFO_T))))
+        return NC_ENOMEM;
+    if (!(type->format_type_info = calloc(1, sizeof(NC_HDF5_TYPE_INFO_T))) ||
+        !(type->hdr.name = strdup(name)))
+    {
+        nullfree(type->format_type_info);
+        free(type);
+        return NC_ENOMEM;
+    }
+    type->hdr.id = (size_t)xtype;
+    type->size = size;
+    type->endianness = endianness;
+    if ((stat = nc4_get_typeclass(NULL, xtype, &type->nc_type_class)))
+    {
+        free(type->hdr.name);
+        free(type->format_type_info);
+        free(type);
+        return stat;
+    }
+    if (xtype == NC_STRING)
+        NC4_set_varsize(type);
+    *typep = type;
+    return NC_NOERR;
+}
+
+/**
+ * @internal Rebuild a group and its children from the index. The
+ * HDF5 group is opened, but its datasets are left closed.
+ *
+ * @param grp Pointer to the group info, already added to the file.
+ * @param rd Cursor over the index payload.
+ *
+ * @return ::NC_NOERR No error.
+ * @return ::NC_EINVAL Malformed index.
+ * @return ::NC_ENOMEM Out of memory.
+ * @return ::NC_EHDFERR HDF5 error.
+ */
+static int
+get_grp(NC_GRP_INFO_T *grp, NCindexreader *rd)
+{
+    NC_HDF5_GRP_INFO_T *hdf5_grp = (NC_HDF5_GRP_INFO_T *)grp->format_grp_info;
+    NC_FILE_INFO_T *h5 = grp->nc4_info;
+    unsigned int n, i, nd;
+    char *name = NULL;
+    int stat = NC_NOERR;
+
+    /* Open the HDF5 group; it remains open until nc_close. */
+    if (grp->parent)
+    {
+        NC_HDF5_GRP_INFO_T *parent_hdf5_grp;
+        parent_hdf5_grp = (NC_HDF5_GRP_INFO_T *)grp->parent->format_grp_info;
+        if ((hdf5_grp->hdf_grpid = H5Gopen2(parent_hdf5_grp->hdf_grpid,
+                                            grp->hdr.name, H5P_DEFAULT)) < 0)
+            {stat = NC_EHDFERR; goto done;}
+    }
+    else
+    {
+        NC_HDF5_FILE_INFO_T *hdf5_info = (NC_HDF5_FILE_INFO_T *)h5->format_file_info;
+        if ((hdf5_grp->hdf_grpid = H5Gopen2(hdf5_info->hdfid, "/", H5P_DEFAULT)) < 0)
+            {stat = NC_EHDFERR; goto done;}
+    }
+
+    /* Dimensions */
+    if ((stat = get_bytes(rd, &n, sizeof(n)))) goto done;
+    for (i = 0; i < n; i++)
+    {
+        NC_DIM_INFO_T *dim;
+        unsigned long long len;
+        unsigned char unlimited, too_long;
+        int id;
+
+        if ((stat = get_str(rd, &name))) goto done;
+        if ((stat = get_bytes(rd, &id, sizeof(id)))) goto done;
+        if ((stat = get_bytes(rd, &len, sizeof(len)))) goto done;
+        if ((stat = get_bytes(rd, &unlimited, sizeof(unlimited)))) goto done;
+        if ((stat = get_bytes(rd, &too_long, sizeof(too_long)))) goto done;
+        if (name == NULL || id < 0) {stat = NC_EINVAL; goto done;}
+        if (id >= h5->next_dimid)
+            h5->next_dimid = id + 1;
+        if ((stat = nc4_dim_list_add(grp, name, (size_t)len, id, &dim))) goto done;
+        if (!(dim->format_dim_info = calloc(1, sizeof(NC_HDF5_DIM_INFO_T))))
+            {stat = NC_ENOMEM; goto done;}
+        dim->unlimited = (unlimited != 0);
+        dim->too_long = (too_long != 0);
+        nullfree(name); name = NULL;
+    }
+
+    /* Variables */
+    if ((stat = get_bytes(rd, &n, sizeof(n)))) goto done;
+    for (i = 0; i < n; i++)
+    {
+        NC_VAR_INFO_T *var;
+        NC_HDF5_VAR_INFO_T *hdf5_var;
+        char *hdf5_name = NULL;
+        int xtype, endianness;
+        unsigned char dimscale;
+        unsigned int d;
+
+        if ((stat = get_str(rd, &name))) goto done;
+        if ((stat = get_str(rd, &hdf5_name))) goto done;
+        if ((stat = get_bytes(rd, &xtype, sizeof(xtype))) ||
+            (stat = get_bytes(rd, &endianness, sizeof(endianness))) ||
+            (stat = get_bytes(rd, &dimscale, sizeof(dimscale))) ||
+            (stat = get_bytes(rd, &nd, sizeof(nd))) ||
+            name == NULL || nd > NC_MAX_VAR_DIMS)
+        {
+            nullfree(hdf5_name);
+            if (!stat) stat = NC_EINVAL;
+            goto done;
+        }
+        if ((stat = nc4_var_list_add(grp, name, (int)nd, &var)))
+            {nullfree(hdf5_name); goto done;}
+        var->alt_name = hdf5_name;
+        if (!(var->format_var_info = calloc(1, sizeof(NC_HDF5_VAR_INFO_T))))
+            {stat = NC_ENOMEM; goto done;}
+        hdf5_var = (NC_HDF5_VAR_INFO_T *)var->format_var_info;
+        var->created = NC_TRUE;
+        var->written_to = NC_TRUE;
+        var->atts_read = 0;
+        var->coords_read = NC_TRUE;
+        var->filters = (void *)nclistnew();
+        for (d = 0; d < nd; d++)
+        {
+            if ((stat = get_bytes(rd, &var->dimids[d], sizeof(int)))) goto done;
+            /* The dimension must already be defined in this group or
+             * an ancestor. */
+            if (var->dimids[d] < 0 || var->dimids[d] >= h5->next_dimid ||
+                nc4_find_dim(grp, var->dimids[d], &var->dim[d], NULL))
+                {stat = NC_EINVAL; goto done;}
+        }
+        if ((stat = index_type_info(xtype, endianness, &var->type_info))) goto done;
+        var->type_info->rc++;
+        var->endianness = var->type_info->endianness;
+        if (dimscale)
+        {
+            NC_DIM_INFO_T *dim = (NC_DIM_INFO_T *)ncindexlookup(grp->dim, name);
+            if (dim == NULL) {stat = NC_EINVAL; goto done;}
+            hdf5_var->dimscale = NC_TRUE;
+            dim->coord_var = var;
+        }
+        nullfree(name); name = NULL;
+    }
+
+    /* Child groups */
+    if ((stat = get_bytes(rd, &n, sizeof(n)))) goto done;
+    for (i = 0; i < n; i++)
+    {
+        NC_GRP_INFO_T *child;
+
+        if ((stat = get_str(rd, &name))) goto done;
+        if (name == NULL) {stat = NC_EINVAL; goto done;}
+        if ((stat = nc4_grp_list_add(h5, grp, name, &child))) goto done;
+        if (!(child->format_grp_info = calloc(1, sizeof(NC_HDF5_GRP_INFO_T))))
+            {stat = NC_ENOMEM; goto done;}
+        nullfree(name); name = NULL;
+        if ((stat = get_grp(child, rd))) goto done;
+    }
+
+done:
+    nullfree(name);
+    return stat;
+}
+
+/**
+ * @internal Free what get_grp() built of a group and its children,
+ * leaving the group itself empty but open, so that its metadata can be
+ * read from the HDF5 file instead. Vars and dims may be only partly
+ * filled in.
+ *
+ * @param grp Pointer to group info.
+ *
+ * @return ::NC_NOERR No error.
+ * @return ::NC_EHDFERR HDF5 error.
+ */
+static int
+discard_grp(NC_GRP_INFO_T *grp)
+{
+    NC_HDF5_GRP_INFO_T *hdf5_grp = (NC_HDF5_GRP_INFO_T *)grp->format_grp_info;
+    size_t i;
+    int stat;
+
+    /* Forget a failed open, so that the group is opened again. */
+    if (hdf5_grp->hdf_grpid < 0)
+        hdf5_grp->hdf_grpid = 0;
+    for (i = ncindexsize(grp->children); i > 0; i--)
+    {
+        NC_GRP_INFO_T *child = (NC_GRP_INFO_T *)ncindexith(grp->children, i - 1);
+        NC_HDF5_GRP_INFO_T *hdf5_child = (NC_HDF5_GRP_INFO_T *)child->format_grp_info;
+        if (hdf5_child)
+        {
+            if ((stat = discard_grp(child)))
+                return stat;
+            if (hdf5_child->hdf_grpid > 0 && H5Gclose(hdf5_child->hdf_grpid) < 0)
+                return NC_EHDFERR;
+            free(hdf5_child);
+        }
+        ncindexidel(grp->children, i - 1);
+        if ((stat = nc4_rec_grp_del(child)))
+            return stat;
+    }
+    for (i = ncindexsize(grp->vars); i > 0; i--)
+    {
+        NC_VAR_INFO_T *var = (NC_VAR_INFO_T *)ncindexith(grp->vars, i - 1);
+        NC_HDF5_VAR_INFO_T *hdf5_var = (NC_HDF5_VAR_INFO_T *)var->format_var_info;
+        if (hdf5_var && hdf5_var->hdf_datasetid > 0 && H5Dclose(hdf5_var->hdf_datasetid) < 0)
+            return NC_EHDFERR;
+        nullfree(hdf5_var);
+        var->format_var_info = NULL;
+        if (var->type_info && var->type_info->format_type_info)
+            if ((stat = nc4_HDF5_close_type(var->type_info)))
+                return stat;
+        if ((stat = NC4_hdf5_filter_freelist(var)))
+            return stat;
+        if ((stat = nc4_var_list_del(grp, var)))
+            return stat;
+    }
+    for (i = ncindexsize(grp->dim); i > 0; i--)
+    {
+        NC_DIM_INFO_T *dim = (NC_DIM_INFO_T *)ncindexith(grp->dim, i - 1);
+        nullfree(dim->format_dim_info);
+        dim->format_dim_info = NULL;
+        if ((stat = nc4_dim_list_del(grp, dim)))
+            return stat;
+    }
+    return NC_NOERR;
+}
+
+/**
+ * @internal Build the metadata of a file from its metadata index, if
+ * the index is enabled and valid. If the index is enabled but not
+ * usable, the file is marked so that the index is written at close.
+ * An index that passes its checks but does not match the objects in
+ * the file is dropped: the part of the tree built from it is freed,
+ * and the caller reads the metadata from the file as usual.
+ *
+ * @param h5 Pointer to file info.
+ * @param loadedp Pointer that gets 1 if the metadata was loaded from
+ * the index, 0 if it must be read from the file as usual.
+ *
+ * @return ::NC_NOERR No error.
+ * @return ::NC_ENOMEM Out of memory.
+ * @return ::NC_EHDFERR HDF5 error.
+ */
+int
+NC4_hdf5_read_index(NC_FILE_INFO_T *h5, int *loadedp)
+{
+    NC_HDF5_FILE_INFO_T *hdf5_info = (NC_HDF5_FILE_INFO_T *)h5->format_file_info;
+    const char *path = h5->controller->path;
+    NCindexheader hdr, sig;
+    NCindexreader rd;
+    char *ipath = NULL, *name = NULL, *payload = NULL;
+    FILE *f = NULL;
+    int stat = NC_NOERR;
+
+    *loadedp = 0;
+    if (!index_enabled(h5))
+        goto done;
+    /* Unless the index turns out to be usable, rebuild it at close. */
+    hdf5_info->write_index = 1;
+
+    if ((ipath = index_path(path)) == NULL)
+        {stat = NC_ENOMEM; goto done;}
+    if ((f = NCfopen(ipath, "rb")) == NULL)
+        goto done; /* No index yet */
+    if (fread(&hdr, sizeof(hdr), 1, f) != 1)
+        goto done;
+    if (memcmp(hdr.magic, NCIDX_MAGIC, sizeof(hdr.magic)) != 0 ||
+        hdr.version != NCIDX_VERSION || hdr.byteorder != NCIDX_BYTEORDER)
+        goto done;
+    if (file_signature(h5, path, &sig) != NC_NOERR ||
+        sig.filesize != hdr.filesize || sig.inode != hdr.inode ||
+        sig.mtime != hdr.mtime || sig.mtimensec != hdr.mtimensec ||
+        sig.ctime != hdr.ctime || sig.ctimensec != hdr.ctimensec ||
+        sig.eoa != hdr.eoa || sig.headcrc != hdr.headcrc)
+        goto done; /* Stale */
+    if (hdr.payloadlen == 0 || hdr.payloadlen > (unsigned long long)sig.filesize)
+        goto done;
+    if ((payload = malloc((size_t)hdr.payloadlen)) == NULL)
+        {stat = NC_ENOMEM; goto done;}
+    if (fread(payload, 1, (size_t)hdr.payloadlen, f) != (size_t)hdr.payloadlen)
+        goto done;
+    if (index_crc64(payload, (size_t)hdr.payloadlen) != hdr.payloadcrc)
+        goto done;
+
+    /* The index is good. The root group already exists, so skip its
+     * name and build the tree. */
+    rd.pos = payload;
+    rd.end = payload + hdr.payloadlen;
+    if ((stat = get_str(&rd, &name)))
+        goto done;
+    if ((stat = get_grp(h5->root_grp, &rd)))
+    {
+        LOG((2, "%s: metadata index of %s does not match the file: %d",
+             __func__, path, stat));
+        if ((stat = discard_grp(h5->root_grp)))
+            goto done;
+        nclistclear(h5->alldims);
+        nclistsetlength(h5->allgroups, 1);
+        h5->next_dimid = 0;
+        h5->next_nc_grpid = 1;
+        goto done;
+    }
+    hdf5_info->write_index = 0;
+    *loadedp = 1;
+
+done:
+    if (f)
+        fclose(f);
+    nullfree(name);
+    nullfree(payload);
+    nullfree(ipath);
+    return stat;
+}
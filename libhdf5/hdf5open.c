@@ -708,6 +708,7 @@ nc4_open_file(const char *path, int mode, void* parameters, int ncid)
     hid_t fapl_id = H5P_DEFAULT;
     unsigned flags;
     int is_classic;
+    int from_index = 0;
 #ifdef USE_PARALLEL4
     NC_MPI_INFO *mpiinfo = NULL;
     int comm_duped = 0; /* Whether the MPI Communicator was duplicated */
@@ -742,6 +743,21 @@ nc4_open_file(const char *path, int mode, void* parameters, int ncid)
 
     h5 = (NC_HDF5_FILE_INFO_T*)nc4_info->format_file_info;
 
+    /* Attribute values bigger than this are not kept in memory after
+     * they have been read. */
+    {
+        const char *limit = NC_rclookup("HDF5.ATTRIBUTE_CACHE_LIMIT", NULL, NULL);
+        if (limit != NULL)
+            h5->att_cache_limit = (size_t)strtoull(limit, NULL, 10);
+    }
+
+    /* Max number of datasets to keep open in a read-only file. */
+    {
+        const char *poolsize = NC_rclookup("HDF5.DATASET_POOL_SIZE", NULL, NULL);
+        if (poolsize != NULL)
+            h5->pool_limit = (size_t)strtoull(poolsize, NULL, 10);
+    }
+
 #ifdef ENABLE_BYTERANGE
     /* Do path as URL processing */
     ncuriparse(path,&h5->uri);
@@ -830,6 +846,10 @@ nc4_open_file(const char *path, int mode, void* parameters, int ncid)
 	LOG((4, "%s: set HDF raw chunk cache to size %d nelems %d preemption %f",
 	     __func__, gs->chunkcache.size, gs->chunkcache.nelems,
 	     gs->chunkcache.preemption));
+
+	/* The chunk caches of all vars share this budget. */
+	h5->cache_budget = gs->chunkcachebudget.size;
+	h5->cache_minimum = gs->chunkcachebudget.minimum;
     }
 
     {
@@ -968,8 +988,11 @@ nc4_open_file(const char *path, int mode, void* parameters, int ncid)
      * information may be difficult to resolve here, if, for example, a
      * dataset of user-defined type is encountered before the
      * definition of that type. */
-    if ((retval = rec_read_metadata(nc4_info->root_grp)))
+    if ((retval = NC4_hdf5_read_index(nc4_info, &from_index)))
         BAIL(retval);
+    if (!from_index)
+        if ((retval = rec_read_metadata(nc4_info->root_grp)))
+            BAIL(retval);
 
     /* Check for classic model attribute. */
     if ((retval = check_for_classic_model(nc4_info->root_grp, &is_classic)))
@@ -986,6 +1009,11 @@ nc4_open_file(const char *path, int mode, void* parameters, int ncid)
     if ((retval = rec_match_dimscales(nc4_info->root_grp)))
         BAIL(retval);
 
+    /* Dimscale matching is done, so datasets beyond the pool size
+     * can be closed. */
+    if ((retval = nc4_hdf5_pool_trim(nc4_info)))
+        BAIL(retval);
+
 #ifdef LOGGING
     /* This will print out the names, types, lens, etc of the vars and
        atts in the file, if the logging level is 2 or greater. */
@@ -1475,6 +1503,25 @@ nc4_get_var_meta(NC_VAR_INFO_T *var)
     /* Get pointer to the HDF5-specific var info struct. */
     hdf5_var = (NC_HDF5_VAR_INFO_T *)var->format_var_info;
 
+    /* The dataset may not be open yet, if the file was opened with
+     * NC_LAZYOPEN. */
+    if (!hdf5_var->hdf_datasetid)
+        if ((retval = nc4_open_var_grp2(var->container, var->hdr.id,
+                                        &hdf5_var->hdf_datasetid)))
+            return retval;
+
+    /* A var read from the metadata index does not have its HDF5 type
+     * yet. */
+    if (!((NC_HDF5_TYPE_INFO_T *)var->type_info->format_type_info)->hdf_typeid)
+    {
+        NC_HDF5_TYPE_INFO_T *hdf5_type = var->type_info->format_type_info;
+        if ((hdf5_type->hdf_typeid = H5Dget_type(hdf5_var->hdf_datasetid)) < 0)
+            BAIL(NC_EHDFERR);
+        if ((hdf5_type->native_hdf_typeid = H5Tget_native_type(hdf5_type->hdf_typeid,
+                                                               H5T_DIR_DEFAULT)) < 0)
+            BAIL(NC_EHDFERR);
+    }
+
     /* Get the current chunk cache settings. */
     if ((access_pid = H5Dget_access_plist(hdf5_var->hdf_datasetid)) < 0)
         BAIL(NC_EVARMETA);
@@ -1525,6 +1572,28 @@ exit:
     return retval;
 }
 
+/**
+ * @internal Should the HDF5 dataset of a var just read be closed
+ * until it is needed? Only for read-only, non-parallel files opened
+ * with NC_LAZYOPEN, and only for non-coordinate vars which had
+ * their dimids in the COORDINATES attribute.
+ *
+ * @param grp Pointer to group info struct.
+ * @param var Pointer to var info struct.
+ * @param dim Pointer to the dim, if this var is a coordinate var.
+ *
+ * @return True if the dataset may be closed.
+ */
+static int
+lazy_var(NC_GRP_INFO_T *grp, NC_VAR_INFO_T *var, NC_DIM_INFO_T *dim)
+{
+    NC_FILE_INFO_T *h5 = grp->nc4_info;
+
+    if (!(h5->cmode & NC_LAZYOPEN) || !h5->no_write || h5->parallel)
+        return 0;
+    return (dim == NULL && var->coords_read);
+}
+
 /**
  * @internal This function is called by read_dataset(), (which is
  * called by rec_read_metadata()) when a netCDF variable is found in
@@ -1617,6 +1686,24 @@ read_var(NC_GRP_INFO_T *grp, hid_t datasetid, const char *obj_name,
     /* Transfer endianness */
     var->endianness = var->type_info->endianness; 
 
+    /* Remember the HDF5 name of a var stored under a secret name. */
+    if (strcmp(obj_name, var->hdr.name) && !(var->alt_name = strdup(obj_name)))
+        BAIL(NC_ENOMEM);
+
+    /* For a lazy open, do not hold the dataset open. Its dimids came
+     * from the COORDINATES attribute, so no dimscale matching is
+     * needed, and nc4_open_var_grp2() will reopen it by name when the
+     * var is first used. */
+    if (lazy_var(grp, var, dim))
+    {
+        if (H5Idec_ref(hdf5_var->hdf_datasetid) < 0)
+            BAIL(NC_EHDFERR);
+        hdf5_var->hdf_datasetid = 0;
+        incr_id_rc = 0;
+    }
+    else if ((retval = nc4_hdf5_pool_add(grp->nc4_info, var)))
+        BAIL(retval);
+
 exit:
     if (finalname)
         free(finalname);
@@ -1764,8 +1851,9 @@ get_netcdf_type(NC_FILE_INFO_T *h5, hid_t native_typeid,
 }
 
 /**
- * @internal Read an attribute. This is called by
- * att_read_callbk().
+ * @internal Read the type and length of an attribute. This is called
+ * by att_read_callbk(). The value is not read until it is needed;
+ * see nc4_hdf5_read_att_data().
  *
  * @param grp Pointer to group info struct.
  * @param attid Attribute ID.
@@ -1774,7 +1862,6 @@ get_netcdf_type(NC_FILE_INFO_T *h5, hid_t native_typeid,
  * @return ::NC_NOERR No error.
  * @return ::NC_EHDFERR HDF5 returned error.
  * @return ::NC_EATTMETA Att metadata error.
- * @return ::NC_ENOMEM Out of memory.
  * @author Ed Hartnett
  */
 static int
@@ -1783,12 +1870,9 @@ read_hdf5_att(NC_GRP_INFO_T *grp, hid_t attid, NC_ATT_INFO_T *att)
     NC_HDF5_ATT_INFO_T *hdf5_att;
     hid_t spaceid = 0, file_typeid = 0;
     hsize_t dims[1] = {0}; /* netcdf attributes always 1-D. */
-    size_t type_size;
     int att_ndims;
     hssize_t att_npoints;
     H5T_class_t att_class;
-    int fixed_len_string = 0;
-    size_t fixed_size = 0;
     int retval = NC_NOERR;
 
     assert(att && att->hdr.name && att->format_att_info);
@@ -1809,8 +1893,7 @@ read_hdf5_att(NC_GRP_INFO_T *grp, hid_t attid, NC_ATT_INFO_T *att)
     if (att_class == H5T_STRING &&
         !H5Tis_variable_str(hdf5_att->native_hdf_typeid))
     {
-        fixed_len_string++;
-        if (!(fixed_size = H5Tget_size(hdf5_att->native_hdf_typeid)))
+        if (!(hdf5_att->fixed_size = H5Tget_size(hdf5_att->native_hdf_typeid)))
             BAIL(NC_EATTMETA);
     }
     if ((retval = get_netcdf_type(grp->nc4_info, hdf5_att->native_hdf_typeid,
@@ -1878,70 +1961,8 @@ read_hdf5_att(NC_GRP_INFO_T *grp, hid_t attid, NC_ATT_INFO_T *att)
     /* Tell the user what the length if this attribute is. */
     att->len = dims[0];
 
-    /* Allocate some memory if the len is not zero, and read the
-       attribute. */
-    if (dims[0])
-    {
-        if ((retval = nc4_get_typelen_mem(grp->nc4_info, att->nc_typeid,
-                                          &type_size)))
-            return retval;
-        {
-            if (!(att->data = malloc((unsigned int)(att->len * type_size))))
-                BAIL(NC_ENOMEM);
-
-            /* For a fixed length HDF5 string, the read requires
-             * contiguous memory. Meanwhile, the netCDF API requires that
-             * nc_free_string be called on string arrays, which would not
-             * work if one contiguous memory block were used. So here I
-             * convert the contiguous block of strings into an array of
-             * malloced strings -- each string with its own malloc. Then I
-             * copy the data and free the contiguous memory. This
-             * involves copying the data, which is bad, but this only
-             * occurs for fixed length string attributes, and presumably
-             * these are small. Note also that netCDF-4 does not create them - it
-             * always uses variable length strings. */
-            if (att->nc_typeid == NC_STRING && fixed_len_string)
-            {
-                int i;
-                char *contig_buf, *cur;
-		char** dst = NULL;
-
-                /* Alloc space for the contiguous memory read. */
-                if (!(contig_buf = malloc(att->len * fixed_size * sizeof(char))))
-                    BAIL(NC_ENOMEM);
-
-                /* Read the fixed-len strings as one big block. */
-                if (H5Aread(attid, hdf5_att->native_hdf_typeid, contig_buf) < 0) {
-                    free(contig_buf);
-                    BAIL(NC_EATTMETA);
-                }
-
-                /* Copy strings, one at a time, into their new home. Alloc
-                   space for each string. The user will later free this
-                   space with nc_free_string. */
-                cur = contig_buf;
-	        dst = (char**)att->data;
-                for (i = 0; i < att->len; i++)
-                {
-		    char* s = NULL;
-                    if (!(s = malloc(fixed_size+1))) {
-                        free(contig_buf);
-                        BAIL(NC_ENOMEM);
-                    }
-		    memcpy(s,cur,fixed_size);
-		    s[fixed_size] = '\0';
-		    dst[i] = s;
-                    cur += fixed_size;
-                }
-                /* Free contiguous memory buffer. */
-                free(contig_buf);
-            } else { /* not fixed string */
-		/* Just read the data */
-                if (H5Aread(attid, hdf5_att->native_hdf_typeid, att->data) < 0)
-                    BAIL(NC_EATTMETA);
-	    }
-        }
-    }
+    /* The value, if any, is read on first use. */
+    hdf5_att->data_pending = (att->len > 0);
 
     if (H5Tclose(file_typeid) < 0)
         BAIL(NC_EHDFERR);
@@ -1958,6 +1979,151 @@ exit:
     return retval;
 }
 
+/**
+ * @internal Read the value of an attribute from the file, if it has
+ * not been read yet. Attribute values are read on first use, rather
+ * than when the attribute list of a group or var is read.
+ *
+ * @param att Pointer to att info struct.
+ *
+ * @return ::NC_NOERR No error.
+ * @return ::NC_EHDFERR HDF5 returned error.
+ * @return ::NC_EATTMETA Att metadata error.
+ * @return ::NC_ENOMEM Out of memory.
+ */
+int
+nc4_hdf5_read_att_data(NC_ATT_INFO_T *att)
+{
+    NC_HDF5_ATT_INFO_T *hdf5_att;
+    NC_GRP_INFO_T *grp;
+    hid_t locid, attid = 0;
+    size_t type_size;
+    void *data = NULL;
+    int retval = NC_NOERR;
+
+    assert(att && att->format_att_info && att->container);
+    hdf5_att = (NC_HDF5_ATT_INFO_T *)att->format_att_info;
+    if (!hdf5_att->data_pending)
+        return NC_NOERR;
+    assert(att->created && !att->data);
+    LOG((4, "%s: att->hdr.name %s", __func__, att->hdr.name));
+
+    /* Find the HDF5 object the attribute is attached to. */
+    if (att->container->sort == NCVAR)
+    {
+        NC_VAR_INFO_T *var = (NC_VAR_INFO_T *)att->container;
+        grp = var->container;
+        if ((retval = nc4_open_var_grp2(grp, var->hdr.id, &locid)))
+            return retval;
+    }
+    else
+    {
+        grp = (NC_GRP_INFO_T *)att->container;
+        locid = ((NC_HDF5_GRP_INFO_T *)grp->format_grp_info)->hdf_grpid;
+    }
+    if ((attid = H5Aopen(locid, att->hdr.name, H5P_DEFAULT)) < 0)
+        return NC_EATTMETA;
+
+    if ((retval = nc4_get_typelen_mem(grp->nc4_info, att->nc_typeid, &type_size)))
+        BAIL(retval);
+    if (!(data = malloc((unsigned int)(att->len * type_size))))
+        BAIL(NC_ENOMEM);
+
+    /* For a fixed length HDF5 string, the read requires
+     * contiguous memory. Meanwhile, the netCDF API requires that
+     * nc_free_string be called on string arrays, which would not
+     * work if one contiguous memory block were used. So here I
+     * convert the contiguous block of strings into an array of
+     * malloced strings -- each string with its own malloc. Then I
+     * copy the data and free the contiguous memory. This
+     * involves copying the data, which is bad, but this only
+     * occurs for fixed length string attributes, and presumably
+     * these are small. Note also that netCDF-4 does not create them - it
+     * always uses variable length strings. */
+    if (att->nc_typeid == NC_STRING && hdf5_att->fixed_size)
+    {
+        size_t fixed_size = hdf5_att->fixed_size;
+        char *contig_buf, *cur;
+        char **dst = (char **)data;
+        int i;
+
+        /* Alloc space for the contiguous memory read. */
+        if (!(contig_buf = malloc(att->len * fixed_size * sizeof(char))))
+            BAIL(NC_ENOMEM);
+
+        /* Read the fixed-len strings as one big block. */
+        if (H5Aread(attid, hdf5_att->native_hdf_typeid, contig_buf) < 0) {
+            free(contig_buf);
+            BAIL(NC_EATTMETA);
+        }
+
+        /* Copy strings, one at a time, into their new home. Alloc
+           space for each string. The user will later free this
+           space with nc_free_string. */
+        memset(dst, 0, att->len * sizeof(char *));
+        cur = contig_buf;
+        for (i = 0; i < att->len; i++)
+        {
+            if (!(dst[i] = malloc(fixed_size+1))) {
+                free(contig_buf);
+                for (i--; i >= 0; i--)
+                    free(dst[i]);
+                BAIL(NC_ENOMEM);
+            }
+            memcpy(dst[i], cur, fixed_size);
+            dst[i][fixed_size] = '\0';
+            cur += fixed_size;
+        }
+        /* Free contiguous memory buffer. */
+        free(contig_buf);
+    } else { /* not fixed string */
+        /* Just read the data */
+        if (H5Aread(attid, hdf5_att->native_hdf_typeid, data) < 0)
+            BAIL(NC_EATTMETA);
+    }
+
+    att->data = data;
+    data = NULL;
+    hdf5_att->data_pending = NC_FALSE;
+
+exit:
+    nullfree(data);
+    if (attid > 0 && H5Aclose(attid) < 0)
+        BAIL2(NC_EHDFERR);
+    return retval;
+}
+
+/**
+ * @internal Drop the value of an attribute from memory, if it is
+ * bigger than the HDF5.ATTRIBUTE_CACHE_LIMIT rc setting and has not
+ * been changed. It is read from the file again on next use.
+ *
+ * @param h5 Pointer to file info.
+ * @param att Pointer to att info struct.
+ *
+ * @return ::NC_NOERR No error.
+ */
+int
+nc4_hdf5_evict_att_data(NC_FILE_INFO_T *h5, NC_ATT_INFO_T *att)
+{
+    NC_HDF5_FILE_INFO_T *hdf5_info = (NC_HDF5_FILE_INFO_T *)h5->format_file_info;
+    NC_HDF5_ATT_INFO_T *hdf5_att = (NC_HDF5_ATT_INFO_T *)att->format_att_info;
+    size_t type_size;
+    int retval;
+
+    if (!hdf5_info->att_cache_limit || !att->data || att->dirty || !att->created)
+        return NC_NOERR;
+    if ((retval = nc4_get_typelen_mem(h5, att->nc_typeid, &type_size)))
+        return retval;
+    if (att->len * type_size <= hdf5_info->att_cache_limit)
+        return NC_NOERR;
+    if ((retval = NC_reclaim_data_all(h5->controller, att->nc_typeid, att->data, att->len)))
+        return retval;
+    att->data = NULL;
+    hdf5_att->data_pending = NC_TRUE;
+    return NC_NOERR;
+}
+
 /**
  * @internal Wrap HDF5 allocated memory free operations
  *
@@ -2342,12 +2508,10 @@ att_read_callbk(hid_t loc_id, const char *att_name, const H5A_info_t *ainfo,
         return NC_NOERR;
 
     /* Add to the end of the list of atts for this var. */
-    if ((retval = nc4_att_list_add(list, att_name, &att)))
+    if ((retval = nc4_att_list_add(list, (att_info->var ? (NC_OBJ*)att_info->var : (NC_OBJ*)att_info->grp),
+                                   att_name, &att)))
         BAIL(-1);
 
-    /* Remember container */
-    att->container = (att_info->var ? (NC_OBJ*)att_info->var: (NC_OBJ*)att_info->grp);
-
 
     /* Allocate storage for the HDF5 specific att info. */
     if (!(att->format_att_info = calloc(1, sizeof(NC_HDF5_ATT_INFO_T))))
@@ -2358,8 +2522,8 @@ att_read_callbk(hid_t loc_id, const char *att_name, const H5A_info_t *ainfo,
         BAIL(-1);
     LOG((4, "%s::  att_name %s", __func__, att_name));
 
-    /* Read the rest of the info about the att,
-     * including its values. */
+    /* Read the type and length of the att. Its value is read when
+     * it is first needed. */
     if ((retval = read_hdf5_att(att_info->grp, attid, att)))
         BAIL(retval);
 
@@ -2410,9 +2574,17 @@ nc4_read_atts(NC_GRP_INFO_T *grp, NC_VAR_INFO_T *var)
     att_info.var = var;
     att_info.grp = grp;
 
-    /* Determine where to read from in the HDF5 file. */
-    locid = var ? ((NC_HDF5_VAR_INFO_T *)(var->format_var_info))->hdf_datasetid :
-        ((NC_HDF5_GRP_INFO_T *)(grp->format_grp_info))->hdf_grpid;
+    /* Determine where to read from in the HDF5 file. The var's
+     * dataset may not be open yet, if the file was opened with
+     * NC_LAZYOPEN. */
+    if (var)
+    {
+        int retval;
+        if ((retval = nc4_open_var_grp2(grp, var->hdr.id, &locid)))
+            return retval;
+    }
+    else
+        locid = ((NC_HDF5_GRP_INFO_T *)(grp->format_grp_info))->hdf_grpid;
 
     /* Now read all the attributes at this location, ignoring special
      * netCDF hidden attributes. */
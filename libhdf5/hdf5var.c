@@ -24,6 +24,10 @@
 /** Number of bytes in 64 KB. */
 #define SIXTY_FOUR_KB (65536)
 
+/** @internal Minimum size of the scratch buffer used when converting
+ * data a tile at a time. */
+#define NC_CONVERT_TILE_MIN (1048576)
+
 #ifdef LOGGING
 /**
  * Report the chunksizes selected for a variable.
@@ -86,12 +90,13 @@ nc4_reopen_dataset(NC_GRP_INFO_T *grp, NC_VAR_INFO_T *var)
         if ((access_pid = H5Pcreate(H5P_DATASET_ACCESS)) < 0)
             return NC_EHDFERR;
         if (H5Pset_chunk_cache(access_pid, var->chunkcache.nelems,
-                               var->chunkcache.size,
+                               nc4_hdf5_cache_size(var),
                                var->chunkcache.preemption) < 0)
             return NC_EHDFERR;
         if (H5Dclose(hdf5_var->hdf_datasetid) < 0)
             return NC_EHDFERR;
-        if ((hdf5_var->hdf_datasetid = H5Dopen2(grpid, var->hdr.name, access_pid)) < 0)
+        if ((hdf5_var->hdf_datasetid = H5Dopen2(grpid, var->alt_name ? var->alt_name : var->hdr.name,
+                                                access_pid)) < 0)
             return NC_EHDFERR;
         if (H5Pclose(access_pid) < 0)
             return NC_EHDFERR;
@@ -1311,9 +1316,8 @@ NC4_rename_var(int ncid, int varid, const char *name)
     }
 
     /* Now change the name in our metadata. */
-    free(var->hdr.name);
-    if (!(var->hdr.name = strdup(name)))
-        return NC_ENOMEM;
+    if ((retval = nc4_rename_obj(h5, (NC_OBJ *)var, name)))
+        return retval;
     LOG((3, "var is now %s", var->hdr.name));
 
     /* rebuild index. */
@@ -1503,6 +1507,247 @@ set_par_access(NC_FILE_INFO_T *h5, NC_VAR_INFO_T *var, hid_t xfer_plistid)
 }
 #endif /* USE_PARALLEL4 */
 
+/**
+ * @internal Work out how to split a hyperslab into tiles for type
+ * conversion, so that the scratch buffer (in the file type) stays
+ * near the var chunk cache size. The selection is split along
+ * dimension *splitp into runs of *rowsp indices; all dimensions
+ * before it are stepped one index at a time. No tile is larger than
+ * the chunk cache or one chunk, whichever is bigger. Within that
+ * bound, for chunked vars the runs are whole multiples of the chunk
+ * size, and the split is moved out to a dimension whose chunks span
+ * more than one index, so that each chunk is read or written only
+ * once. Where that does not fit, the split stays at the inner
+ * dimension and those chunks are visited once per index.
+ *
+ * @param var Pointer to var info struct.
+ * @param count Array of counts.
+ * @param stride Array of strides.
+ * @param splitp Pointer that gets the split dimension.
+ * @param rowsp Pointer that gets the number of indices per tile
+ * along the split dimension.
+ *
+ * @return 1 if the selection should be tiled, 0 if it should be
+ * converted in one piece.
+ */
+static int
+compute_tiles(NC_VAR_INFO_T *var, const hsize_t *count, const hsize_t *stride,
+              int *splitp, size_t *rowsp)
+{
+    size_t tilesize = var->chunkcache.size;
+    size_t maxsize; /* bytes in the largest tile allowed */
+    size_t inner = var->type_info->size; /* bytes per index of the split dim */
+    size_t rows;
+    int chunked = (var->storage == NC_CHUNKED && var->chunksizes);
+    int d, split;
+
+    if (tilesize < NC_CONVERT_TILE_MIN)
+        tilesize = NC_CONVERT_TILE_MIN;
+    maxsize = tilesize;
+    if (chunked)
+    {
+        size_t chunkbytes = var->type_info->size;
+        for (d = 0; d < var->ndims; d++)
+            chunkbytes *= var->chunksizes[d];
+        if (chunkbytes > maxsize)
+            maxsize = chunkbytes;
+    }
+
+    /* Find the innermost dimension that cannot be taken whole. */
+    for (split = (int)var->ndims - 1; split >= 0; split--)
+    {
+        if (inner * count[split] > tilesize)
+            break;
+        inner *= count[split];
+    }
+    if (split < 0)
+        return 0; /* Everything fits in one tile. */
+
+    /* Rather than step through a dimension whose chunks are wider
+     * than one index, split there so those chunks are visited once,
+     * if a tile one chunk deep there still fits. */
+    if (chunked)
+        for (d = 0; d < split; d++)
+        {
+            size_t outer = inner, depth;
+            int s;
+
+            if (count[d] <= 1 || var->chunksizes[d] <= 1)
+                continue;
+            for (s = split; s > d; s--)
+                outer *= count[s];
+            depth = (stride[d] == 1 ? var->chunksizes[d] : 1);
+            if (depth > count[d])
+                depth = count[d];
+            if (outer * depth <= maxsize)
+            {
+                split = d;
+                inner = outer;
+                break;
+            }
+        }
+
+    rows = tilesize / inner;
+    if (rows == 0)
+        rows = 1;
+    if (chunked && stride[split] == 1)
+    {
+        size_t cs = var->chunksizes[split];
+        if (rows >= cs)
+            rows = (rows / cs) * cs;
+        else if ((cs < count[split] ? cs : count[split]) * inner <= maxsize)
+            rows = cs;
+    }
+    if (split == 0 && rows >= count[0])
+        return 0; /* A single tile, no larger than maxsize. */
+
+    *splitp = split;
+    *rowsp = rows;
+    return 1;
+}
+
+/**
+ * @internal Read or write a hyperslab that needs type conversion a
+ * tile at a time, as laid out by compute_tiles(), so that only one
+ * tile worth of data in the file type is ever held in memory.
+ *
+ * @param h5 Pointer to HDF5 file info struct.
+ * @param var Pointer to var info struct.
+ * @param writing Non-zero to write, zero to read.
+ * @param file_spaceid File space of the dataset; its selection is
+ * changed.
+ * @param xfer_plistid Data transfer property list.
+ * @param start Array of start indices.
+ * @param count Array of counts.
+ * @param stride Array of strides.
+ * @param split Split dimension from compute_tiles().
+ * @param rows Number of indices per tile along the split dimension.
+ * @param data The data in memory.
+ * @param mem_nc_type The type of the data in memory.
+ * @param range_errorp Pointer that gets 1 if there was a range error.
+ *
+ * @return ::NC_NOERR No error.
+ * @return ::NC_ENOMEM Out of memory.
+ * @return ::NC_EHDFERR HDF5 function returned error.
+ */
+static int
+transfer_tiled(NC_FILE_INFO_T *h5, NC_VAR_INFO_T *var, int writing,
+               hid_t file_spaceid, hid_t xfer_plistid, const hsize_t *start,
+               const hsize_t *count, const hsize_t *stride, int split,
+               size_t rows, void *data, nc_type mem_nc_type, int *range_errorp)
+{
+    NC_HDF5_VAR_INFO_T *hdf5_var = (NC_HDF5_VAR_INFO_T *)var->format_var_info;
+    NC_HDF5_TYPE_INFO_T *hdf5_type = (NC_HDF5_TYPE_INFO_T *)var->type_info->format_type_info;
+    hsize_t tstart[NC_MAX_VAR_DIMS], tcount[NC_MAX_VAR_DIMS];
+    size_t index[NC_MAX_VAR_DIMS]; /* odometer over dims before split */
+    hid_t mem_spaceid = 0;
+    size_t file_type_size = var->type_info->size;
+    size_t mem_type_size, inner = 1, cs = 0;
+    void *bufr = NULL;
+    int range_error = 0;
+    int retval = NC_NOERR;
+    int d;
+
+    if ((retval = nc4_get_typelen_mem(h5, mem_nc_type, &mem_type_size)))
+        return retval;
+    for (d = split + 1; d < var->ndims; d++)
+        inner *= count[d];
+    if (!(bufr = malloc((rows < count[split] ? rows : count[split]) * inner * file_type_size)))
+        return NC_ENOMEM;
+    if (var->storage == NC_CHUNKED && var->chunksizes && stride[split] == 1 &&
+        rows % var->chunksizes[split] == 0)
+        cs = var->chunksizes[split];
+
+    for (d = 0; d < var->ndims; d++)
+    {
+        index[d] = 0;
+        tstart[d] = start[d];
+        tcount[d] = (d < split ? 1 : count[d]);
+    }
+
+    for (;;)
+    {
+        size_t j, n, offset;
+
+        /* Element offset in memory of the first index of this row. */
+        for (offset = 0, d = 0; d < split; d++)
+            offset = offset * count[d] + index[d];
+        offset *= count[split];
+
+        for (j = 0; j < count[split]; j += n)
+        {
+            char *mem;
+
+            /* Run to the next tile boundary; if chunk-aligned, the
+             * first tile may stop short at a chunk boundary. */
+            n = rows;
+            if (cs)
+                n = ((start[split] + j) / cs) * cs + rows - (start[split] + j);
+            if (n > count[split] - j)
+                n = count[split] - j;
+            tstart[split] = start[split] + j * stride[split];
+            tcount[split] = n;
+            mem = (char *)data + (offset + j) * inner * mem_type_size;
+
+            if (H5Sselect_hyperslab(file_spaceid, H5S_SELECT_SET, tstart,
+                                    stride, tcount, NULL) < 0)
+                BAIL(NC_EHDFERR);
+            if ((mem_spaceid = H5Screate_simple((int)var->ndims, tcount, NULL)) < 0)
+                BAIL(NC_EHDFERR);
+
+            if (writing)
+            {
+                if ((retval = nc4_convert_type(mem, bufr, mem_nc_type,
+                                               var->type_info->hdr.id, n * inner,
+                                               &range_error, var->fill_value,
+                                               (h5->cmode & NC_CLASSIC_MODEL),
+                                               var->quantize_mode, var->nsd)))
+                    BAIL(retval);
+                if (range_error)
+                    *range_errorp = 1;
+                if (H5Dwrite(hdf5_var->hdf_datasetid, hdf5_type->hdf_typeid,
+                             mem_spaceid, file_spaceid, xfer_plistid, bufr) < 0)
+                    BAIL(NC_EHDFERR);
+            }
+            else
+            {
+                if (H5Dread(hdf5_var->hdf_datasetid, hdf5_type->native_hdf_typeid,
+                            mem_spaceid, file_spaceid, xfer_plistid, bufr) < 0)
+                    BAIL(NC_EHDFERR);
+                if ((retval = nc4_convert_type(bufr, mem, var->type_info->hdr.id,
+                                               mem_nc_type, n * inner,
+                                               &range_error, var->fill_value,
+                                               (h5->cmode & NC_CLASSIC_MODEL),
+                                               var->quantize_mode, var->nsd)))
+                    BAIL(retval);
+                if (range_error)
+                    *range_errorp = 1;
+            }
+            if (H5Sclose(mem_spaceid) < 0)
+                BAIL(NC_EHDFERR);
+            mem_spaceid = 0;
+        }
+
+        /* Step the odometer over the dims before the split. */
+        for (d = split - 1; d >= 0; d--)
+        {
+            if (++index[d] < count[d])
+                break;
+            index[d] = 0;
+        }
+        if (d < 0)
+            break;
+        for (d = 0; d < split; d++)
+            tstart[d] = start[d] + index[d] * stride[d];
+    }
+
+exit:
+    if (mem_spaceid > 0 && H5Sclose(mem_spaceid) < 0)
+        BAIL2(NC_EHDFERR);
+    free(bufr);
+    return retval;
+}
+
 /**
  * @internal Write a strided array of data to a variable. This is
  * called by nc_put_vars() and other nc_put_vars_* functions, for
@@ -1555,6 +1800,8 @@ NC4_put_vars(int ncid, int varid, const size_t *startp, const size_t *countp,
     int need_to_convert = 0;
     int zero_count = 0; /* true if a count is zero */
     size_t len = 1;
+    int tiled = 0, split = 0;
+    size_t rows = 0;
 
     /* Find info for this file, group, and var. */
     if ((retval = nc4_hdf5_find_grp_h5_var(ncid, varid, &h5, &grp, &var)))
@@ -1577,6 +1824,10 @@ NC4_put_vars(int ncid, int varid, const size_t *startp, const size_t *countp,
         return retval;
     assert(hdf5_var->hdf_datasetid && (!var->ndims || (startp && countp)));
 
+    /* Take this var's share of the file's chunk cache budget. */
+    if ((retval = nc4_hdf5_cache_touch(h5, var)))
+        return retval;
+
     /* Verify that all the variable's filters are available */
     if(hdf5_var->flags & NC_HDF5_VAR_FILTER_MISSING) {
 	unsigned id = 0;
@@ -1678,10 +1929,21 @@ NC4_put_vars(int ncid, int varid, const size_t *startp, const size_t *countp,
         assert(var->type_info->size);
         file_type_size = var->type_info->size;
 
+        /* Large requests are converted a tile at a time, so that the
+         * scratch memory stays bounded. BitGroom alternates its
+         * treatment of even and odd values, so must see the whole
+         * request at once. */
+        if (!zero_count && var->ndims && !h5->parallel &&
+            var->type_info->hdr.id <= NC_MAX_ATOMIC_TYPE &&
+            var->type_info->hdr.id != NC_STRING &&
+            var->quantize_mode != NC_QUANTIZE_BITGROOM &&
+            H5Sget_simple_extent_type(file_spaceid) != H5S_SCALAR)
+            tiled = compute_tiles(var, count, stride, &split, &rows);
+
         /* If we're reading, we need bufr to have enough memory to store
          * the data in the file. If we're writing, we need bufr to be
          * big enough to hold all the data in the file's type. */
-        if (len > 0)
+        if (len > 0 && !tiled)
             if (!(bufr = malloc(len * file_type_size)))
                 BAIL(NC_ENOMEM);
     }
@@ -1778,23 +2040,36 @@ NC4_put_vars(int ncid, int varid, const size_t *startp, const size_t *countp,
         }
     }
 
-    /* Do we need to convert the data? */
-    if (need_to_convert)
+    if (tiled)
     {
-        if ((retval = nc4_convert_type(data, bufr, mem_nc_type, var->type_info->hdr.id,
-                                       len, &range_error, var->fill_value,
-                                       (h5->cmode & NC_CLASSIC_MODEL), var->quantize_mode,
-				       var->nsd)))
+        /* Convert and write the data one tile at a time. */
+        LOG((4, "writing var %s in tiles of %d along dim %d", var->hdr.name,
+             rows, split));
+        if ((retval = transfer_tiled(h5, var, 1, file_spaceid, xfer_plistid,
+                                     start, count, stride, split, rows,
+                                     (void *)data, mem_nc_type, &range_error)))
             BAIL(retval);
     }
+    else
+    {
+        /* Do we need to convert the data? */
+        if (need_to_convert)
+        {
+            if ((retval = nc4_convert_type(data, bufr, mem_nc_type, var->type_info->hdr.id,
+                                           len, &range_error, var->fill_value,
+                                           (h5->cmode & NC_CLASSIC_MODEL), var->quantize_mode,
+                                           var->nsd)))
+                BAIL(retval);
+        }
 
-    /* Write the data. At last! */
-    LOG((4, "about to H5Dwrite datasetid 0x%x mem_spaceid 0x%x "
-         "file_spaceid 0x%x", hdf5_var->hdf_datasetid, mem_spaceid, file_spaceid));
-    if (H5Dwrite(hdf5_var->hdf_datasetid,
-                 ((NC_HDF5_TYPE_INFO_T *)var->type_info->format_type_info)->hdf_typeid,
-                 mem_spaceid, file_spaceid, xfer_plistid, bufr) < 0)
-        BAIL(NC_EHDFERR);
+        /* Write the data. At last! */
+        LOG((4, "about to H5Dwrite datasetid 0x%x mem_spaceid 0x%x "
+             "file_spaceid 0x%x", hdf5_var->hdf_datasetid, mem_spaceid, file_spaceid));
+        if (H5Dwrite(hdf5_var->hdf_datasetid,
+                     ((NC_HDF5_TYPE_INFO_T *)var->type_info->format_type_info)->hdf_typeid,
+                     mem_spaceid, file_spaceid, xfer_plistid, bufr) < 0)
+            BAIL(NC_EHDFERR);
+    }
 
     /* Remember that we have written to this var so that Fill Value
      * can't be set for it. */
@@ -1883,6 +2158,8 @@ NC4_get_vars(int ncid, int varid, const size_t *startp, const size_t *countp,
     int fixedlengthstring = 0;
     hsize_t fstring_len = 0;
     size_t fstring_count = 1;
+    int tiled = 0, split = 0;
+    size_t rows = 0;
 
     /* Find info for this file, group, and var. */
     if ((retval = nc4_hdf5_find_grp_h5_var(ncid, varid, &h5, &grp, &var)))
@@ -1902,8 +2179,16 @@ NC4_get_vars(int ncid, int varid, const size_t *startp, const size_t *countp,
      * mode, if needed. */
     if ((retval = check_for_vara(&mem_nc_type, var, h5)))
         return retval;
+
+    /* The dataset may have been closed by the dataset pool. */
+    if ((retval = nc4_open_var_grp2(grp, var->hdr.id, &hdf5_var->hdf_datasetid)))
+        return retval;
     assert(hdf5_var->hdf_datasetid && (!var->ndims || (startp && countp)));
 
+    /* Take this var's share of the file's chunk cache budget. */
+    if ((retval = nc4_hdf5_cache_touch(h5, var)))
+        return retval;
+
     /* Verify that all the variable's filters are available */
     if(hdf5_var->flags & NC_HDF5_VAR_FILTER_MISSING) {
 	unsigned id = 0;
@@ -1964,12 +2249,14 @@ NC4_get_vars(int ncid, int varid, const size_t *startp, const size_t *countp,
         LOG((4, "converting data for var %s type=%d len=%d", var->hdr.name,
         var->type_info->hdr.id, len));
 
-        /* If we're reading, we need bufr to have enough memory to store
-         * the data in the file. If we're writing, we need bufr to be
-         * big enough to hold all the data in the file's type. */
-        if (len > 0)
-            if (!(bufr = malloc(len * file_type_size)))
-                BAIL(NC_ENOMEM);
+        /* Large requests are converted a tile at a time; see
+         * NC4_put_vars(). The tiles are laid out below, once it is
+         * known that no fill values need to be supplied. */
+        if (var->ndims && !h5->parallel &&
+            var->type_info->hdr.id <= NC_MAX_ATOMIC_TYPE &&
+            var->type_info->hdr.id != NC_STRING &&
+            var->quantize_mode != NC_QUANTIZE_BITGROOM)
+            tiled = 1;
     }
     else
         if (!bufr)
@@ -2038,7 +2325,33 @@ NC4_get_vars(int ncid, int varid, const size_t *startp, const size_t *countp,
         }
     }
 
-    if (!no_read)
+    if (tiled)
+        tiled = (!no_read && !provide_fill &&
+                 H5Sget_simple_extent_type(file_spaceid) != H5S_SCALAR &&
+                 compute_tiles(var, count, stride, &split, &rows));
+
+    /* If we're reading, we need bufr to have enough memory to store
+     * the data in the file. If we're writing, we need bufr to be
+     * big enough to hold all the data in the file's type. */
+    if (need_to_convert && !tiled && len > 0)
+        if (!(bufr = malloc(len * file_type_size)))
+            BAIL(NC_ENOMEM);
+
+    if (tiled)
+    {
+        /* Create the data transfer property list. */
+        if ((xfer_plistid = H5Pcreate(H5P_DATASET_XFER)) < 0)
+            BAIL(NC_EHDFERR);
+
+        /* Read and convert the data one tile at a time. */
+        LOG((4, "reading var %s in tiles of %d along dim %d", var->hdr.name,
+             rows, split));
+        if ((retval = transfer_tiled(h5, var, 0, file_spaceid, xfer_plistid,
+                                     start, count, stride, split, rows,
+                                     data, mem_nc_type, &range_error)))
+            BAIL(retval);
+    }
+    else if (!no_read)
     {
         /* Now you would think that no one would be crazy enough to write
            a scalar dataspace with one of the array function calls, but you
@@ -2181,22 +2494,16 @@ NC4_get_vars(int ncid, int varid, const size_t *startp, const size_t *countp,
 
         /* Copy the fill value into the rest of the data buffer. */
         filldata = (char *)bufr + real_data_size;
-        for (i = 0; i < fill_len; i++)
-        {
-
-	    {
-		/* Copy one instance of the fill_value */
-		if((retval = NC_copy_data(h5->controller,var->type_info->hdr.id,fillvalue,1,filldata)))
-		    BAIL(retval);
-	    }
-            filldata = (char *)filldata + file_type_size;
-	}        
+        if ((retval = NC_fill_data(h5->controller, var->type_info->hdr.id, fillvalue,
+                                   fill_len, filldata)))
+            BAIL(retval);
     }
 
     /* Convert data type if needed. */
     if (need_to_convert)
     {
-        if ((retval = nc4_convert_type(bufr, data, var->type_info->hdr.id, mem_nc_type,
+        if (!tiled &&
+            (retval = nc4_convert_type(bufr, data, var->type_info->hdr.id, mem_nc_type,
 				       len, &range_error, var->fill_value,
 				       (h5->cmode & NC_CLASSIC_MODEL), var->quantize_mode, var->nsd)))
             BAIL(retval);
@@ -2306,6 +2613,176 @@ NC4_HDF5_inq_var_all(int ncid, int varid, char *name, nc_type *xtypep,
                            endiannessp, unused1, unused2, unused3);
 }
 
+/**
+ * @internal Find the var whose stored chunks are to be read or
+ * written, make sure its dataset is open, and convert the start of
+ * a chunk to an HDF5 chunk offset. The start must be on a chunk
+ * boundary, and inside the current extent of the dataset.
+ *
+ * @param ncid File and group ID.
+ * @param varid Variable ID.
+ * @param startp Index of the first element of the chunk.
+ * @param h5 Pointer that gets pointer to file info.
+ * @param var Pointer that gets pointer to var info.
+ * @param offset Gets the HDF5 chunk offset.
+ *
+ * @return ::NC_NOERR No error.
+ * @return ::NC_EBADID Bad ncid.
+ * @return ::NC_ENOTVAR Invalid variable ID.
+ * @return ::NC_EINVAL Var is not chunked, or file is open for
+ * parallel I/O.
+ * @return ::NC_EBADTYPE Var has a variable length type.
+ * @return ::NC_EINVALCOORDS Start is not on a chunk boundary.
+ * @return ::NC_EEDGE Chunk is outside the extent of the dataset.
+ * @return ::NC_EHDFERR HDF5 error.
+ */
+static int
+find_raw_chunk(int ncid, int varid, const size_t *startp, NC_FILE_INFO_T **h5,
+               NC_VAR_INFO_T **var, hsize_t *offset)
+{
+    NC_GRP_INFO_T *grp;
+    NC_HDF5_VAR_INFO_T *hdf5_var;
+    hsize_t fdims[NC_MAX_VAR_DIMS];
+    hid_t file_spaceid;
+    int retval, d;
+
+    if ((retval = nc4_hdf5_find_grp_h5_var(ncid, varid, h5, &grp, var)))
+        return retval;
+    hdf5_var = (NC_HDF5_VAR_INFO_T *)(*var)->format_var_info;
+
+    if ((*var)->storage != NC_CHUNKED || (*h5)->parallel)
+        return NC_EINVAL;
+    if ((*var)->type_info->varsized)
+        return NC_EBADTYPE;
+
+    /* Datasets are created when define mode ends. */
+    if ((*h5)->flags & NC_INDEF)
+    {
+        if ((*h5)->cmode & NC_CLASSIC_MODEL)
+            return NC_EINDEFINE;
+        if ((retval = nc4_enddef_netcdf4_file(*h5)))
+            return retval;
+    }
+
+    /* The dataset may have been closed by the dataset pool. */
+    if ((retval = nc4_open_var_grp2(grp, varid, &hdf5_var->hdf_datasetid)))
+        return retval;
+
+    if ((file_spaceid = H5Dget_space(hdf5_var->hdf_datasetid)) < 0)
+        return NC_EHDFERR;
+    if (H5Sget_simple_extent_dims(file_spaceid, fdims, NULL) < 0)
+    {
+        H5Sclose(file_spaceid);
+        return NC_EHDFERR;
+    }
+    if (H5Sclose(file_spaceid) < 0)
+        return NC_EHDFERR;
+
+    for (d = 0; d < (*var)->ndims; d++)
+    {
+        if (startp[d] % (*var)->chunksizes[d])
+            return NC_EINVALCOORDS;
+        if (startp[d] >= fdims[d])
+            return NC_EEDGE;
+        offset[d] = startp[d];
+    }
+    return NC_NOERR;
+}
+
+/**
+ * @internal Read a chunk of a var as it is stored in the file, with
+ * the var's filters applied. This is the internal function called
+ * by nc_get_var_chunk_raw().
+ *
+ * @param ncid File and group ID.
+ * @param varid Variable ID.
+ * @param startp Index of the first element of the chunk.
+ * @param sizep Pointer that gets the size of the stored chunk, 0 if
+ * the chunk has not been written. Ignored if NULL.
+ * @param data Pointer that gets the stored chunk. Ignored if NULL.
+ *
+ * @return ::NC_NOERR No error.
+ * @return ::NC_EFILTER Chunk was stored with some of the filters
+ * skipped.
+ * @return ::NC_EHDFERR HDF5 error.
+ */
+int
+NC4_hdf5_get_var_chunk_raw(int ncid, int varid, const size_t *startp,
+                           size_t *sizep, void *data)
+{
+#if H5_VERSION_GE(1,10,3)
+    NC_FILE_INFO_T *h5;
+    NC_VAR_INFO_T *var;
+    hid_t datasetid;
+    hsize_t offset[NC_MAX_VAR_DIMS];
+    hsize_t nbytes = 0;
+    uint32_t filter_mask = 0;
+    int retval;
+
+    if ((retval = find_raw_chunk(ncid, varid, startp, &h5, &var, offset)))
+        return retval;
+    datasetid = ((NC_HDF5_VAR_INFO_T *)var->format_var_info)->hdf_datasetid;
+
+    /* A chunk that has never been written has no storage. */
+    if (H5Dget_chunk_storage_size(datasetid, offset, &nbytes) < 0)
+        nbytes = 0;
+    if (data && nbytes)
+    {
+        if (H5Dread_chunk(datasetid, H5P_DEFAULT, offset, &filter_mask, data) < 0)
+            return NC_EHDFERR;
+        if (filter_mask)
+            return NC_EFILTER;
+    }
+    if (sizep)
+        *sizep = (size_t)nbytes;
+    return NC_NOERR;
+#else
+    return NC_ENOTBUILT;
+#endif
+}
+
+/**
+ * @internal Write a chunk of a var as it is to be stored in the
+ * file, with the var's filters applied. This is the internal
+ * function called by nc_put_var_chunk_raw().
+ *
+ * @param ncid File and group ID.
+ * @param varid Variable ID.
+ * @param startp Index of the first element of the chunk.
+ * @param size Size of the stored chunk.
+ * @param data The stored chunk.
+ *
+ * @return ::NC_NOERR No error.
+ * @return ::NC_EPERM File is read-only.
+ * @return ::NC_EHDFERR HDF5 error.
+ */
+int
+NC4_hdf5_put_var_chunk_raw(int ncid, int varid, const size_t *startp,
+                           size_t size, const void *data)
+{
+#if H5_VERSION_GE(1,10,3)
+    NC_FILE_INFO_T *h5;
+    NC_VAR_INFO_T *var;
+    hid_t datasetid;
+    hsize_t offset[NC_MAX_VAR_DIMS];
+    int retval;
+
+    if ((retval = find_raw_chunk(ncid, varid, startp, &h5, &var, offset)))
+        return retval;
+    if (h5->no_write)
+        return NC_EPERM;
+    datasetid = ((NC_HDF5_VAR_INFO_T *)var->format_var_info)->hdf_datasetid;
+
+    /* HDF5 drops any copy of the chunk in the chunk cache. */
+    if (H5Dwrite_chunk(datasetid, H5P_DEFAULT, 0, offset, size, data) < 0)
+        return NC_EHDFERR;
+    var->written_to = NC_TRUE;
+    return NC_NOERR;
+#else
+    return NC_ENOTBUILT;
+#endif
+}
+
 /**
  * @internal Set chunk cache size for a variable. This is the internal
  * function called by nc_set_var_chunk_cache().
@@ -2348,6 +2825,12 @@ NC4_HDF5_set_var_chunk_cache(int ncid, int varid, size_t size, size_t nelems,
         return NC_ENOTVAR;
     assert(var && var->hdr.id == varid);
 
+    /* Read the var metadata now, or reading it later would replace
+     * these settings with the ones the dataset was opened with. */
+    if (!var->meta_read)
+        if ((retval = nc4_get_var_meta(var)))
+            return retval;
+
     /* Set the values. */
     var->chunkcache.size = size;
     var->chunkcache.nelems = nelems;
@@ -2356,6 +2839,12 @@ NC4_HDF5_set_var_chunk_cache(int ncid, int varid, size_t size, size_t nelems,
     /* Reopen the dataset to bring new settings into effect. */
     if ((retval = nc4_reopen_dataset(grp, var)))
         return retval;
+
+    /* If the var shares the file's chunk cache budget, work out its
+     * share again. */
+    if (((NC_HDF5_VAR_INFO_T *)var->format_var_info)->in_cache)
+        if ((retval = nc4_hdf5_cache_touch(h5, var)))
+            return retval;
     return NC_NOERR;
 }
 
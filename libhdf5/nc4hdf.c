@@ -31,26 +31,33 @@
 #define NC_HDF5_MAX_NAME 1024 /**< @internal Max size of HDF5 name. */
 
 /**
- * @internal Flag attributes in a linked list as dirty.
+ * @internal Flag the attributes of a var as dirty. Atts and values
+ * not yet read from the file are read first, since they will be
+ * rewritten.
  *
- * @param attlist List of attributes, may be NULL.
+ * @param var Pointer to var info.
  *
  * @return NC_NOERR No error.
  * @author Dennis Heimbigner
  */
 static int
-flag_atts_dirty(NCindex *attlist) {
+flag_atts_dirty(NC_VAR_INFO_T *var) {
 
     NC_ATT_INFO_T *att = NULL;
     int i;
+    int retval;
+
+    if(!var->atts_read)
+        if((retval = nc4_read_atts(var->container, var))) return retval;
 
-    if(attlist == NULL) {
+    if(var->att == NULL) {
         return NC_NOERR;
     }
 
-    for(i=0;i<ncindexsize(attlist);i++) {
-        att = (NC_ATT_INFO_T*)ncindexith(attlist,i);
+    for(i=0;i<ncindexsize(var->att);i++) {
+        att = (NC_ATT_INFO_T*)ncindexith(var->att,i);
         if(att == NULL) continue;
+        if((retval = nc4_hdf5_read_att_data(att))) return retval;
         att->dirty = NC_TRUE;
     }
 
@@ -188,7 +195,9 @@ rec_detach_scales(NC_GRP_INFO_T *grp, int dimid, hid_t dimscaleid)
 }
 
 /**
- * @internal Open a HDF5 dataset and leave it open.
+ * @internal Open a HDF5 dataset and leave it open. If the file has
+ * a dataset pool, the dataset becomes its most recently used one,
+ * and the least recently used datasets may be closed.
  *
  * @param grp Pointer to group info struct.
  * @param varid Variable ID.
@@ -203,6 +212,7 @@ nc4_open_var_grp2(NC_GRP_INFO_T *grp, int varid, hid_t *dataset)
 {
     NC_VAR_INFO_T *var;
     NC_HDF5_VAR_INFO_T *hdf5_var;
+    int retval;
 
     assert(grp && grp->format_grp_info && dataset);
 
@@ -216,18 +226,142 @@ nc4_open_var_grp2(NC_GRP_INFO_T *grp, int varid, hid_t *dataset)
     if (!hdf5_var->hdf_datasetid)
     {
         NC_HDF5_GRP_INFO_T *hdf5_grp;
+        hid_t access_pid = H5P_DEFAULT;
         hdf5_grp = (NC_HDF5_GRP_INFO_T *)grp->format_grp_info;
 
-        if ((hdf5_var->hdf_datasetid = H5Dopen2(hdf5_grp->hdf_grpid,
-                                                var->hdr.name, H5P_DEFAULT)) < 0)
+        /* If the dataset was closed by the dataset pool, reopen it
+         * with the var's own chunk cache settings. */
+        if (var->meta_read)
+        {
+            if ((access_pid = H5Pcreate(H5P_DATASET_ACCESS)) < 0)
+                return NC_EHDFERR;
+            if (H5Pset_chunk_cache(access_pid, var->chunkcache.nelems,
+                                   nc4_hdf5_cache_size(var),
+                                   var->chunkcache.preemption) < 0)
+            {
+                H5Pclose(access_pid);
+                return NC_EHDFERR;
+            }
+        }
+        hdf5_var->hdf_datasetid = H5Dopen2(hdf5_grp->hdf_grpid,
+                                           var->alt_name ? var->alt_name : var->hdr.name,
+                                           access_pid);
+        if (access_pid != H5P_DEFAULT && H5Pclose(access_pid) < 0)
+            return NC_EHDFERR;
+        if (hdf5_var->hdf_datasetid < 0)
+        {
+            hdf5_var->hdf_datasetid = 0;
             return NC_ENOTVAR;
+        }
     }
 
+    /* Keep the number of open datasets within the pool limit. */
+    if ((retval = nc4_hdf5_pool_add(grp->nc4_info, var)))
+        return retval;
+    if ((retval = nc4_hdf5_pool_trim(grp->nc4_info)))
+        return retval;
+
     *dataset = hdf5_var->hdf_datasetid;
 
     return NC_NOERR;
 }
 
+/**
+ * @internal Take a var out of the dataset pool list.
+ *
+ * @param hdf5_info Pointer to HDF5 file info.
+ * @param var Pointer to var info.
+ */
+static void
+pool_unlink(NC_HDF5_FILE_INFO_T *hdf5_info, NC_VAR_INFO_T *var)
+{
+    NC_HDF5_VAR_INFO_T *hdf5_var = (NC_HDF5_VAR_INFO_T *)var->format_var_info;
+
+    if (hdf5_var->pool_prev)
+        ((NC_HDF5_VAR_INFO_T *)hdf5_var->pool_prev->format_var_info)->pool_next = hdf5_var->pool_next;
+    else
+        hdf5_info->pool_head = hdf5_var->pool_next;
+    if (hdf5_var->pool_next)
+        ((NC_HDF5_VAR_INFO_T *)hdf5_var->pool_next->format_var_info)->pool_prev = hdf5_var->pool_prev;
+    else
+        hdf5_info->pool_tail = hdf5_var->pool_prev;
+    hdf5_var->pool_prev = hdf5_var->pool_next = NULL;
+    hdf5_var->in_pool = NC_FALSE;
+    hdf5_info->pool_count--;
+}
+
+/**
+ * @internal Make the open dataset of a var the most recently used
+ * one of the dataset pool. The pool, set up by the rc key
+ * HDF5.DATASET_POOL_SIZE, is only used for read-only, non-parallel
+ * files, where a dataset can be closed at any time and reopened by
+ * name. Coordinate vars are not pooled.
+ *
+ * @param h5 Pointer to file info.
+ * @param var Pointer to var info.
+ *
+ * @return ::NC_NOERR No error.
+ */
+int
+nc4_hdf5_pool_add(NC_FILE_INFO_T *h5, NC_VAR_INFO_T *var)
+{
+    NC_HDF5_FILE_INFO_T *hdf5_info = (NC_HDF5_FILE_INFO_T *)h5->format_file_info;
+    NC_HDF5_VAR_INFO_T *hdf5_var = (NC_HDF5_VAR_INFO_T *)var->format_var_info;
+
+    if (!hdf5_info->pool_limit || !h5->no_write || h5->parallel ||
+        hdf5_var->dimscale || !hdf5_var->hdf_datasetid)
+        return NC_NOERR;
+
+    if (hdf5_var->in_pool)
+    {
+        if (hdf5_info->pool_head == var)
+            return NC_NOERR;
+        pool_unlink(hdf5_info, var);
+    }
+
+    /* Put it at the head of the list. */
+    hdf5_var->pool_prev = NULL;
+    hdf5_var->pool_next = hdf5_info->pool_head;
+    if (hdf5_info->pool_head)
+        ((NC_HDF5_VAR_INFO_T *)hdf5_info->pool_head->format_var_info)->pool_prev = var;
+    hdf5_info->pool_head = var;
+    if (!hdf5_info->pool_tail)
+        hdf5_info->pool_tail = var;
+    hdf5_var->in_pool = NC_TRUE;
+    hdf5_info->pool_count++;
+    return NC_NOERR;
+}
+
+/**
+ * @internal Close the least recently used datasets of the dataset
+ * pool until no more than HDF5.DATASET_POOL_SIZE are open. They are
+ * reopened by nc4_open_var_grp2() when next needed.
+ *
+ * @param h5 Pointer to file info.
+ *
+ * @return ::NC_NOERR No error.
+ * @return ::NC_EHDFERR HDF5 error.
+ */
+int
+nc4_hdf5_pool_trim(NC_FILE_INFO_T *h5)
+{
+    NC_HDF5_FILE_INFO_T *hdf5_info = (NC_HDF5_FILE_INFO_T *)h5->format_file_info;
+
+    while (hdf5_info->pool_limit && hdf5_info->pool_count > hdf5_info->pool_limit)
+    {
+        NC_VAR_INFO_T *var = hdf5_info->pool_tail;
+        NC_HDF5_VAR_INFO_T *hdf5_var = (NC_HDF5_VAR_INFO_T *)var->format_var_info;
+
+        pool_unlink(hdf5_info, var);
+        LOG((4, "%s: closing dataset of var %s", __func__, var->hdr.name));
+        if (H5Dclose(hdf5_var->hdf_datasetid) < 0)
+            return NC_EHDFERR;
+        hdf5_var->hdf_datasetid = 0;
+        nc4_hdf5_cache_release(h5, var);
+    }
+    return NC_NOERR;
+}
+
 /**
  * @internal Given a netcdf type, return appropriate HDF typeid.  (All
  * hdf_typeid's returned from this routine must be H5Tclosed by the
@@ -1595,7 +1729,8 @@ write_var(NC_VAR_INFO_T *var, NC_GRP_INFO_T *grp, nc_bool_t write_dimid)
            else *only* the fill value attribute will be copied over and
            the rest will be lost.  See
            https://github.com/Unidata/netcdf-c/issues/239 */
-        flag_atts_dirty(var->att);
+        if ((retval = flag_atts_dirty(var)))
+            return retval;
     }
 
     /* Is this a coordinate var that has already been created in
@@ -1615,7 +1750,8 @@ write_var(NC_VAR_INFO_T *var, NC_GRP_INFO_T *grp, nc_bool_t write_dimid)
                 /* Indicate that the variable already exists, and should
                  * be replaced. */
                 replace_existing_var = NC_TRUE;
-                flag_atts_dirty(var->att);
+                if ((retval = flag_atts_dirty(var)))
+                    return retval;
             }
         }
     }
@@ -1698,6 +1834,7 @@ write_var(NC_VAR_INFO_T *var, NC_GRP_INFO_T *grp, nc_bool_t write_dimid)
         if (hdf5_var->hdf_datasetid && H5Dclose(hdf5_var->hdf_datasetid) < 0)
             return NC_EHDFERR;
         hdf5_var->hdf_datasetid = 0;
+        nc4_hdf5_cache_release(grp->nc4_info, var);
 
         /* Now delete the variable. */
         if (H5Gunlink(hdf5_grp->hdf_grpid, var->hdr.name) < 0)
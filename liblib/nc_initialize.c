@@ -91,6 +91,7 @@ nc_initialize()
 
     /* Initialize each active protocol */
     if((stat = NC3_initialize())) goto done;
+    if((stat = NCAGG_initialize())) goto done;
 #ifdef ENABLE_DAP
     if((stat = NCD2_initialize())) goto done;
 #endif
@@ -178,6 +179,7 @@ nc_finalize(void)
     if((stat = NC_s3sdkfinalize())) failed = stat;
 #endif
 
+    if((stat = NCAGG_finalize())) failed = stat;
     if((stat = NC3_finalize())) failed = stat;
 
     /* Do general finalization */
@@ -63,6 +63,8 @@ ncz_create_dataset(NC_FILE_INFO_T* file, NC_GRP_INFO_T* root, const char** contr
 	   &zinfo->zarr.nczarr_version.release);
 
     zinfo->default_maxstrlen = NCZ_MAXSTR_DEFAULT;
+    zinfo->budget.size = NC_getglobalstate()->chunkcachebudget.size;
+    zinfo->budget.minimum = NC_getglobalstate()->chunkcachebudget.minimum;
 
     /* Apply client controls */
     if((stat = applycontrols(zinfo))) goto done;
@@ -78,6 +80,11 @@ ncz_create_dataset(NC_FILE_INFO_T* file, NC_GRP_INFO_T* root, const char** contr
     if((stat = nczmap_create(zinfo->controls.mapimpl,nc->path,nc->mode,zinfo->controls.flags,NULL,&zinfo->map)))
 	goto done;
 
+    /* Collect the metadata to consolidate at close, if requested */
+    if(zinfo->controls.flags & FLAG_CONSOLIDATED) {
+	if((stat = NCZ_consolidated_begin(zinfo))) goto done;
+    }
+
 done:
     ncurifree(uri);
     NCJreclaim(json);
@@ -129,6 +136,8 @@ ncz_open_dataset(NC_FILE_INFO_T* file, const char** controls)
     if((zinfo->envv_controls = NCZ_clonestringvec(0,controls))==NULL) /*0=>envv style*/
 	{stat = NC_ENOMEM; goto done;}
     zinfo->default_maxstrlen = NCZ_MAXSTR_DEFAULT;
+    zinfo->budget.size = NC_getglobalstate()->chunkcachebudget.size;
+    zinfo->budget.minimum = NC_getglobalstate()->chunkcachebudget.minimum;
 
     /* Add struct to hold NCZ-specific group info. */
     if (!(root->format_grp_info = calloc(1, sizeof(NCZ_GRP_INFO_T))))
@@ -142,6 +151,12 @@ ncz_open_dataset(NC_FILE_INFO_T* file, const char** controls)
     if((stat = nczmap_open(zinfo->controls.mapimpl,nc->path,mode,zinfo->controls.flags,NULL,&zinfo->map)))
 	goto done;
 
+    /* Use consolidated metadata if available; else collect it if requested */
+    if((stat = NCZ_consolidated_load(zinfo))) goto done;
+    if(!zinfo->consolidated.loaded && (zinfo->controls.flags & FLAG_CONSOLIDATED)) {
+	if((stat = NCZ_consolidated_begin(zinfo))) goto done;
+    }
+
     /* Ok, try to read superblock */
     if((stat = ncz_read_superblock(file,&nczarr_version,&zarr_format))) goto done;
 
@@ -328,6 +343,12 @@ applycontrols(NCZ_FILE_INFO_T* zinfo)
 	    zinfo->controls.flags |= FLAG_PUREZARR;
 	else if(strcasecmp(p,NOXARRAYCONTROL)==0)
 	    noflags |= FLAG_XARRAYDIMS;
+	else if(strcasecmp(p,CONSOLIDATEDCONTROL)==0)
+	    zinfo->controls.flags |= FLAG_CONSOLIDATED;
+	else if(strcasecmp(p,NOCONSOLIDATEDCONTROL)==0) {
+	    zinfo->controls.flags |= FLAG_NOCONSOLIDATED;
+	    noflags |= FLAG_CONSOLIDATED;
+	}
 	else if(strcasecmp(p,"zip")==0) zinfo->controls.mapimpl = NCZM_ZIP;
 	else if(strcasecmp(p,"file")==0) zinfo->controls.mapimpl = NCZM_FILE;
 	else if(strcasecmp(p,"s3")==0) zinfo->controls.mapimpl = NCZM_S3;
@@ -237,9 +237,8 @@ NCZ_rename_att(int ncid, int varid, const char *name, const char *newname)
         return NC_ENOTINDEFINE;
 
     /* Copy the new name into our metadata. */
-    if(att->hdr.name) free(att->hdr.name);
-    if (!(att->hdr.name = strdup(norm_newname)))
-        return NC_ENOMEM;
+    if ((retval = nc4_rename_obj(h5, (NC_OBJ *)att, norm_newname)))
+        return retval;
 
     att->dirty = NC_TRUE;
 
@@ -545,17 +544,13 @@ ncz_put_att(NC_GRP_INFO_T* grp, int varid, const char *name, nc_type file_type,
     if (new_att)
     {
         LOG((3, "adding attribute %s to the list...", norm_name));
-        if ((ret = nc4_att_list_add(attlist, norm_name, &att)))
+        if ((ret = nc4_att_list_add(attlist, (varid == NC_GLOBAL ? (NC_OBJ*)grp : (NC_OBJ*)var),
+                                    norm_name, &att)))
             BAIL(ret);
 
         /* Allocate storage for the ZARR specific att info. */
         if (!(att->format_att_info = calloc(1, sizeof(NCZ_ATT_INFO_T))))
             BAIL(NC_ENOMEM);
-
-	if(varid == NC_GLOBAL)
-	    att->container = (NC_OBJ*)grp;
-	else
-	    att->container = (NC_OBJ*)var;
     }
 
     /* Now fill in the metadata. */
@@ -1022,7 +1017,7 @@ ncz_makeattr(NC_OBJ* container, NCindex* attlist, const char* name, nc_type type
     clonesize = len*typesize;
     if((clone = malloc(clonesize))==NULL) {stat = NC_ENOMEM; goto done;}
     if((stat = NC_copy_data(grp->nc4_info->controller, typeid, values, len, clone))) goto done;
-    if((stat=nc4_att_list_add(attlist,name,&att)))
+    if((stat=nc4_att_list_add(attlist,container,name,&att)))
 	goto done;
     if((zatt = calloc(1,sizeof(NCZ_ATT_INFO_T))) == NULL)
 	{stat = NC_ENOMEM; goto done;}
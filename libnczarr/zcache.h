@@ -31,6 +31,7 @@ typedef struct NCZCacheEntry {
         char* chunkkey; /* name of the chunk */
     } key;
     size64_t hashkey;
+    size64_t tick; /* value of the file's budget clock at last use */
     int isfiltered; /* 1=>data contains filtered data else real data */
     int isfixedstring; /* 1 => data contains the fixed strings, 0 => data contains pointers to strings */
     size64_t size; /* |data| */
@@ -49,8 +50,42 @@ typedef struct NCZChunkCache {
     NClist* mru; /* NClist<NCZCacheEntry> all cache entries in mru order */
     struct NCxcache* xcache;
     char dimension_separator;
+    NClist* shardindices; /* NClist<NCZShardIndex> recently used shard indices in mru order */
+    NClist* shardbuffers; /* NClist<NCZShardBuffer> shards with unwritten chunks, oldest first */
+    size64_t pending; /* total size of the unwritten chunks in shardbuffers */
 } NCZChunkCache;
 
+/* Sharded storage packs the inner chunks of a shard into a single
+   object followed by an index of (offset,nbytes) pairs, one pair per
+   inner chunk in row-major order, each encoded as a little-endian
+   uint64.  Missing inner chunks have offset == nbytes == SHARD_MISSING.
+   This is the same layout as the Zarr V3 sharding codec. */
+#define SHARD_MISSING 0xffffffffffffffffULL
+
+/* A shard object is keyed like a chunk, but with this prefix and the
+   dimension separator in front of the shard indices (e.g. "s.0.1"),
+   so it can never be mistaken for a chunk */
+#define SHARD_PREFIX "s"
+
+typedef struct NCZShardIndex {
+    char* path; /* key of the shard object */
+    size64_t count; /* number of inner chunks */
+    size64_t* entries; /* [2*count] (offset,nbytes) pairs */
+} NCZShardIndex;
+
+/* Modified chunks evicted from the cache are held, in raw form, until
+   their shard is complete or the cache is flushed, so that a shard is
+   not rewritten for every chunk */
+typedef struct NCZShardBuffer {
+    char* path; /* key of the shard object */
+    size64_t shardindices[NC_MAX_VAR_DIMS];
+    size64_t count; /* number of inner chunks */
+    size64_t npieces; /* number of non-NULL pieces */
+    size64_t size; /* sum of lens */
+    size_t* lens; /* [count] */
+    void** pieces; /* [count] raw inner chunks; NULL => not held */
+} NCZShardBuffer;
+
 /**************************************************/
 
 #define FILTERED(cache) (nclistlength((NClist*)(cache)->var->filters))
@@ -68,5 +103,8 @@ extern int NCZ_buildchunkpath(NCZChunkCache* cache, const size64_t* chunkindices
 extern int NCZ_ensure_fill_chunk(NCZChunkCache* cache);
 extern int NCZ_reclaim_fill_chunk(NCZChunkCache* cache);
 extern int NCZ_chunk_cache_modify(NCZChunkCache* cache, const size64_t* indices);
+extern int NCZ_read_chunk_raw(NCZChunkCache* cache, const size64_t* indices, size64_t* sizep, void* data);
+extern int NCZ_write_chunk_raw(NCZChunkCache* cache, const size64_t* indices, size64_t size, const void* data);
+extern int NCZ_compute_shards(NC_VAR_INFO_T* var);
 
 #endif /*ZCACHE_H*/
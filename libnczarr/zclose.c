@@ -49,6 +49,8 @@ ncz_close_file(NC_FILE_INFO_T* file, int abort)
 
     if((stat = nczmap_close(zinfo->map,(abort && zinfo->creating)?1:0)))
 	goto done;
+    NCZ_consolidated_free(zinfo);
+    nclistfree(zinfo->budget.caches);
     NCZ_freestringvec(0,zinfo->envv_controls);
     NC_authfree(zinfo->auth);
     nullfree(zinfo);
@@ -173,6 +175,7 @@ NCZ_zclose_var1(NC_VAR_INFO_T* var)
     if(zvar->cache) NCZ_free_chunk_cache(zvar->cache);
     /* reclaim xarray */
     if(zvar->xarray) nclistfreeall(zvar->xarray);
+    nullfree(zvar->shards);
     nullfree(zvar);
     var->format_var_info = NULL; /* avoid memory errors */
     return stat;
@@ -0,0 +1,366 @@
+/*********************************************************************
+ *   Copyright 2018, UCAR/Unidata
+ *   See netcdf/COPYRIGHT file for copying and redistribution conditions.
+ *********************************************************************/
+
+/**
+Support for Zarr consolidated metadata.
+
+A consolidated metadata object (/.zmetadata) holds a copy of every
+metadata object (.zgroup, .zattrs, .zarray, and the NCZarr V1
+objects) in the dataset. Its layout is the one used by Zarr:
+{
+"zarr_consolidated_format": 1,
+"metadata": {
+    ".zgroup": {...},
+    ".zattrs": {...},
+    "g1/.zgroup": {...},
+    "g1/v1/.zarray": {...},
+    ...
+    }
+}
+Keys in the "metadata" dict are relative to the dataset root,
+so they never have a leading '/'.
+
+When /.zmetadata exists at open, all metadata reads
+(and the pure-zarr searches for variables and groups) are
+answered from it, so that opening a dataset costs one request
+instead of one or more per group and per variable. If it does not
+exist, the per-object walk is used.
+
+Consolidated metadata is written at close if the dataset was
+opened or created with the "consolidated" mode flag, or if an
+existing /.zmetadata was loaded at open (so it can never go stale).
+The "noconsolidated" mode flag suppresses both reading and writing.
+*/
+
+#include "zincludes.h"
+
+#define ZMETADATA_FORMAT 1
+
+/* Forward */
+static int consolidated_setup(NCZ_FILE_INFO_T* zinfo, NCjson* jmeta);
+static int consolidated_lookup(NCZ_FILE_INFO_T* zinfo, const char* key, NCjson** jvaluep);
+static int consolidated_insert(NCZ_FILE_INFO_T* zinfo, const char* key, NCjson* json);
+
+/**************************************************/
+
+/* Convert a map key to a key into the metadata dict */
+static const char*
+relkey(const char* key)
+{
+    while(*key == NCZM_SEP[0]) key++;
+    return key;
+}
+
+/**
+@internal Try to read the consolidated metadata object.
+If it does not exist (or is not recognized), then the
+dataset is read object by object.
+@param zinfo - [in] the file annotation
+@return NC_NOERR
+@return NC_ENCZARR if /.zmetadata exists but is malformed
+*/
+int
+NCZ_consolidated_load(NCZ_FILE_INFO_T* zinfo)
+{
+    int stat = NC_NOERR;
+    NCjson* json = NULL;
+    NCjson* jformat = NULL;
+    NCjson* jmeta = NULL;
+
+    ZTRACE(3,"zinfo=%s",zinfo->common.file->controller->path);
+
+    if(zinfo->controls.flags & FLAG_NOCONSOLIDATED) goto done;
+
+    switch (stat = NCZ_downloadjson(zinfo->map,ZMETADATA,&json)) {
+    case NC_NOERR: break;
+    case NC_EEMPTY: stat = NC_NOERR; goto done; /* not consolidated */
+    default: goto done;
+    }
+    if(NCJsort(json) != NCJ_DICT) {stat = NC_ENCZARR; goto done;}
+    if((stat = NCJdictget(json,"zarr_consolidated_format",&jformat))) goto done;
+    /* Ignore unknown versions of consolidation */
+    if(jformat == NULL || NCJsort(jformat) != NCJ_INT
+       || atoi(NCJstring(jformat)) != ZMETADATA_FORMAT)
+	goto done;
+    if((stat = NCJdictget(json,"metadata",&jmeta))) goto done;
+    if(jmeta == NULL || NCJsort(jmeta) != NCJ_DICT) {stat = NC_ENCZARR; goto done;}
+    if((stat = NCJclone(jmeta,&jmeta))) goto done;
+    if((stat = consolidated_setup(zinfo,jmeta))) goto done;
+    zinfo->consolidated.loaded = 1;
+
+done:
+    NCJreclaim(json);
+    return ZUNTRACE(THROW(stat));
+}
+
+/**
+@internal Start collecting consolidated metadata for a dataset
+that does not yet have any.
+@param zinfo - [in] the file annotation
+@return NC_NOERR
+*/
+int
+NCZ_consolidated_begin(NCZ_FILE_INFO_T* zinfo)
+{
+    int stat = NC_NOERR;
+    NCjson* jmeta = NULL;
+
+    if(zinfo->consolidated.metadata != NULL) goto done; /* already active */
+    if((stat = NCJnew(NCJ_DICT,&jmeta))) goto done;
+    stat = consolidated_setup(zinfo,jmeta);
+done:
+    return stat;
+}
+
+/**
+@internal Write the /.zmetadata object, if consolidation is active.
+@param zinfo - [in] the file annotation
+@return NC_NOERR
+*/
+int
+NCZ_consolidated_write(NCZ_FILE_INFO_T* zinfo)
+{
+    int stat = NC_NOERR;
+    NCjson* json = NULL;
+    NCjson* jmeta = NULL;
+    char sformat[32];
+
+    ZTRACE(3,"zinfo=%s",zinfo->common.file->controller->path);
+
+    if(zinfo->consolidated.metadata == NULL) goto done;
+
+    snprintf(sformat,sizeof(sformat),"%d",ZMETADATA_FORMAT);
+    if((stat = NCJnew(NCJ_DICT,&json))) goto done;
+    if((stat = NCJclone(zinfo->consolidated.metadata,&jmeta))) goto done;
+    if((stat = NCJinsert(json,"metadata",jmeta))) goto done;
+    jmeta = NULL;
+    if((stat = NCJaddstring(json,NCJ_STRING,"zarr_consolidated_format"))) goto done;
+    if((stat = NCJaddstring(json,NCJ_INT,sformat))) goto done;
+    if((stat = NCZ_uploadjson(zinfo->map,ZMETADATA,json))) goto done;
+
+done:
+    NCJreclaim(jmeta);
+    NCJreclaim(json);
+    return ZUNTRACE(THROW(stat));
+}
+
+/**
+@internal Reclaim consolidated metadata state
+@param zinfo - [in] the file annotation
+*/
+void
+NCZ_consolidated_free(NCZ_FILE_INFO_T* zinfo)
+{
+    NCJreclaim(zinfo->consolidated.metadata);
+    zinfo->consolidated.metadata = NULL;
+    if(zinfo->consolidated.index != NULL)
+        NC_hashmapfree(zinfo->consolidated.index);
+    zinfo->consolidated.index = NULL;
+    zinfo->consolidated.loaded = 0;
+}
+
+/**************************************************/
+/* Metadata access: these are the consolidation-aware
+   equivalents of NCZ_downloadjson, NCZ_uploadjson, nczmap_exists
+   and nczmap_search.
+*/
+
+/**
+@internal Get the json for a metadata object, either from the
+consolidated metadata or from the map.
+@param zinfo - [in] the file annotation
+@param key - [in] key of the object
+@param jsonp - [out] return parsed json; caller must reclaim
+@return NC_NOERR
+@return NC_EEMPTY [object did not exist]
+*/
+int
+NCZ_downloadmeta(NCZ_FILE_INFO_T* zinfo, const char* key, NCjson** jsonp)
+{
+    int stat = NC_NOERR;
+    NCjson* jvalue = NULL;
+
+    if(!zinfo->consolidated.loaded)
+	return NCZ_downloadjson(zinfo->map,key,jsonp);
+    if((stat = consolidated_lookup(zinfo,key,&jvalue))) goto done;
+    if(jsonp) stat = NCJclone(jvalue,jsonp);
+done:
+    return stat;
+}
+
+/**
+@internal Get the json dict for a metadata object; fail if not a dict.
+@param zinfo - [in] the file annotation
+@param key - [in] key of the object
+@param jsonp - [out] return parsed json; caller must reclaim
+@return NC_NOERR
+@return NC_EEMPTY [object did not exist]
+*/
+int
+NCZ_readmetadict(NCZ_FILE_INFO_T* zinfo, const char* key, NCjson** jsonp)
+{
+    int stat = NC_NOERR;
+    NCjson* json = NULL;
+
+    if((stat = NCZ_downloadmeta(zinfo,key,&json)))
+	goto done;
+    if(NCJsort(json) != NCJ_DICT) {stat = NC_ENCZARR; goto done;}
+    if(jsonp) {*jsonp = json; json = NULL;}
+done:
+    NCJreclaim(json);
+    return stat;
+}
+
+/**
+@internal Write a metadata object to the map and record it
+in the consolidated metadata, if active.
+@param zinfo - [in] the file annotation
+@param key - [in] key of the object
+@param json - [in] the content; not reclaimed
+@return NC_NOERR
+*/
+int
+NCZ_uploadmeta(NCZ_FILE_INFO_T* zinfo, const char* key, NCjson* json)
+{
+    int stat = NC_NOERR;
+
+    if((stat = NCZ_uploadjson(zinfo->map,key,json))) goto done;
+    if(zinfo->consolidated.metadata != NULL)
+	stat = consolidated_insert(zinfo,key,json);
+done:
+    return stat;
+}
+
+/**
+@internal Test if a metadata object exists.
+@param zinfo - [in] the file annotation
+@param key - [in] key of the object
+@return NC_NOERR if the object exists
+@return NC_EEMPTY otherwise
+*/
+int
+NCZ_existsmeta(NCZ_FILE_INFO_T* zinfo, const char* key)
+{
+    if(!zinfo->consolidated.loaded)
+	return nczmap_exists(zinfo->map,key);
+    return consolidated_lookup(zinfo,key,NULL);
+}
+
+/**
+@internal Return the names of the next segment of all
+metadata objects below a prefix key.
+Note that when using consolidated metadata, keys that
+only hold chunks are not visible.
+@param zinfo - [in] the file annotation
+@param prefix - [in] key of the containing group
+@param matches - [out] list of segment names
+@return NC_NOERR
+*/
+int
+NCZ_searchmeta(NCZ_FILE_INFO_T* zinfo, const char* prefix, NClist* matches)
+{
+    int stat = NC_NOERR;
+    size_t i, plen;
+    const char* rprefix = NULL;
+    NCjson* jmeta = zinfo->consolidated.metadata;
+
+    if(!zinfo->consolidated.loaded)
+	return nczmap_search(zinfo->map,prefix,matches);
+
+    rprefix = relkey(prefix);
+    plen = strlen(rprefix);
+    for(i=0;i<(size_t)NCJlength(jmeta);i+=2) {
+	const char* key = NCJstring(NCJith(jmeta,i));
+	const char* segment = key;
+	const char* p = NULL;
+	char* name = NULL;
+	size_t seglen;
+	if(plen > 0) {
+	    if(strncmp(key,rprefix,plen) != 0 || key[plen] != NCZM_SEP[0])
+		continue;
+	    segment = key + plen + 1;
+	}
+	p = strchr(segment,NCZM_SEP[0]);
+	seglen = (p == NULL ? strlen(segment) : (size_t)(p - segment));
+	if(seglen == 0) continue;
+	if((name = malloc(seglen+1)) == NULL) {stat = NC_ENOMEM; goto done;}
+	memcpy(name,segment,seglen);
+	name[seglen] = '\0';
+	if(nclistmatch(matches,name,1)) {
+	    nullfree(name);
+	} else
+	    nclistpush(matches,name);
+    }
+done:
+    return stat;
+}
+
+/**************************************************/
+/* Utilities */
+
+static int
+consolidated_setup(NCZ_FILE_INFO_T* zinfo, NCjson* jmeta)
+{
+    int stat = NC_NOERR;
+    size_t i;
+    NC_hashmap* index = NULL;
+
+    if((index = NC_hashmapnew((size_t)NCJlength(jmeta))) == NULL)
+	{stat = NC_ENOMEM; goto done;}
+    for(i=0;i<(size_t)NCJlength(jmeta);i+=2) {
+	NCjson* jkey = NCJith(jmeta,i);
+	if(NCJsort(jkey) != NCJ_STRING || NCJstring(jkey) == NULL)
+	    {stat = NC_ENCZARR; goto done;}
+	if(!NC_hashmapadd(index,(uintptr_t)i,NCJstring(jkey),strlen(NCJstring(jkey))))
+	    {stat = NC_ENOMEM; goto done;}
+    }
+    NCZ_consolidated_free(zinfo);
+    zinfo->consolidated.metadata = jmeta; jmeta = NULL;
+    zinfo->consolidated.index = index; index = NULL;
+done:
+    if(index) NC_hashmapfree(index);
+    NCJreclaim(jmeta);
+    return stat;
+}
+
+/* Return borrowed json for key; NC_EEMPTY if not present */
+static int
+consolidated_lookup(NCZ_FILE_INFO_T* zinfo, const char* key, NCjson** jvaluep)
+{
+    uintptr_t pos;
+    const char* rkey = relkey(key);
+
+    if(!NC_hashmapget(zinfo->consolidated.index,rkey,strlen(rkey),&pos))
+	return NC_EEMPTY;
+    if(jvaluep) *jvaluep = NCJith(zinfo->consolidated.metadata,pos+1);
+    return NC_NOERR;
+}
+
+/* Insert or replace a copy of json under key */
+static int
+consolidated_insert(NCZ_FILE_INFO_T* zinfo, const char* key, NCjson* json)
+{
+    int stat = NC_NOERR;
+    uintptr_t pos;
+    const char* rkey = relkey(key);
+    NCjson* jmeta = zinfo->consolidated.metadata;
+    NCjson* jclone = NULL;
+
+    if((stat = NCJclone(json,&jclone))) goto done;
+    if(NC_hashmapget(zinfo->consolidated.index,rkey,strlen(rkey),&pos)) {
+	NCJreclaim(NCJith(jmeta,pos+1));
+	NCJith(jmeta,pos+1) = jclone;
+    } else {
+	pos = (uintptr_t)NCJlength(jmeta);
+	if((stat = NCJaddstring(jmeta,NCJ_STRING,rkey))) goto done;
+	if((stat = NCJappend(jmeta,jclone))) goto done;
+	if(!NC_hashmapadd(zinfo->consolidated.index,pos,rkey,strlen(rkey)))
+	    {jclone = NULL; stat = NC_ENOMEM; goto done;}
+    }
+    jclone = NULL;
+done:
+    NCJreclaim(jclone);
+    return stat;
+}
@@ -262,9 +262,8 @@ NCZ_rename_dim(int ncid, int dimid, const char *name)
     /* Give the dimension its new name in metadata. UTF8 normalization
      * has been done. */
     assert(dim->hdr.name);
-    free(dim->hdr.name);
-    if (!(dim->hdr.name = strdup(norm_name)))
-        return NC_ENOMEM;
+    if ((stat = nc4_rename_obj(h5, (NC_OBJ *)dim, norm_name)))
+        return stat;
     LOG((3, "dim is now named %s", dim->hdr.name));
 
     /* rebuild index. */
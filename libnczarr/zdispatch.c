@@ -107,6 +107,8 @@ static const NC_Dispatch NCZ_dispatcher = {
     NCZ_def_var_quantize,
     NCZ_inq_var_quantize,
     NCZ_inq_filter_avail,
+    NCZ_get_var_chunk_raw,
+    NCZ_put_var_chunk_raw,
 };
 
 const NC_Dispatch* NCZ_dispatch_table = NULL; /* moved here from ddispatch.c */
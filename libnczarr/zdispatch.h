@@ -177,6 +177,9 @@ EXTERNL int NCZ_inq_filter_avail(int ncid, unsigned id);
 EXTERNL int NCZ_def_var_quantize(int ncid, int varid, int quantize_mode, int nsd);
 EXTERNL int NCZ_inq_var_quantize(int ncid, int varid, int *quantize_modep, int *nsdp);
 
+EXTERNL int NCZ_get_var_chunk_raw(int ncid, int varid, const size_t *startp, size_t *sizep, void *data);
+EXTERNL int NCZ_put_var_chunk_raw(int ncid, int varid, const size_t *startp, size_t size, const void *data);
+
 /**************************************************/
 /* Following functions wrap libsrc4 */
 EXTERNL int NCZ_inq_type(int ncid, nc_type xtype, char *name, size_t *size);
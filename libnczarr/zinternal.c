@@ -55,6 +55,7 @@ NCZ_initialize_internal(void)
 {
     int stat = NC_NOERR;
     char* dimsep = NULL;
+    char* shardchunks = NULL;
     NCglobalstate* ngs = NULL;
 
     ncz_initialized = 1;
@@ -68,6 +69,13 @@ NCZ_initialize_internal(void)
 	    if(dimsep != NULL && strlen(dimsep) == 1 && islegaldimsep(dimsep[0]))
 		ngs->zarr.dimension_separator = dimsep[0];
         }    
+	ngs->zarr.shard_chunks = 0;
+        shardchunks = NC_rclookup("ZARR.SHARD_CHUNKS",NULL,NULL);
+        if(shardchunks != NULL) {
+	    unsigned long n = 0;
+	    if(sscanf(shardchunks,"%lu",&n) == 1 && n > 1)
+		ngs->zarr.shard_chunks = (size_t)n;
+        }
     }
 
     return stat;
@@ -49,6 +49,7 @@
 #define NCZATTRDEP ".nczattr"
 
 #define ZMETAROOT "/.zgroup"
+#define ZMETADATA "/.zmetadata"
 #define ZGROUP ".zgroup"
 #define ZATTRS ".zattrs"
 #define ZARRAY ".zarray"
@@ -90,10 +91,17 @@ Inserted into any .zattrs ? or should it go into the container?
 #define NCZ_V2_ARRAY_UC   "_NCZARR_ARRAY"
 #define NCZ_V2_ATTR_UC    NC_NCZARR_ATTR_UC
 
+/* Codec id listed first in the "filters" of the .zarray of a sharded
+   variable, so that readers that do not support shards refuse to read it
+   instead of misreading its shard objects */
+#define NCZ_SHARD_CODEC "_nczarr_shard"
+
 #define NCZARRCONTROL "nczarr"
 #define PUREZARRCONTROL "zarr"
 #define XARRAYCONTROL "xarray"
 #define NOXARRAYCONTROL "noxarray"
+#define CONSOLIDATEDCONTROL "consolidated"
+#define NOCONSOLIDATEDCONTROL "noconsolidated"
 #define XARRAYSCALAR "_scalar_"
 
 #define LEGAL_DIM_SEPARATORS "./"
@@ -120,6 +128,7 @@ struct NCjson;
 struct NCauth;
 struct NCZMAP;
 struct NCZChunkCache;
+struct NC_hashmap;
 
 /**************************************************/
 /* Define annotation data for NCZ objects */
@@ -152,9 +161,23 @@ typedef struct NCZ_FILE_INFO {
 #		define FLAG_LOGGING     4
 #		define FLAG_XARRAYDIMS  8
 #		define FLAG_NCZARR_V1   16
+#		define FLAG_CONSOLIDATED 32
+#		define FLAG_NOCONSOLIDATED 64
 	NCZM_IMPL mapimpl;
     } controls;
     int default_maxstrlen; /* default max str size for variables of type string */
+    struct Consolidated {
+	struct NCjson* metadata; /* dict: key => json; NULL => not consolidated */
+	struct NC_hashmap* index; /* key => position of key in metadata */
+	int loaded; /* 1=> metadata was read from an existing /.zmetadata */
+    } consolidated;
+    struct ChunkBudget { /* see nc_set_chunk_cache_budget() */
+	size64_t size; /* max bytes cached by the chunk caches of all vars; 0 => no budget */
+	size64_t minimum; /* bytes of chunks each var may keep */
+	size64_t used; /* bytes cached by the chunk caches of all vars */
+	size64_t clock; /* counts chunk cache uses, to order entries across vars */
+	NClist* caches; /* NClist<NCZChunkCache*> of all vars */
+    } budget;
 } NCZ_FILE_INFO_T;
 
 /* This is a struct to handle the dim metadata. */
@@ -196,6 +219,8 @@ typedef struct NCZ_VAR_INFO {
     char dimension_separator; /* '.' | '/' */
     NClist* incompletefilters;
     int maxstrlen; /* max length of strings for this variable */
+    size_t shard_chunks; /* requested inner chunks per shard per dimension; 0 => unsharded */
+    size64_t* shards; /* [ndims] inner chunks per shard per dimension; NULL => unsharded */
 } NCZ_VAR_INFO_T;
 
 /* Struct to hold ZARR-specific info for a field. */
@@ -243,6 +268,17 @@ int ncz_find_grp_var_att(int ncid, int varid, const char *name, int attnum,
                               NC_ATT_INFO_T** att);
 int NCZ_set_log_level(void);
 
+/* zconsolidated.c */
+int NCZ_consolidated_load(NCZ_FILE_INFO_T* zinfo);
+int NCZ_consolidated_begin(NCZ_FILE_INFO_T* zinfo);
+int NCZ_consolidated_write(NCZ_FILE_INFO_T* zinfo);
+void NCZ_consolidated_free(NCZ_FILE_INFO_T* zinfo);
+int NCZ_downloadmeta(NCZ_FILE_INFO_T* zinfo, const char* key, struct NCjson** jsonp);
+int NCZ_readmetadict(NCZ_FILE_INFO_T* zinfo, const char* key, struct NCjson** jsonp);
+int NCZ_uploadmeta(NCZ_FILE_INFO_T* zinfo, const char* key, struct NCjson* json);
+int NCZ_existsmeta(NCZ_FILE_INFO_T* zinfo, const char* key);
+int NCZ_searchmeta(NCZ_FILE_INFO_T* zinfo, const char* prefix, struct NClist* matches);
+
 /* zcache.c */
 int ncz_adjust_var_cache(NC_GRP_INFO_T* grp, NC_VAR_INFO_T* var);
 int NCZ_set_var_chunk_cache(int ncid, int varid, size_t size, size_t nelems, float preemption);
@@ -302,7 +302,7 @@ NCZ_write_ncproperties(NC_FILE_INFO_T* h5)
 
     /* Build the property if we have legit value */
     if(prov->ncproperties != NULL) {
-        if((stat=nc4_att_list_add(attlist,NCPROPS,&ncprops)))
+        if((stat=nc4_att_list_add(attlist,(NC_OBJ*)h5->root_grp,NCPROPS,&ncprops)))
 	    goto done;
 	ncprops->nc_typeid = NC_CHAR;
 	ncprops->len = strlen(prov->ncproperties);
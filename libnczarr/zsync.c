@@ -20,7 +20,7 @@
 static int ncz_collect_dims(NC_FILE_INFO_T* file, NC_GRP_INFO_T* grp, NCjson** jdimsp);
 static int ncz_sync_var(NC_FILE_INFO_T* file, NC_VAR_INFO_T* var, int isclose);
 
-static int load_jatts(NCZMAP* map, NC_OBJ* container, int nczarrv1, NCjson** jattrsp, NClist** atypes);
+static int load_jatts(NCZ_FILE_INFO_T* zinfo, NC_OBJ* container, int nczarrv1, NCjson** jattrsp, NClist** atypes);
 static int zconvert(NCjson* src, nc_type typeid, size_t typelen, int* countp, NCbytes* dst);
 static int computeattrinfo(const char* name, NClist* atypes, nc_type typehint, int purezarr, NCjson* values,
 		nc_type* typeidp, size_t* typelenp, size_t* lenp, void** datap);
@@ -76,6 +76,13 @@ ncz_sync_file(NC_FILE_INFO_T* file, int isclose)
     if((stat = ncz_sync_grp(file, file->root_grp, isclose)))
         goto done;
 
+    /* Everything has been rewritten, so consolidate it */
+    if(isclose) {
+	NCZ_FILE_INFO_T* zinfo = file->format_file_info;
+	if((stat = NCZ_consolidated_write(zinfo)))
+	    goto done;
+    }
+
 done:
     NCJreclaim(json);
     return ZUNTRACE(stat);
@@ -147,7 +154,6 @@ ncz_sync_grp(NC_FILE_INFO_T* file, NC_GRP_INFO_T* grp, int isclose)
     NCZ_FILE_INFO_T* zinfo = NULL;
     char version[1024];
     int purezarr = 0;
-    NCZMAP* map = NULL;
     char* fullpath = NULL;
     char* key = NULL;
     NCjson* json = NULL;
@@ -162,7 +168,6 @@ ncz_sync_grp(NC_FILE_INFO_T* file, NC_GRP_INFO_T* grp, int isclose)
     ZTRACE(3,"file=%s grp=%s isclose=%d",file->controller->path,grp->hdr.name,isclose);
 
     zinfo = file->format_file_info;
-    map = zinfo->map;
 
     purezarr = (zinfo->controls.flags & FLAG_PUREZARR)?1:0;
 
@@ -230,7 +235,7 @@ ncz_sync_grp(NC_FILE_INFO_T* file, NC_GRP_INFO_T* grp, int isclose)
     if((stat = nczm_concat(fullpath,ZGROUP,&key)))
 	goto done;
     /* Write to map */
-    if((stat=NCZ_uploadjson(map,key,jgroup)))
+    if((stat=NCZ_uploadmeta(zinfo,key,jgroup)))
 	goto done;
     nullfree(key); key = NULL;
 
@@ -280,7 +285,6 @@ ncz_sync_var_meta(NC_FILE_INFO_T* file, NC_VAR_INFO_T* var, int isclose)
     int i,stat = NC_NOERR;
     NCZ_FILE_INFO_T* zinfo = NULL;
     char number[1024];
-    NCZMAP* map = NULL;
     char* fullpath = NULL;
     char* key = NULL;
     char* dimpath = NULL;
@@ -290,6 +294,7 @@ ncz_sync_var_meta(NC_FILE_INFO_T* file, NC_VAR_INFO_T* var, int isclose)
     NCjson* jdimrefs = NULL;
     NCjson* jtmp = NULL;
     NCjson* jfill = NULL;
+    NCjson* jshard = NULL;
     char* dtypename = NULL;
     int purezarr = 0;
     size64_t shape[NC_MAX_VAR_DIMS];
@@ -302,7 +307,6 @@ ncz_sync_var_meta(NC_FILE_INFO_T* file, NC_VAR_INFO_T* var, int isclose)
     ZTRACE(3,"file=%s var=%s isclose=%d",file->controller->path,var->hdr.name,isclose);
 
     zinfo = file->format_file_info;
-    map = zinfo->map;
 
     purezarr = (zinfo->controls.flags & FLAG_PUREZARR)?1:0;
 
@@ -433,11 +437,21 @@ ncz_sync_var_meta(NC_FILE_INFO_T* file, NC_VAR_INFO_T* var, int isclose)
     /* A list of JSON objects providing codec configurations, or ``null``
        if no filters are to be applied. */
     if((stat = NCJaddstring(jvar,NCJ_STRING,"filters"))) goto done;
+    /* A sharded variable lists the shard codec first */
+    if((stat = NCZ_compute_shards(var))) goto done;
+    if(zvar->shards != NULL) {
+	if((stat = NCJnew(NCJ_ARRAY,&jtmp))) goto done;
+	if((stat = NCJnew(NCJ_DICT,&jshard))) goto done;
+	if((stat = NCJaddstring(jshard,NCJ_STRING,"id"))) goto done;
+	if((stat = NCJaddstring(jshard,NCJ_STRING,NCZ_SHARD_CODEC))) goto done;
+	if((stat = NCJappend(jtmp,jshard))) goto done;
+	jshard = NULL;
+    }
 #ifdef ENABLE_NCZARR_FILTERS
     if(nclistlength(filterchain) > 1) {
 	int k;
 	/* jtmp holds the array of filters */
-	if((stat = NCJnew(NCJ_ARRAY,&jtmp))) goto done;
+	if(jtmp == NULL && (stat = NCJnew(NCJ_ARRAY,&jtmp))) goto done;
 	for(k=0;k<nclistlength(filterchain)-1;k++) {
  	    struct NCZ_Filter* filter = (struct NCZ_Filter*)nclistget(filterchain,k);
 	    /* encode up the filter as a string */
@@ -446,7 +460,7 @@ ncz_sync_var_meta(NC_FILE_INFO_T* file, NC_VAR_INFO_T* var, int isclose)
 	}
     } else
 #endif
-    { /* no filters at all */
+    if(jtmp == NULL) { /* no filters at all */
         if((stat = NCJnew(NCJ_NULL,&jtmp))) goto done;
     }
     if((stat = NCJappend(jvar,jtmp))) goto done;
@@ -503,6 +517,18 @@ ncz_sync_var_meta(NC_FILE_INFO_T* file, NC_VAR_INFO_T* var, int isclose)
 	if((stat = NCJinsert(jncvar,"storage",jtmp))) goto done;
 	jtmp = NULL;
 
+	/* Record the shard shape, if any */
+	if(zvar->shards != NULL) {
+	    if((stat = NCJnew(NCJ_ARRAY,&jtmp))) goto done;
+	    for(i=0;i<var->ndims;i++) {
+		char number[64];
+		snprintf(number,sizeof(number),"%llu",(unsigned long long)zvar->shards[i]);
+		NCJaddstring(jtmp,NCJ_INT,number);
+	    }
+	    if((stat = NCJinsert(jncvar,"shards",jtmp))) goto done;
+	    jtmp = NULL;
+	}
+
 	if(!(zinfo->controls.flags & FLAG_PUREZARR)) {
 	    if((stat = NCJinsert(jvar,NCZ_V2_ARRAY,jncvar))) goto done;
 	    jncvar = NULL;
@@ -514,7 +540,7 @@ ncz_sync_var_meta(NC_FILE_INFO_T* file, NC_VAR_INFO_T* var, int isclose)
 	goto done;
 
     /* Write to map */
-    if((stat=NCZ_uploadjson(map,key,jvar)))
+    if((stat=NCZ_uploadmeta(zinfo,key,jvar)))
 	goto done;
     nullfree(key); key = NULL;
 
@@ -535,6 +561,7 @@ done:
     NCJreclaim(jncvar);
     NCJreclaim(jtmp);
     NCJreclaim(jfill);
+    NCJreclaim(jshard);
     return ZUNTRACE(THROW(stat));
 }
 
@@ -669,7 +696,6 @@ ncz_sync_atts(NC_FILE_INFO_T* file, NC_OBJ* container, NCindex* attlist, int isc
     NCjson* jdict = NULL;
     NCjson* jint = NULL;
     NCjson* jdata = NULL;
-    NCZMAP* map = NULL;
     char* fullpath = NULL;
     char* key = NULL;
     char* content = NULL;
@@ -694,7 +720,6 @@ ncz_sync_atts(NC_FILE_INFO_T* file, NC_OBJ* container, NCindex* attlist, int isc
     }
     
     zinfo = file->format_file_info;
-    map = zinfo->map;
 
     purezarr = (zinfo->controls.flags & FLAG_PUREZARR)?1:0;
     if(zinfo->controls.flags & FLAG_XARRAYDIMS) isxarray = 1;
@@ -819,7 +844,7 @@ ncz_sync_atts(NC_FILE_INFO_T* file, NC_OBJ* container, NCindex* attlist, int isc
         if((stat = nczm_concat(fullpath,ZATTRS,&key)))
             goto done;
         /* Write to map */
-        if((stat=NCZ_uploadjson(map,key,jatts)))
+        if((stat=NCZ_uploadmeta(zinfo,key,jatts)))
             goto done;
         nullfree(key); key = NULL;
     }
@@ -846,7 +871,7 @@ done:
 /**
 @internal Extract attributes from a group or var and return
 the corresponding NCjson dict.
-@param map - [in] the map object for storage
+@param zinfo - [in] the file annotation
 @param container - [in] the containing object
 @param jattrsp - [out] the json for .zattrs
 @param jtypesp - [out] the json for .ztypes
@@ -854,7 +879,7 @@ the corresponding NCjson dict.
 @author Dennis Heimbigner
 */
 static int
-load_jatts(NCZMAP* map, NC_OBJ* container, int nczarrv1, NCjson** jattrsp, NClist** atypesp)
+load_jatts(NCZ_FILE_INFO_T* zinfo, NC_OBJ* container, int nczarrv1, NCjson** jattrsp, NClist** atypesp)
 {
     int stat = NC_NOERR;
     char* fullpath = NULL;
@@ -864,7 +889,7 @@ load_jatts(NCZMAP* map, NC_OBJ* container, int nczarrv1, NCjson** jattrsp, NClis
     NCjson* jncattr = NULL;
     NClist* atypes = NULL; /* envv list */
 
-    ZTRACE(3,"map=%p container=%s nczarrv1=%d",map,container->name,nczarrv1);
+    ZTRACE(3,"zinfo=%p container=%s nczarrv1=%d",zinfo,container->name,nczarrv1);
 
     /* alway return (possibly empty) list of types */
     atypes = nclistnew();
@@ -886,7 +911,7 @@ load_jatts(NCZMAP* map, NC_OBJ* container, int nczarrv1, NCjson** jattrsp, NClis
 	goto done;
 
     /* Download the .zattrs object: may not exist if not NCZarr V1 */
-    switch ((stat=NCZ_downloadjson(map,key,&jattrs))) {
+    switch ((stat=NCZ_downloadmeta(zinfo,key,&jattrs))) {
     case NC_NOERR: break;
     case NC_EEMPTY: stat = NC_NOERR; break; /* did not exist */
     default: goto done; /* failure */
@@ -898,12 +923,12 @@ load_jatts(NCZMAP* map, NC_OBJ* container, int nczarrv1, NCjson** jattrsp, NClis
 	    /* Construct the path to the NCZATTRS object */
 	    if((stat = nczm_concat(fullpath,NCZATTRS,&key))) goto done;
 	    /* Download the NCZATTRS object: may not exist if pure zarr or using deprecated name */
-	    stat=NCZ_downloadjson(map,key,&jncattr);
+	    stat=NCZ_downloadmeta(zinfo,key,&jncattr);
 	    if(stat == NC_EEMPTY) {
 	        /* try deprecated name */
 	        nullfree(key); key = NULL;
 	        if((stat = nczm_concat(fullpath,NCZATTRDEP,&key))) goto done;
-	        stat=NCZ_downloadjson(map,key,&jncattr);
+	        stat=NCZ_downloadmeta(zinfo,key,&jncattr);
 	    }
 	} else {/* Get _nczarr_attrs from .zattrs */
             stat = NCJdictget(jattrs,NCZ_V2_ATTR,&jncattr);
@@ -1158,7 +1183,6 @@ define_grp(NC_FILE_INFO_T* file, NC_GRP_INFO_T* grp)
 {
     int stat = NC_NOERR;
     NCZ_FILE_INFO_T* zinfo = NULL;
-    NCZMAP* map = NULL;
     char* fullpath = NULL;
     char* key = NULL;
     NCjson* json = NULL;
@@ -1174,7 +1198,6 @@ define_grp(NC_FILE_INFO_T* file, NC_GRP_INFO_T* grp)
     ZTRACE(3,"file=%s grp=%s",file->controller->path,grp->hdr.name);
     
     zinfo = file->format_file_info;
-    map = zinfo->map;
 
     /* Construct grp path */
     if((stat = NCZ_grpkey(grp,&fullpath)))
@@ -1191,14 +1214,14 @@ define_grp(NC_FILE_INFO_T* file, NC_GRP_INFO_T* grp)
 	        goto done;
 	    /* Read */
 	    jdict = NULL;
-	    stat=NCZ_downloadjson(map,key,&jdict);
+	    stat=NCZ_downloadmeta(zinfo,key,&jdict);
 	    v1 = 1;
 	} else {
   	    /* build ZGROUP path */
 	    if((stat = nczm_concat(fullpath,ZGROUP,&key)))
 	        goto done;
 	    /* Read */
-	    switch (stat=NCZ_downloadjson(map,key,&jgroup)) {
+	    switch (stat=NCZ_downloadmeta(zinfo,key,&jgroup)) {
 	    case NC_NOERR: /* Extract the NCZ_V2_GROUP dict */
 	        if((stat = NCJdictget(jgroup,NCZ_V2_GROUP,&jdict))) goto done;
 		if(!stat && jdict == NULL)
@@ -1264,7 +1287,6 @@ ncz_read_atts(NC_FILE_INFO_T* file, NC_OBJ* container)
     NC_VAR_INFO_T* var = NULL;
     NCZ_VAR_INFO_T* zvar = NULL;
     NC_GRP_INFO_T* grp = NULL;
-    NCZMAP* map = NULL;
     NC_ATT_INFO_T* att = NULL;
     NCindex* attlist = NULL;
     NCjson* jattrs = NULL;
@@ -1279,7 +1301,6 @@ ncz_read_atts(NC_FILE_INFO_T* file, NC_OBJ* container)
     ZTRACE(3,"file=%s container=%s",file->controller->path,container->name);
 
     zinfo = file->format_file_info;
-    map = zinfo->map;
 
     purezarr = (zinfo->controls.flags & FLAG_PUREZARR)?1:0;
  
@@ -1292,7 +1313,7 @@ ncz_read_atts(NC_FILE_INFO_T* file, NC_OBJ* container)
 	attlist =  var->att;
     }
 
-    switch ((stat = load_jatts(map, container, (zinfo->controls.flags & FLAG_NCZARR_V1), &jattrs, &atypes))) {
+    switch ((stat = load_jatts(zinfo, container, (zinfo->controls.flags & FLAG_NCZARR_V1), &jattrs, &atypes))) {
     case NC_NOERR: break;
     case NC_EEMPTY:  /* container has no attributes */
         stat = NC_NOERR;
@@ -1449,7 +1470,6 @@ define_vars(NC_FILE_INFO_T* file, NC_GRP_INFO_T* grp, NClist* varnames)
     int stat = NC_NOERR;
     int i,j;
     NCZ_FILE_INFO_T* zinfo = NULL;
-    NCZMAP* map = NULL;
     int purezarr = 0;
     int xarray = 0;
     int formatv1 = 0;
@@ -1457,7 +1477,6 @@ define_vars(NC_FILE_INFO_T* file, NC_GRP_INFO_T* grp, NClist* varnames)
     ZTRACE(3,"file=%s grp=%s |varnames|=%u",file->controller->path,grp->hdr.name,nclistlength(varnames));
 
     zinfo = file->format_file_info;
-    map = zinfo->map;
 
     if(zinfo->controls.flags & FLAG_PUREZARR) purezarr = 1;
     if(zinfo->controls.flags & FLAG_NCZARR_V1) formatv1 = 1;
@@ -1485,6 +1504,7 @@ define_vars(NC_FILE_INFO_T* file, NC_GRP_INFO_T* grp, NClist* varnames)
         int zarr_rank = 0; /* Need to watch out for scalars */
 #ifdef ENABLE_NCZARR_FILTERS
         NCjson* jfilter = NULL;
+        NCjson* jshard = NULL;
         int chainindex = 0;
 #endif
 
@@ -1514,7 +1534,7 @@ define_vars(NC_FILE_INFO_T* file, NC_GRP_INFO_T* grp, NClist* varnames)
 	if((stat = nczm_concat(varpath,ZARRAY,&key)))
 	    goto done;
 	/* Download the zarray object */
-	if((stat=NCZ_readdict(map,key,&jvar)))
+	if((stat=NCZ_readmetadict(zinfo,key,&jvar)))
 	    goto done;
 	nullfree(key); key = NULL;
 	assert(NCJsort(jvar) == NCJ_DICT);
@@ -1569,7 +1589,7 @@ define_vars(NC_FILE_INFO_T* file, NC_GRP_INFO_T* grp, NClist* varnames)
 		if((stat = nczm_concat(varpath,NCZARRAY,&key)))
 		    goto done;
 		/* Download the nczarray object */
-		if((stat=NCZ_readdict(map,key,&jncvar)))
+		if((stat=NCZ_readmetadict(zinfo,key,&jncvar)))
 		    goto done;
 		nullfree(key); key = NULL;
 	    } else {/* format v2 */
@@ -1615,6 +1635,19 @@ define_vars(NC_FILE_INFO_T* file, NC_GRP_INFO_T* grp, NClist* varnames)
 	    default: goto done;
 	    }
 	    jdimrefs = NULL;
+	    /* Extract the shard shape, if any */
+	    if((stat = NCJdictget(jncvar,"shards",&jvalue)))
+		goto done;
+	    if(jvalue != NULL) {
+		if(NCJsort(jvalue) != NCJ_ARRAY || zvar->scalar || NCJlength(jvalue) != nclistlength(dimnames))
+		    {stat = (THROW(NC_ENCZARR)); goto done;}
+		if((zvar->shards = (size64_t*)malloc(sizeof(size64_t)*NCJlength(jvalue)))==NULL)
+		    {stat = NC_ENOMEM; goto done;}
+		if((stat = decodeints(jvalue, zvar->shards))) goto done;
+		for(j=0;j<NCJlength(jvalue);j++) {
+		    if(zvar->shards[j] == 0) {stat = (THROW(NC_ENCZARR)); goto done;}
+		}
+	    }
 	}
 
 	/* Capture dimension_separator (must precede chunk cache creation) */
@@ -1747,6 +1780,13 @@ define_vars(NC_FILE_INFO_T* file, NC_GRP_INFO_T* grp, NClist* varnames)
 		    jfilter = NCJith(jvalue,k);
 		    if(jfilter == NULL) break; /* done */
 		    if(NCJsort(jfilter) != NCJ_DICT) {stat = NC_EFILTER; goto done;}
+		    /* The shard codec is not a real filter */
+		    if((stat = NCJdictget(jfilter,"id",&jshard))) goto done;
+		    if(jshard != NULL && NCJsort(jshard) == NCJ_STRING
+		       && strcmp(NCJstring(jshard),NCZ_SHARD_CODEC)==0) {
+			if(zvar->shards == NULL) {stat = (THROW(NC_ENCZARR)); goto done;}
+			continue;
+		    }
 		    if((stat = NCZ_filter_build(file,var,jfilter,chainindex++))) goto done;
 		}
 	    }
@@ -1868,7 +1908,7 @@ ncz_read_superblock(NC_FILE_INFO_T* file, char** nczarrvp, char** zarrfp)
     ZTRACE(3,"file=%s",file->controller->path);
 
     /* See if the V1 META-Root is being used */
-    switch(stat = NCZ_downloadjson(zinfo->map, NCZMETAROOT, &jnczgroup)) {
+    switch(stat = NCZ_downloadmeta(zinfo, NCZMETAROOT, &jnczgroup)) {
     case NC_EEMPTY: /* not there */
 	stat = NC_NOERR;
 	break;
@@ -1879,7 +1919,7 @@ ncz_read_superblock(NC_FILE_INFO_T* file, char** nczarrvp, char** zarrfp)
     default: goto done;
     }
     /* Get Zarr Root Group, if any */
-    switch(stat = NCZ_downloadjson(zinfo->map, ZMETAROOT, &jzgroup)) {
+    switch(stat = NCZ_downloadmeta(zinfo, ZMETAROOT, &jzgroup)) {
     case NC_NOERR:
 	break;
     case NC_EEMPTY: /* not there */
@@ -2068,14 +2108,14 @@ searchvars(NCZ_FILE_INFO_T* zfile, NC_GRP_INFO_T* grp, NClist* varnames)
     /* Compute the key for the grp */
     if((stat = NCZ_grpkey(grp,&grpkey))) goto done;
     /* Get the map and search group */
-    if((stat = nczmap_search(zfile->map,grpkey,matches))) goto done;
+    if((stat = NCZ_searchmeta(zfile,grpkey,matches))) goto done;
     for(i=0;i<nclistlength(matches);i++) {
 	const char* name = nclistget(matches,i);
 	if(name[0] == NCZM_DOT) continue; /* zarr/nczarr specific */
 	/* See if name/.zarray exists */
 	if((stat = nczm_concat(grpkey,name,&varkey))) goto done;
 	if((stat = nczm_concat(varkey,ZARRAY,&zarray))) goto done;
-	if((stat = nczmap_exists(zfile->map,zarray)) == NC_NOERR)
+	if((stat = NCZ_existsmeta(zfile,zarray)) == NC_NOERR)
 	    nclistpush(varnames,strdup(name));
 	stat = NC_NOERR;
 	nullfree(varkey); varkey = NULL;
@@ -2102,14 +2142,14 @@ searchsubgrps(NCZ_FILE_INFO_T* zfile, NC_GRP_INFO_T* grp, NClist* subgrpnames)
     /* Compute the key for the grp */
     if((stat = NCZ_grpkey(grp,&grpkey))) goto done;
     /* Get the map and search group */
-    if((stat = nczmap_search(zfile->map,grpkey,matches))) goto done;
+    if((stat = NCZ_searchmeta(zfile,grpkey,matches))) goto done;
     for(i=0;i<nclistlength(matches);i++) {
 	const char* name = nclistget(matches,i);
 	if(name[0] == NCZM_DOT) continue; /* zarr/nczarr specific */
 	/* See if name/.zgroup exists */
 	if((stat = nczm_concat(grpkey,name,&subkey))) goto done;
 	if((stat = nczm_concat(subkey,ZGROUP,&zgroup))) goto done;
-	if((stat = nczmap_exists(zfile->map,zgroup)) == NC_NOERR)
+	if((stat = NCZ_existsmeta(zfile,zgroup)) == NC_NOERR)
 	    nclistpush(subgrpnames,strdup(name));
 	stat = NC_NOERR;
 	nullfree(subkey); subkey = NULL;
@@ -2503,6 +2543,9 @@ ncz_validate(NC_FILE_INFO_T* file)
 	    
     ZTRACE(3,"file=%s",file->controller->path);
 
+    /* Consolidated metadata can only come from a zarr dataset */
+    if(zinfo->consolidated.loaded) {validate = 1; goto done;}
+
     path = strdup("/");
     nclistpush(queue,path);
     path = NULL;
@@ -383,6 +383,10 @@ NCZ_def_var(int ncid, const char *name, nc_type xtype, int ndims,
     zvar->dimension_separator = gstate->zarr.dimension_separator;
     assert(zvar->dimension_separator != 0);
 
+    /* Sharding is an NCZarr extension, so never shard pure Zarr output */
+    if(!(((NCZ_FILE_INFO_T*)h5->format_file_info)->controls.flags & FLAG_PUREZARR))
+        zvar->shard_chunks = gstate->zarr.shard_chunks;
+
     /* Set these state flags for the var. */
     var->is_new_var = NC_TRUE;
     var->meta_read = NC_TRUE;
@@ -1347,9 +1351,8 @@ NCZ_rename_var(int ncid, int varid, const char *name)
 #endif
 
     /* Now change the name in our metadata. */
-    free(var->hdr.name);
-    if (!(var->hdr.name = strdup(name)))
-	return NC_ENOMEM;
+    if ((retval = nc4_rename_obj(h5, (NC_OBJ *)var, name)))
+	return retval;
     LOG((3, "var is now %s", var->hdr.name));
 
     /* rebuild index. */
@@ -2031,13 +2034,8 @@ NCZ_get_vars(int ncid, int varid, const size_t *startp, const size_t *countp,
 
 	/* Copy the fill value into the rest of the data buffer. */
 	filldata = (char *)data + real_data_size;
-	for (i = 0; i < fill_len; i++)
-	{
-	    /* Copy one instance of the fill_value */
-	    if((retval = NC_copy_data(h5->controller,var->type_info->hdr.id,var->fill_value,1,filldata)))
-	        BAIL(retval);
-	    filldata = (char *)filldata + file_type_size;
-	}
+	if((retval = NC_fill_data(h5->controller,var->type_info->hdr.id,var->fill_value,fill_len,filldata)))
+	    BAIL(retval);
     }
 
     /* Convert data type if needed. */
@@ -2278,6 +2276,132 @@ exit:
     return THROW(retval);
 }
 
+/**
+ * @internal Find the var whose stored chunks are to be read or
+ * written, and convert the start of a chunk to chunk indices. The
+ * start must be on a chunk boundary, and inside the current extent
+ * of the var.
+ *
+ * @param ncid File and group ID.
+ * @param varid Variable ID.
+ * @param startp Index of the first element of the chunk.
+ * @param h5p Pointer that gets pointer to file info.
+ * @param varp Pointer that gets pointer to var info.
+ * @param indices Gets the indices of the chunk.
+ *
+ * @return ::NC_NOERR No error.
+ * @return ::NC_EINVAL Var is not chunked.
+ * @return ::NC_EBADTYPE Var has a variable length type.
+ * @return ::NC_EINVALCOORDS Start is not on a chunk boundary.
+ * @return ::NC_EEDGE Chunk is outside the extent of the var.
+ */
+static int
+find_raw_chunk(int ncid, int varid, const size_t* startp, NC_FILE_INFO_T** h5p,
+	       NC_VAR_INFO_T** varp, size64_t* indices)
+{
+    int retval;
+    NC_GRP_INFO_T *grp;
+    NC_FILE_INFO_T *h5;
+    NC_VAR_INFO_T *var;
+    NCZ_VAR_INFO_T* zvar;
+    int d;
+
+    if ((retval = nc4_find_grp_h5_var(ncid, varid, &h5, &grp, &var)))
+	return THROW(retval);
+    zvar = (NCZ_VAR_INFO_T*)var->format_var_info;
+
+    if (zvar->scalar || var->ndims == 0 || var->storage != NC_CHUNKED)
+	return THROW(NC_EINVAL);
+    if (var->type_info->varsized)
+	return THROW(NC_EBADTYPE);
+
+    /* The chunk cache is set up when define mode ends. */
+    if (h5->flags & NC_INDEF)
+    {
+	if (h5->cmode & NC_CLASSIC_MODEL)
+	    return NC_EINDEFINE;
+	if ((retval = ncz_enddef_netcdf4_file(h5)))
+	    return THROW(retval);
+    }
+    if (zvar->cache == NULL)
+	return THROW(NC_EINTERNAL);
+
+    for (d = 0; d < var->ndims; d++)
+    {
+	if (startp[d] % var->chunksizes[d])
+	    return THROW(NC_EINVALCOORDS);
+	if (startp[d] >= var->dim[d]->len)
+	    return THROW(NC_EEDGE);
+	indices[d] = startp[d] / var->chunksizes[d];
+    }
+    *h5p = h5;
+    *varp = var;
+    return NC_NOERR;
+}
+
+/**
+ * @internal Read a chunk of a var as it is stored, with the var's
+ * filters applied. This is the internal function called by
+ * nc_get_var_chunk_raw().
+ *
+ * @param ncid File and group ID.
+ * @param varid Variable ID.
+ * @param startp Index of the first element of the chunk.
+ * @param sizep Pointer that gets the size of the stored chunk, 0 if
+ * the chunk has not been written. Ignored if NULL.
+ * @param data Pointer that gets the stored chunk. Ignored if NULL.
+ *
+ * @return ::NC_NOERR No error.
+ */
+int
+NCZ_get_var_chunk_raw(int ncid, int varid, const size_t *startp, size_t *sizep, void *data)
+{
+    int retval;
+    NC_FILE_INFO_T *h5;
+    NC_VAR_INFO_T *var;
+    size64_t indices[NC_MAX_VAR_DIMS];
+    size64_t size = 0;
+
+    if ((retval = find_raw_chunk(ncid, varid, startp, &h5, &var, indices)))
+	return retval;
+    if ((retval = NCZ_read_chunk_raw(((NCZ_VAR_INFO_T*)var->format_var_info)->cache, indices, &size, data)))
+	return THROW(retval);
+    if (sizep) *sizep = (size_t)size;
+    return NC_NOERR;
+}
+
+/**
+ * @internal Write a chunk of a var as it is to be stored, with the
+ * var's filters applied. This is the internal function called by
+ * nc_put_var_chunk_raw().
+ *
+ * @param ncid File and group ID.
+ * @param varid Variable ID.
+ * @param startp Index of the first element of the chunk.
+ * @param size Size of the stored chunk.
+ * @param data The stored chunk.
+ *
+ * @return ::NC_NOERR No error.
+ * @return ::NC_EPERM File is read-only.
+ */
+int
+NCZ_put_var_chunk_raw(int ncid, int varid, const size_t *startp, size_t size, const void *data)
+{
+    int retval;
+    NC_FILE_INFO_T *h5;
+    NC_VAR_INFO_T *var;
+    size64_t indices[NC_MAX_VAR_DIMS];
+
+    if ((retval = find_raw_chunk(ncid, varid, startp, &h5, &var, indices)))
+	return retval;
+    if (h5->no_write)
+	return NC_EPERM;
+    if ((retval = NCZ_write_chunk_raw(((NCZ_VAR_INFO_T*)var->format_var_info)->cache, indices, size, data)))
+	return THROW(retval);
+    var->written_to = NC_TRUE;
+    return NC_NOERR;
+}
+
 #if 0
 /**
 Given start+count+stride+dim vectors, determine the largest
@@ -23,12 +23,23 @@
 
 #define USEPARAMSIZE 0xffffffffffffffff
 
+/* Max number of shard indices to keep in memory per variable */
+#define SHARDINDEXMAX 16
+
 /* Forward */
 static int get_chunk(NCZChunkCache* cache, NCZCacheEntry* entry);
 static int put_chunk(NCZChunkCache* cache, NCZCacheEntry*);
+static int put_shard(NCZChunkCache* cache, NCZCacheEntry*);
+static int write_shard(NCZChunkCache* cache, NCZShardBuffer* buffer);
+static const void* find_pending(NCZChunkCache* cache, const size64_t* indices, size64_t* sizep);
+static int locate_chunk(NCZChunkCache* cache, NCZCacheEntry* entry, char** pathp, size64_t* offsetp, size64_t* sizep);
+static void free_shard_index(NCZShardIndex* index);
+static void free_shard_buffer(NCZShardBuffer* buffer);
 static int verifycache(NCZChunkCache* cache);
 static int flushcache(NCZChunkCache* cache);
 static int constraincache(NCZChunkCache* cache, size64_t needed);
+static int constrainbudget(NCZChunkCache* cache);
+static int evictentry(NCZChunkCache* cache, NCZCacheEntry* e);
 
 static void
 setmodified(NCZCacheEntry* e, int tf)
@@ -36,6 +47,14 @@ setmodified(NCZCacheEntry* e, int tf)
     e->modified = tf;
 }
 
+/* The chunk cache budget shared by all vars of the file */
+static struct ChunkBudget*
+getbudget(NCZChunkCache* cache)
+{
+    NCZ_FILE_INFO_T* zfile = (NCZ_FILE_INFO_T*)cache->var->container->nc4_info->format_file_info;
+    return &zfile->budget;
+}
+
 /**************************************************/
 /* Dispatch table per-var cache functions */
 
@@ -204,6 +223,14 @@ NCZ_create_chunk_cache(NC_VAR_INFO_T* var, size64_t chunksize, char dimsep, NCZC
     if((cache->mru = nclistnew()) == NULL)
 	{stat = NC_ENOMEM; goto done;}
     nclistsetalloc(cache->mru,cache->params.nelems);
+    if((cache->shardindices = nclistnew()) == NULL)
+	{stat = NC_ENOMEM; goto done;}
+    if((cache->shardbuffers = nclistnew()) == NULL)
+	{stat = NC_ENOMEM; goto done;}
+    /* Track all caches of the file, so the budget can be shared */
+    if(getbudget(cache)->caches == NULL && (getbudget(cache)->caches = nclistnew()) == NULL)
+	{stat = NC_ENOMEM; goto done;}
+    nclistpush(getbudget(cache)->caches,cache);
 
     if(cachep) {*cachep = cache; cache = NULL;}
 done:
@@ -234,6 +261,10 @@ NCZ_free_chunk_cache(NCZChunkCache* cache)
 
     ZTRACE(4,"cache.var=%s",cache->var->hdr.name);
 
+    /* Give back its share of the budget */
+    if(nclistelemremove(getbudget(cache)->caches,cache))
+        getbudget(cache)->used -= cache->used;
+
     /* Iterate over the entries */
     while(nclistlength(cache->mru) > 0) {
 	void* ptr;
@@ -248,6 +279,14 @@ fprintf(stderr,"|cache.free|=%ld\n",nclistlength(cache->mru));
     ncxcachefree(cache->xcache);
     nclistfree(cache->mru);
     cache->mru = NULL;
+    while(nclistlength(cache->shardindices) > 0)
+        free_shard_index((NCZShardIndex*)nclistremove(cache->shardindices,0));
+    nclistfree(cache->shardindices);
+    cache->shardindices = NULL;
+    while(nclistlength(cache->shardbuffers) > 0)
+        free_shard_buffer((NCZShardBuffer*)nclistremove(cache->shardbuffers,0));
+    nclistfree(cache->shardbuffers);
+    cache->shardbuffers = NULL;
     (void)NCZ_reclaim_fill_chunk(cache);
     nullfree(cache);
     (void)ZUNTRACE(NC_NOERR);
@@ -285,6 +324,7 @@ NCZ_read_cache_chunk(NCZChunkCache* cache, const size64_t* indices, void** datap
     case NC_NOERR:
         /* Move to front of the lru */
         (void)ncxcachetouch(cache->xcache,hkey);
+	entry->tick = ++getbudget(cache)->clock;
         break;
     case NC_ENOOBJECT:
         entry = NULL; /* not found; */
@@ -306,6 +346,8 @@ NCZ_read_cache_chunk(NCZChunkCache* cache, const size64_t* indices, void** datap
 	assert(entry->data != NULL);
 	/* Ensure cache constraints not violated; but do it before entry is added */
 	if((stat=verifycache(cache))) goto done;
+	if((stat=constrainbudget(cache))) goto done;
+	entry->tick = ++getbudget(cache)->clock;
         nclistpush(cache->mru,entry);
 	if((stat = ncxcacheinsert(cache->xcache,entry->hashkey,entry))) goto done;
     }
@@ -423,26 +465,9 @@ constraincache(NCZChunkCache* cache, size64_t needed)
 
     /* Flush from LRU end if we are at capacity */
     while(nclistlength(cache->mru) > cache->params.nelems || cache->used > final_size) {
-	int i;
-	void* ptr;
 	NCZCacheEntry* e = ncxcachelast(cache->xcache); /* last entry is the least recently used */
 	if(e == NULL) break;
-        if((stat = ncxcacheremove(cache->xcache,e->hashkey,&ptr))) goto done;
-   	assert(e == ptr);
-        for(i=0;i<nclistlength(cache->mru);i++) {
-	    e = nclistget(cache->mru,i);
-	    if(ptr == e) break;
-	}
-  	assert(e != NULL);
-	assert(i >= 0 && i < nclistlength(cache->mru));
-	nclistremove(cache->mru,i);
-	assert(cache->used >= e->size);
-	/* Note that |old chunk data| may not be same as |new chunk data| because of filters */
-	cache->used -= e->size; /* old size */
-	if(e->modified) /* flush to file */
-	    stat=put_chunk(cache,e);
-	/* reclaim */
-        nullfree(e->data); nullfree(e->key.varkey); nullfree(e->key.chunkkey); nullfree(e);
+	if((stat = evictentry(cache,e))) goto done;
     }
 #ifdef DEBUG
 fprintf(stderr,"|cache.makeroom|=%ld\n",nclistlength(cache->mru));
@@ -451,6 +476,63 @@ done:
     return stat;
 }
 
+/* Remove entries from the caches of all vars of the file, least
+   recently used first, until the file's chunk cache budget is
+   respected, but never leave a cache with less than the budget minimum.
+   The entry being added to cache is not yet in its mru list, so it
+   cannot be removed.
+*/
+static int
+constrainbudget(NCZChunkCache* cache)
+{
+    int stat = NC_NOERR;
+    struct ChunkBudget* budget = getbudget(cache);
+
+    if(budget->size == 0) goto done;
+    while(budget->used > budget->size) {
+	size_t i;
+	NCZChunkCache* victim = NULL;
+	NCZCacheEntry* oldest = NULL;
+	for(i=0;i<nclistlength(budget->caches);i++) {
+	    NCZChunkCache* c = nclistget(budget->caches,i);
+	    NCZCacheEntry* e = ncxcachelast(c->xcache);
+	    if(e == NULL || c->used - e->size < budget->minimum) continue;
+	    if(oldest == NULL || e->tick < oldest->tick) {victim = c; oldest = e;}
+	}
+	if(victim == NULL) break; /* only minimums are left */
+	if((stat = evictentry(victim,oldest))) goto done;
+    }
+done:
+    return stat;
+}
+
+/* Remove an entry from a cache, writing it out if modified */
+static int
+evictentry(NCZChunkCache* cache, NCZCacheEntry* e)
+{
+    int stat = NC_NOERR;
+    size_t i;
+    void* ptr;
+
+    if((stat = ncxcacheremove(cache->xcache,e->hashkey,&ptr))) goto done;
+    assert(e == ptr);
+    for(i=0;i<nclistlength(cache->mru);i++) {
+	if(ptr == nclistget(cache->mru,i)) break;
+    }
+    assert(i < nclistlength(cache->mru));
+    nclistremove(cache->mru,i);
+    assert(cache->used >= e->size);
+    /* Note that |old chunk data| may not be same as |new chunk data| because of filters */
+    cache->used -= e->size; /* old size */
+    getbudget(cache)->used -= e->size;
+    if(e->modified) /* flush to file */
+	stat=put_chunk(cache,e);
+    /* reclaim */
+    nullfree(e->data); nullfree(e->key.varkey); nullfree(e->key.chunkkey); nullfree(e);
+done:
+    return stat;
+}
+
 /**
 Push modified cache entries to disk.
 Also make sure the cache size is correct.
@@ -465,7 +547,7 @@ NCZ_flush_chunk_cache(NCZChunkCache* cache)
 
     ZTRACE(4,"cache.var=%s |cache|=%d",cache->var->hdr.name,(int)nclistlength(cache->mru));
 
-    if(NCZ_cache_size(cache) == 0) goto done;
+    if(NCZ_cache_size(cache) == 0) goto shards;
     
     /* Iterate over the entries in hashmap */
     for(i=0;i<nclistlength(cache->mru);i++) {
@@ -478,14 +560,22 @@ NCZ_flush_chunk_cache(NCZChunkCache* cache)
         setmodified(entry,0);
     }
     /* Re-compute space used */
+    getbudget(cache)->used -= cache->used;
     cache->used = 0;
     for(i=0;i<nclistlength(cache->mru);i++) {
         NCZCacheEntry* entry = nclistget(cache->mru,i);
         cache->used += entry->size;
     }
+    getbudget(cache)->used += cache->used;
     /* Make sure cache size and nelems are correct */
     if((stat=verifycache(cache))) goto done;
 
+shards:
+    /* Write out the shards holding chunks evicted from the cache */
+    while(nclistlength(cache->shardbuffers) > 0) {
+	if((stat = write_shard(cache,(NCZShardBuffer*)nclistget(cache->shardbuffers,0))))
+	    goto done;
+    }
 
 done:
     return ZUNTRACE(stat);
@@ -515,32 +605,7 @@ NCZ_ensure_fill_chunk(NCZChunkCache* cache)
 	char** dst = (char**)(cache->fillchunk);
         for(i=0;i<cache->chunkcount;i++) dst[i] = strdup(src);
     } else
-    switch (typesize) {
-    case 1: {
-        unsigned char c = *((unsigned char*)var->fill_value);
-        memset(cache->fillchunk,c,cache->chunksize);
-        } break;
-    case 2: {
-        unsigned short fv = *((unsigned short*)var->fill_value);
-        unsigned short* p2 = (unsigned short*)cache->fillchunk;
-        for(i=0;i<cache->chunksize;i+=typesize) *p2++ = fv;
-        } break;
-    case 4: {
-        unsigned int fv = *((unsigned int*)var->fill_value);
-        unsigned int* p4 = (unsigned int*)cache->fillchunk;
-        for(i=0;i<cache->chunksize;i+=typesize) *p4++ = fv;
-        } break;
-    case 8: {
-        unsigned long long fv = *((unsigned long long*)var->fill_value);
-        unsigned long long* p8 = (unsigned long long*)cache->fillchunk;
-        for(i=0;i<cache->chunksize;i+=typesize) *p8++ = fv;
-        } break;
-    default: {
-        unsigned char* p;
-        for(p=cache->fillchunk,i=0;i<cache->chunksize;i+=typesize,p+=typesize)
-            memcpy(p,var->fill_value,typesize);
-        } break;
-    }
+        NC_fill_replicate(cache->fillchunk,var->fill_value,typesize,cache->chunkcount);
 done:
     return NC_NOERR;
 }
@@ -577,6 +642,106 @@ done:
     return THROW(stat);
 }
 
+/**
+ * @internal Read the raw (i.e. fixed string and filtered) form of a
+ * chunk as it is stored, without going through the cache. A modified
+ * copy of the chunk in the cache is written out first.
+ *
+ * @param cache Pointer to the cache of the variable
+ * @param indices indices of the chunk
+ * @param sizep return the size of the raw data, 0 if the chunk does
+ * not exist
+ * @param data return the raw data; ignored if NULL
+ *
+ * @return ::NC_NOERR No error.
+ */
+int
+NCZ_read_chunk_raw(NCZChunkCache* cache, const size64_t* indices, size64_t* sizep, void* data)
+{
+    int stat = NC_NOERR;
+    NCZ_FILE_INFO_T* zfile = (NCZ_FILE_INFO_T*)cache->var->container->nc4_info->format_file_info;
+    NCZCacheEntry entry; /* Only the indices and key are used */
+    NCZCacheEntry* cached = NULL;
+    char* path = NULL;
+    size64_t offset = 0;
+    size64_t size = 0;
+
+    memset(&entry,0,sizeof(entry));
+    memcpy(entry.indices,indices,sizeof(size64_t)*cache->ndims);
+
+    switch(stat = ncxcachelookup(cache->xcache,ncxcachekey(indices,sizeof(size64_t)*cache->ndims),(void**)&cached)) {
+    case NC_NOERR:
+	if(cached->modified && (stat = evictentry(cache,cached))) goto done;
+	break;
+    case NC_ENOOBJECT: stat = NC_NOERR; break;
+    default: goto done;
+    }
+
+    if((stat = NCZ_buildchunkpath(cache,indices,&entry.key))) goto done;
+    switch(stat = locate_chunk(cache,&entry,&path,&offset,&size)) {
+    case NC_NOERR: break;
+    case NC_EEMPTY: stat = NC_NOERR; size = 0; goto done;
+    default: goto done;
+    }
+    if(data != NULL && size > 0) {
+	if(path == NULL) /* still held in a shard buffer */
+	    memcpy(data,find_pending(cache,indices,NULL),size);
+	else if((stat = nczmap_read(zfile->map,path,offset,size,data))) goto done;
+    }
+
+done:
+    if(stat == NC_NOERR && sizep) *sizep = size;
+    nullfree(path);
+    nullfree(entry.key.varkey);
+    nullfree(entry.key.chunkkey);
+    return THROW(stat);
+}
+
+/**
+ * @internal Write the raw (i.e. fixed string and filtered) form of a
+ * chunk as it is to be stored, without going through the cache. Any
+ * copy of the chunk in the cache is dropped.
+ *
+ * @param cache Pointer to the cache of the variable
+ * @param indices indices of the chunk
+ * @param size size of the raw data
+ * @param data the raw data
+ *
+ * @return ::NC_NOERR No error.
+ */
+int
+NCZ_write_chunk_raw(NCZChunkCache* cache, const size64_t* indices, size64_t size, const void* data)
+{
+    int stat = NC_NOERR;
+    NCZCacheEntry entry;
+    NCZCacheEntry* cached = NULL;
+
+    memset(&entry,0,sizeof(entry));
+    memcpy(entry.indices,indices,sizeof(size64_t)*cache->ndims);
+
+    switch(stat = ncxcachelookup(cache->xcache,ncxcachekey(indices,sizeof(size64_t)*cache->ndims),(void**)&cached)) {
+    case NC_NOERR:
+	setmodified(cached,0);
+	if((stat = evictentry(cache,cached))) goto done;
+	break;
+    case NC_ENOOBJECT: stat = NC_NOERR; break;
+    default: goto done;
+    }
+
+    if((stat = NCZ_buildchunkpath(cache,indices,&entry.key))) goto done;
+    /* Marked as already encoded, so put_chunk writes it as is */
+    entry.data = (void*)data;
+    entry.size = size;
+    entry.isfiltered = 1;
+    entry.isfixedstring = 1;
+    stat = put_chunk(cache,&entry);
+
+done:
+    nullfree(entry.key.varkey);
+    nullfree(entry.key.chunkkey);
+    return THROW(stat);
+}
+
 /**************************************************/
 /*
 From Zarr V2 Specification:
@@ -655,6 +820,13 @@ put_chunk(NCZChunkCache* cache, NCZCacheEntry* entry)
     zfile = file->format_file_info;
     map = zfile->map;
 
+    /* Sharded chunks are written as part of their containing shard */
+    if((stat = NCZ_compute_shards(cache->var))) goto done;
+    if(((NCZ_VAR_INFO_T*)cache->var->format_var_info)->shards != NULL) {
+	stat = put_shard(cache,entry);
+	goto done;
+    }
+
     /* Collect some info */
     tid = cache->var->type_info->hdr.id;
 
@@ -729,7 +901,8 @@ get_chunk(NCZChunkCache* cache, NCZCacheEntry* entry)
     NCZ_FILE_INFO_T* zfile = NULL;
     NC_TYPE_INFO_T* xtype = NULL;
     char** strchunk = NULL;
-    size64_t size;
+    size64_t size = 0;
+    size64_t offset = 0;
     int empty = 0;
     char* path = NULL;
     int tid;
@@ -747,10 +920,8 @@ get_chunk(NCZChunkCache* cache, NCZCacheEntry* entry)
     xtype = cache->var->type_info;
     tid = xtype->hdr.id;
 
-    /* get size of the "raw" data on "disk" */
-    path = NCZ_chunkpath(entry->key);
-    stat = nczmap_len(map,path,&size);
-    nullfree(path); path = NULL;
+    /* get location and size of the "raw" data on "disk" */
+    stat = locate_chunk(cache,entry,&path,&offset,&size);
     switch(stat) {
     case NC_NOERR: entry->size = size; break;
     case NC_EEMPTY: empty = 1; stat = NC_NOERR; break;
@@ -760,13 +931,22 @@ get_chunk(NCZChunkCache* cache, NCZCacheEntry* entry)
     /* make room in the cache */
     if((stat = constraincache(cache,size))) goto done;    
 
+    /* Making room may have rewritten the containing shard, so locate again */
+    if(!empty && ((NCZ_VAR_INFO_T*)cache->var->format_var_info)->shards != NULL) {
+        nullfree(path); path = NULL;
+        if((stat = locate_chunk(cache,entry,&path,&offset,&size))) goto done;
+        assert(entry->size == size);
+    }
+
     if(!empty) {
         /* Make sure we have a place to read it */
         if((entry->data = (void*)calloc(1,entry->size)) == NULL)
 	    {stat = NC_ENOMEM; goto done;}
 	/* Read the raw data */
-        path = NCZ_chunkpath(entry->key);
-        stat = nczmap_read(map,path,0,entry->size,(char*)entry->data);
+	if(path == NULL) /* still held in a shard buffer */
+	    memcpy(entry->data,find_pending(cache,entry->indices,NULL),entry->size);
+	else
+            stat = nczmap_read(map,path,offset,entry->size,(char*)entry->data);
         nullfree(path); path = NULL;
         switch (stat) {
         case NC_NOERR: break;
@@ -831,6 +1011,7 @@ get_chunk(NCZChunkCache* cache, NCZCacheEntry* entry)
 
     /* track new chunk */
     cache->used += entry->size;
+    getbudget(cache)->used += entry->size;
 
 done:
     nullfree(strchunk);
@@ -859,6 +1040,499 @@ done:
     return THROW(stat);
 }
 
+/**************************************************/
+/* Sharded chunk storage */
+
+/**
+ * @internal Compute the shard shape of a variable from its
+ * requested number of inner chunks per shard. The request is
+ * clipped to the number of chunks along each fixed size dimension.
+ * A variable whose shard would hold only one chunk is left unsharded.
+ * Once computed, the shard shape is fixed for the life of the variable.
+ *
+ * @param var Pointer to var info struct.
+ *
+ * @return ::NC_NOERR No error.
+ */
+int
+NCZ_compute_shards(NC_VAR_INFO_T* var)
+{
+    int stat = NC_NOERR;
+    NCZ_VAR_INFO_T* zvar = (NCZ_VAR_INFO_T*)var->format_var_info;
+    size64_t product = 1;
+    int i;
+
+    if(zvar->shards != NULL || zvar->shard_chunks <= 1) goto done;
+    if(zvar->scalar || var->ndims == 0) goto done;
+    if((zvar->shards = (size64_t*)calloc(var->ndims,sizeof(size64_t)))==NULL)
+	{stat = NC_ENOMEM; goto done;}
+    for(i=0;i<var->ndims;i++) {
+	NC_DIM_INFO_T* dim = var->dim[i];
+	size64_t n = zvar->shard_chunks;
+	if(dim != NULL && !dim->unlimited) {
+	    size64_t nchunks = ceildiv(dim->len,var->chunksizes[i]);
+	    if(nchunks == 0) nchunks = 1;
+	    if(n > nchunks) n = nchunks;
+	}
+	zvar->shards[i] = n;
+	product *= n;
+    }
+    if(product <= 1) {nullfree(zvar->shards); zvar->shards = NULL;}
+done:
+    zvar->shard_chunks = 0; /* request has been consumed */
+    return THROW(stat);
+}
+
+/* Compute the shard containing a chunk and the position of the chunk
+   within that shard (row-major); return number of chunks per shard. */
+static size64_t
+shardof(NCZChunkCache* cache, const size64_t* indices, size64_t* shardindices, size64_t* posp)
+{
+    NCZ_VAR_INFO_T* zvar = (NCZ_VAR_INFO_T*)cache->var->format_var_info;
+    size64_t pos = 0;
+    size64_t count = 1;
+    int r;
+
+    for(r=0;r<cache->ndims;r++) {
+	shardindices[r] = indices[r] / zvar->shards[r];
+	pos = (pos * zvar->shards[r]) + (indices[r] % zvar->shards[r]);
+	count *= zvar->shards[r];
+    }
+    if(posp) *posp = pos;
+    return count;
+}
+
+/* Build the map key of a shard from its shard indices */
+static int
+shardpath(NCZChunkCache* cache, const size64_t* shardindices, char** pathp)
+{
+    int stat = NC_NOERR;
+    struct ChunkKey key = {NULL,NULL};
+    char* chunkkey = NULL;
+    size_t len;
+
+    if((stat = NCZ_buildchunkpath(cache,shardindices,&key))) goto done;
+    /* Prefix the shard indices to distinguish the shard from a chunk */
+    len = strlen(SHARD_PREFIX) + 1 + strlen(key.chunkkey) + 1;
+    if((chunkkey = (char*)malloc(len))==NULL) {stat = NC_ENOMEM; goto done;}
+    snprintf(chunkkey,len,"%s%c%s",SHARD_PREFIX,cache->dimension_separator,key.chunkkey);
+    nullfree(key.chunkkey);
+    key.chunkkey = chunkkey; chunkkey = NULL;
+    if((*pathp = NCZ_chunkpath(key))==NULL) {stat = NC_ENOMEM; goto done;}
+done:
+    nullfree(chunkkey);
+    nullfree(key.varkey);
+    nullfree(key.chunkkey);
+    return THROW(stat);
+}
+
+static size64_t
+decodeu64(const unsigned char* p)
+{
+    size64_t v = 0;
+    int i;
+    for(i=7;i>=0;i--) v = (v << 8) | p[i];
+    return v;
+}
+
+static void
+encodeu64(size64_t v, unsigned char* p)
+{
+    int i;
+    for(i=0;i<8;i++) {p[i] = (unsigned char)(v & 0xff); v >>= 8;}
+}
+
+static void
+free_shard_index(NCZShardIndex* index)
+{
+    if(index == NULL) return;
+    nullfree(index->path);
+    nullfree(index->entries);
+    nullfree(index);
+}
+
+static void
+free_shard_buffer(NCZShardBuffer* buffer)
+{
+    size64_t i;
+    if(buffer == NULL) return;
+    if(buffer->pieces != NULL) {
+	for(i=0;i<buffer->count;i++) nullfree(buffer->pieces[i]);
+	nullfree(buffer->pieces);
+    }
+    nullfree(buffer->lens);
+    nullfree(buffer->path);
+    nullfree(buffer);
+}
+
+/* Find the raw data of a chunk that is held in a shard buffer, if any */
+static const void*
+find_pending(NCZChunkCache* cache, const size64_t* indices, size64_t* sizep)
+{
+    size64_t shardindices[NC_MAX_VAR_DIMS];
+    size64_t pos;
+    size_t i;
+
+    if(nclistlength(cache->shardbuffers) == 0) return NULL;
+    (void)shardof(cache,indices,shardindices,&pos);
+    for(i=0;i<nclistlength(cache->shardbuffers);i++) {
+	NCZShardBuffer* buffer = (NCZShardBuffer*)nclistget(cache->shardbuffers,i);
+	if(memcmp(buffer->shardindices,shardindices,sizeof(size64_t)*cache->ndims) != 0) continue;
+	if(buffer->pieces[pos] == NULL) return NULL;
+	if(sizep) *sizep = buffer->lens[pos];
+	return buffer->pieces[pos];
+    }
+    return NULL;
+}
+
+/**
+ * @internal Get the index of a shard, reading it from the tail of the
+ * shard object if it is not already cached. A non-existent shard
+ * yields an index in which every chunk is missing.
+ *
+ * @param cache Pointer to parent cache
+ * @param path key of the shard object
+ * @param count number of inner chunks in the shard
+ * @param indexp return the (cached) index
+ *
+ * @return ::NC_NOERR No error.
+ */
+static int
+get_shard_index(NCZChunkCache* cache, const char* path, size64_t count, NCZShardIndex** indexp)
+{
+    int stat = NC_NOERR;
+    NCZ_FILE_INFO_T* zfile = (NCZ_FILE_INFO_T*)cache->var->container->nc4_info->format_file_info;
+    NCZShardIndex* index = NULL;
+    unsigned char* raw = NULL;
+    size64_t len = 0;
+    size64_t rawlen = 16 * count;
+    size64_t i;
+
+    /* See if it is already cached; if so, move it to the mru end */
+    for(i=0;i<nclistlength(cache->shardindices);i++) {
+	index = (NCZShardIndex*)nclistget(cache->shardindices,i);
+	if(strcmp(index->path,path)==0) {
+	    nclistremove(cache->shardindices,i);
+	    nclistpush(cache->shardindices,index);
+	    goto done;
+	}
+    }
+    index = NULL;
+
+    if((index = (NCZShardIndex*)calloc(1,sizeof(NCZShardIndex)))==NULL)
+	{stat = NC_ENOMEM; goto done;}
+    if((index->path = strdup(path))==NULL) {stat = NC_ENOMEM; goto done;}
+    index->count = count;
+    if((index->entries = (size64_t*)malloc(sizeof(size64_t)*2*count))==NULL)
+	{stat = NC_ENOMEM; goto done;}
+    for(i=0;i<2*count;i++) index->entries[i] = SHARD_MISSING;
+
+    switch (stat = nczmap_len(zfile->map,path,&len)) {
+    case NC_NOERR: break;
+    case NC_EEMPTY: stat = NC_NOERR; goto cache;
+    default: goto done;
+    }
+    if(len < rawlen) {stat = NC_ENCZARR; goto done;}
+    if((raw = (unsigned char*)malloc(rawlen))==NULL) {stat = NC_ENOMEM; goto done;}
+    /* Read only the index at the tail of the shard */
+    if((stat = nczmap_read(zfile->map,path,len-rawlen,rawlen,raw))) goto done;
+    for(i=0;i<2*count;i++) index->entries[i] = decodeu64(raw+(8*i));
+    /* Validate the index */
+    for(i=0;i<count;i++) {
+	size64_t offset = index->entries[2*i];
+	size64_t nbytes = index->entries[2*i+1];
+	if(offset == SHARD_MISSING) continue;
+	if(offset > len-rawlen || nbytes > (len-rawlen)-offset)
+	    {stat = NC_ENCZARR; goto done;}
+    }
+
+cache:
+    /* Bound the number of cached indices */
+    while(nclistlength(cache->shardindices) >= SHARDINDEXMAX)
+	free_shard_index((NCZShardIndex*)nclistremove(cache->shardindices,0));
+    nclistpush(cache->shardindices,index);
+
+done:
+    if(stat) {free_shard_index(index); index = NULL;}
+    if(indexp) *indexp = index;
+    nullfree(raw);
+    return THROW(stat);
+}
+
+/**
+ * @internal Locate the raw data of a chunk. For unsharded variables,
+ * this is the whole of the chunk object; for sharded variables,
+ * it is a byte range of the containing shard object.
+ *
+ * @param cache Pointer to parent cache
+ * @param entry cache entry whose raw data is to be located
+ * @param pathp return the key of the containing object, or NULL
+ * if the chunk is held in a shard buffer
+ * @param offsetp return the offset of the raw data in the object
+ * @param sizep return the size of the raw data
+ *
+ * @return ::NC_NOERR No error.
+ * @return ::NC_EEMPTY chunk does not exist.
+ */
+static int
+locate_chunk(NCZChunkCache* cache, NCZCacheEntry* entry, char** pathp, size64_t* offsetp, size64_t* sizep)
+{
+    int stat = NC_NOERR;
+    NCZ_FILE_INFO_T* zfile = (NCZ_FILE_INFO_T*)cache->var->container->nc4_info->format_file_info;
+    NCZShardIndex* index = NULL;
+    size64_t shardindices[NC_MAX_VAR_DIMS];
+    size64_t pos, count;
+    char* path = NULL;
+
+    if((stat = NCZ_compute_shards(cache->var))) goto done;
+    if(((NCZ_VAR_INFO_T*)cache->var->format_var_info)->shards == NULL) {
+	path = NCZ_chunkpath(entry->key);
+	*offsetp = 0;
+	stat = nczmap_len(zfile->map,path,sizep);
+	goto done;
+    }
+    if(find_pending(cache,entry->indices,sizep) != NULL) {
+	*offsetp = 0;
+	goto done;
+    }
+    count = shardof(cache,entry->indices,shardindices,&pos);
+    if((stat = shardpath(cache,shardindices,&path))) goto done;
+    if((stat = get_shard_index(cache,path,count,&index))) goto done;
+    if(index->entries[2*pos] == SHARD_MISSING) {stat = NC_EEMPTY; goto done;}
+    *offsetp = index->entries[2*pos];
+    *sizep = index->entries[2*pos+1];
+
+done:
+    if(stat == NC_NOERR) {*pathp = path; path = NULL;}
+    nullfree(path);
+    return stat; /* NC_EEMPTY is not an error */
+}
+
+/**
+ * @internal Produce the raw (i.e. fixed string and filtered) form of
+ * the data of a cache entry as a newly allocated buffer.
+ * The cache entry itself is left unchanged.
+ *
+ * @param cache Pointer to parent cache
+ * @param entry cache entry to encode
+ * @param lenp return the length of the raw data
+ * @param datap return the raw data
+ *
+ * @return ::NC_NOERR No error.
+ */
+static int
+encode_chunk(NCZChunkCache* cache, NCZCacheEntry* entry, size_t* lenp, void** datap)
+{
+    int stat = NC_NOERR;
+    NC_VAR_INFO_T* var = cache->var;
+    size_t len = 0;
+    void* data = NULL;
+
+    if(var->type_info->hdr.id == NC_STRING && !entry->isfixedstring) {
+	int maxstrlen = NCZ_get_maxstrlen((NC_OBJ*)var);
+	assert(maxstrlen > 0);
+	len = cache->chunkcount * maxstrlen;
+	if((data = malloc(len))==NULL) {stat = NC_ENOMEM; goto done;}
+	if((stat = NCZ_char2fixed((const char**)entry->data,data,cache->chunkcount,maxstrlen))) goto done;
+    } else {
+	len = entry->size;
+	if((data = malloc(len))==NULL) {stat = NC_ENOMEM; goto done;}
+	memcpy(data,entry->data,len);
+    }
+#ifdef ENABLE_NCZARR_FILTERS
+    if(!entry->isfiltered && nclistlength((NClist*)var->filters) > 0) {
+	void* filtered = NULL;
+	size_t flen = 0;
+	/* Note that the filter chain will reclaim data if filtered differs */
+	stat = NCZ_applyfilterchain(var->container->nc4_info,var,(NClist*)var->filters,len,data,&flen,&filtered,ENCODING);
+	data = NULL;
+	if(stat) goto done;
+	data = filtered;
+	len = flen;
+    }
+#endif
+    *lenp = len;
+    *datap = data; data = NULL;
+done:
+    nullfree(data);
+    return THROW(stat);
+}
+
+/**
+ * @internal Hold a modified chunk for writing as part of its
+ * containing shard. The shard is written once all of its inner chunks
+ * are held; if the held chunks of all shards take more space than the
+ * larger of the cache size and one shard, the oldest shards are
+ * written.
+ *
+ * @param cache Pointer to parent cache
+ * @param entry cache entry to write
+ *
+ * @return ::NC_NOERR No error.
+ */
+static int
+put_shard(NCZChunkCache* cache, NCZCacheEntry* entry)
+{
+    int stat = NC_NOERR;
+    NCZShardBuffer* buffer = NULL;
+    size64_t shardindices[NC_MAX_VAR_DIMS];
+    size64_t pos, count, limit;
+    size_t i, len = 0;
+    void* piece = NULL;
+
+    count = shardof(cache,entry->indices,shardindices,&pos);
+    if((stat = encode_chunk(cache,entry,&len,&piece))) goto done;
+
+    for(i=0;i<nclistlength(cache->shardbuffers);i++) {
+	buffer = (NCZShardBuffer*)nclistget(cache->shardbuffers,i);
+	if(memcmp(buffer->shardindices,shardindices,sizeof(size64_t)*cache->ndims) == 0) break;
+	buffer = NULL;
+    }
+    if(buffer == NULL) {
+	if((buffer = (NCZShardBuffer*)calloc(1,sizeof(NCZShardBuffer)))==NULL)
+	    {stat = NC_ENOMEM; goto done;}
+	memcpy(buffer->shardindices,shardindices,sizeof(size64_t)*cache->ndims);
+	buffer->count = count;
+	if((stat = shardpath(cache,shardindices,&buffer->path))
+	   || (buffer->pieces = (void**)calloc(count,sizeof(void*)))==NULL
+	   || (buffer->lens = (size_t*)calloc(count,sizeof(size_t)))==NULL) {
+	    if(stat == NC_NOERR) stat = NC_ENOMEM;
+	    free_shard_buffer(buffer);
+	    goto done;
+	}
+	nclistpush(cache->shardbuffers,buffer);
+    }
+    if(buffer->pieces[pos] != NULL) {
+	nullfree(buffer->pieces[pos]);
+	buffer->size -= buffer->lens[pos];
+	cache->pending -= buffer->lens[pos];
+    } else
+	buffer->npieces++;
+    buffer->pieces[pos] = piece; piece = NULL;
+    buffer->lens[pos] = len;
+    buffer->size += len;
+    cache->pending += len;
+
+    if(buffer->npieces == buffer->count) {
+	if((stat = write_shard(cache,buffer))) goto done;
+    }
+    /* Bound the space used by the held chunks */
+    limit = cache->params.size;
+    if(limit < count * cache->chunksize) limit = count * cache->chunksize;
+    while(cache->pending > limit && nclistlength(cache->shardbuffers) > 0) {
+	if((stat = write_shard(cache,(NCZShardBuffer*)nclistget(cache->shardbuffers,0)))) goto done;
+    }
+
+done:
+    nullfree(piece);
+    return THROW(stat);
+}
+
+/**
+ * @internal Write a shard from its buffer of held chunks. Modified
+ * chunks of the same shard that are in the cache are written at the
+ * same time and marked as unmodified. Chunks of the shard that are
+ * neither held nor modified are carried over from the existing shard
+ * object, if any. The buffer is removed from the cache and reclaimed,
+ * even on error.
+ *
+ * @param cache Pointer to parent cache
+ * @param buffer the shard buffer to write
+ *
+ * @return ::NC_NOERR No error.
+ */
+static int
+write_shard(NCZChunkCache* cache, NCZShardBuffer* buffer)
+{
+    int stat = NC_NOERR;
+    NCZ_FILE_INFO_T* zfile = (NCZ_FILE_INFO_T*)cache->var->container->nc4_info->format_file_info;
+    NCZShardIndex* index = NULL;
+    size64_t otherindices[NC_MAX_VAR_DIMS];
+    size64_t count = buffer->count;
+    size64_t i;
+    size64_t oldlen = 0;
+    size64_t newlen = 0;
+    char* path = buffer->path;
+    unsigned char* olddata = NULL;
+    unsigned char* newdata = NULL;
+    size_t* lens = buffer->lens;
+    void** pieces = buffer->pieces;
+
+    (void)nclistelemremove(cache->shardbuffers,buffer);
+    cache->pending -= buffer->size;
+
+    if((stat = get_shard_index(cache,path,count,&index))) goto done;
+
+    /* Modified chunks of the same shard that are in the cache are newer */
+    for(i=0;i<nclistlength(cache->mru);i++) {
+	NCZCacheEntry* e = (NCZCacheEntry*)nclistget(cache->mru,i);
+	size64_t epos;
+	if(!e->modified) continue;
+	(void)shardof(cache,e->indices,otherindices,&epos);
+	if(memcmp(otherindices,buffer->shardindices,sizeof(size64_t)*cache->ndims) != 0) continue;
+	nullfree(pieces[epos]); pieces[epos] = NULL;
+	if((stat = encode_chunk(cache,e,&lens[epos],&pieces[epos]))) goto done;
+	setmodified(e,0);
+    }
+
+    /* Read the data part of the existing shard in one request */
+    for(i=0;i<count;i++) {
+	if(pieces[i] != NULL || index->entries[2*i] == SHARD_MISSING) continue;
+	if(index->entries[2*i] + index->entries[2*i+1] > oldlen)
+	    oldlen = index->entries[2*i] + index->entries[2*i+1];
+    }
+    if(oldlen > 0) {
+	if((olddata = (unsigned char*)malloc(oldlen))==NULL) {stat = NC_ENOMEM; goto done;}
+	if((stat = nczmap_read(zfile->map,path,0,oldlen,olddata))) goto done;
+    }
+
+    /* Assemble the new shard: the inner chunks followed by the index */
+    for(i=0;i<count;i++) {
+	if(pieces[i] != NULL) newlen += lens[i];
+	else if(index->entries[2*i] != SHARD_MISSING) newlen += index->entries[2*i+1];
+    }
+    newlen += 16 * count;
+    if((newdata = (unsigned char*)malloc(newlen))==NULL) {stat = NC_ENOMEM; goto done;}
+    {
+	unsigned char* p = newdata;
+	unsigned char* q = newdata + (newlen - (16 * count));
+	for(i=0;i<count;i++) {
+	    size64_t offset = SHARD_MISSING;
+	    size64_t nbytes = SHARD_MISSING;
+	    if(pieces[i] != NULL) {
+		offset = (size64_t)(p - newdata);
+		nbytes = lens[i];
+		memcpy(p,pieces[i],lens[i]);
+	    } else if(index->entries[2*i] != SHARD_MISSING) {
+		offset = (size64_t)(p - newdata);
+		nbytes = index->entries[2*i+1];
+		memcpy(p,olddata+index->entries[2*i],nbytes);
+	    }
+	    if(offset != SHARD_MISSING) p += nbytes;
+	    encodeu64(offset,q); q += 8;
+	    encodeu64(nbytes,q); q += 8;
+	    index->entries[2*i] = offset;
+	    index->entries[2*i+1] = nbytes;
+	}
+    }
+    if((stat = nczmap_write(zfile->map,path,newlen,newdata))) goto done;
+
+done:
+    if(stat && index != NULL) {
+	/* The cached index may no longer be valid */
+	for(i=0;i<nclistlength(cache->shardindices);i++) {
+	    if(nclistget(cache->shardindices,i) == index) {
+		free_shard_index((NCZShardIndex*)nclistremove(cache->shardindices,i));
+		break;
+	    }
+	}
+    }
+    free_shard_buffer(buffer);
+    nullfree(olddata);
+    nullfree(newdata);
+    return THROW(stat);
+}
+
 void
 NCZ_dumpxcacheentry(NCZChunkCache* cache, NCZCacheEntry* e, NCbytes* buf)
 {
@@ -167,15 +167,9 @@ fill_NC_var(NC3_INFO* ncp, const NC_var *varp, long long varsize, size_t recno)
 		else
 		{
 			/* Use the user defined value */
-			char *cp = xfillp;
-			const char *const end = &xfillp[sizeof(xfillp)];
-
 			assert(step <= (*attrpp)->xsz);
 
-			for( /*NADA*/; cp < end; cp += step)
-			{
-				(void) memcpy(cp, (*attrpp)->xvalue, step);
-			}
+			NC_fill_replicate(xfillp, (*attrpp)->xvalue, step, nelems);
 		}
 	}
 	else
@@ -252,7 +246,6 @@ fill_NC_var(NC3_INFO* ncp, const NC_var *varp, long long varsize, size_t recno)
 	for(;;)
 	{
 		const size_t chunksz = MIN(remaining, ncp->chunk);
-		size_t ii;
 
 		status = ncio_get(ncp->nciop, offset, chunksz,
 				 RGN_WRITE, &xp);
@@ -264,11 +257,8 @@ fill_NC_var(NC3_INFO* ncp, const NC_var *varp, long long varsize, size_t recno)
 		/*
 		 * fill the chunksz buffer in units  of xsz
 		 */
-		for(ii = 0; ii < chunksz/xsz; ii++)
-		{
-			(void) memcpy(xp, xfillp, xsz);
-			xp = (char *)xp + xsz;
-		}
+		NC_fill_replicate(xp, xfillp, xsz, chunksz/xsz);
+		xp = (char *)xp + (chunksz/xsz)*xsz;
 		/*
 		 * Deal with any remainder
 		 */
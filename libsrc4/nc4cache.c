@@ -106,6 +106,66 @@ nc_get_chunk_cache(size_t *sizep, size_t *nelemsp, float *preemptionp)
     return NC_NOERR;
 }
 
+/**
+ * Set a chunk cache budget shared by the variables of a file. Only
+ * affects netCDF-4/HDF5 and NCZarr files opened/created *after* it
+ * is called.
+ *
+ * Without a budget, each variable has a chunk cache of its own (see
+ * nc_set_chunk_cache() and nc_set_var_chunk_cache()), so the memory
+ * used for caching grows with the number of variables that are read
+ * or written. With a budget, the chunk caches of all the variables
+ * of a file together hold no more than size bytes. A variable that
+ * is in use may take cache space from variables that have not been
+ * used recently, up to its own chunk cache size; each variable keeps
+ * at least minimum bytes (for NCZarr, at least one chunk, if minimum
+ * is not 0), even if that means exceeding the budget.
+ *
+ * For netCDF-4/HDF5 files, HDF5 fixes the chunk cache size of a
+ * dataset when it is opened, so a variable's dataset is reopened
+ * when its share of the budget changes, and the chunks in its cache
+ * are dropped. The budget is not used for files opened for parallel
+ * I/O.
+ *
+ * @param size Size in bytes of the budget of each file. 0 (the
+ * default) means no budget.
+ * @param minimum Size in bytes of chunk cache each variable keeps.
+ *
+ * @return ::NC_NOERR No error.
+ * @ingroup datasets
+ */
+int
+nc_set_chunk_cache_budget(size_t size, size_t minimum)
+{
+    NCglobalstate* gs = NC_getglobalstate();
+    gs->chunkcachebudget.size = size;
+    gs->chunkcachebudget.minimum = minimum;
+    return NC_NOERR;
+}
+
+/**
+ * Get the current chunk cache budget settings, as set by
+ * nc_set_chunk_cache_budget().
+ *
+ * @param sizep Pointer that gets the budget in bytes. Ignored if
+ * NULL.
+ * @param minimump Pointer that gets the minimum chunk cache size of
+ * each variable. Ignored if NULL.
+ *
+ * @return ::NC_NOERR No error.
+ * @ingroup datasets
+ */
+int
+nc_get_chunk_cache_budget(size_t *sizep, size_t *minimump)
+{
+    NCglobalstate* gs = NC_getglobalstate();
+    if (sizep)
+        *sizep = gs->chunkcachebudget.size;
+    if (minimump)
+        *minimump = gs->chunkcachebudget.minimum;
+    return NC_NOERR;
+}
+
 /**
  * @internal Set the chunk cache. This is like nc_set_chunk_cache()
  * but with integers instead of size_t, and with an integer preemption
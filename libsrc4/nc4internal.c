@@ -348,6 +348,11 @@ nc4_nc4f_list_add(NC *nc, const char *path, int mode)
     h5->alltypes = nclistnew();
     h5->allgroups = nclistnew();
 
+    /* Vars, dims and atts are allocated from this arena and released
+     * all at once when the file is closed. */
+    if (!(h5->arena = ncarenanew(0)))
+        return NC_ENOMEM;
+
     /* There's always at least one open group - the root
      * group. Allocate space for one group's worth of information. Set
      * its grp id, name, and allocate associated empty lists. */
@@ -736,7 +741,7 @@ nc4_var_list_add2(NC_GRP_INFO_T *grp, const char *name, NC_VAR_INFO_T **var)
     NCglobalstate* gs = NC_getglobalstate();
 
     /* Allocate storage for new variable. */
-    if (!(new_var = calloc(1, sizeof(NC_VAR_INFO_T))))
+    if (!(new_var = ncarenaalloc(grp->nc4_info->arena, sizeof(NC_VAR_INFO_T))))
         return NC_ENOMEM;
     new_var->hdr.sort = NCVAR;
     new_var->container = grp;
@@ -748,11 +753,8 @@ nc4_var_list_add2(NC_GRP_INFO_T *grp, const char *name, NC_VAR_INFO_T **var)
 
     /* Now fill in the values in the var info structure. */
     new_var->hdr.id = ncindexsize(grp->vars);
-    if (!(new_var->hdr.name = strdup(name))) {
-      if(new_var)
-        free(new_var);
-      return NC_ENOMEM;
-    }
+    if (!(new_var->hdr.name = ncarenastrdup(grp->nc4_info->arena, name)))
+        return NC_ENOMEM;
 
     /* Create an indexed list for the attributes. */
     new_var->att = ncindexnew(0);
@@ -849,7 +851,7 @@ nc4_dim_list_add(NC_GRP_INFO_T *grp, const char *name, size_t len,
     assert(grp && name);
 
     /* Allocate memory for dim metadata. */
-    if (!(new_dim = calloc(1, sizeof(NC_DIM_INFO_T))))
+    if (!(new_dim = ncarenaalloc(grp->nc4_info->arena, sizeof(NC_DIM_INFO_T))))
         return NC_ENOMEM;
 
     new_dim->hdr.sort = NCDIM;
@@ -861,12 +863,8 @@ nc4_dim_list_add(NC_GRP_INFO_T *grp, const char *name, size_t len,
         new_dim->hdr.id = grp->nc4_info->next_dimid++;
 
     /* Remember the name and create a hash. */
-    if (!(new_dim->hdr.name = strdup(name))) {
-      if(new_dim)
-        free(new_dim);
-
-      return NC_ENOMEM;
-    }
+    if (!(new_dim->hdr.name = ncarenastrdup(grp->nc4_info->arena, name)))
+        return NC_ENOMEM;
 
     /* Is dimension unlimited? */
     new_dim->len = len;
@@ -887,10 +885,27 @@ nc4_dim_list_add(NC_GRP_INFO_T *grp, const char *name, size_t len,
     return NC_NOERR;
 }
 
+/**
+ * @internal Find the file that a group or var belongs to.
+ *
+ * @param obj Pointer to a group or var.
+ *
+ * @return Pointer to the file info.
+ */
+static NC_FILE_INFO_T *
+obj_file(NC_OBJ *obj)
+{
+    if (obj->sort == NCVAR)
+        obj = (NC_OBJ *)((NC_VAR_INFO_T *)obj)->container;
+    assert(obj->sort == NCGRP);
+    return ((NC_GRP_INFO_T *)obj)->nc4_info;
+}
+
 /**
  * @internal Add to an attribute list.
  *
  * @param list NCindex of att info structs.
+ * @param container The group or var that owns the list.
  * @param name name of the new attribute
  * @param att Pointer to pointer that gets the new att info
  * struct. Ignored if NULL.
@@ -900,23 +915,25 @@ nc4_dim_list_add(NC_GRP_INFO_T *grp, const char *name, size_t len,
  * @author Ed Hartnett
  */
 int
-nc4_att_list_add(NCindex *list, const char *name, NC_ATT_INFO_T **att)
+nc4_att_list_add(NCindex *list, NC_OBJ *container, const char *name,
+                 NC_ATT_INFO_T **att)
 {
     NC_ATT_INFO_T *new_att = NULL;
+    NCarena *arena;
 
+    assert(container);
     LOG((3, "%s: name %s ", __func__, name));
 
-    if (!(new_att = calloc(1, sizeof(NC_ATT_INFO_T))))
+    arena = obj_file(container)->arena;
+    if (!(new_att = ncarenaalloc(arena, sizeof(NC_ATT_INFO_T))))
         return NC_ENOMEM;
     new_att->hdr.sort = NCATT;
+    new_att->container = container;
 
     /* Fill in the information we know. */
     new_att->hdr.id = ncindexsize(list);
-    if (!(new_att->hdr.name = strdup(name))) {
-      if(new_att)
-        free(new_att);
-      return NC_ENOMEM;
-    }
+    if (!(new_att->hdr.name = ncarenastrdup(arena, name)))
+        return NC_ENOMEM;
 
     /* Add object to list as specified by its number */
     ncindexadd(list, (NC_OBJ *)new_att);
@@ -1326,19 +1343,10 @@ nc4_att_free(NC_ATT_INFO_T *att)
     assert(att);
     LOG((3, "%s: name %s ", __func__, att->hdr.name));
 
-    /* Free the name. */
-    if (att->hdr.name)
-        free(att->hdr.name);
-
+    /* The att and its name belong to the file's arena, and are
+     * released when the file is closed. */
     if (att->data) {
-	NC_OBJ* parent;
-	NC_FILE_INFO_T* h5 = NULL;
-
-	/* Locate relevant objects */
-	parent = att->container;
-	if(parent->sort == NCVAR) parent = (NC_OBJ*)(((NC_VAR_INFO_T*)parent)->container);
-	assert(parent->sort == NCGRP);
-	h5 = ((NC_GRP_INFO_T*)parent)->nc4_info;
+	NC_FILE_INFO_T* h5 = obj_file(att->container);
 	/* Reclaim the attribute data */
 	if((stat = NC_reclaim_data(h5->controller,att->nc_typeid,att->data,att->len))) goto done;
 	free(att->data); /* reclaim top level */
@@ -1346,7 +1354,6 @@ nc4_att_free(NC_ATT_INFO_T *att)
     }
 
 done:
-    free(att);
     return stat;
 }
 
@@ -1399,13 +1406,8 @@ var_free(NC_VAR_INFO_T *var)
         if ((retval = nc4_type_free(var->type_info)))
             return retval;
 
-    /* Do this last because debugging may need it */
-    if (var->hdr.name)
-        free(var->hdr.name);
-
-    /* Delete the var. */
-    free(var);
-
+    /* The var and its name belong to the file's arena, and are
+     * released when the file is closed. */
     return NC_NOERR;
 }
 
@@ -1447,11 +1449,8 @@ dim_free(NC_DIM_INFO_T *dim)
     assert(dim);
     LOG((4, "%s: deleting dim %s", __func__, dim->hdr.name));
 
-    /* Free memory allocated for names. */
-    if (dim->hdr.name)
-        free(dim->hdr.name);
-
-    free(dim);
+    /* The dim and its name belong to the file's arena, and are
+     * released when the file is closed. */
     return NC_NOERR;
 }
 
@@ -1565,7 +1564,9 @@ nc4_rec_grp_del_att_data(NC_GRP_INFO_T *grp)
     /* Free attribute data in this group */
     for (i = 0; i < ncindexsize(grp->att); i++) {
 	NC_ATT_INFO_T * att = (NC_ATT_INFO_T*)ncindexith(grp->att, i);
-	if((retval = NC_reclaim_data_all(grp->nc4_info->controller,att->nc_typeid,att->data,att->len)))
+	/* The value of an att may never have been read. */
+	if(att->data != NULL
+	   && (retval = NC_reclaim_data_all(grp->nc4_info->controller,att->nc_typeid,att->data,att->len)))
 	    return retval;
 	att->data = NULL;
 	att->len = 0;
@@ -1578,7 +1579,8 @@ nc4_rec_grp_del_att_data(NC_GRP_INFO_T *grp)
 	NC_VAR_INFO_T* v = (NC_VAR_INFO_T *)ncindexith(grp->vars, i);
 	for(j=0;j<ncindexsize(v->att);j++) {
 	    NC_ATT_INFO_T* att = (NC_ATT_INFO_T*)ncindexith(v->att, j);
-   	    if((retval = NC_reclaim_data_all(grp->nc4_info->controller,att->nc_typeid,att->data,att->len)))
+   	    if(att->data != NULL
+	       && (retval = NC_reclaim_data_all(grp->nc4_info->controller,att->nc_typeid,att->data,att->len)))
 	        return retval;
 	    att->data = NULL;
 	    att->len = 0;
@@ -1673,6 +1675,9 @@ nc4_nc4f_list_del(NC_FILE_INFO_T *h5)
     nclistfree(h5->allgroups);
     nclistfree(h5->alltypes);
 
+    /* Release all vars, dims and atts at once. */
+    ncarenafree(h5->arena);
+
     /* Free the NC_FILE_INFO_T struct. */
     nullfree(h5->hdr.name);
     free(h5);
@@ -1680,6 +1685,29 @@ nc4_nc4f_list_del(NC_FILE_INFO_T *h5)
     return NC_NOERR;
 }
 
+/**
+ * @internal Give a var, dim or att a new name. The old name belongs
+ * to the file's arena, so it is not freed here.
+ *
+ * @param h5 Pointer to file info.
+ * @param obj Pointer to the var, dim or att.
+ * @param name The new name.
+ *
+ * @return ::NC_NOERR No error.
+ * @return ::NC_ENOMEM Out of memory.
+ */
+int
+nc4_rename_obj(NC_FILE_INFO_T *h5, NC_OBJ *obj, const char *name)
+{
+    char *newname;
+
+    assert(h5 && obj && obj->sort != NCGRP && obj->sort != NCTYP);
+    if (!(newname = ncarenastrdup(h5->arena, name)))
+        return NC_ENOMEM;
+    obj->name = newname;
+    return NC_NOERR;
+}
+
 /**
  * @internal Normalize a UTF8 name. Put the result in norm_name, which
  * can be NC_MAX_NAME + 1 in size. This function makes sure the free()
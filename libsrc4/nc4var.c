@@ -448,6 +448,119 @@ NC4_var_par_access(int ncid, int varid, int par_access)
 #endif /* USE_PARALLEL4 */
 }
 
+/* Where the compiler supports it, build the quantize kernels for
+ * several instruction sets and pick one at load time by CPU
+ * features. */
+#ifdef HAVE_ATTRIBUTE_TARGET_CLONES
+#define NC_TARGET_CLONES __attribute__((target_clones("avx2","default")))
+#else
+#define NC_TARGET_CLONES
+#endif
+
+/* The quantize kernels below are written without branches, and
+ * access the values only as integers, so that the compiler can
+ * vectorize them. Values equal to the fill value are left alone. */
+
+/**
+ * @internal BitGroom an array of floats: shave the LSBs of even
+ * elements, set the LSBs of odd non-zero elements.
+ *
+ * @param u32 The float data, as bits.
+ * @param len Number of elements.
+ * @param fill Fill value.
+ * @param zro Mask for shaving.
+ * @param one Mask for setting.
+ */
+static NC_TARGET_CLONES void
+quantize_bitgroom_float(unsigned int *u32, size_t len, float fill,
+                        unsigned int zro, unsigned int one)
+{
+    size_t idx;
+    for (idx = 0; idx < len; idx++)
+    {
+        unsigned int u = u32[idx], q;
+        float f;
+        memcpy(&f, &u, sizeof(f));
+        /* Never quantize upwards floating point values of zero */
+        q = (idx & 1) ? (u != 0U ? (u | one) : u) : (u & zro);
+        u32[idx] = (f != fill) ? q : u;
+    }
+}
+
+/**
+ * @internal BitGroom an array of doubles; see
+ * quantize_bitgroom_float().
+ *
+ * @param u64 The double data, as bits.
+ * @param len Number of elements.
+ * @param fill Fill value.
+ * @param zro Mask for shaving.
+ * @param one Mask for setting.
+ */
+static NC_TARGET_CLONES void
+quantize_bitgroom_double(unsigned long long *u64, size_t len, double fill,
+                         unsigned long long zro, unsigned long long one)
+{
+    size_t idx;
+    for (idx = 0; idx < len; idx++)
+    {
+        unsigned long long u = u64[idx], q;
+        double d;
+        memcpy(&d, &u, sizeof(d));
+        /* Never quantize upwards floating point values of zero */
+        q = (idx & 1) ? (u != 0ULL ? (u | one) : u) : (u & zro);
+        u64[idx] = (d != fill) ? q : u;
+    }
+}
+
+/**
+ * @internal BitRound an array of floats: add 1 to the MSB of the
+ * LSBs, carrying into the mantissa or even exponent, then shave.
+ *
+ * @param u32 The float data, as bits.
+ * @param len Number of elements.
+ * @param fill Fill value.
+ * @param zro Mask for shaving.
+ * @param hshv Mask with the MSB of the LSBs set.
+ */
+static NC_TARGET_CLONES void
+quantize_bitround_float(unsigned int *u32, size_t len, float fill,
+                        unsigned int zro, unsigned int hshv)
+{
+    size_t idx;
+    for (idx = 0; idx < len; idx++)
+    {
+        unsigned int u = u32[idx];
+        float f;
+        memcpy(&f, &u, sizeof(f));
+        u32[idx] = (f != fill) ? ((u + hshv) & zro) : u;
+    }
+}
+
+/**
+ * @internal BitRound an array of doubles; see
+ * quantize_bitround_float().
+ *
+ * @param u64 The double data, as bits.
+ * @param len Number of elements.
+ * @param fill Fill value.
+ * @param zro Mask for shaving.
+ * @param hshv Mask with the MSB of the LSBs set.
+ */
+static NC_TARGET_CLONES void
+quantize_bitround_double(unsigned long long *u64, size_t len, double fill,
+                         unsigned long long zro, unsigned long long hshv)
+{
+    size_t idx;
+    for (idx = 0; idx < len; idx++)
+    {
+        unsigned long long u = u64[idx];
+        double d;
+        memcpy(&d, &u, sizeof(d));
+        u64[idx] = (d != fill) ? ((u + hshv) & zro) : u;
+    }
+}
+
 /**
  * @internal Copy data from one buffer to another, performing
  * appropriate data conversion.
@@ -523,6 +636,7 @@ nc4_convert_type(const void *src, void *dest, const nc_type src_type,
     long long *lip, *lip1;
     unsigned long long *ulip, *ulip1;
     size_t count = 0;
+    int nrange = 0; /* local, so that the loops below can be vectorized */
 
     *range_error = 0;
     LOG((3, "%s: len %d src_type %d dest_type %d", __func__, len, src_type,
@@ -658,7 +772,7 @@ nc4_convert_type(const void *src, void *dest, const nc_type src_type,
             for (bp = (signed char *)src, ubp = dest; count < len; count++)
             {
                 if (*bp < 0)
-                    (*range_error)++;
+                    nrange++;
                 *ubp++ = *bp++;
             }
             break;
@@ -670,7 +784,7 @@ nc4_convert_type(const void *src, void *dest, const nc_type src_type,
             for (bp = (signed char *)src, usp = dest; count < len; count++)
             {
                 if (*bp < 0)
-                    (*range_error)++;
+                    nrange++;
                 *usp++ = *bp++;
             }
             break;
@@ -682,7 +796,7 @@ nc4_convert_type(const void *src, void *dest, const nc_type src_type,
             for (bp = (signed char *)src, uip = dest; count < len; count++)
             {
                 if (*bp < 0)
-                    (*range_error)++;
+                    nrange++;
                 *uip++ = *bp++;
             }
             break;
@@ -694,7 +808,7 @@ nc4_convert_type(const void *src, void *dest, const nc_type src_type,
             for (bp = (signed char *)src, ulip = dest; count < len; count++)
             {
                 if (*bp < 0)
-                    (*range_error)++;
+                    nrange++;
                 *ulip++ = *bp++;
             }
             break;
@@ -720,7 +834,7 @@ nc4_convert_type(const void *src, void *dest, const nc_type src_type,
             for (ubp = (unsigned char *)src, bp = dest; count < len; count++)
             {
                 if (!strict_nc3 && *ubp > X_SCHAR_MAX)
-                    (*range_error)++;
+                    nrange++;
                 *bp++ = *ubp++;
             }
             break;
@@ -774,7 +888,7 @@ nc4_convert_type(const void *src, void *dest, const nc_type src_type,
             for (sp = (short *)src, ubp = dest; count < len; count++)
             {
                 if (*sp > X_UCHAR_MAX || *sp < 0)
-                    (*range_error)++;
+                    nrange++;
                 *ubp++ = *sp++;
             }
             break;
@@ -782,7 +896,7 @@ nc4_convert_type(const void *src, void *dest, const nc_type src_type,
             for (sp = (short *)src, bp = dest; count < len; count++)
             {
                 if (*sp > X_SCHAR_MAX || *sp < X_SCHAR_MIN)
-                    (*range_error)++;
+                    nrange++;
                 *bp++ = *sp++;
             }
             break;
@@ -794,7 +908,7 @@ nc4_convert_type(const void *src, void *dest, const nc_type src_type,
             for (sp = (short *)src, usp = dest; count < len; count++)
             {
                 if (*sp < 0)
-                    (*range_error)++;
+                    nrange++;
                 *usp++ = *sp++;
             }
             break;
@@ -806,7 +920,7 @@ nc4_convert_type(const void *src, void *dest, const nc_type src_type,
             for (sp = (short *)src, uip = dest; count < len; count++)
             {
                 if (*sp < 0)
-                    (*range_error)++;
+                    nrange++;
                 *uip++ = *sp++;
             }
             break;
@@ -818,7 +932,7 @@ nc4_convert_type(const void *src, void *dest, const nc_type src_type,
             for (sp = (short *)src, ulip = dest; count < len; count++)
             {
                 if (*sp < 0)
-                    (*range_error)++;
+                    nrange++;
                 *ulip++ = *sp++;
             }
             break;
@@ -844,7 +958,7 @@ nc4_convert_type(const void *src, void *dest, const nc_type src_type,
             for (usp = (unsigned short *)src, ubp = dest; count < len; count++)
             {
                 if (*usp > X_UCHAR_MAX)
-                    (*range_error)++;
+                    nrange++;
                 *ubp++ = *usp++;
             }
             break;
@@ -852,7 +966,7 @@ nc4_convert_type(const void *src, void *dest, const nc_type src_type,
             for (usp = (unsigned short *)src, bp = dest; count < len; count++)
             {
                 if (*usp > X_SCHAR_MAX)
-                    (*range_error)++;
+                    nrange++;
                 *bp++ = *usp++;
             }
             break;
@@ -860,7 +974,7 @@ nc4_convert_type(const void *src, void *dest, const nc_type src_type,
             for (usp = (unsigned short *)src, sp = dest; count < len; count++)
             {
                 if (*usp > X_SHORT_MAX)
-                    (*range_error)++;
+                    nrange++;
                 *sp++ = *usp++;
             }
             break;
@@ -906,7 +1020,7 @@ nc4_convert_type(const void *src, void *dest, const nc_type src_type,
             for (ip = (int *)src, ubp = dest; count < len; count++)
             {
                 if (*ip > X_UCHAR_MAX || *ip < 0)
-                    (*range_error)++;
+                    nrange++;
                 *ubp++ = *ip++;
             }
             break;
@@ -914,7 +1028,7 @@ nc4_convert_type(const void *src, void *dest, const nc_type src_type,
             for (ip = (int *)src, bp = dest; count < len; count++)
             {
                 if (*ip > X_SCHAR_MAX || *ip < X_SCHAR_MIN)
-                    (*range_error)++;
+                    nrange++;
                 *bp++ = *ip++;
             }
             break;
@@ -922,7 +1036,7 @@ nc4_convert_type(const void *src, void *dest, const nc_type src_type,
             for (ip = (int *)src, sp = dest; count < len; count++)
             {
                 if (*ip > X_SHORT_MAX || *ip < X_SHORT_MIN)
-                    (*range_error)++;
+                    nrange++;
                 *sp++ = *ip++;
             }
             break;
@@ -930,7 +1044,7 @@ nc4_convert_type(const void *src, void *dest, const nc_type src_type,
             for (ip = (int *)src, usp = dest; count < len; count++)
             {
                 if (*ip > X_USHORT_MAX || *ip < 0)
-                    (*range_error)++;
+                    nrange++;
                 *usp++ = *ip++;
             }
             break;
@@ -938,7 +1052,7 @@ nc4_convert_type(const void *src, void *dest, const nc_type src_type,
             for (ip = (int *)src, ip1 = dest; count < len; count++)
             {
                 if (*ip > X_INT_MAX || *ip < X_INT_MIN)
-                    (*range_error)++;
+                    nrange++;
                 *ip1++ = *ip++;
             }
             break;
@@ -946,7 +1060,7 @@ nc4_convert_type(const void *src, void *dest, const nc_type src_type,
             for (ip = (int *)src, uip = dest; count < len; count++)
             {
                 if (*ip > X_UINT_MAX || *ip < 0)
-                    (*range_error)++;
+                    nrange++;
                 *uip++ = *ip++;
             }
             break;
@@ -958,7 +1072,7 @@ nc4_convert_type(const void *src, void *dest, const nc_type src_type,
             for (ip = (int *)src, ulip = dest; count < len; count++)
             {
                 if (*ip < 0)
-                    (*range_error)++;
+                    nrange++;
                 *ulip++ = *ip++;
             }
             break;
@@ -984,7 +1098,7 @@ nc4_convert_type(const void *src, void *dest, const nc_type src_type,
             for (uip = (unsigned int *)src, ubp = dest; count < len; count++)
             {
                 if (*uip > X_UCHAR_MAX)
-                    (*range_error)++;
+                    nrange++;
                 *ubp++ = *uip++;
             }
             break;
@@ -992,7 +1106,7 @@ nc4_convert_type(const void *src, void *dest, const nc_type src_type,
             for (uip = (unsigned int *)src, bp = dest; count < len; count++)
             {
                 if (*uip > X_SCHAR_MAX)
-                    (*range_error)++;
+                    nrange++;
                 *bp++ = *uip++;
             }
             break;
@@ -1000,7 +1114,7 @@ nc4_convert_type(const void *src, void *dest, const nc_type src_type,
             for (uip = (unsigned int *)src, sp = dest; count < len; count++)
             {
                 if (*uip > X_SHORT_MAX)
-                    (*range_error)++;
+                    nrange++;
                 *sp++ = *uip++;
             }
             break;
@@ -1008,7 +1122,7 @@ nc4_convert_type(const void *src, void *dest, const nc_type src_type,
             for (uip = (unsigned int *)src, usp = dest; count < len; count++)
             {
                 if (*uip > X_USHORT_MAX)
-                    (*range_error)++;
+                    nrange++;
                 *usp++ = *uip++;
             }
             break;
@@ -1016,7 +1130,7 @@ nc4_convert_type(const void *src, void *dest, const nc_type src_type,
             for (uip = (unsigned int *)src, ip = dest; count < len; count++)
             {
                 if (*uip > X_INT_MAX)
-                    (*range_error)++;
+                    nrange++;
                 *ip++ = *uip++;
             }
             break;
@@ -1024,7 +1138,7 @@ nc4_convert_type(const void *src, void *dest, const nc_type src_type,
             for (uip = (unsigned int *)src, uip1 = dest; count < len; count++)
             {
                 if (*uip > X_UINT_MAX)
-                    (*range_error)++;
+                    nrange++;
                 *uip1++ = *uip++;
             }
             break;
@@ -1058,7 +1172,7 @@ nc4_convert_type(const void *src, void *dest, const nc_type src_type,
             for (lip = (long long *)src, ubp = dest; count < len; count++)
             {
                 if (*lip > X_UCHAR_MAX || *lip < 0)
-                    (*range_error)++;
+                    nrange++;
                 *ubp++ = *lip++;
             }
             break;
@@ -1066,7 +1180,7 @@ nc4_convert_type(const void *src, void *dest, const nc_type src_type,
             for (lip = (long long *)src, bp = dest; count < len; count++)
             {
                 if (*lip > X_SCHAR_MAX || *lip < X_SCHAR_MIN)
-                    (*range_error)++;
+                    nrange++;
                 *bp++ = *lip++;
             }
             break;
@@ -1074,7 +1188,7 @@ nc4_convert_type(const void *src, void *dest, const nc_type src_type,
             for (lip = (long long *)src, sp = dest; count < len; count++)
             {
                 if (*lip > X_SHORT_MAX || *lip < X_SHORT_MIN)
-                    (*range_error)++;
+                    nrange++;
                 *sp++ = *lip++;
             }
             break;
@@ -1082,7 +1196,7 @@ nc4_convert_type(const void *src, void *dest, const nc_type src_type,
             for (lip = (long long *)src, usp = dest; count < len; count++)
             {
                 if (*lip > X_USHORT_MAX || *lip < 0)
-                    (*range_error)++;
+                    nrange++;
                 *usp++ = *lip++;
             }
             break;
@@ -1090,7 +1204,7 @@ nc4_convert_type(const void *src, void *dest, const nc_type src_type,
             for (lip = (long long *)src, uip = dest; count < len; count++)
             {
                 if (*lip > X_UINT_MAX || *lip < 0)
-                    (*range_error)++;
+                    nrange++;
                 *uip++ = *lip++;
             }
             break;
@@ -1098,7 +1212,7 @@ nc4_convert_type(const void *src, void *dest, const nc_type src_type,
             for (lip = (long long *)src, ip = dest; count < len; count++)
             {
                 if (*lip > X_INT_MAX || *lip < X_INT_MIN)
-                    (*range_error)++;
+                    nrange++;
                 *ip++ = *lip++;
             }
             break;
@@ -1110,7 +1224,7 @@ nc4_convert_type(const void *src, void *dest, const nc_type src_type,
             for (lip = (long long *)src, ulip = dest; count < len; count++)
             {
                 if (*lip < 0)
-                    (*range_error)++;
+                    nrange++;
                 *ulip++ = *lip++;
             }
             break;
@@ -1136,7 +1250,7 @@ nc4_convert_type(const void *src, void *dest, const nc_type src_type,
             for (ulip = (unsigned long long *)src, ubp = dest; count < len; count++)
             {
                 if (*ulip > X_UCHAR_MAX)
-                    (*range_error)++;
+                    nrange++;
                 *ubp++ = *ulip++;
             }
             break;
@@ -1144,7 +1258,7 @@ nc4_convert_type(const void *src, void *dest, const nc_type src_type,
             for (ulip = (unsigned long long *)src, bp = dest; count < len; count++)
             {
                 if (*ulip > X_SCHAR_MAX)
-                    (*range_error)++;
+                    nrange++;
                 *bp++ = *ulip++;
             }
             break;
@@ -1152,7 +1266,7 @@ nc4_convert_type(const void *src, void *dest, const nc_type src_type,
             for (ulip = (unsigned long long *)src, sp = dest; count < len; count++)
             {
                 if (*ulip > X_SHORT_MAX)
-                    (*range_error)++;
+                    nrange++;
                 *sp++ = *ulip++;
             }
             break;
@@ -1160,7 +1274,7 @@ nc4_convert_type(const void *src, void *dest, const nc_type src_type,
             for (ulip = (unsigned long long *)src, usp = dest; count < len; count++)
             {
                 if (*ulip > X_USHORT_MAX)
-                    (*range_error)++;
+                    nrange++;
                 *usp++ = *ulip++;
             }
             break;
@@ -1168,7 +1282,7 @@ nc4_convert_type(const void *src, void *dest, const nc_type src_type,
             for (ulip = (unsigned long long *)src, uip = dest; count < len; count++)
             {
                 if (*ulip > X_UINT_MAX)
-                    (*range_error)++;
+                    nrange++;
                 *uip++ = *ulip++;
             }
             break;
@@ -1176,7 +1290,7 @@ nc4_convert_type(const void *src, void *dest, const nc_type src_type,
             for (ulip = (unsigned long long *)src, ip = dest; count < len; count++)
             {
                 if (*ulip > X_INT_MAX)
-                    (*range_error)++;
+                    nrange++;
                 *ip++ = *ulip++;
             }
             break;
@@ -1184,7 +1298,7 @@ nc4_convert_type(const void *src, void *dest, const nc_type src_type,
             for (ulip = (unsigned long long *)src, lip = dest; count < len; count++)
             {
                 if (*ulip > X_INT64_MAX)
-                    (*range_error)++;
+                    nrange++;
                 *lip++ = *ulip++;
             }
             break;
@@ -1214,7 +1328,7 @@ nc4_convert_type(const void *src, void *dest, const nc_type src_type,
             for (fp = (float *)src, ubp = dest; count < len; count++)
             {
                 if (*fp > X_UCHAR_MAX || *fp < 0)
-                    (*range_error)++;
+                    nrange++;
                 *ubp++ = *fp++;
             }
             break;
@@ -1222,7 +1336,7 @@ nc4_convert_type(const void *src, void *dest, const nc_type src_type,
             for (fp = (float *)src, bp = dest; count < len; count++)
             {
                 if (*fp > (double)X_SCHAR_MAX || *fp < (double)X_SCHAR_MIN)
-                    (*range_error)++;
+                    nrange++;
                 *bp++ = *fp++;
             }
             break;
@@ -1230,7 +1344,7 @@ nc4_convert_type(const void *src, void *dest, const nc_type src_type,
             for (fp = (float *)src, sp = dest; count < len; count++)
             {
                 if (*fp > (double)X_SHORT_MAX || *fp < (double)X_SHORT_MIN)
-                    (*range_error)++;
+                    nrange++;
                 *sp++ = *fp++;
             }
             break;
@@ -1238,7 +1352,7 @@ nc4_convert_type(const void *src, void *dest, const nc_type src_type,
             for (fp = (float *)src, usp = dest; count < len; count++)
             {
                 if (*fp > X_USHORT_MAX || *fp < 0)
-                    (*range_error)++;
+                    nrange++;
                 *usp++ = *fp++;
             }
             break;
@@ -1246,7 +1360,7 @@ nc4_convert_type(const void *src, void *dest, const nc_type src_type,
             for (fp = (float *)src, uip = dest; count < len; count++)
             {
                 if (*fp > X_UINT_MAX || *fp < 0)
-                    (*range_error)++;
+                    nrange++;
                 *uip++ = *fp++;
             }
             break;
@@ -1254,7 +1368,7 @@ nc4_convert_type(const void *src, void *dest, const nc_type src_type,
             for (fp = (float *)src, ip = dest; count < len; count++)
             {
                 if (*fp > (double)X_INT_MAX || *fp < (double)X_INT_MIN)
-                    (*range_error)++;
+                    nrange++;
                 *ip++ = *fp++;
             }
             break;
@@ -1262,7 +1376,7 @@ nc4_convert_type(const void *src, void *dest, const nc_type src_type,
             for (fp = (float *)src, lip = dest; count < len; count++)
             {
                 if (*fp > X_INT64_MAX || *fp <X_INT64_MIN)
-                    (*range_error)++;
+                    nrange++;
                 *lip++ = *fp++;
             }
             break;
@@ -1270,7 +1384,7 @@ nc4_convert_type(const void *src, void *dest, const nc_type src_type,
             for (fp = (float *)src, lip = dest; count < len; count++)
             {
                 if (*fp > X_UINT64_MAX || *fp < 0)
-                    (*range_error)++;
+                    nrange++;
                 *lip++ = *fp++;
             }
             break;
@@ -1296,7 +1410,7 @@ nc4_convert_type(const void *src, void *dest, const nc_type src_type,
             for (dp = (double *)src, ubp = dest; count < len; count++)
             {
                 if (*dp > X_UCHAR_MAX || *dp < 0)
-                    (*range_error)++;
+                    nrange++;
                 *ubp++ = *dp++;
             }
             break;
@@ -1304,7 +1418,7 @@ nc4_convert_type(const void *src, void *dest, const nc_type src_type,
             for (dp = (double *)src, bp = dest; count < len; count++)
             {
                 if (*dp > X_SCHAR_MAX || *dp < X_SCHAR_MIN)
-                    (*range_error)++;
+                    nrange++;
                 *bp++ = *dp++;
             }
             break;
@@ -1312,7 +1426,7 @@ nc4_convert_type(const void *src, void *dest, const nc_type src_type,
             for (dp = (double *)src, sp = dest; count < len; count++)
             {
                 if (*dp > X_SHORT_MAX || *dp < X_SHORT_MIN)
-                    (*range_error)++;
+                    nrange++;
                 *sp++ = *dp++;
             }
             break;
@@ -1320,7 +1434,7 @@ nc4_convert_type(const void *src, void *dest, const nc_type src_type,
             for (dp = (double *)src, usp = dest; count < len; count++)
             {
                 if (*dp > X_USHORT_MAX || *dp < 0)
-                    (*range_error)++;
+                    nrange++;
                 *usp++ = *dp++;
             }
             break;
@@ -1328,7 +1442,7 @@ nc4_convert_type(const void *src, void *dest, const nc_type src_type,
             for (dp = (double *)src, uip = dest; count < len; count++)
             {
                 if (*dp > X_UINT_MAX || *dp < 0)
-                    (*range_error)++;
+                    nrange++;
                 *uip++ = *dp++;
             }
             break;
@@ -1336,7 +1450,7 @@ nc4_convert_type(const void *src, void *dest, const nc_type src_type,
             for (dp = (double *)src, ip = dest; count < len; count++)
             {
                 if (*dp > X_INT_MAX || *dp < X_INT_MIN)
-                    (*range_error)++;
+                    nrange++;
                 *ip++ = *dp++;
             }
             break;
@@ -1344,7 +1458,7 @@ nc4_convert_type(const void *src, void *dest, const nc_type src_type,
             for (dp = (double *)src, lip = dest; count < len; count++)
             {
                 if (*dp > X_INT64_MAX || *dp < X_INT64_MIN)
-                    (*range_error)++;
+                    nrange++;
                 *lip++ = *dp++;
             }
             break;
@@ -1352,7 +1466,7 @@ nc4_convert_type(const void *src, void *dest, const nc_type src_type,
             for (dp = (double *)src, lip = dest; count < len; count++)
             {
                 if (*dp > X_UINT64_MAX || *dp < 0)
-                    (*range_error)++;
+                    nrange++;
                 *lip++ = *dp++;
             }
             break;
@@ -1360,7 +1474,7 @@ nc4_convert_type(const void *src, void *dest, const nc_type src_type,
             for (dp = (double *)src, fp = dest; count < len; count++)
             {
                 if (isgreater(*dp, X_FLOAT_MAX) || isless(*dp, X_FLOAT_MIN))
-                    (*range_error)++;
+                    nrange++;
                 *fp++ = *dp++;
             }
             break;
@@ -1381,62 +1495,30 @@ nc4_convert_type(const void *src, void *dest, const nc_type src_type,
         return NC_EBADTYPE;
     }
 
+    *range_error = nrange;
+
     /* If quantize is in use, determine masks, copy the data, do the
      * quantization. */
     if (quantize_mode == NC_QUANTIZE_BITGROOM)
     {
+        /* BitGroom: alternately shave and set LSBs */
         if (dest_type == NC_FLOAT)
-        {
-            /* BitGroom: alternately shave and set LSBs */
-            op1.fp = (float *)dest;
-            u32_ptr = op1.ui32p;
-            for (idx = 0L; idx < len; idx += 2L)
-                if (op1.fp[idx] != mss_val_cmp_flt)
-                    u32_ptr[idx] &= msk_f32_u32_zro;
-            for (idx = 1L; idx < len; idx += 2L)
-                if (op1.fp[idx] != mss_val_cmp_flt && u32_ptr[idx] != 0U) /* Never quantize upwards floating point values of zero */
-                    u32_ptr[idx] |= msk_f32_u32_one;
-        }
+            quantize_bitgroom_float((unsigned int *)dest, len, mss_val_cmp_flt,
+                                    msk_f32_u32_zro, msk_f32_u32_one);
         else
-        {
-            /* BitGroom: alternately shave and set LSBs. */
-            op1.dp = (double *)dest;
-            u64_ptr = op1.ui64p;
-            for (idx = 0L; idx < len; idx += 2L)
-                if (op1.dp[idx] != mss_val_cmp_dbl)
-                    u64_ptr[idx] &= msk_f64_u64_zro;
-            for (idx = 1L; idx < len; idx += 2L)
-                if (op1.dp[idx] != mss_val_cmp_dbl && u64_ptr[idx] != 0ULL) /* Never quantize upwards floating point values of zero */
-                    u64_ptr[idx] |= msk_f64_u64_one;
-        }
+            quantize_bitgroom_double((unsigned long long *)dest, len, mss_val_cmp_dbl,
+                                     msk_f64_u64_zro, msk_f64_u64_one);
     } /* endif BitGroom */
 
     if (quantize_mode == NC_QUANTIZE_BITROUND)
       {
+        /* BitRound: Quantize to user-specified NSB with IEEE-rounding */
         if (dest_type == NC_FLOAT)
-	  {
-            /* BitRound: Quantize to user-specified NSB with IEEE-rounding */
-            op1.fp = (float *)dest;
-            u32_ptr = op1.ui32p;
-            for (idx = 0L; idx < len; idx++){
-	      if (op1.fp[idx] != mss_val_cmp_flt){
-		u32_ptr[idx] += msk_f32_u32_hshv; /* Add 1 to the MSB of LSBs, carry 1 to mantissa or even exponent */
-		u32_ptr[idx] &= msk_f32_u32_zro; /* Shave it */
-	      }
-	    }
-	  }
+            quantize_bitround_float((unsigned int *)dest, len, mss_val_cmp_flt,
+                                    msk_f32_u32_zro, msk_f32_u32_hshv);
         else
-	  {
-            /* BitRound: Quantize to user-specified NSB with IEEE-rounding */
-            op1.dp = (double *)dest;
-            u64_ptr = op1.ui64p;
-            for (idx = 0L; idx < len; idx++){
-	      if (op1.dp[idx] != mss_val_cmp_dbl){
-		u64_ptr[idx] += msk_f64_u64_hshv; /* Add 1 to the MSB of LSBs, carry 1 to mantissa or even exponent */
-		u64_ptr[idx] &= msk_f64_u64_zro; /* Shave it */
-	      }
-	    }
-	  }
+            quantize_bitround_double((unsigned long long *)dest, len, mss_val_cmp_dbl,
+                                     msk_f64_u64_zro, msk_f64_u64_hshv);
       } /* endif BitRound */
     
     if (quantize_mode == NC_QUANTIZE_GRANULARBR)
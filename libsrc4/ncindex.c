@@ -105,8 +105,10 @@ ncindexadd(NCindex* ncindex, NC_OBJ* obj)
 #ifndef NCNOHASH
     {
         uintptr_t index; /*Note not the global id */
+        size_t len = strlen(obj->name);
         index = (uintptr_t)nclistlength(ncindex->list);
-        NC_hashmapadd(ncindex->map,index,(void*)obj->name,strlen(obj->name));
+        obj->hashkey = NC_hashmapkey(obj->name,len);
+        NC_hashmapaddkey(ncindex->map,index,obj->name,len,obj->hashkey);
     }
 #endif
     if(!nclistpush(ncindex->list,obj))
@@ -124,7 +126,9 @@ ncindexset(NCindex* ncindex, size_t i, NC_OBJ* obj)
 #ifndef NCNOHASH
     {
         uintptr_t index = (uintptr_t)i;
-        NC_hashmapadd(ncindex->map,index,(void*)obj->name,strlen(obj->name));
+        size_t len = strlen(obj->name);
+        obj->hashkey = NC_hashmapkey(obj->name,len);
+        NC_hashmapaddkey(ncindex->map,index,obj->name,len,obj->hashkey);
     }
 #endif
     return 1;
@@ -136,12 +140,21 @@ ncindexset(NCindex* ncindex, size_t i, NC_OBJ* obj)
 int
 ncindexidel(NCindex* index, size_t i)
 {
+#ifndef NCNOHASH
+    NC_OBJ* obj;
+#endif
     if(index == NULL) return 0;
-    nclistremove(index->list,i);
 #ifndef NCNOHASH
-    /* Remove from the hash map by deactivating its entry */
-    if(!NC_hashmapdeactivate(index->map,(uintptr_t)i))
+    obj = (NC_OBJ*)nclistremove(index->list,i);
+    /* Remove from the hash map using the object's name and hashkey,
+       else by deactivating the entry that points to i */
+    if(obj != NULL) {
+        if(!NC_hashmapremovekey(index->map,obj->name,strlen(obj->name),obj->hashkey,NULL))
+            return 0; /* not present */
+    } else if(!NC_hashmapdeactivate(index->map,(uintptr_t)i))
         return 0; /* not present */
+#else
+    nclistremove(index->list,i);
 #endif
     return 1;
 }
@@ -228,18 +241,6 @@ ncindexnew(size_t size0)
     return index;
 }
 
-#ifndef NCNOHASH
-/* Debug: handle the data key part */
-static const char*
-keystr(NC_hentry* e)
-{
-    if(e->keysize < sizeof(uintptr_t))
-        return (const char*)(&e->key);
-    else
-        return (const char*)(e->key);
-}
-#endif
-
 int
 ncindexverify(NCindex* lm, int dump)
 {
@@ -248,6 +249,8 @@ ncindexverify(NCindex* lm, int dump)
     int nerrs = 0;
 #ifndef NCNOHASH
     size_t m;
+    uintptr_t udata;
+    const char* key;
 #endif
 
     if(lm == NULL) {
@@ -257,14 +260,14 @@ ncindexverify(NCindex* lm, int dump)
     if(dump) {
         fprintf(stderr,"-------------------------\n");
 #ifndef NCNOHASH
-        if(lm->map->active == 0) {
+        if(NC_hashmapcount(lm->map) == 0) {
             fprintf(stderr,"hash: <empty>\n");
             goto next1;
         }
         for(i=0;i < lm->map->alloc; i++) {
-            NC_hentry* e = &lm->map->table[i];
-            if(e->flags != 1) continue;
-            fprintf(stderr,"hash: %ld: data=%lu key=%s\n",(unsigned long)i,(unsigned long)e->data,keystr(e));
+            NC_hashmapith(lm->map,i,&udata,&key);
+            if(key == NULL) continue;
+            fprintf(stderr,"hash: %ld: data=%lu key=%s\n",(unsigned long)i,(unsigned long)udata,key);
             fflush(stderr);
         }
     next1:
@@ -288,64 +291,37 @@ next2:
 
     /* Verify that map entry points to same-named entry in vector */
     for(m=0;m < lm->map->alloc; m++) {
-        NC_hentry* e = &lm->map->table[m];
-        char** object = NULL;
-        char* oname = NULL;
-        uintptr_t udata = (uintptr_t)e->data;
-        if((e->flags & 1) == 0) continue;
+        NC_OBJ* object = NULL;
+        NC_hashmapith(lm->map,m,&udata,&key);
+        if(key == NULL) continue;
         object = nclistget(l,(size_t)udata);
         if(object == NULL) {
             fprintf(stderr,"bad data: %d: %lu\n",(int)m,(unsigned long)udata);
             nerrs++;
-        } else {
-            oname = *object;
-            if(strcmp(oname,keystr(e)) != 0)  {
-                fprintf(stderr,"name mismatch: %d: %lu: hash=%s list=%s\n",
-                        (int)m,(unsigned long)udata,keystr(e),oname);
-                nerrs++;
-            }
+        } else if(strcmp(object->name,key) != 0)  {
+            fprintf(stderr,"name mismatch: %d: %lu: hash=%s list=%s\n",
+                    (int)m,(unsigned long)udata,key,object->name);
+            nerrs++;
         }
     }
-    /* Walk vector and mark corresponding hash entry*/
-    if(nclistlength(l) == 0 || lm->map->active == 0)
-        goto done; /* cannot verify */
+    /* Verify that each element of the vector is in the map at its position;
+       since the map has no duplicate keys, the counts then must match */
     for(i=0;i < nclistlength(l); i++) {
-        int match;
-        const char** xp = (const char**)nclistget(l,i);
-        /* Walk map looking for *xp */
-        for(match=0,m=0;m < lm->map->active; m++) {
-            NC_hentry* e = &lm->map->table[m];
-            if((e->flags & 1) == 0) continue;
-            if(strcmp(keystr(e),*xp)==0) {
-                if((e->flags & 128) == 128) {
-                    fprintf(stderr,"%ld: %s already in map at %ld\n",(unsigned long)i,keystr(e),(unsigned long)m);
-                    nerrs++;
-                }
-                match = 1;
-                e->flags += 128;
-            }
-        }
-        if(!match) {
-            fprintf(stderr,"mismatch: %d: %s in vector, not in map\n",(int)i,*xp);
+        NC_OBJ* object = (NC_OBJ*)nclistget(l,i);
+        if(object == NULL) continue;
+        if(!NC_hashmapget(lm->map,object->name,strlen(object->name),&udata)) {
+            fprintf(stderr,"mismatch: %d: %s in vector, not in map\n",(int)i,object->name);
+            nerrs++;
+        } else if(udata != (uintptr_t)i) {
+            fprintf(stderr,"%ld: %s in map at %lu\n",(unsigned long)i,object->name,(unsigned long)udata);
             nerrs++;
         }
     }
-    /* Verify that every element in map in in vector */
-    for(m=0;m < lm->map->active; m++) {
-        NC_hentry* e = &lm->map->table[m];
-        if((e->flags & 1) == 0) continue;
-        if((e->flags & 128) == 128) continue;
-        /* We have a hash entry not in the vector */
-        fprintf(stderr,"mismatch: %d: %s->%lu in hash, not in vector\n",(int)m,keystr(e),(unsigned long)e->data);
+    if(NC_hashmapcount(lm->map) != (size_t)ncindexcount(lm)) {
+        fprintf(stderr,"mismatch: %lu entries in hash, %d in vector\n",
+                (unsigned long)NC_hashmapcount(lm->map),ncindexcount(lm));
         nerrs++;
     }
-    /* clear the 'touched' flag */
-    for(m=0;m < lm->map->active; m++) {
-        NC_hentry* e = &lm->map->table[m];
-        e->flags &= ~128;
-    }
-
-done:
 #endif /*NCNOHASH*/
     fflush(stderr);
     return (nerrs > 0 ? 0: 1);
@@ -1468,6 +1468,9 @@ NC_NOTNC4_def_var_quantize,
 NC_NOTNC4_inq_var_quantize,
 
 NC_NOOP_inq_filter_avail,
+
+NC_NOTNC4_get_var_chunk_raw,
+NC_NOTNC4_put_var_chunk_raw,
 };
 
 const NC_Dispatch *NCP_dispatch_table = NULL; /* moved here from ddispatch.c */
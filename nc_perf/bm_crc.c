@@ -0,0 +1,88 @@
+/* This is part of the netCDF package. Copyright 2018 University
+   Corporation for Atmospheric Research/Unidata See COPYRIGHT file for
+   conditions of use.
+
+   This program benchmarks the CRC-32 and CRC-64 used for checksums,
+   computed with the CPU's CRC instructions and with tables only.
+*/
+
+#include <config.h>
+#include <nc_tests.h>
+#include "err_macros.h"
+#include "nccrc.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include <sys/time.h> /* Extra high precision time info. */
+
+#define DEFAULT_SIZE (16 * 1024 * 1024)
+#define MIN_BYTES (1024 * 1024 * 1024)
+
+/* Prototype from tst_utils.c. */
+int nc4_timeval_subtract(struct timeval *result, struct timeval *x,
+                         struct timeval *y);
+
+/* Time CRCs of the buffer until at least MIN_BYTES are done, getting
+ * MB/s and the CRC. */
+static int
+bm_crc(int crc64, unsigned char *buf, size_t size, double *mbsp,
+       unsigned long long *crcp)
+{
+    struct timeval start_time, end_time, diff_time;
+    unsigned long long crc = 0;
+    size_t done;
+    double sec;
+
+    if (gettimeofday(&start_time, NULL)) ERR;
+    for (done = 0; done < MIN_BYTES; done += size)
+    {
+	if (crc64)
+	    crc = NC_crc64(crc, buf, (unsigned int)size);
+	else
+	    crc = NC_crc32((unsigned int)crc, buf, (unsigned int)size);
+    }
+    if (gettimeofday(&end_time, NULL)) ERR;
+    if (nc4_timeval_subtract(&diff_time, &end_time, &start_time)) ERR;
+    sec = (double)diff_time.tv_sec + 1.0e-6 * (double)diff_time.tv_usec;
+    *mbsp = (double)done / (1024.0 * 1024.0) / (sec > 0 ? sec : 1.0e-6);
+    *crcp = crc;
+    return 0;
+}
+
+int main(int argc, char **argv)
+{
+    size_t size = DEFAULT_SIZE;
+    unsigned char *buf;
+    size_t i;
+    int crc64, hw;
+
+    if(argc > 2) { 	/* Usage */
+	printf("NetCDF performance test, computing CRC-32 and CRC-64 checksums.\n");
+	printf("Usage:\t%s [N]\n", argv[0]);
+	printf("\tN: bytes checksummed at a time\n");
+	return(0);
+    }
+    if(argc == 2)
+	size = (size_t)atol(argv[1]);
+    if(size < 1) ERR;
+
+    if (!(buf = malloc(size))) ERR;
+    for (i = 0; i < size; i++)
+	buf[i] = (unsigned char)(i * 7 + (i >> 8));
+
+    printf("CRC instructions: %s, buffer %lu bytes\n", NC_crc_hwname(),
+	   (unsigned long)size);
+    for (crc64 = 0; crc64 <= 1; crc64++) {
+	unsigned long long crc[2];
+	double mbs[2];
+	for (hw = 0; hw <= 1; hw++) {
+	    NC_crc_usehardware(hw);
+	    if (bm_crc(crc64, buf, size, &mbs[hw], &crc[hw])) ERR;
+	}
+	printf("%s\ttables %.0f MB/s\tinstructions %.0f MB/s\t(%.1fx)\n",
+	       crc64 ? "CRC-64" : "CRC-32", mbs[0], mbs[1], mbs[1] / mbs[0]);
+	if (crc[0] != crc[1]) ERR;
+    }
+    free(buf);
+    FINAL_RESULTS;
+}
@@ -0,0 +1,359 @@
+/* This is part of the netCDF package. Copyright 2018 University
+   Corporation for Atmospheric Research/Unidata. See COPYRIGHT file
+   for conditions of use.
+
+   Test aggregations of files joined along a dimension.
+*/
+
+#include "config.h"
+#include <nc_tests.h>
+#include "err_macros.h"
+#include "nc.h"
+
+#define FILE_NAME_BASE "tst_agg"
+#define AGG_EXISTING "tst_agg_existing.ncagg"
+#define AGG_NEW "tst_agg_new.ncagg"
+#define AGG_BAD "tst_agg_bad.ncagg"
+#define AGG_REORDER "tst_agg_reorder.ncagg"
+#define NFILES 3
+#define NX 4
+#define NTOTAL 6
+
+/* Lengths of the files along time, 6 in all */
+static const size_t ntimes[NFILES] = {2, 3, 1};
+
+/* Value of T[t][x] and of V[x][t], t counting along the aggregation */
+#define TVAL(t, x) ((int)(100 * (t) + (x)))
+
+/* How write_file() writes a file */
+#define SAME 0       /* as the first */
+#define REORDERED 1  /* with the dims and vars defined in reverse order */
+#define FLOAT_T 2    /* with T a float */
+#define NO_V 3       /* without V */
+#define LONG_X 4     /* with x one longer */
+
+static void
+filename(int f, int mode, char *name)
+{
+    if (mode == SAME)
+        snprintf(name, NC_MAX_NAME, "%s_%d.nc", FILE_NAME_BASE, f);
+    else
+        snprintf(name, NC_MAX_NAME, "%s_%d_%d.nc", FILE_NAME_BASE, f, mode);
+}
+
+/* Write a file with time, x, T(time, x), V(x, time), the
+ * coordinate variable x(x), P(x), and the scalar s. */
+static int
+write_file(int f, size_t first, int mode)
+{
+    char name[NC_MAX_NAME + 1];
+    int ncid, timedim, xdim, dimids[2], tvarid, vvarid, xvarid, pvarid, svarid;
+    int tvals[3][NX], vvals[NX][3], xvals[NX + 1], pvals[NX + 1], s = f;
+    size_t t, x, nx = (mode == LONG_X) ? NX + 1 : NX;
+
+    filename(f, mode, name);
+    if (nc_create(name, NC_CLOBBER, &ncid)) ERR;
+    if (mode == REORDERED)
+    {
+        if (nc_def_dim(ncid, "x", nx, &xdim)) ERR;
+        if (nc_def_dim(ncid, "time", ntimes[f], &timedim)) ERR;
+        if (nc_def_var(ncid, "s", NC_INT, 0, NULL, &svarid)) ERR;
+        if (nc_def_var(ncid, "P", NC_INT, 1, &xdim, &pvarid)) ERR;
+        if (nc_def_var(ncid, "x", NC_INT, 1, &xdim, &xvarid)) ERR;
+    }
+    else
+    {
+        if (nc_def_dim(ncid, "time", ntimes[f], &timedim)) ERR;
+        if (nc_def_dim(ncid, "x", nx, &xdim)) ERR;
+    }
+    dimids[0] = timedim;
+    dimids[1] = xdim;
+    if (mode == REORDERED)
+    {
+        dimids[0] = xdim;
+        dimids[1] = timedim;
+        if (nc_def_var(ncid, "V", NC_INT, 2, dimids, &vvarid)) ERR;
+        dimids[0] = timedim;
+        dimids[1] = xdim;
+    }
+    if (nc_def_var(ncid, "T", mode == FLOAT_T ? NC_FLOAT : NC_INT, 2, dimids, &tvarid)) ERR;
+    if (mode != REORDERED)
+    {
+        dimids[0] = xdim;
+        dimids[1] = timedim;
+        if (mode != NO_V && nc_def_var(ncid, "V", NC_INT, 2, dimids, &vvarid)) ERR;
+        if (nc_def_var(ncid, "x", NC_INT, 1, &xdim, &xvarid)) ERR;
+        if (nc_def_var(ncid, "P", NC_INT, 1, &xdim, &pvarid)) ERR;
+        if (nc_def_var(ncid, "s", NC_INT, 0, NULL, &svarid)) ERR;
+    }
+    if (nc_put_att_text(ncid, NC_GLOBAL, "title", 3, "agg")) ERR;
+    if (nc_enddef(ncid)) ERR;
+    for (x = 0; x < NX; x++)
+    {
+        for (t = 0; t < ntimes[f]; t++)
+        {
+            tvals[t][x] = TVAL(first + t, x);
+            vvals[x][t] = TVAL(first + t, x);
+        }
+        xvals[x] = (int)x;
+        pvals[x] = 10 * f + (int)x;
+    }
+    xvals[NX] = pvals[NX] = NX;
+    {
+        size_t start[2] = {0, 0}, count[2] = {ntimes[f], NX};
+        if (nc_put_vara_int(ncid, tvarid, start, count, &tvals[0][0])) ERR;
+    }
+    for (x = 0; x < NX && mode != NO_V; x++)
+    {
+        size_t start[2] = {x, 0}, count[2] = {1, ntimes[f]};
+        if (nc_put_vara_int(ncid, vvarid, start, count, vvals[x])) ERR;
+    }
+    if (nc_put_var_int(ncid, xvarid, xvals)) ERR;
+    if (nc_put_var_int(ncid, pvarid, pvals)) ERR;
+    if (nc_put_var_int(ncid, svarid, &s)) ERR;
+    if (nc_close(ncid)) ERR;
+    return 0;
+}
+
+/* Write a description of an aggregation, of files written with
+ * modes[f], or all SAME if modes is NULL. */
+static int
+write_agg(const char *aggname, const char *header, int withlens, const int *modes)
+{
+    char name[NC_MAX_NAME + 1];
+    FILE *fp;
+    int f;
+
+    if (!(fp = fopen(aggname, "w"))) ERR;
+    fprintf(fp, "ncagg\n# test aggregation\n%s", header);
+    for (f = 0; f < NFILES; f++)
+    {
+        filename(f, modes ? modes[f] : SAME, name);
+        /* The last file's length is found by opening it. */
+        if (withlens && f < NFILES - 1)
+            fprintf(fp, "file %s %d\n", name, (int)ntimes[f]);
+        else
+            fprintf(fp, "file %s\n", name);
+    }
+    fclose(fp);
+    return 0;
+}
+
+int
+main(int argc, char **argv)
+{
+    size_t first = 0;
+    int f;
+
+    printf("\n*** Testing aggregations.\n");
+    for (f = 0; f < NFILES; f++)
+    {
+        if (write_file(f, first, SAME)) ERR;
+        first += ntimes[f];
+    }
+    if (write_agg(AGG_EXISTING, "dimension time\nmaxopen 2\n", 1, NULL)) ERR;
+    if (write_agg(AGG_NEW, "dimension day\n", 0, NULL)) ERR;
+
+    printf("*** checking metadata of a join along an existing dimension...");
+    {
+        int ncid, dimid, unlimdimid, ndims, nvars, format, formatx;
+        size_t len;
+        char title[4];
+
+        if (nc_open(AGG_EXISTING, NC_WRITE, &ncid) != NC_EPERM) ERR;
+        if (nc_open(AGG_EXISTING, NC_NOWRITE, &ncid)) ERR;
+        if (nc_inq_format(ncid, &format)) ERR;
+        if (format != NC_FORMAT_CLASSIC) ERR;
+        if (nc_inq_format_extended(ncid, &formatx, NULL)) ERR;
+        if (formatx != NC_FORMATX_NCAGG) ERR;
+        if (nc_inq(ncid, &ndims, &nvars, NULL, &unlimdimid)) ERR;
+        if (ndims != 2 || nvars != 5) ERR;
+        if (unlimdimid != -1) ERR;
+        if (nc_inq_dimid(ncid, "time", &dimid)) ERR;
+        if (nc_inq_dimlen(ncid, dimid, &len)) ERR;
+        if (len != NTOTAL) ERR;
+        if (nc_get_att_text(ncid, NC_GLOBAL, "title", title)) ERR;
+        if (strncmp(title, "agg", 3)) ERR;
+        if (nc_redef(ncid) != NC_EPERM) ERR;
+        if (nc_close(ncid)) ERR;
+    }
+    SUMMARIZE_ERR;
+
+    printf("*** checking data of a join along an existing dimension...");
+    {
+        int ncid, varid, i, t, x;
+        int tvals[NTOTAL][NX], vvals[NX][NTOTAL], svals[NTOTAL / 2][2];
+        float fvals[NX];
+        size_t start[2], count[2];
+        ptrdiff_t stride[2];
+
+        if (nc_open(AGG_EXISTING, NC_NOWRITE, &ncid)) ERR;
+
+        /* The whole variable, from all the files */
+        if (nc_inq_varid(ncid, "T", &varid)) ERR;
+        if (nc_get_var_int(ncid, varid, &tvals[0][0])) ERR;
+        for (t = 0; t < NTOTAL; t++)
+            for (x = 0; x < NX; x++)
+                if (tvals[t][x] != TVAL(t, x)) ERR;
+
+        /* A slab across two files, converted to float */
+        start[0] = 1; start[1] = 2;
+        count[0] = 3; count[1] = 1;
+        if (nc_get_vara_float(ncid, varid, start, count, fvals)) ERR;
+        for (i = 0; i < 3; i++)
+            if (fvals[i] != (float)TVAL(1 + i, 2)) ERR;
+
+        /* Every other time, across all the files */
+        start[0] = 1; start[1] = 0;
+        count[0] = NTOTAL / 2; count[1] = 2;
+        stride[0] = 2; stride[1] = 2;
+        if (nc_get_vars_int(ncid, varid, start, count, stride, &svals[0][0])) ERR;
+        for (i = 0; i < NTOTAL / 2; i++)
+            for (x = 0; x < 2; x++)
+                if (svals[i][x] != TVAL(1 + 2 * i, 2 * x)) ERR;
+
+        /* Past the end */
+        start[0] = NTOTAL - 1; start[1] = 0;
+        count[0] = 2; count[1] = 1;
+        if (nc_get_vara_int(ncid, varid, start, count, &tvals[0][0]) != NC_EEDGE) ERR;
+        start[0] = NTOTAL + 1;
+        count[0] = 0;
+        if (nc_get_vara_int(ncid, varid, start, count, &tvals[0][0]) != NC_EINVALCOORDS) ERR;
+        if (nc_put_var_int(ncid, varid, &tvals[0][0]) != NC_EPERM) ERR;
+
+        /* The joined dimension need not be the first */
+        if (nc_inq_varid(ncid, "V", &varid)) ERR;
+        if (nc_get_var_int(ncid, varid, &vvals[0][0])) ERR;
+        for (t = 0; t < NTOTAL; t++)
+            for (x = 0; x < NX; x++)
+                if (vvals[x][t] != TVAL(t, x)) ERR;
+
+        /* Other variables are those of the first file */
+        if (nc_inq_varid(ncid, "s", &varid)) ERR;
+        if (nc_get_var_int(ncid, varid, &i)) ERR;
+        if (i != 0) ERR;
+        if (nc_close(ncid)) ERR;
+    }
+    SUMMARIZE_ERR;
+
+    printf("*** checking a join along a new dimension...");
+    {
+        int ncid, dimid, varid, ndims, dimids[2], s, x;
+        int pvals[NFILES][NX];
+        size_t len, start[1];
+
+        if (nc_open(AGG_NEW, NC_NOWRITE, &ncid)) ERR;
+        if (nc_inq_ndims(ncid, &ndims)) ERR;
+        if (ndims != 3) ERR;
+        if (nc_inq_dimid(ncid, "day", &dimid)) ERR;
+        if (dimid != 2) ERR;
+        if (nc_inq_dimlen(ncid, dimid, &len)) ERR;
+        if (len != NFILES) ERR;
+
+        /* P and s get the new dimension; the coordinate variable x
+         * does not. */
+        if (nc_inq_varid(ncid, "P", &varid)) ERR;
+        if (nc_inq_var(ncid, varid, NULL, NULL, &ndims, dimids, NULL)) ERR;
+        if (ndims != 2 || dimids[0] != dimid) ERR;
+        if (nc_get_var_int(ncid, varid, &pvals[0][0])) ERR;
+        for (s = 0; s < NFILES; s++)
+            for (x = 0; x < NX; x++)
+                if (pvals[s][x] != 10 * s + x) ERR;
+        if (nc_inq_varid(ncid, "x", &varid)) ERR;
+        if (nc_inq_varndims(ncid, varid, &ndims)) ERR;
+        if (ndims != 1) ERR;
+        if (nc_inq_varid(ncid, "s", &varid)) ERR;
+        if (nc_inq_varndims(ncid, varid, &ndims)) ERR;
+        if (ndims != 1) ERR;
+        start[0] = 2;
+        if (nc_get_var1_int(ncid, varid, start, &s)) ERR;
+        if (s != 2) ERR;
+        if (nc_close(ncid)) ERR;
+    }
+    SUMMARIZE_ERR;
+
+#ifndef _MSC_VER
+    printf("*** checking at most maxopen members are open...");
+    {
+        int ncid, varid, nopen = count_NCList();
+        int tvals[NTOTAL][NX];
+
+        /* The aggregation, the first member, and the last member,
+         * opened to find its length */
+        if (nc_open(AGG_EXISTING, NC_NOWRITE, &ncid)) ERR;
+        if (count_NCList() != nopen + 3) ERR;
+        if (nc_inq_varid(ncid, "T", &varid)) ERR;
+        if (nc_get_var_int(ncid, varid, &tvals[0][0])) ERR;
+        if (count_NCList() != nopen + 3) ERR;
+        if (nc_close(ncid)) ERR;
+        if (count_NCList() != nopen) ERR;
+    }
+    SUMMARIZE_ERR;
+#endif
+
+    printf("*** checking members with vars in another order...");
+    {
+        int modes[NFILES] = {SAME, REORDERED, REORDERED};
+        int ncid, varid, t, x;
+        int tvals[NTOTAL][NX], vvals[NX][NTOTAL];
+
+        first = ntimes[0];
+        for (f = 1; f < NFILES; f++)
+        {
+            if (write_file(f, first, REORDERED)) ERR;
+            first += ntimes[f];
+        }
+        if (write_agg(AGG_REORDER, "dimension time\n", 0, modes)) ERR;
+        if (nc_open(AGG_REORDER, NC_NOWRITE, &ncid)) ERR;
+        if (nc_inq_varid(ncid, "T", &varid)) ERR;
+        if (nc_get_var_int(ncid, varid, &tvals[0][0])) ERR;
+        for (t = 0; t < NTOTAL; t++)
+            for (x = 0; x < NX; x++)
+                if (tvals[t][x] != TVAL(t, x)) ERR;
+        if (nc_inq_varid(ncid, "V", &varid)) ERR;
+        if (nc_get_var_int(ncid, varid, &vvals[0][0])) ERR;
+        for (t = 0; t < NTOTAL; t++)
+            for (x = 0; x < NX; x++)
+                if (vvals[x][t] != TVAL(t, x)) ERR;
+        if (nc_close(ncid)) ERR;
+    }
+    SUMMARIZE_ERR;
+
+    printf("*** checking members whose vars do not match...");
+    {
+        int modes[NFILES] = {SAME, SAME, SAME};
+        int mode, ncid, varid;
+        int tvals[NTOTAL][NX], vvals[NX][NTOTAL];
+
+        for (mode = FLOAT_T; mode <= LONG_X; mode++)
+        {
+            if (write_file(1, ntimes[0], mode)) ERR;
+            modes[1] = mode;
+            if (write_agg(AGG_BAD, "dimension time\n", 0, modes)) ERR;
+            if (nc_open(AGG_BAD, NC_NOWRITE, &ncid)) ERR;
+            if (nc_inq_varid(ncid, "T", &varid)) ERR;
+            if (nc_get_var_int(ncid, varid, &tvals[0][0]) != (mode == NO_V ? NC_NOERR : NC_EINVAL)) ERR;
+            if (nc_inq_varid(ncid, "V", &varid)) ERR;
+            if (nc_get_var_int(ncid, varid, &vvals[0][0]) != (mode == FLOAT_T ? NC_NOERR : NC_EINVAL)) ERR;
+            if (nc_close(ncid)) ERR;
+        }
+    }
+    SUMMARIZE_ERR;
+
+    printf("*** checking bad descriptions...");
+    {
+        int ncid;
+
+        if (write_agg(AGG_BAD, "dimension time\nmaxopen none\n", 0, NULL)) ERR;
+        if (nc_open(AGG_BAD, NC_NOWRITE, &ncid) != NC_EINVAL) ERR;
+        if (write_agg(AGG_BAD, "variable P\n", 0, NULL)) ERR;
+        if (nc_open(AGG_BAD, NC_NOWRITE, &ncid) != NC_EINVAL) ERR;
+        if (write_agg(AGG_BAD, "dimension day\nvariable nosuchvar\n", 0, NULL)) ERR;
+        if (nc_open(AGG_BAD, NC_NOWRITE, &ncid) != NC_ENOTVAR) ERR;
+        /* The first member stays open, so at least one other must fit */
+        if (write_agg(AGG_BAD, "dimension time\nmaxopen 1\n", 0, NULL)) ERR;
+        if (nc_open(AGG_BAD, NC_NOWRITE, &ncid) != NC_EINVAL) ERR;
+    }
+    SUMMARIZE_ERR;
+    FINAL_RESULTS;
+}
@@ -0,0 +1,232 @@
+/* This is part of the netCDF package.
+   Copyright 2018 University Corporation for Atmospheric Research/Unidata
+   See COPYRIGHT file for conditions of use.
+
+   Test the chunk cache budget shared by the vars of a file, which is
+   set up with nc_set_chunk_cache_budget().
+*/
+
+#include <nc_tests.h>
+#include "err_macros.h"
+#include "netcdf.h"
+#include <hdf5.h>
+
+#define FILE_NAME "tst_chunk_cache_budget.nc"
+#define ZARR_NAME "file://tst_chunk_cache_budget.file#mode=nczarr,file"
+#define NVARS 10
+#define NY 64
+#define NX 64
+#define CHUNK 16
+#define VAR_CACHE 65536
+#define BUDGET 262144
+#define MINIMUM 8192
+#define NREADS 12
+
+/* Sum the chunk cache sizes of the open datasets of the vars. If
+ * var0p is not NULL, it gets the chunk cache size of var_0. */
+static size_t
+granted(size_t *var0p)
+{
+   hid_t ids[NVARS + 8];
+   ssize_t n, i;
+   size_t total = 0;
+
+   n = H5Fget_obj_ids(H5F_OBJ_ALL, H5F_OBJ_DATASET, NVARS + 8, ids);
+   for (i = 0; i < n; i++)
+   {
+      char name[NC_MAX_NAME + 1];
+      hid_t access_pid;
+      size_t nslots, nbytes;
+      double w0;
+
+      H5Iget_name(ids[i], name, sizeof(name));
+      if (strncmp(name, "/var_", 5))
+         continue;
+      access_pid = H5Dget_access_plist(ids[i]);
+      H5Pget_chunk_cache(access_pid, &nslots, &nbytes, &w0);
+      H5Pclose(access_pid);
+      total += nbytes;
+      if (var0p && !strcmp(name, "/var_0"))
+         *var0p = nbytes;
+   }
+   return total;
+}
+
+/* Create a file with NVARS chunked vars. */
+static int
+create_file(const char *path, int cmode)
+{
+   int ncid, dimids[2], varid, v, i;
+   size_t chunks[2] = {CHUNK, CHUNK};
+   int *data;
+
+   if (!(data = malloc(NY * NX * sizeof(int)))) ERR;
+   if (nc_create(path, cmode | NC_CLOBBER, &ncid)) ERR;
+   if (nc_def_dim(ncid, "y", NY, &dimids[0])) ERR;
+   if (nc_def_dim(ncid, "x", NX, &dimids[1])) ERR;
+   for (v = 0; v < NVARS; v++)
+   {
+      char name[NC_MAX_NAME + 1];
+      snprintf(name, sizeof(name), "var_%d", v);
+      if (nc_def_var(ncid, name, NC_INT, 2, dimids, &varid)) ERR;
+      if (nc_def_var_chunking(ncid, varid, NC_CHUNKED, chunks)) ERR;
+   }
+   if (nc_enddef(ncid)) ERR;
+   for (v = 0; v < NVARS; v++)
+   {
+      for (i = 0; i < NY * NX; i++)
+         data[i] = v * NY * NX + i;
+      if (nc_put_var_int(ncid, v, data)) ERR;
+   }
+   if (nc_close(ncid)) ERR;
+   free(data);
+   return 0;
+}
+
+/* Read and check a row of a var. */
+static int
+check_row(int ncid, int v, int y, int offset)
+{
+   size_t start[2] = {0, 0}, count[2] = {1, NX};
+   int row[NX], i;
+
+   start[0] = (size_t)y;
+   if (nc_get_vara_int(ncid, v, start, count, row)) ERR;
+   for (i = 0; i < NX; i++)
+      if (row[i] != v * NY * NX + y * NX + i + offset) ERR;
+   return 0;
+}
+
+/* Read and check every var, a row of each var at a time. */
+static int
+check_vars(int ncid, int offset)
+{
+   int v, y;
+
+   for (y = 0; y < NY; y++)
+      for (v = 0; v < NVARS; v++)
+         if (check_row(ncid, v, y, offset)) ERR;
+   return 0;
+}
+
+/* Add offset to every value of every var, a row of each var at a
+ * time. */
+static int
+update_vars(int ncid, int offset)
+{
+   size_t start[2] = {0, 0}, count[2] = {1, NX};
+   int row[NX], v, y, i;
+
+   for (y = 0; y < NY; y++)
+      for (v = 0; v < NVARS; v++)
+      {
+         start[0] = (size_t)y;
+         for (i = 0; i < NX; i++)
+            row[i] = v * NY * NX + y * NX + i + offset;
+         if (nc_put_vara_int(ncid, v, start, count, row)) ERR;
+      }
+   return 0;
+}
+
+int
+main(int argc, char **argv)
+{
+   printf("\n*** Testing the chunk cache budget.\n");
+   printf("*** setting and getting the budget...");
+   {
+      size_t size, minimum;
+
+      if (nc_get_chunk_cache_budget(&size, &minimum)) ERR;
+      if (size || minimum) ERR;
+      if (nc_set_chunk_cache_budget(BUDGET, MINIMUM)) ERR;
+      if (nc_get_chunk_cache_budget(&size, NULL)) ERR;
+      if (nc_get_chunk_cache_budget(NULL, &minimum)) ERR;
+      if (size != BUDGET || minimum != MINIMUM) ERR;
+      if (nc_set_chunk_cache_budget(0, 0)) ERR;
+   }
+   SUMMARIZE_ERR;
+
+   printf("*** checking HDF5 chunk caches without a budget...");
+   {
+      int ncid;
+
+      if (create_file(FILE_NAME, NC_NETCDF4)) ERR;
+      if (nc_set_chunk_cache(VAR_CACHE, 1009, 0.75)) ERR;
+      if (nc_open(FILE_NAME, NC_NOWRITE, &ncid)) ERR;
+      if (check_vars(ncid, 0)) ERR;
+      if (granted(NULL) != NVARS * VAR_CACHE) ERR;
+      if (nc_close(ncid)) ERR;
+   }
+   SUMMARIZE_ERR;
+
+   if (nc_set_chunk_cache_budget(BUDGET, MINIMUM)) ERR;
+
+   printf("*** checking HDF5 chunk caches with a budget...");
+   {
+      int ncid, r;
+      size_t var0, size;
+
+      if (nc_open(FILE_NAME, NC_NOWRITE, &ncid)) ERR;
+      if (check_vars(ncid, 0)) ERR;
+      if (granted(NULL) > BUDGET) ERR;
+
+      /* Only var_0 is used, so it takes the cache of the others. */
+      for (r = 0; r < NREADS; r++)
+         if (check_row(ncid, 0, r, 0)) ERR;
+      if (granted(&var0) > BUDGET) ERR;
+      if (var0 != VAR_CACHE) ERR;
+
+      /* The var's own setting is unchanged. */
+      if (nc_get_var_chunk_cache(ncid, 1, &size, NULL, NULL)) ERR;
+      if (size != VAR_CACHE) ERR;
+
+      /* Asking for more than the budget gets what is left. */
+      if (nc_set_var_chunk_cache(ncid, 0, 4 * BUDGET, 1009, 0.75)) ERR;
+      if (granted(&var0) > BUDGET) ERR;
+      if (var0 <= VAR_CACHE) ERR;
+      if (check_row(ncid, 0, 0, 0)) ERR;
+      if (nc_close(ncid)) ERR;
+   }
+   SUMMARIZE_ERR;
+
+   printf("*** checking HDF5 writes with a budget...");
+   {
+      int ncid;
+
+      if (nc_open(FILE_NAME, NC_WRITE, &ncid)) ERR;
+      if (update_vars(ncid, 1)) ERR;
+      if (granted(NULL) > BUDGET) ERR;
+      if (nc_close(ncid)) ERR;
+      if (nc_open(FILE_NAME, NC_NOWRITE, &ncid)) ERR;
+      if (check_vars(ncid, 1)) ERR;
+      if (nc_close(ncid)) ERR;
+   }
+   SUMMARIZE_ERR;
+
+#ifdef ENABLE_NCZARR
+   printf("*** checking NCZarr reads and writes with a budget...");
+   {
+      int ncid;
+
+      /* Less than a chunk of each var fits, so chunks of one var are
+       * written out to make room for another's. */
+      if (nc_set_chunk_cache_budget(NVARS * CHUNK * CHUNK * sizeof(int) / 2, 0)) ERR;
+      if (create_file(ZARR_NAME, NC_NETCDF4)) ERR;
+      if (nc_open(ZARR_NAME, NC_WRITE, &ncid)) ERR;
+      if (update_vars(ncid, 2)) ERR;
+      if (check_vars(ncid, 2)) ERR;
+      if (nc_close(ncid)) ERR;
+      if (nc_open(ZARR_NAME, NC_NOWRITE, &ncid)) ERR;
+      if (check_vars(ncid, 2)) ERR;
+      if (nc_close(ncid)) ERR;
+
+      /* With a minimum, each var keeps a chunk. */
+      if (nc_set_chunk_cache_budget(1, 1)) ERR;
+      if (nc_open(ZARR_NAME, NC_NOWRITE, &ncid)) ERR;
+      if (check_vars(ncid, 2)) ERR;
+      if (nc_close(ncid)) ERR;
+   }
+   SUMMARIZE_ERR;
+#endif
+   FINAL_RESULTS;
+}
@@ -0,0 +1,191 @@
+/* This is part of the netCDF package.
+   Copyright 2018 University Corporation for Atmospheric Research/Unidata
+   See COPYRIGHT file for conditions of use.
+
+   Test reading and writing chunks as they are stored, with
+   nc_get_var_chunk_raw() and nc_put_var_chunk_raw().
+*/
+
+#include <nc_tests.h>
+#include "err_macros.h"
+#include "netcdf.h"
+#include "netcdf_filter.h"
+
+#define FILE_NAME "tst_chunk_raw.nc"
+#define COPY_NAME "tst_chunk_raw_copy.nc"
+#define ZARR_NAME "file://tst_chunk_raw.file#mode=nczarr,file"
+#define ZARR_COPY_NAME "file://tst_chunk_raw_copy.file#mode=nczarr,file"
+#define CLASSIC_NAME "tst_chunk_raw_classic.nc"
+#define NY 10
+#define NX 12
+#define CHUNK_Y 4
+#define CHUNK_X 5
+#define WRITTEN_Y 6 /* rows written, so the last row of chunks is not */
+
+/* Define the vars: a chunked var, compressed if deflate is set, a
+ * chunked var with an unlimited dim, and a contiguous var if
+ * contiguous is set. */
+static int
+define_vars(int ncid, int deflate, int contiguous)
+{
+   int dimids[2], tdimids[2], varid;
+   size_t chunks[2] = {CHUNK_Y, CHUNK_X};
+
+   if (nc_def_dim(ncid, "y", NY, &dimids[0])) ERR;
+   if (nc_def_dim(ncid, "x", NX, &dimids[1])) ERR;
+   if (nc_def_dim(ncid, "t", NC_UNLIMITED, &tdimids[0])) ERR;
+   tdimids[1] = dimids[1];
+   if (nc_def_var(ncid, "data", NC_INT, 2, dimids, &varid)) ERR;
+   if (nc_def_var_chunking(ncid, varid, NC_CHUNKED, chunks)) ERR;
+   if (deflate && nc_def_var_deflate(ncid, varid, 1, 1, 3)) ERR;
+   if (nc_def_var(ncid, "series", NC_INT, 2, tdimids, &varid)) ERR;
+   if (nc_def_var_chunking(ncid, varid, NC_CHUNKED, chunks)) ERR;
+   if (contiguous)
+   {
+      if (nc_def_var(ncid, "contig", NC_INT, 2, dimids, &varid)) ERR;
+      if (nc_def_var_chunking(ncid, varid, NC_CONTIGUOUS, NULL)) ERR;
+   }
+   return 0;
+}
+
+/* Create a file, writing the first WRITTEN_Y rows of data and NY
+ * rows of series. */
+static int
+create_file(const char *path, int deflate)
+{
+   int ncid, data[NY * NX], i;
+   size_t start[2] = {0, 0}, count[2] = {WRITTEN_Y, NX};
+
+   for (i = 0; i < NY * NX; i++)
+      data[i] = i;
+   if (nc_create(path, NC_NETCDF4 | NC_CLOBBER, &ncid)) ERR;
+   if (define_vars(ncid, deflate, 1)) ERR;
+   if (nc_enddef(ncid)) ERR;
+   if (nc_put_vara_int(ncid, 0, start, count, data)) ERR;
+   count[0] = NY;
+   if (nc_put_vara_int(ncid, 1, start, count, data)) ERR;
+   if (nc_close(ncid)) ERR;
+   return 0;
+}
+
+/* Copy the chunks of a var, as they are stored. Chunks that were
+ * never written are not copied. */
+static int
+copy_chunks(int ncid, int ncid2, int varid, size_t ny)
+{
+   size_t start[2], size;
+   char *chunk;
+
+   for (start[0] = 0; start[0] < ny; start[0] += CHUNK_Y)
+      for (start[1] = 0; start[1] < NX; start[1] += CHUNK_X)
+      {
+         if (nc_get_var_chunk_raw(ncid, varid, start, &size, NULL)) ERR;
+         if (start[0] >= WRITTEN_Y && !varid && size) ERR;
+         if (!size)
+            continue;
+         if (!(chunk = malloc(size))) ERR;
+         if (nc_get_var_chunk_raw(ncid, varid, start, &size, chunk)) ERR;
+         if (nc_put_var_chunk_raw(ncid2, varid, start, size, chunk)) ERR;
+         free(chunk);
+      }
+   return 0;
+}
+
+/* Check the errors, and copy the vars of a file to another file a
+ * chunk at a time. */
+static int
+test_raw(const char *path, const char *copy_path, int deflate)
+{
+   int ncid, ncid2, data_in[NY * NX], fill, storage, i;
+   size_t start[2] = {0, 0}, count[2] = {1, 1}, size;
+   int one = 1;
+
+   if (create_file(path, deflate)) ERR;
+   if (nc_open(path, NC_NOWRITE, &ncid)) ERR;
+
+   /* Chunks must be on a chunk boundary, inside the var, of a
+    * chunked var. */
+   start[1] = 1;
+   if (nc_get_var_chunk_raw(ncid, 0, start, &size, NULL) != NC_EINVALCOORDS) ERR;
+   start[0] = NY + CHUNK_Y - NY % CHUNK_Y;
+   start[1] = 0;
+   if (nc_get_var_chunk_raw(ncid, 0, start, &size, NULL) != NC_EEDGE) ERR;
+   start[0] = 0;
+   /* NCZarr stores every var in chunks. */
+   if (nc_inq_var_chunking(ncid, 2, &storage, NULL)) ERR;
+   if (storage == NC_CONTIGUOUS &&
+       nc_get_var_chunk_raw(ncid, 2, start, &size, NULL) != NC_EINVAL) ERR;
+   if (nc_get_var_chunk_raw(ncid, 0, NULL, &size, NULL) != NC_EINVALCOORDS) ERR;
+   if (nc_put_var_chunk_raw(ncid, 0, start, sizeof(int), &one) != NC_EPERM) ERR;
+
+   /* Copy the chunks to a file with the same vars. The series var
+    * must be extended before its chunks are written. */
+   if (nc_create(copy_path, NC_NETCDF4 | NC_CLOBBER, &ncid2)) ERR;
+   if (define_vars(ncid2, deflate, 0)) ERR;
+   if (nc_enddef(ncid2)) ERR;
+   if (nc_put_var_chunk_raw(ncid2, 1, start, sizeof(int), &one) != NC_EEDGE) ERR;
+   start[0] = NY - 1;
+   if (nc_get_vara_int(ncid, 1, start, count, &one)) ERR;
+   if (nc_put_vara_int(ncid2, 1, start, count, &one)) ERR;
+   if (copy_chunks(ncid, ncid2, 0, NY)) ERR;
+   if (copy_chunks(ncid, ncid2, 1, NY)) ERR;
+   if (nc_close(ncid2)) ERR;
+   if (nc_close(ncid)) ERR;
+
+   /* Check the copy. */
+   if (nc_open(copy_path, NC_NOWRITE, &ncid2)) ERR;
+   if (nc_get_var_int(ncid2, 0, data_in)) ERR;
+   if (nc_inq_var_fill(ncid2, 0, NULL, &fill)) ERR;
+   for (i = 0; i < NY * NX; i++)
+      if (data_in[i] != (i < WRITTEN_Y * NX ? i : fill)) ERR;
+   if (nc_get_var_int(ncid2, 1, data_in)) ERR;
+   for (i = 0; i < NY * NX; i++)
+      if (data_in[i] != i) ERR;
+   if (nc_close(ncid2)) ERR;
+   return 0;
+}
+
+int
+main(int argc, char **argv)
+{
+   printf("\n*** Testing raw chunk reads and writes.\n");
+   printf("*** checking netCDF-4/HDF5 files...");
+   {
+      int ncid, ret;
+      size_t start[2] = {0, 0};
+
+      /* Older HDF5 versions cannot access stored chunks. */
+      if (create_file(FILE_NAME, 1)) ERR;
+      if (nc_open(FILE_NAME, NC_NOWRITE, &ncid)) ERR;
+      ret = nc_get_var_chunk_raw(ncid, 0, start, NULL, NULL);
+      if (nc_close(ncid)) ERR;
+      if (ret == NC_ENOTBUILT)
+         printf("not built...");
+      else if (test_raw(FILE_NAME, COPY_NAME, 1)) ERR;
+   }
+   SUMMARIZE_ERR;
+
+   printf("*** checking that classic files have no stored chunks...");
+   {
+      int ncid, dimid, varid;
+      size_t start = 0, size;
+
+      if (nc_create(CLASSIC_NAME, NC_CLOBBER, &ncid)) ERR;
+      if (nc_def_dim(ncid, "x", NX, &dimid)) ERR;
+      if (nc_def_var(ncid, "x", NC_INT, 1, &dimid, &varid)) ERR;
+      if (nc_enddef(ncid)) ERR;
+      if (nc_get_var_chunk_raw(ncid, varid, &start, &size, NULL) != NC_ENOTNC4) ERR;
+      if (nc_close(ncid)) ERR;
+   }
+   SUMMARIZE_ERR;
+
+#ifdef ENABLE_NCZARR
+   printf("*** checking NCZarr files...");
+   {
+      /* Filters may not be available to NCZarr here. */
+      if (test_raw(ZARR_NAME, ZARR_COPY_NAME, 0)) ERR;
+   }
+   SUMMARIZE_ERR;
+#endif
+   FINAL_RESULTS;
+}
@@ -0,0 +1,133 @@
+/* This is part of the netCDF package.
+   Copyright 2018 University Corporation for Atmospheric Research/Unidata
+   See COPYRIGHT file for conditions of use.
+
+   Test the pool of open HDF5 datasets for read-only files, which is
+   set up with the HDF5.DATASET_POOL_SIZE rc key.
+*/
+
+#include <nc_tests.h>
+#include "err_macros.h"
+#include "netcdf.h"
+#include <hdf5.h>
+
+#define FILE_NAME "tst_dataset_pool.nc"
+#define NVARS 40
+#define NX 6
+#define POOL_SIZE 4
+#define CACHE_SIZE 123456
+#define CACHE_NELEMS 1009
+
+/* # of open HDF5 datasets, in all open files. */
+static ssize_t
+open_datasets(void)
+{
+   return H5Fget_obj_count(H5F_OBJ_ALL, H5F_OBJ_DATASET);
+}
+
+/* Read and check every var and its att. */
+static int
+check_vars(int ncid)
+{
+   int v, i, data_in[NX], att_in;
+
+   for (v = 0; v < NVARS; v++)
+   {
+      if (nc_get_var_int(ncid, v + 1, data_in)) ERR;
+      for (i = 0; i < NX; i++)
+         if (data_in[i] != v * NX + i) ERR;
+      if (nc_get_att_int(ncid, v + 1, "v", &att_in)) ERR;
+      if (att_in != v) ERR;
+   }
+   return 0;
+}
+
+int
+main(int argc, char **argv)
+{
+   printf("\n*** Testing the HDF5 dataset pool.\n");
+   printf("*** creating file...");
+   {
+      int ncid, dimid, varid, v, i, data[NX];
+
+      if (nc_create(FILE_NAME, NC_NETCDF4 | NC_CLOBBER, &ncid)) ERR;
+      if (nc_def_dim(ncid, "x", NX, &dimid)) ERR;
+      if (nc_def_var(ncid, "x", NC_INT, 1, &dimid, &varid)) ERR;
+      for (v = 0; v < NVARS; v++)
+      {
+         char name[NC_MAX_NAME + 1];
+         snprintf(name, sizeof(name), "var_%d", v);
+         if (nc_def_var(ncid, name, NC_INT, 1, &dimid, &varid)) ERR;
+         if (nc_put_att_int(ncid, varid, "v", NC_INT, 1, &v)) ERR;
+      }
+      for (v = 0; v < NVARS; v++)
+      {
+         for (i = 0; i < NX; i++)
+            data[i] = v * NX + i;
+         if (nc_put_var_int(ncid, v + 1, data)) ERR;
+      }
+      if (nc_close(ncid)) ERR;
+   }
+   SUMMARIZE_ERR;
+
+   printf("*** checking without a pool...");
+   {
+      int ncid;
+
+      if (nc_open(FILE_NAME, NC_NOWRITE, &ncid)) ERR;
+      if (check_vars(ncid)) ERR;
+      if (open_datasets() < NVARS) ERR;
+      if (nc_close(ncid)) ERR;
+   }
+   SUMMARIZE_ERR;
+
+   if (nc_rc_set("HDF5.DATASET_POOL_SIZE", "4")) ERR;
+
+   printf("*** checking read-only file with a pool...");
+   {
+      int ncid, r;
+
+      if (nc_open(FILE_NAME, NC_NOWRITE, &ncid)) ERR;
+      /* The coordinate var is not pooled. */
+      if (open_datasets() > POOL_SIZE + 1) ERR;
+      for (r = 0; r < 2; r++)
+      {
+         if (check_vars(ncid)) ERR;
+         if (open_datasets() > POOL_SIZE + 1) ERR;
+      }
+      if (nc_close(ncid)) ERR;
+      if (open_datasets()) ERR;
+   }
+   SUMMARIZE_ERR;
+
+   printf("*** checking chunk cache settings of a reopened dataset...");
+   {
+      int ncid;
+      size_t size, nelems;
+      float preemption;
+
+      if (nc_open(FILE_NAME, NC_NOWRITE | NC_LAZYOPEN, &ncid)) ERR;
+      if (nc_set_var_chunk_cache(ncid, 1, CACHE_SIZE, CACHE_NELEMS, 0.25)) ERR;
+      /* Push var 1 out of the pool, and bring it back. */
+      if (check_vars(ncid)) ERR;
+      if (open_datasets() > POOL_SIZE + 1) ERR;
+      if (nc_get_var_chunk_cache(ncid, 1, &size, &nelems, &preemption)) ERR;
+      if (size != CACHE_SIZE || nelems != CACHE_NELEMS || preemption != 0.25f) ERR;
+      if (check_vars(ncid)) ERR;
+      if (nc_close(ncid)) ERR;
+   }
+   SUMMARIZE_ERR;
+
+   printf("*** checking that writable files are not pooled...");
+   {
+      int ncid, one = 1;
+
+      if (nc_open(FILE_NAME, NC_WRITE, &ncid)) ERR;
+      if (check_vars(ncid)) ERR;
+      if (open_datasets() < NVARS) ERR;
+      if (nc_put_att_int(ncid, 1, "w", NC_INT, 1, &one)) ERR;
+      if (nc_close(ncid)) ERR;
+   }
+   SUMMARIZE_ERR;
+   FINAL_RESULTS;
+}
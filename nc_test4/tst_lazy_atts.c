@@ -0,0 +1,158 @@
+/* This is part of the netCDF package.
+   Copyright 2018 University Corporation for Atmospheric Research/Unidata
+   See COPYRIGHT file for conditions of use.
+
+   Test that attribute values of netCDF-4 files, which are read from
+   the file on first use, are correct after the atts are read, changed,
+   renamed, and dropped from memory with the
+   HDF5.ATTRIBUTE_CACHE_LIMIT rc key.
+*/
+
+#include <nc_tests.h>
+#include "err_macros.h"
+#include "netcdf.h"
+
+#define FILE_NAME "tst_lazy_atts.nc"
+#define BIG_LEN 10000
+#define NX 4
+#define BIG_ATT "big"
+#define SMALL_ATT "small"
+#define STR_ATT "strings"
+#define UNITS "units"
+#define NSTR 3
+
+/* Check the att values, with the var that was called "v" called
+ * var_name, and the att that was called SMALL_ATT called
+ * small_name. */
+static int
+check_atts(int ncid, const char *var_name, const char *small_name)
+{
+   int *big_in;
+   int small_in[NX];
+   char *str_in[NSTR];
+   char units_in[NC_MAX_NAME + 1];
+   size_t len;
+   int varid, i, r;
+
+   if (!(big_in = malloc(BIG_LEN * sizeof(int)))) ERR;
+   if (nc_inq_varid(ncid, var_name, &varid)) ERR;
+
+   /* Read the big att twice, since it may be dropped from memory
+    * after the first read. */
+   for (r = 0; r < 2; r++)
+   {
+      if (nc_inq_attlen(ncid, NC_GLOBAL, BIG_ATT, &len)) ERR;
+      if (len != BIG_LEN) ERR;
+      if (nc_get_att_int(ncid, NC_GLOBAL, BIG_ATT, big_in)) ERR;
+      for (i = 0; i < BIG_LEN; i++)
+         if (big_in[i] != i) ERR;
+   }
+   if (nc_get_att_int(ncid, varid, small_name, small_in)) ERR;
+   for (i = 0; i < NX; i++)
+      if (small_in[i] != -i) ERR;
+   if (nc_get_att_text(ncid, varid, UNITS, units_in)) ERR;
+   if (strncmp(units_in, "m", 1)) ERR;
+   if (nc_get_att_string(ncid, NC_GLOBAL, STR_ATT, str_in)) ERR;
+   if (strcmp(str_in[0], "x") || strcmp(str_in[1], "yy") || strcmp(str_in[2], "zzz")) ERR;
+   if (nc_free_string(NSTR, str_in)) ERR;
+   free(big_in);
+   return 0;
+}
+
+int
+main(int argc, char **argv)
+{
+   printf("\n*** Testing lazy reading of attribute values.\n");
+   printf("*** creating file...");
+   {
+      int ncid, dimid, varid, i;
+      int *big, small[NX];
+      const char *str[NSTR] = {"x", "yy", "zzz"};
+
+      if (!(big = malloc(BIG_LEN * sizeof(int)))) ERR;
+      for (i = 0; i < BIG_LEN; i++)
+         big[i] = i;
+      for (i = 0; i < NX; i++)
+         small[i] = -i;
+      if (nc_create(FILE_NAME, NC_NETCDF4 | NC_CLOBBER, &ncid)) ERR;
+      if (nc_def_dim(ncid, "x", NX, &dimid)) ERR;
+      if (nc_def_var(ncid, "v", NC_INT, 1, &dimid, &varid)) ERR;
+      if (nc_put_att_int(ncid, NC_GLOBAL, BIG_ATT, NC_INT, BIG_LEN, big)) ERR;
+      if (nc_put_att_string(ncid, NC_GLOBAL, STR_ATT, NSTR, str)) ERR;
+      if (nc_put_att_int(ncid, varid, SMALL_ATT, NC_INT, NX, small)) ERR;
+      if (nc_put_att_text(ncid, varid, UNITS, 1, "m")) ERR;
+      if (nc_close(ncid)) ERR;
+      free(big);
+   }
+   SUMMARIZE_ERR;
+
+   printf("*** checking atts that are never read...");
+   {
+      int ncid, natts;
+      if (nc_open(FILE_NAME, NC_NOWRITE, &ncid)) ERR;
+      if (nc_inq_natts(ncid, &natts)) ERR;
+      if (natts != 2) ERR;
+      if (nc_close(ncid)) ERR;
+   }
+   SUMMARIZE_ERR;
+
+   printf("*** checking att values...");
+   {
+      int ncid;
+      if (nc_open(FILE_NAME, NC_NOWRITE, &ncid)) ERR;
+      if (check_atts(ncid, "v", SMALL_ATT)) ERR;
+      if (nc_close(ncid)) ERR;
+   }
+   SUMMARIZE_ERR;
+
+   printf("*** checking att values with a cache limit...");
+   {
+      int ncid;
+      if (nc_rc_set("HDF5.ATTRIBUTE_CACHE_LIMIT", "1024")) ERR;
+      if (nc_open(FILE_NAME, NC_NOWRITE, &ncid)) ERR;
+      if (check_atts(ncid, "v", SMALL_ATT)) ERR;
+      if (nc_close(ncid)) ERR;
+   }
+   SUMMARIZE_ERR;
+
+   printf("*** checking rename of an att that was never read...");
+   {
+      int ncid;
+      if (nc_open(FILE_NAME, NC_WRITE, &ncid)) ERR;
+      if (nc_rename_att(ncid, 0, SMALL_ATT, "renamed")) ERR;
+      if (nc_close(ncid)) ERR;
+      if (nc_open(FILE_NAME, NC_NOWRITE, &ncid)) ERR;
+      if (check_atts(ncid, "v", "renamed")) ERR;
+      if (nc_close(ncid)) ERR;
+   }
+   SUMMARIZE_ERR;
+
+   printf("*** checking that a var which becomes a coord var keeps its atts...");
+   {
+      int ncid;
+      if (nc_open(FILE_NAME, NC_WRITE, &ncid)) ERR;
+      if (nc_rename_var(ncid, 0, "x")) ERR;
+      if (nc_close(ncid)) ERR;
+      if (nc_open(FILE_NAME, NC_NOWRITE, &ncid)) ERR;
+      if (check_atts(ncid, "x", "renamed")) ERR;
+      if (nc_close(ncid)) ERR;
+   }
+   SUMMARIZE_ERR;
+
+   printf("*** checking overwrite of an att that was never read...");
+   {
+      int ncid, one = 1, one_in;
+      size_t len;
+      if (nc_open(FILE_NAME, NC_WRITE, &ncid)) ERR;
+      if (nc_put_att_int(ncid, NC_GLOBAL, BIG_ATT, NC_INT, 1, &one)) ERR;
+      if (nc_close(ncid)) ERR;
+      if (nc_open(FILE_NAME, NC_NOWRITE, &ncid)) ERR;
+      if (nc_inq_attlen(ncid, NC_GLOBAL, BIG_ATT, &len)) ERR;
+      if (len != 1) ERR;
+      if (nc_get_att_int(ncid, NC_GLOBAL, BIG_ATT, &one_in)) ERR;
+      if (one_in != one) ERR;
+      if (nc_close(ncid)) ERR;
+   }
+   SUMMARIZE_ERR;
+   FINAL_RESULTS;
+}
@@ -0,0 +1,146 @@
+/* This is part of the netCDF package.
+   Copyright 2018 University Corporation for Atmospheric Research/Unidata
+   See COPYRIGHT file for conditions of use.
+
+   Test opening netCDF-4 files with NC_LAZYOPEN.
+*/
+
+#include <nc_tests.h>
+#include "err_macros.h"
+#include "netcdf.h"
+
+#define FILE_NAME "tst_lazy_open.nc"
+#define NVARS 50
+#define NX 4
+#define NREC 3
+#define DIM_X "x"
+#define DIM_TIME "time"
+#define CHUNK_X 2
+#define DEFLATE_LEVEL 3
+
+/* Open the file with the given mode and check everything in it. */
+static int
+check_file(int mode)
+{
+   int ncid, varid, nvars, ndims, nunlim, unlimid;
+   int dimids[1], dimids_in[2], natts;
+   char name[NC_MAX_NAME + 1], att_in[NC_MAX_NAME + 1];
+   size_t len, chunks_in[2];
+   int storage, shuffle, deflate, deflate_level;
+   float fill_in, data_in[NREC][NX];
+   nc_type xtype;
+   int v, i, j;
+
+   if (nc_open(FILE_NAME, mode, &ncid)) ERR;
+   if (nc_inq(ncid, &ndims, &nvars, NULL, &unlimid)) ERR;
+   if (ndims != 2 || nvars != NVARS + 2) ERR;
+   if (nc_inq_unlimdims(ncid, &nunlim, NULL)) ERR;
+   if (nunlim != 1) ERR;
+   if (nc_inq_dimlen(ncid, unlimid, &len)) ERR;
+   if (len != NREC) ERR;
+
+   /* Read the vars in reverse order, so that they are not visited
+    * in the order they were read from the file. */
+   for (v = NVARS - 1; v >= 0; v -= 7)
+   {
+      snprintf(name, sizeof(name), "var_%d", v);
+      if (nc_inq_varid(ncid, name, &varid)) ERR;
+      if (nc_inq_var(ncid, varid, NULL, &xtype, &ndims, dimids_in, &natts)) ERR;
+      if (xtype != NC_FLOAT || ndims != 2 || natts != 2) ERR;
+      if (nc_inq_dimname(ncid, dimids_in[0], name)) ERR;
+      if (strcmp(name, DIM_TIME)) ERR;
+      if (nc_inq_dimname(ncid, dimids_in[1], name)) ERR;
+      if (strcmp(name, DIM_X)) ERR;
+      if (nc_get_att_text(ncid, varid, "units", att_in)) ERR;
+      if (strncmp(att_in, "m/s", 3)) ERR;
+      if (nc_inq_var_chunking(ncid, varid, &storage, chunks_in)) ERR;
+      if (storage != NC_CHUNKED || chunks_in[0] != 1 || chunks_in[1] != CHUNK_X) ERR;
+      if (nc_inq_var_deflate(ncid, varid, &shuffle, &deflate, &deflate_level)) ERR;
+      if (!deflate || deflate_level != DEFLATE_LEVEL) ERR;
+      if (nc_inq_var_fill(ncid, varid, NULL, &fill_in)) ERR;
+      if (fill_in != (float)-v) ERR;
+      if (nc_get_var_float(ncid, varid, &data_in[0][0])) ERR;
+      for (i = 0; i < NREC; i++)
+         for (j = 0; j < NX; j++)
+            if (data_in[i][j] != (float)(v * 100 + i * NX + j)) ERR;
+   }
+
+   /* The coordinate var. */
+   if (nc_inq_varid(ncid, DIM_X, &varid)) ERR;
+   if (nc_get_var_float(ncid, varid, &data_in[0][0])) ERR;
+   for (j = 0; j < NX; j++)
+      if (data_in[0][j] != (float)j) ERR;
+
+   /* A non-coordinate var that has the same name as a dim. */
+   if (nc_inq_varid(ncid, DIM_TIME, &varid)) ERR;
+   if (nc_inq_vardimid(ncid, varid, dimids)) ERR;
+   if (nc_inq_dimname(ncid, dimids[0], name)) ERR;
+   if (strcmp(name, DIM_X)) ERR;
+   if (nc_get_var_float(ncid, varid, &data_in[0][0])) ERR;
+   for (j = 0; j < NX; j++)
+      if (data_in[0][j] != (float)(NX - j)) ERR;
+
+   if (nc_close(ncid)) ERR;
+   return 0;
+}
+
+int
+main(int argc, char **argv)
+{
+   printf("\n*** Testing NC_LAZYOPEN.\n");
+   printf("*** creating file...");
+   {
+      int ncid, dimids[2], varid, v, i;
+      size_t chunks[2] = {1, CHUNK_X};
+      float data[NREC][NX], fill;
+
+      if (nc_create(FILE_NAME, NC_NETCDF4, &ncid)) ERR;
+      if (nc_def_dim(ncid, DIM_TIME, NC_UNLIMITED, &dimids[0])) ERR;
+      if (nc_def_dim(ncid, DIM_X, NX, &dimids[1])) ERR;
+      if (nc_def_var(ncid, DIM_X, NC_FLOAT, 1, &dimids[1], &varid)) ERR;
+      for (v = 0; v < NVARS; v++)
+      {
+         char name[NC_MAX_NAME + 1];
+         snprintf(name, sizeof(name), "var_%d", v);
+         if (nc_def_var(ncid, name, NC_FLOAT, 2, dimids, &varid)) ERR;
+         if (nc_def_var_chunking(ncid, varid, NC_CHUNKED, chunks)) ERR;
+         if (nc_def_var_deflate(ncid, varid, 0, 1, DEFLATE_LEVEL)) ERR;
+         fill = (float)-v;
+         if (nc_def_var_fill(ncid, varid, 0, &fill)) ERR;
+         if (nc_put_att_text(ncid, varid, "units", 3, "m/s")) ERR;
+      }
+      /* A var named after a dim (but not its coordinate var) is
+       * stored under a secret name in the HDF5 file. */
+      if (nc_def_var(ncid, DIM_TIME, NC_FLOAT, 1, &dimids[1], &varid)) ERR;
+      if (nc_enddef(ncid)) ERR;
+
+      for (i = 0; i < NX; i++)
+         data[0][i] = (float)i;
+      if (nc_put_var_float(ncid, 0, &data[0][0])) ERR;
+      for (v = 0; v < NVARS; v++)
+      {
+         size_t start[2] = {0, 0}, count[2] = {NREC, NX};
+         for (i = 0; i < NREC * NX; i++)
+            (&data[0][0])[i] = (float)(v * 100 + i);
+         if (nc_put_vara_float(ncid, v + 1, start, count, &data[0][0])) ERR;
+      }
+      for (i = 0; i < NX; i++)
+         data[0][i] = (float)(NX - i);
+      if (nc_put_var_float(ncid, NVARS + 1, &data[0][0])) ERR;
+      if (nc_close(ncid)) ERR;
+   }
+   SUMMARIZE_ERR;
+
+   printf("*** checking file with regular open...");
+   if (check_file(NC_NOWRITE)) ERR;
+   SUMMARIZE_ERR;
+
+   printf("*** checking file with lazy open...");
+   if (check_file(NC_NOWRITE | NC_LAZYOPEN)) ERR;
+   SUMMARIZE_ERR;
+
+   printf("*** checking that lazy open is ignored for writable files...");
+   if (check_file(NC_WRITE | NC_LAZYOPEN)) ERR;
+   SUMMARIZE_ERR;
+   FINAL_RESULTS;
+}
@@ -0,0 +1,327 @@
+/* This is part of the netCDF package.
+   Copyright 2018 University Corporation for Atmospheric Research/Unidata
+   See COPYRIGHT file for conditions of use.
+
+   Test the persistent metadata index of netCDF-4 files, which is
+   enabled with the HDF5.METADATA_INDEX rc key.
+*/
+
+#include <nc_tests.h>
+#include "err_macros.h"
+#include "netcdf.h"
+#include "nccrc.h"
+#include <stdio.h>
+
+#define FILE_NAME "tst_metadata_index.nc"
+#define INDEX_NAME "tst_metadata_index.nc.ncidx"
+#define NVARS 10
+#define NX 5
+#define NREC 2
+#define DIM_X "x"
+#define DIM_TIME "time"
+#define GRP_NAME "sub"
+#define DIM_Y "y"
+#define NY 3
+#define INDEX_HEADSIZE 88 /* Bytes in the index header */
+#define INDEX_MAXSIZE 4096
+
+/* Does the file exist? */
+static int
+file_exists(const char *name)
+{
+   FILE *f;
+   if (!(f = fopen(name, "rb")))
+      return 0;
+   fclose(f);
+   return 1;
+}
+
+/* Check everything in an open file, whose int var has the given
+ * endianness. */
+static int
+check_contents(int ncid, int endianness)
+{
+   int varid, nvars, ndims, unlimid, grpid, ngrps, dimids_in[2], natts;
+   char name[NC_MAX_NAME + 1], att_in[NC_MAX_NAME + 1];
+   float data_in[NREC][NX], fill_in;
+   int idata_in[NY];
+   char *str_in[NY];
+   size_t len;
+   nc_type xtype;
+   int endian_in;
+   int v, i, j;
+
+   if (nc_inq(ncid, &ndims, &nvars, NULL, &unlimid)) ERR;
+   if (ndims != 2 || nvars != NVARS + 2) ERR;
+   if (nc_inq_dimlen(ncid, unlimid, &len)) ERR;
+   if (len != NREC) ERR;
+   if (nc_inq_dimname(ncid, unlimid, name)) ERR;
+   if (strcmp(name, DIM_TIME)) ERR;
+
+   for (v = 0; v < NVARS; v++)
+   {
+      snprintf(name, sizeof(name), "var_%d", v);
+      if (nc_inq_varid(ncid, name, &varid)) ERR;
+      if (varid != v + 1) ERR;
+      if (nc_inq_var(ncid, varid, NULL, &xtype, &ndims, dimids_in, &natts)) ERR;
+      if (xtype != NC_FLOAT || ndims != 2 || natts != 2) ERR;
+      if (dimids_in[0] != unlimid) ERR;
+      if (nc_get_att_text(ncid, varid, "units", att_in)) ERR;
+      if (strncmp(att_in, "m/s", 3)) ERR;
+      if (nc_inq_var_fill(ncid, varid, NULL, &fill_in)) ERR;
+      if (fill_in != (float)-v) ERR;
+      if (nc_get_var_float(ncid, varid, &data_in[0][0])) ERR;
+      for (i = 0; i < NREC; i++)
+         for (j = 0; j < NX; j++)
+            if (data_in[i][j] != (float)(v * 100 + i * NX + j)) ERR;
+   }
+
+   /* The coordinate var. */
+   if (nc_inq_varid(ncid, DIM_X, &varid)) ERR;
+   if (varid != 0) ERR;
+   if (nc_get_var_float(ncid, varid, &data_in[0][0])) ERR;
+   for (j = 0; j < NX; j++)
+      if (data_in[0][j] != (float)j) ERR;
+
+   /* A non-coordinate var that has the same name as a dim. */
+   if (nc_inq_varid(ncid, DIM_TIME, &varid)) ERR;
+   if (nc_inq_vardimid(ncid, varid, dimids_in)) ERR;
+   if (nc_inq_dimname(ncid, dimids_in[0], name)) ERR;
+   if (strcmp(name, DIM_X)) ERR;
+   if (nc_get_var_float(ncid, varid, &data_in[0][0])) ERR;
+   for (j = 0; j < NX; j++)
+      if (data_in[0][j] != (float)(NX - j)) ERR;
+
+   /* The child group, with a dim, an int var that uses a dim of the
+    * parent, and a string var. */
+   if (nc_inq_grps(ncid, &ngrps, &grpid)) ERR;
+   if (ngrps != 1) ERR;
+   if (nc_inq_grpname(grpid, name)) ERR;
+   if (strcmp(name, GRP_NAME)) ERR;
+   if (nc_get_att_text(grpid, NC_GLOBAL, "title", att_in)) ERR;
+   if (strncmp(att_in, "child", 5)) ERR;
+   if (nc_inq_varid(grpid, "ivar", &varid)) ERR;
+   if (nc_inq_var(grpid, varid, NULL, &xtype, &ndims, dimids_in, NULL)) ERR;
+   if (xtype != NC_INT || ndims != 1) ERR;
+   if (nc_inq_var_endian(grpid, varid, &endian_in)) ERR;
+   if (endian_in != endianness) ERR;
+   if (nc_inq_dimname(grpid, dimids_in[0], name)) ERR;
+   if (strcmp(name, DIM_Y)) ERR;
+   if (nc_get_var_int(grpid, varid, idata_in)) ERR;
+   for (j = 0; j < NY; j++)
+      if (idata_in[j] != j * 7) ERR;
+   if (nc_inq_varid(grpid, "svar", &varid)) ERR;
+   if (nc_inq_vartype(grpid, varid, &xtype)) ERR;
+   if (xtype != NC_STRING) ERR;
+   if (nc_get_var_string(grpid, varid, str_in)) ERR;
+   if (strcmp(str_in[0], "a") || strcmp(str_in[1], "bb") || strcmp(str_in[2], "ccc")) ERR;
+   if (nc_free_string(NY, str_in)) ERR;
+   return 0;
+}
+
+/* Open the file, check it, and close it. If remove_index, the index
+ * is removed while the file is open, so that the caller can tell if
+ * it was written again at close. */
+static int
+check_file(int remove_index, int endianness)
+{
+   int ncid;
+
+   if (nc_open(FILE_NAME, NC_NOWRITE, &ncid)) ERR;
+   if (remove_index)
+      remove(INDEX_NAME);
+   if (check_contents(ncid, endianness)) ERR;
+   if (nc_close(ncid)) ERR;
+   return 0;
+}
+
+/* Create the file, with an int var of the given endianness. */
+static int
+create_file(int endianness)
+{
+   int ncid, grpid, dimids[2], ydimid, varid, v, i;
+   float data[NREC][NX], fill;
+   int idata[NY];
+   const char *sdata[NY] = {"a", "bb", "ccc"};
+
+   if (nc_create(FILE_NAME, NC_NETCDF4 | NC_CLOBBER, &ncid)) ERR;
+   if (nc_def_dim(ncid, DIM_TIME, NC_UNLIMITED, &dimids[0])) ERR;
+   if (nc_def_dim(ncid, DIM_X, NX, &dimids[1])) ERR;
+   if (nc_def_var(ncid, DIM_X, NC_FLOAT, 1, &dimids[1], &varid)) ERR;
+   for (v = 0; v < NVARS; v++)
+   {
+      char name[NC_MAX_NAME + 1];
+      snprintf(name, sizeof(name), "var_%d", v);
+      if (nc_def_var(ncid, name, NC_FLOAT, 2, dimids, &varid)) ERR;
+      fill = (float)-v;
+      if (nc_def_var_fill(ncid, varid, 0, &fill)) ERR;
+      if (nc_put_att_text(ncid, varid, "units", 3, "m/s")) ERR;
+   }
+   if (nc_def_var(ncid, DIM_TIME, NC_FLOAT, 1, &dimids[1], &varid)) ERR;
+   if (nc_def_grp(ncid, GRP_NAME, &grpid)) ERR;
+   if (nc_put_att_text(grpid, NC_GLOBAL, "title", 5, "child")) ERR;
+   if (nc_def_dim(grpid, DIM_Y, NY, &ydimid)) ERR;
+   if (nc_def_var(grpid, "ivar", NC_INT, 1, &ydimid, &varid)) ERR;
+   if (nc_def_var_endian(grpid, varid, endianness)) ERR;
+   if (nc_def_var(grpid, "svar", NC_STRING, 1, &ydimid, &varid)) ERR;
+   if (nc_enddef(ncid)) ERR;
+
+   for (i = 0; i < NX; i++)
+      data[0][i] = (float)i;
+   if (nc_put_var_float(ncid, 0, &data[0][0])) ERR;
+   for (v = 0; v < NVARS; v++)
+   {
+      size_t start[2] = {0, 0}, count[2] = {NREC, NX};
+      for (i = 0; i < NREC * NX; i++)
+         (&data[0][0])[i] = (float)(v * 100 + i);
+      if (nc_put_vara_float(ncid, v + 1, start, count, &data[0][0])) ERR;
+   }
+   for (i = 0; i < NX; i++)
+      data[0][i] = (float)(NX - i);
+   if (nc_put_var_float(ncid, NVARS + 1, &data[0][0])) ERR;
+   for (i = 0; i < NY; i++)
+      idata[i] = i * 7;
+   if (nc_put_var_int(grpid, 0, idata)) ERR;
+   if (nc_put_var_string(grpid, 1, sdata)) ERR;
+   if (nc_close(ncid)) ERR;
+   return 0;
+}
+
+/* Replace the first string of the index payload that is str by
+ * newstr, of the same length, or if newstr is NULL, make its length
+ * too large. The payload crc is then fixed up, so that the index
+ * passes its checks but does not describe the file. */
+static int
+tamper_index(const char *str, const char *newstr)
+{
+   char buf[INDEX_MAXSIZE];
+   unsigned int len = (unsigned int)strlen(str);
+   unsigned long long crc;
+   size_t n, i;
+   FILE *f;
+
+   if (!(f = fopen(INDEX_NAME, "r+b"))) ERR;
+   n = fread(buf, 1, sizeof(buf), f);
+   if (n <= INDEX_HEADSIZE || n == sizeof(buf)) ERR;
+   for (i = INDEX_HEADSIZE; i + sizeof(len) + len <= n; i++)
+      if (!memcmp(buf + i, &len, sizeof(len)) &&
+          !memcmp(buf + i + sizeof(len), str, len))
+         break;
+   if (i + sizeof(len) + len > n) ERR;
+   if (newstr)
+      memcpy(buf + i + sizeof(len), newstr, len);
+   else
+      memset(buf + i, 0xff, sizeof(len));
+   /* The payload crc ends the header. */
+   crc = NC_crc64(0, buf + INDEX_HEADSIZE, (unsigned int)(n - INDEX_HEADSIZE));
+   memcpy(buf + INDEX_HEADSIZE - sizeof(crc), &crc, sizeof(crc));
+   rewind(f);
+   if (fwrite(buf, 1, n, f) != n) ERR;
+   fclose(f);
+   return 0;
+}
+
+int
+main(int argc, char **argv)
+{
+   printf("\n*** Testing metadata index.\n");
+   printf("*** creating file...");
+   if (create_file(NC_ENDIAN_LITTLE)) ERR;
+   remove(INDEX_NAME);
+   SUMMARIZE_ERR;
+
+   printf("*** checking that no index is written unless asked for...");
+   if (check_file(0, NC_ENDIAN_LITTLE)) ERR;
+   if (file_exists(INDEX_NAME)) ERR;
+   SUMMARIZE_ERR;
+
+   if (nc_rc_set("HDF5.METADATA_INDEX", "1")) ERR;
+
+   printf("*** checking that the index is written at close...");
+   if (check_file(0, NC_ENDIAN_LITTLE)) ERR;
+   if (!file_exists(INDEX_NAME)) ERR;
+   SUMMARIZE_ERR;
+
+   printf("*** checking open from the index...");
+   /* An open that used the index does not write it again. */
+   if (check_file(1, NC_ENDIAN_LITTLE)) ERR;
+   if (file_exists(INDEX_NAME)) ERR;
+   SUMMARIZE_ERR;
+
+   printf("*** checking that a corrupt index is ignored...");
+   {
+      FILE *f;
+      if (check_file(0, NC_ENDIAN_LITTLE)) ERR;
+      if (!(f = fopen(INDEX_NAME, "r+b"))) ERR;
+      if (fseek(f, -4, SEEK_END)) ERR;
+      if (fwrite("XXXX", 1, 4, f) != 4) ERR;
+      fclose(f);
+      /* The bad index is not used, so it is rewritten at close. */
+      if (check_file(1, NC_ENDIAN_LITTLE)) ERR;
+      if (!file_exists(INDEX_NAME)) ERR;
+      if (check_file(1, NC_ENDIAN_LITTLE)) ERR;
+      if (file_exists(INDEX_NAME)) ERR;
+   }
+   SUMMARIZE_ERR;
+
+   printf("*** checking that an index that does not match the file is dropped...");
+   {
+      /* A child group that is not in the file fails to open after
+       * the root group has been built; a bad name length fails while
+       * the root vars are being read. Either way the file is read as
+       * usual and the index is rewritten at close. */
+      if (check_file(0, NC_ENDIAN_LITTLE)) ERR;
+      if (tamper_index(GRP_NAME, "sux")) ERR;
+      if (check_file(1, NC_ENDIAN_LITTLE)) ERR;
+      if (!file_exists(INDEX_NAME)) ERR;
+      if (tamper_index("var_5", NULL)) ERR;
+      if (check_file(1, NC_ENDIAN_LITTLE)) ERR;
+      if (!file_exists(INDEX_NAME)) ERR;
+      if (check_file(1, NC_ENDIAN_LITTLE)) ERR;
+      if (file_exists(INDEX_NAME)) ERR;
+   }
+   SUMMARIZE_ERR;
+
+   printf("*** checking that a stale index is ignored...");
+   {
+      int ncid;
+      if (check_file(0, NC_ENDIAN_LITTLE)) ERR;
+      if (!file_exists(INDEX_NAME)) ERR;
+      if (nc_open(FILE_NAME, NC_WRITE, &ncid)) ERR;
+      if (nc_put_att_text(ncid, NC_GLOBAL, "history", 7, "changed")) ERR;
+      if (nc_close(ncid)) ERR;
+      if (check_file(1, NC_ENDIAN_LITTLE)) ERR;
+      if (!file_exists(INDEX_NAME)) ERR;
+   }
+   SUMMARIZE_ERR;
+
+#ifdef HAVE_STRUCT_STAT_ST_MTIM_TV_NSEC
+   printf("*** checking that the index of a regenerated file is ignored...");
+   {
+      /* The new file has the same size, the same first few kilobytes
+       * and is written within the same second as the index, but its
+       * int var has another byte order. */
+      if (check_file(0, NC_ENDIAN_LITTLE)) ERR;
+      if (!file_exists(INDEX_NAME)) ERR;
+      if (create_file(NC_ENDIAN_BIG)) ERR;
+      if (check_file(1, NC_ENDIAN_BIG)) ERR;
+      if (!file_exists(INDEX_NAME)) ERR;
+      if (create_file(NC_ENDIAN_LITTLE)) ERR;
+      if (check_file(0, NC_ENDIAN_LITTLE)) ERR;
+      if (check_file(1, NC_ENDIAN_LITTLE)) ERR;
+      if (file_exists(INDEX_NAME)) ERR;
+   }
+   SUMMARIZE_ERR;
+#endif
+
+   printf("*** checking that the index is not used for writable files...");
+   {
+      int ncid;
+      if (nc_open(FILE_NAME, NC_WRITE, &ncid)) ERR;
+      if (check_contents(ncid, NC_ENDIAN_LITTLE)) ERR;
+      if (nc_close(ncid)) ERR;
+   }
+   SUMMARIZE_ERR;
+   remove(INDEX_NAME);
+   FINAL_RESULTS;
+}
@@ -0,0 +1,280 @@
+/* This is part of the netCDF package.
+   Copyright 2018 University Corporation for Atmospheric Research/Unidata
+   See COPYRIGHT file for conditions of use.
+
+   Test data conversions of requests large enough to be converted a
+   tile at a time.
+*/
+
+#include <nc_tests.h>
+#include "err_macros.h"
+#include "netcdf.h"
+
+#define FILE_NAME "tst_tiled_converts.nc"
+#define NDIMS 3
+#define NX 40
+#define NY 100
+#define NZ 100
+#define NVARS 3
+#define TOTAL (NX * NY * NZ)
+
+/* The value stored at [i][j][k]. */
+#define VALUE(i, j, k) ((double)((i) * 10000 + (j) * 100 + (k)))
+
+int
+main(int argc, char **argv)
+{
+   int ncid, dimids[NDIMS], varids[NVARS];
+   const char *var_names[NVARS] = {"contiguous", "chunked", "chunked_wide"};
+   size_t chunks[NVARS][NDIMS] = {{0, 0, 0}, {1, 25, 50}, {4, 25, 25}};
+   double *data, *data_in;
+   int *idata_in;
+   size_t i, j, k;
+   int v;
+
+   printf("\n*** Testing tiled data conversion.\n");
+   if (!(data = malloc(TOTAL * sizeof(double)))) ERR;
+   if (!(data_in = malloc(TOTAL * sizeof(double)))) ERR;
+   if (!(idata_in = malloc(TOTAL * sizeof(int)))) ERR;
+   for (i = 0; i < NX; i++)
+      for (j = 0; j < NY; j++)
+         for (k = 0; k < NZ; k++)
+            data[(i * NY + j) * NZ + k] = VALUE(i, j, k);
+
+   printf("*** writing double data to float vars...");
+   {
+      if (nc_create(FILE_NAME, NC_NETCDF4, &ncid)) ERR;
+      if (nc_def_dim(ncid, "x", NX, &dimids[0])) ERR;
+      if (nc_def_dim(ncid, "y", NY, &dimids[1])) ERR;
+      if (nc_def_dim(ncid, "z", NZ, &dimids[2])) ERR;
+      for (v = 0; v < NVARS; v++)
+      {
+         if (nc_def_var(ncid, var_names[v], NC_FLOAT, NDIMS, dimids, &varids[v])) ERR;
+         if (chunks[v][0])
+         {
+            if (nc_def_var_chunking(ncid, varids[v], NC_CHUNKED, chunks[v])) ERR;
+         }
+         else
+         {
+            if (nc_def_var_chunking(ncid, varids[v], NC_CONTIGUOUS, NULL)) ERR;
+         }
+         /* A small chunk cache makes the conversion use small tiles. */
+         if (nc_set_var_chunk_cache(ncid, varids[v], 0, 0, 0.75)) ERR;
+         if (nc_put_var_double(ncid, varids[v], data)) ERR;
+      }
+      if (nc_close(ncid)) ERR;
+   }
+   SUMMARIZE_ERR;
+
+   printf("*** reading whole vars with conversion...");
+   {
+      if (nc_open(FILE_NAME, NC_NOWRITE, &ncid)) ERR;
+      for (v = 0; v < NVARS; v++)
+      {
+         if (nc_inq_varid(ncid, var_names[v], &varids[v])) ERR;
+         if (nc_set_var_chunk_cache(ncid, varids[v], 0, 0, 0.75)) ERR;
+         if (nc_get_var_double(ncid, varids[v], data_in)) ERR;
+         for (i = 0; i < TOTAL; i++)
+            if (data_in[i] != data[i]) ERR;
+         if (nc_get_var_int(ncid, varids[v], idata_in)) ERR;
+         for (i = 0; i < TOTAL; i++)
+            if (idata_in[i] != (int)data[i]) ERR;
+      }
+      if (nc_close(ncid)) ERR;
+   }
+   SUMMARIZE_ERR;
+
+   printf("*** reading unaligned and strided subsets with conversion...");
+   {
+      size_t start[NDIMS] = {3, 7, 1};
+      size_t count[NDIMS] = {35, 90, 97};
+      ptrdiff_t stride[NDIMS] = {1, 1, 1};
+      size_t n;
+
+      if (nc_open(FILE_NAME, NC_NOWRITE, &ncid)) ERR;
+      for (v = 0; v < NVARS; v++)
+      {
+         if (nc_inq_varid(ncid, var_names[v], &varids[v])) ERR;
+         if (nc_set_var_chunk_cache(ncid, varids[v], 0, 0, 0.75)) ERR;
+
+         if (nc_get_vara_double(ncid, varids[v], start, count, data_in)) ERR;
+         for (n = 0, i = 0; i < count[0]; i++)
+            for (j = 0; j < count[1]; j++)
+               for (k = 0; k < count[2]; k++, n++)
+                  if (data_in[n] != VALUE(start[0] + i, start[1] + j, start[2] + k)) ERR;
+
+         stride[0] = 3;
+         count[0] = 12;
+         if (nc_get_vars_double(ncid, varids[v], start, count, stride, data_in)) ERR;
+         for (n = 0, i = 0; i < count[0]; i++)
+            for (j = 0; j < count[1]; j++)
+               for (k = 0; k < count[2]; k++, n++)
+                  if (data_in[n] != VALUE(start[0] + i * (size_t)stride[0], start[1] + j,
+                                          start[2] + k)) ERR;
+         stride[0] = 1;
+         count[0] = 35;
+      }
+      if (nc_close(ncid)) ERR;
+   }
+   SUMMARIZE_ERR;
+
+   printf("*** writing a subset with conversion...");
+   {
+      size_t start[NDIMS] = {5, 3, 0};
+      size_t count[NDIMS] = {33, 91, NZ};
+      size_t n;
+
+      for (n = 0; n < count[0] * count[1] * count[2]; n++)
+         data_in[n] = -(double)n;
+      if (nc_open(FILE_NAME, NC_WRITE, &ncid)) ERR;
+      for (v = 0; v < NVARS; v++)
+      {
+         if (nc_inq_varid(ncid, var_names[v], &varids[v])) ERR;
+         if (nc_set_var_chunk_cache(ncid, varids[v], 0, 0, 0.75)) ERR;
+         if (nc_put_vara_double(ncid, varids[v], start, count, data_in)) ERR;
+      }
+      if (nc_close(ncid)) ERR;
+
+      if (nc_open(FILE_NAME, NC_NOWRITE, &ncid)) ERR;
+      for (v = 0; v < NVARS; v++)
+      {
+         if (nc_inq_varid(ncid, var_names[v], &varids[v])) ERR;
+         if (nc_get_var_double(ncid, varids[v], data)) ERR;
+         for (i = 0; i < NX; i++)
+            for (j = 0; j < NY; j++)
+               for (k = 0; k < NZ; k++)
+               {
+                  double expected = VALUE(i, j, k);
+                  if (i >= start[0] && i < start[0] + count[0] &&
+                      j >= start[1] && j < start[1] + count[1])
+                     expected = -(double)(((i - start[0]) * count[1] + (j - start[1])) * count[2] + k);
+                  if (data[(i * NY + j) * NZ + k] != expected) ERR;
+               }
+      }
+      if (nc_close(ncid)) ERR;
+   }
+   SUMMARIZE_ERR;
+
+   free(data);
+   free(data_in);
+   free(idata_in);
+
+   printf("*** converting rows larger than one tile...");
+   {
+#define NROWS 3
+#define ROWLEN 400000
+      int rowdimids[2];
+      size_t rowchunks[2] = {1, 100000};
+      size_t start[2] = {1, 12345};
+      size_t count[2] = {2, ROWLEN - 12345};
+      double *row_data, *row_in;
+      size_t n;
+
+      if (!(row_data = malloc(NROWS * ROWLEN * sizeof(double)))) ERR;
+      if (!(row_in = malloc(NROWS * ROWLEN * sizeof(double)))) ERR;
+      for (n = 0; n < NROWS * ROWLEN; n++)
+         row_data[n] = (double)n;
+
+      if (nc_create(FILE_NAME, NC_NETCDF4, &ncid)) ERR;
+      if (nc_def_dim(ncid, "rows", NROWS, &rowdimids[0])) ERR;
+      if (nc_def_dim(ncid, "len", ROWLEN, &rowdimids[1])) ERR;
+      if (nc_def_var(ncid, "contiguous", NC_FLOAT, 2, rowdimids, &varids[0])) ERR;
+      if (nc_def_var_chunking(ncid, varids[0], NC_CONTIGUOUS, NULL)) ERR;
+      if (nc_def_var(ncid, "chunked", NC_FLOAT, 2, rowdimids, &varids[1])) ERR;
+      if (nc_def_var_chunking(ncid, varids[1], NC_CHUNKED, rowchunks)) ERR;
+      for (v = 0; v < 2; v++)
+      {
+         if (nc_set_var_chunk_cache(ncid, varids[v], 0, 0, 0.75)) ERR;
+         if (nc_put_var_double(ncid, varids[v], row_data)) ERR;
+      }
+      if (nc_close(ncid)) ERR;
+
+      if (nc_open(FILE_NAME, NC_NOWRITE, &ncid)) ERR;
+      for (v = 0; v < 2; v++)
+      {
+         if (nc_set_var_chunk_cache(ncid, varids[v], 0, 0, 0.75)) ERR;
+         if (nc_get_var_double(ncid, varids[v], row_in)) ERR;
+         for (n = 0; n < NROWS * ROWLEN; n++)
+            if (row_in[n] != row_data[n]) ERR;
+         if (nc_get_vara_double(ncid, varids[v], start, count, row_in)) ERR;
+         for (i = 0; i < count[0]; i++)
+            for (j = 0; j < count[1]; j++)
+               if (row_in[i * count[1] + j] != row_data[(start[0] + i) * ROWLEN + start[1] + j]) ERR;
+      }
+      if (nc_close(ncid)) ERR;
+      free(row_data);
+      free(row_in);
+   }
+   SUMMARIZE_ERR;
+
+   printf("*** converting a large var whose chunks span several tiles...");
+   {
+      /* The chunks are wider than one index in the outer dims, but a
+       * tile one chunk deep there would be far larger than the chunk
+       * cache, so the tiles are cut along the inner dim. The chunks
+       * of the second var are larger than the chunk cache, and the
+       * whole of it is converted as a single chunk-sized tile. */
+#define BX 4
+#define BY 6
+#define BZ 300000
+#define BTOTAL (BX * BY * BZ)
+#define SX 6
+#define SY 60000
+      int bdimids[NDIMS], sdimids[2];
+      size_t bchunks[NDIMS] = {2, 3, 50000};
+      size_t schunks[2] = {SX, SY};
+      size_t start[NDIMS] = {1, 2, 777};
+      size_t count[NDIMS] = {3, 3, 250000};
+      double *big_data, *big_in;
+      int *ibig_in;
+      size_t n;
+
+      if (!(big_data = malloc(BTOTAL * sizeof(double)))) ERR;
+      if (!(big_in = malloc(BTOTAL * sizeof(double)))) ERR;
+      if (!(ibig_in = malloc(BTOTAL * sizeof(int)))) ERR;
+      for (n = 0; n < BTOTAL; n++)
+         big_data[n] = (double)(n % 1000003);
+
+      if (nc_create(FILE_NAME, NC_NETCDF4, &ncid)) ERR;
+      if (nc_def_dim(ncid, "x", BX, &bdimids[0])) ERR;
+      if (nc_def_dim(ncid, "y", BY, &bdimids[1])) ERR;
+      if (nc_def_dim(ncid, "z", BZ, &bdimids[2])) ERR;
+      if (nc_def_dim(ncid, "sx", SX, &sdimids[0])) ERR;
+      if (nc_def_dim(ncid, "sy", SY, &sdimids[1])) ERR;
+      if (nc_def_var(ncid, "big", NC_FLOAT, NDIMS, bdimids, &varids[0])) ERR;
+      if (nc_def_var_chunking(ncid, varids[0], NC_CHUNKED, bchunks)) ERR;
+      if (nc_def_var(ncid, "small_cache", NC_FLOAT, 2, sdimids, &varids[1])) ERR;
+      if (nc_def_var_chunking(ncid, varids[1], NC_CHUNKED, schunks)) ERR;
+      for (v = 0; v < 2; v++)
+      {
+         if (nc_set_var_chunk_cache(ncid, varids[v], 0, 0, 0.75)) ERR;
+         if (nc_put_var_double(ncid, varids[v], big_data)) ERR;
+      }
+      if (nc_close(ncid)) ERR;
+
+      if (nc_open(FILE_NAME, NC_NOWRITE, &ncid)) ERR;
+      for (v = 0; v < 2; v++)
+      {
+         size_t len = (v == 0 ? BTOTAL : SX * SY);
+         if (nc_set_var_chunk_cache(ncid, varids[v], 0, 0, 0.75)) ERR;
+         if (nc_get_var_double(ncid, varids[v], big_in)) ERR;
+         for (n = 0; n < len; n++)
+            if (big_in[n] != big_data[n]) ERR;
+         if (nc_get_var_int(ncid, varids[v], ibig_in)) ERR;
+         for (n = 0; n < len; n++)
+            if (ibig_in[n] != (int)big_data[n]) ERR;
+      }
+      if (nc_get_vara_double(ncid, varids[0], start, count, big_in)) ERR;
+      for (n = 0, i = 0; i < count[0]; i++)
+         for (j = 0; j < count[1]; j++)
+            for (k = 0; k < count[2]; k++, n++)
+               if (big_in[n] != big_data[((start[0] + i) * BY + start[1] + j) * BZ +
+                                         start[2] + k]) ERR;
+      if (nc_close(ncid)) ERR;
+      free(big_data);
+      free(big_in);
+      free(ibig_in);
+   }
+   SUMMARIZE_ERR;
+   FINAL_RESULTS;
+}
@@ -165,6 +165,10 @@ static NC_Dispatch tst_dispatcher = {
 #if NC_DISPATCH_VERSION >= 5
     NC_NOOP_inq_filter_avail,
 #endif
+#if NC_DISPATCH_VERSION >= 6
+    NC_NOTNC4_get_var_chunk_raw,
+    NC_NOTNC4_put_var_chunk_raw,
+#endif
 };
 
 /* This is the dispatch object that holds pointers to all the
@@ -268,6 +272,10 @@ static NC_Dispatch tst_dispatcher_bad_version = {
 #if NC_DISPATCH_VERSION >= 5
     NC_NOOP_inq_filter_avail,
 #endif
+#if NC_DISPATCH_VERSION >= 6
+    NC_NOTNC4_get_var_chunk_raw,
+    NC_NOTNC4_put_var_chunk_raw,
+#endif
 };
 
 #define NUM_UDFS 2
@@ -0,0 +1,366 @@
+/*! \file
+
+Copyright 2018 University Corporation for Atmospheric Research/Unidata.
+
+See \ref copyright file for more info.
+
+Test the [batch] client parameter: partial reads of the same hyperslab
+of several variables must be satisfied with a single fetch after the
+first two reads. The test runs its own minimal DAP2 server on the
+loopback interface, which counts the data requests it receives, so no
+test server is required.
+*/
+
+#include "config.h"
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <ctype.h>
+#include <signal.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/types.h>
+#include <sys/wait.h>
+#include <sys/socket.h>
+#include <netinet/in.h>
+#include <arpa/inet.h>
+#include "netcdf.h"
+
+/* The dataset served is as follows, where
+   var[i][j] = 1000*(index of var) + 10*i + j
+netcdf batch {
+dimensions:
+	x = 6 ;
+	y = 5 ;
+variables:
+	int a(x, y) ;
+	int b(x, y) ;
+	int c(x, y) ;
+	int d(x, y) ;
+}
+*/
+
+#define NVARS 4
+#define X 6
+#define Y 5
+#define RANK 2
+
+static const char* varnames[NVARS] = {"a","b","c","d"};
+
+#define ERRCODE 2
+#define ERR(e) {printf("Error: line %d: %s\n", __LINE__, nc_strerror(e)); exit(ERRCODE);}
+#define FAIL(msg) {printf("Error: line %d: %s\n", __LINE__, (msg)); exit(ERRCODE);}
+
+#undef DEBUG
+
+/**************************************************/
+/* The server */
+
+static int
+varindex(const char* name, size_t len)
+{
+    int i;
+    for(i=0;i<NVARS;i++) {
+	if(strlen(varnames[i]) == len && strncmp(varnames[i],name,len)==0) return i;
+    }
+    return -1;
+}
+
+/* Decode %xx escapes in place */
+static void
+unescape(char* s)
+{
+    char* p = s;
+    for(;*s;s++) {
+	if(s[0] == '%' && isxdigit((unsigned char)s[1]) && isxdigit((unsigned char)s[2])) {
+	    char hex[3] = {s[1],s[2],'\0'};
+	    *p++ = (char)strtol(hex,NULL,16);
+	    s += 2;
+	} else
+	    *p++ = *s;
+    }
+    *p = '\0';
+}
+
+static void
+putu32(char* p, unsigned int v)
+{
+    p[0] = (char)((v >> 24) & 0xff);
+    p[1] = (char)((v >> 16) & 0xff);
+    p[2] = (char)((v >> 8) & 0xff);
+    p[3] = (char)(v & 0xff);
+}
+
+/* Build the DDS for projections of the variables, followed by the
+   data in XDR form if data is non-NULL. A projection is of the form
+   var[start:stride:last]... with one index per dimension; a missing
+   index is the whole dimension. Return the length of the response,
+   or 0 if a projection is malformed. */
+static size_t
+respond(const char* query, char* buf, size_t bufsize, int data)
+{
+    size_t len = 0;
+    size_t nvars = 0;
+    int vars[NVARS*4];
+    size_t start[NVARS*4][RANK], stride[NVARS*4][RANK], count[NVARS*4][RANK];
+    const char* p = query;
+    size_t v;
+    int d;
+
+    /* Parse the projections */
+    while(p != NULL && *p) {
+	const char* q = p;
+	int index;
+	while(*q && *q != '[' && *q != ',') q++;
+	if((index = varindex(p,(size_t)(q-p))) < 0 || nvars >= NVARS*4) return 0;
+	vars[nvars] = index;
+	for(d=0;d<RANK;d++) {
+	    unsigned long first = 0, step = 1, last = (d == 0 ? X : Y) - 1;
+	    if(*q == '[') {
+		int n = 0;
+		if(sscanf(q,"[%lu:%lu:%lu]%n",&first,&step,&last,&n) != 3) {
+		    n = 0;
+		    step = 1;
+		    if(sscanf(q,"[%lu:%lu]%n",&first,&last,&n) != 2) {
+			n = 0;
+			if(sscanf(q,"[%lu]%n",&first,&n) != 1) return 0;
+			last = first;
+		    }
+		}
+		q += n;
+	    }
+	    if(step == 0 || last < first) return 0;
+	    start[nvars][d] = first;
+	    stride[nvars][d] = step;
+	    count[nvars][d] = ((last - first) / step) + 1;
+	}
+	nvars++;
+	p = (*q == ',' ? q+1 : q);
+    }
+    if(nvars == 0) { /* whole dataset */
+	for(nvars=0;nvars<NVARS;nvars++) {
+	    vars[nvars] = (int)nvars;
+	    for(d=0;d<RANK;d++) {
+		start[nvars][d] = 0;
+		stride[nvars][d] = 1;
+		count[nvars][d] = (d == 0 ? X : Y);
+	    }
+	}
+    }
+
+    len += (size_t)snprintf(buf+len,bufsize-len,"Dataset {\n");
+    for(v=0;v<nvars;v++)
+	len += (size_t)snprintf(buf+len,bufsize-len,"    Int32 %s[x = %lu][y = %lu];\n",
+			varnames[vars[v]],(unsigned long)count[v][0],(unsigned long)count[v][1]);
+    len += (size_t)snprintf(buf+len,bufsize-len,"} batch;\n");
+    if(!data) return len;
+
+    len += (size_t)snprintf(buf+len,bufsize-len,"Data:\n");
+    for(v=0;v<nvars;v++) {
+	size_t i, j;
+	size_t n = count[v][0] * count[v][1];
+	putu32(buf+len,(unsigned int)n); len += 4;
+	putu32(buf+len,(unsigned int)n); len += 4;
+	for(i=0;i<count[v][0];i++) {
+	    for(j=0;j<count[v][1];j++) {
+		size_t x = start[v][0] + i*stride[v][0];
+		size_t y = start[v][1] + j*stride[v][1];
+		putu32(buf+len,(unsigned int)(1000*(size_t)vars[v] + 10*x + y)); len += 4;
+	    }
+	}
+    }
+    return len;
+}
+
+/* Serve requests until killed; write a byte to counter for each
+   data request. */
+static void
+serve(int listener, int counter)
+{
+    static char request[8192];
+    static char body[65536];
+    char header[256];
+
+    for(;;) {
+	char* target;
+	char* query;
+	char* end;
+	size_t n = 0, len = 0;
+	ssize_t got;
+	int status = 200;
+	int conn = accept(listener,NULL,NULL);
+	if(conn < 0) continue;
+	/* Read the request header */
+	while(n < sizeof(request)-1 && (got = read(conn,request+n,sizeof(request)-1-n)) > 0) {
+	    n += (size_t)got;
+	    request[n] = '\0';
+	    if(strstr(request,"\r\n\r\n") != NULL) break;
+	}
+	request[n] = '\0';
+	target = strchr(request,' ');
+	if(target == NULL) {close(conn); continue;}
+	target++;
+	if((end = strchr(target,' ')) != NULL) *end = '\0';
+	if((query = strchr(target,'?')) != NULL) {
+	    *query++ = '\0';
+	    unescape(query);
+	} else
+	    query = target + strlen(target); /* empty */
+#ifdef DEBUG
+	fprintf(stderr,"server: %s ? %s\n",target,query);
+#endif
+	n = strlen(target);
+	if(n > 4 && strcmp(target+n-4,".das")==0) {
+	    len = (size_t)snprintf(body,sizeof(body),"Attributes {\n}\n");
+	} else if(n > 4 && strcmp(target+n-4,".dds")==0) {
+	    if((len = respond(query,body,sizeof(body),0)) == 0) status = 400;
+	} else if(n > 5 && strcmp(target+n-5,".dods")==0) {
+	    (void)write(counter,"x",1);
+	    if((len = respond(query,body,sizeof(body),1)) == 0) status = 400;
+	} else
+	    status = 404;
+	if(status != 200) len = 0;
+	n = (size_t)snprintf(header,sizeof(header),
+		"HTTP/1.0 %d %s\r\nContent-Type: %s\r\nContent-Length: %lu\r\nConnection: close\r\n\r\n",
+		status,(status == 200 ? "OK" : "Error"),
+		"application/octet-stream",(unsigned long)len);
+	(void)write(conn,header,n);
+	if(len > 0) (void)write(conn,body,len);
+	close(conn);
+    }
+}
+
+/**************************************************/
+/* The client */
+
+/* Return the number of data requests since the last call */
+static int
+fetches(int counter)
+{
+    char buf[64];
+    int total = 0;
+    ssize_t n;
+    while((n = read(counter,buf,sizeof(buf))) > 0) total += (int)n;
+    return total;
+}
+
+static void
+readvar(int ncid, int index, const size_t* start, const size_t* count)
+{
+    int ret, varid;
+    int data[X*Y];
+    size_t i, j;
+    if((ret = nc_inq_varid(ncid,varnames[index],&varid))) ERR(ret);
+    if((ret = nc_get_vara_int(ncid,varid,start,count,data))) ERR(ret);
+    for(i=0;i<count[0];i++) {
+	for(j=0;j<count[1];j++) {
+	    int expected = (int)(1000*(size_t)index + 10*(start[0]+i) + (start[1]+j));
+	    if(data[i*count[1]+j] != expected) {
+		printf("%s[%lu][%lu] = %d; expected %d\n",varnames[index],
+		       (unsigned long)(start[0]+i),(unsigned long)(start[1]+j),
+		       data[i*count[1]+j],expected);
+		FAIL("wrong data");
+	    }
+	}
+    }
+}
+
+/* Read the same slab of all the variables; return the number of fetches */
+static int
+readall(const char* url, int counter, int batch)
+{
+    int ret, ncid, v;
+    size_t start[RANK] = {1,2};
+    size_t count[RANK] = {3,2};
+    int n;
+
+    if((ret = nc_open(url,NC_NOWRITE,&ncid))) ERR(ret);
+    (void)fetches(counter);
+    for(v=0;v<NVARS;v++)
+	readvar(ncid,v,start,count);
+    n = fetches(counter);
+    if(batch) {
+	/* Read them again, which must not fetch anything */
+	for(v=0;v<NVARS;v++)
+	    readvar(ncid,v,start,count);
+	if(fetches(counter) != 0) FAIL("cached slab was fetched again");
+	/* A different slab is fetched */
+	start[0] = 0;
+	readvar(ncid,0,start,count);
+	if(fetches(counter) != 1) FAIL("new slab was not fetched");
+    }
+    if((ret = nc_close(ncid))) ERR(ret);
+    return n;
+}
+
+static pid_t server = 0;
+
+static void
+stopserver(void)
+{
+    if(server > 0) {
+	kill(server,SIGTERM);
+	waitpid(server,NULL,0);
+	server = 0;
+    }
+}
+
+int
+main(int argc, char** argv)
+{
+    int listener;
+    int counter[2];
+    struct sockaddr_in addr;
+    socklen_t addrlen = sizeof(addr);
+    char url[1024];
+    int n;
+
+    /* Start the server */
+    if((listener = socket(AF_INET,SOCK_STREAM,0)) < 0) FAIL("socket");
+    memset(&addr,0,sizeof(addr));
+    addr.sin_family = AF_INET;
+    addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    addr.sin_port = 0;
+    if(bind(listener,(struct sockaddr*)&addr,sizeof(addr)) < 0) FAIL("bind");
+    if(listen(listener,8) < 0) FAIL("listen");
+    if(getsockname(listener,(struct sockaddr*)&addr,&addrlen) < 0) FAIL("getsockname");
+    if(pipe(counter) < 0) FAIL("pipe");
+    if((server = fork()) < 0) FAIL("fork");
+    if(server == 0) {
+	close(counter[0]);
+	alarm(300); /* in case the client dies without stopping the server */
+	serve(listener,counter[1]);
+	exit(0);
+    }
+    atexit(stopserver);
+    close(listener);
+    close(counter[1]);
+    fcntl(counter[0],F_SETFL,O_NONBLOCK);
+    /* Make sure curl talks to the server directly */
+    unsetenv("http_proxy");
+    unsetenv("HTTP_PROXY");
+    unsetenv("all_proxy");
+    unsetenv("ALL_PROXY");
+
+    printf("*** Testing partial reads without batching...");
+    snprintf(url,sizeof(url),"http://127.0.0.1:%d/batch#noprefetch",(int)ntohs(addr.sin_port));
+    if((n = readall(url,counter[0],0)) != NVARS) {
+	printf("%d fetches\n",n);
+	FAIL("expected one fetch per variable");
+    }
+    printf("ok.\n");
+
+    printf("*** Testing partial reads with batching...");
+    snprintf(url,sizeof(url),"http://127.0.0.1:%d/batch#noprefetch&batch",(int)ntohs(addr.sin_port));
+    /* The first read is fetched alone; the second read of the same slab
+       fetches it for all the remaining variables at once */
+    if((n = readall(url,counter[0],1)) != 2) {
+	printf("%d fetches\n",n);
+	FAIL("expected two fetches");
+    }
+    printf("ok.\n");
+
+    stopserver();
+    printf("*** PASS\n");
+    return 0;
+}
@@ -112,6 +112,10 @@ char double_var_fmt[] = "%.NNg";
 char float_att_fmt[] = "%#.NNgf";
 char float_attx_fmt[] = "%#.NNg";
 char double_att_fmt[] = "%#.NNg";
+/* Floating-point values that are whole numbers smaller in magnitude
+ * than these print with the default formats as plain integers */
+static double float_var_intlimit = 1e7;
+static double double_var_intlimit = 1e15;
 
 /* magic number stored in a safebuf and checked, hoping it will be
  * changed if buffer was overwritten inadvertently */
@@ -195,6 +199,26 @@ sbuf_cat(safebuf_t *sb, const char *s2) {
     assert(SAFEBUF_CHECK(sb));
 }
 
+/* Concatenate the s2len chars at s2 to end of string in safe buffer,
+ * growing if necessary */
+void
+sbuf_catn(safebuf_t *sb, const char *s2, size_t s2len) {
+    assert(SAFEBUF_CHECK(sb));
+    sbuf_grow(sb, 1 + sb->cl + s2len);
+    memcpy(sb->buf + sb->cl, s2, s2len);
+    sb->cl += s2len;
+    sb->buf[sb->cl] = '\0';
+    assert(SAFEBUF_CHECK(sb));
+}
+
+/* Empty the string in safe buffer */
+void
+sbuf_clear(safebuf_t *sb) {
+    assert(SAFEBUF_CHECK(sb));
+    sb->buf[0] = '\0';
+    sb->cl = 0;
+}
+
 /* Concatenate string in safebuf s2 to end of string in safebuf s1,
  * growing if necessary */
 void
@@ -254,6 +278,9 @@ set_formats(int float_digits, int double_digits)
     res = snprintf(double_att_fmt, sizeof double_att_fmt, "%%#.%dg",
 		   double_digits) + 1;
     assert(res <= sizeof(double_att_fmt));
+    /* Past 1e18, whole numbers do not fit in a long long */
+    float_var_intlimit = pow(10.0, float_digits < 18 ? float_digits : 18);
+    double_var_intlimit = pow(10.0, double_digits < 18 ? double_digits : 18);
 }
 
 
@@ -1214,6 +1241,95 @@ ncdouble_val_tostring(const ncvar_t *varp, safebuf_t *sfbf, const void *valp) {
     return sbuf_len(sfbf);
 }
 
+/* Write the decimal digits of v, with a leading '-' if negative is
+ * set, into buf, which must hold at least 22 chars.  Returns the
+ * number of chars written, not counting the terminating null. */
+static size_t
+integer_tostring(char *buf, unsigned long long v, int negative) {
+    char digits[20];
+    size_t n = 0, len = 0;
+    do {
+	digits[n++] = (char)('0' + v % 10);
+	v /= 10;
+    } while(v != 0);
+    if(negative)
+	buf[len++] = '-';
+    while(n > 0)
+	buf[len++] = digits[--n];
+    buf[len] = '\0';
+    return len;
+}
+
+/* Same as the ncXXX_val_tostring functions for integer types, when
+ * the variable has the default format, but without printf. */
+static int
+ncinteger_val_tostring(const ncvar_t *varp, safebuf_t *sfbf, const void *valp) {
+    long long sv = 0;
+    unsigned long long uv = 0;
+    int is_signed = 1;
+    switch (varp->type) {
+    case NC_BYTE: sv = *(signed char *)valp; break;
+    case NC_SHORT: sv = *(short *)valp; break;
+    case NC_INT: sv = *(int *)valp; break;
+    case NC_INT64: sv = *(long long *)valp; break;
+    case NC_UBYTE: uv = *(unsigned char *)valp; is_signed = 0; break;
+    case NC_USHORT: uv = *(unsigned short *)valp; is_signed = 0; break;
+    case NC_UINT: uv = *(unsigned int *)valp; is_signed = 0; break;
+    case NC_UINT64: uv = *(unsigned long long *)valp; is_signed = 0; break;
+    default:
+	error("ncinteger_val_tostring: type not integer primitive");
+    }
+    sbuf_grow(sfbf, PRIM_LEN);
+    if(is_signed && sv < 0)
+	sfbf->cl = integer_tostring(sfbf->buf, 0 - (unsigned long long)sv, 1);
+    else
+	sfbf->cl = integer_tostring(sfbf->buf, is_signed ? (unsigned long long)sv : uv, 0);
+    return sbuf_len(sfbf);
+}
+
+/* Same as ncfloat_val_tostring and ncdouble_val_tostring, when the
+ * variable has the default "%.Ng" format.  Whole numbers with at most
+ * N digits print the same as integers, so printf is only needed for
+ * the other values. */
+static int
+ncfloating_val_tostring(const ncvar_t *varp, safebuf_t *sfbf, const void *valp) {
+    double vv, limit;
+    if(varp->type == NC_FLOAT) {
+	vv = *(float *)valp;
+	limit = float_var_intlimit;
+    } else {
+	vv = *(double *)valp;
+	limit = double_var_intlimit;
+    }
+    if(!isfinite(vv)) {
+	char sout[PRIM_LEN];
+	if(varp->type == NC_FLOAT)
+	    float_special_tostring((float)vv, sout);
+	else
+	    double_special_tostring(vv, sout);
+	sbuf_cpy(sfbf, sout);
+	return sbuf_len(sfbf);
+    }
+    sbuf_grow(sfbf, PRIM_LEN);
+    if(vv > -limit && vv < limit && vv == (double)(long long)vv
+       && !(vv == 0 && signbit(vv))) {
+	long long iv = (long long)vv;
+	if(iv < 0)
+	    sfbf->cl = integer_tostring(sfbf->buf, 0 - (unsigned long long)iv, 1);
+	else
+	    sfbf->cl = integer_tostring(sfbf->buf, (unsigned long long)iv, 0);
+    } else {
+	int res;
+	if(varp->type == NC_FLOAT)
+	    res = snprintf(sfbf->buf, PRIM_LEN, varp->fmt, (float)vv);
+	else
+	    res = snprintf(sfbf->buf, PRIM_LEN, varp->fmt, vv);
+	assert(res < PRIM_LEN);
+	sfbf->cl = (size_t)res;
+    }
+    return sbuf_len(sfbf);
+}
+
 /* Convert value of any numeric type to a double.  Beware, this may
  * lose precision for values of type NC_INT64 or NC_UINT64 */
 static
@@ -1418,6 +1534,25 @@ set_tostring_func(ncvar_t *varp) {
     }
     if( !is_user_defined_type(varp->type) ) {
 	varp->val_tostring = tostring_funcs[varp->type - 1];
+	/* Format values with the default formats without printf
+	 * where that gives the same output */
+	switch(varp->type) {
+	case NC_FLOAT:
+	    if(strcmp(varp->fmt, float_var_fmt) == 0)
+		varp->val_tostring = (val_tostring_func) ncfloating_val_tostring;
+	    break;
+	case NC_DOUBLE:
+	    if(strcmp(varp->fmt, double_var_fmt) == 0)
+		varp->val_tostring = (val_tostring_func) ncfloating_val_tostring;
+	    break;
+	case NC_CHAR:
+	case NC_STRING:
+	    break;
+	default:
+	    if(strcmp(varp->fmt, get_default_fmt(varp->type)) == 0)
+		varp->val_tostring = (val_tostring_func) ncinteger_val_tostring;
+	    break;
+	}
 	return;
     }
 #ifdef USE_NETCDF4
@@ -95,6 +95,12 @@ void sbuf_cpy(safebuf_t *sbuf, const char *s2);
 /* Concatenate string s2 to end of buffer in sbuf, growing if necessary */
 void sbuf_cat(safebuf_t *sbuf, const char *s2);
 
+/* Concatenate s2len chars at s2 to end of buffer in sbuf, growing if necessary */
+void sbuf_catn(safebuf_t *sbuf, const char *s2, size_t s2len);
+
+/* Empty the string in sbuf */
+void sbuf_clear(safebuf_t *sbuf);
+
 /* Concatenate sbuf s2 to end of sbuf s1, growing if necessary */
 void sbuf_catb(safebuf_t *s1, const safebuf_t *s2);
 
@@ -21,6 +21,13 @@
 #include <unistd.h>
 #endif
 #include <string.h>
+#ifdef HAVE_FORK
+#include <errno.h>
+#include <poll.h>
+#include <signal.h>
+#include <sys/types.h>
+#include <sys/wait.h>
+#endif
 #include "netcdf.h"
 #include "netcdf_filter.h"
 #include "netcdf_aux.h"
@@ -31,6 +38,7 @@
 #include "nccomps.h"
 #include "list.h"
 #include "ncpathmgr.h"
+#include "ncrc.h"
 
 #undef DEBUGFILTER
 #undef DEBUGCHUNK
@@ -153,6 +161,20 @@ static char** option_lvars = 0;		/* list of variable names specified with -v
 static bool_t option_varstruct = false;	  /* if -v set, copy structure for non-selected vars */
 static int option_compute_chunkcaches = 0; /* default, don't try still flaky estimate of
 					    * chunk cache for each variable */
+static int option_nprocs = 1;	/* default, copy variable data in one process */
+static size_t option_rechunk_memory = 0; /* default, rechunk with copy buffer and chunk caches */
+static List* option_accessspecs = NULL; /* default, no access patterns to advise chunking */
+static size_t option_advise_chunk_bytes = 0; /* default, advise chunks of the library default size */
+
+/* An access pattern given with -a: the counts of the slabs accessed
+ * along named dimensions, and how often they are accessed. */
+typedef struct AccessSpec {
+    double weight;
+    int ndims;
+    char* names[NC_MAX_VAR_DIMS];
+    size_t counts[NC_MAX_VAR_DIMS]; /* 0 for the whole dimension */
+} AccessSpec;
+
 /* get group id in output corresponding to group igrp in input,
  * given parent group id (or root group id) parid in output. */
 static int
@@ -897,6 +919,55 @@ done:
     return stat;
 }
 
+/* If the access patterns given with -a name any dimension of a
+ * variable, set chunksizes to the chunk sizes advised for them and
+ * return 1, else return 0.  Dimensions an access pattern does not
+ * name are accessed one index at a time. */
+static int
+advise_chunking(int igrp, int ndims, const int *dimids, const size_t *dimlens,
+		size_t typesize, size_t *chunksizes)
+{
+    NC_Access_Pattern *patterns;
+    size_t *counts;
+    size_t npatterns = 0;
+    int i, idim, k;
+
+    if(listlength(option_accessspecs) == 0 || ndims == 0)
+	return 0;
+    patterns = (NC_Access_Pattern*)emalloc((size_t)listlength(option_accessspecs) * sizeof(NC_Access_Pattern));
+    counts = (size_t*)emalloc((size_t)listlength(option_accessspecs) * (size_t)ndims * sizeof(size_t));
+    for(i = 0; i < listlength(option_accessspecs); i++) {
+	AccessSpec *spec = (AccessSpec*)listget(option_accessspecs, (unsigned long)i);
+	size_t *pcounts = &counts[npatterns * (size_t)ndims];
+	int named = 0;
+	for(idim = 0; idim < ndims; idim++) {
+	    char name[NC_MAX_NAME + 1];
+	    NC_CHECK(nc_inq_dimname(igrp, dimids[idim], name));
+	    pcounts[idim] = 1;
+	    for(k = 0; k < spec->ndims; k++) {
+		if(strcmp(spec->names[k], name) == 0) {
+		    size_t count = spec->counts[k];
+		    if(count == 0 || (dimlens[idim] && count > dimlens[idim]))
+			count = dimlens[idim];
+		    pcounts[idim] = count ? count : 1;
+		    named = 1;
+		    break;
+		}
+	    }
+	}
+	if(named) {
+	    patterns[npatterns].weight = spec->weight;
+	    patterns[npatterns].counts = pcounts;
+	    npatterns++;
+	}
+    }
+    if(npatterns > 0)
+	NC_CHECK(ncaux_advise_chunking(ndims, dimlens, typesize, option_advise_chunk_bytes, npatterns, patterns, chunksizes));
+    free(patterns);
+    free(counts);
+    return npatterns > 0;
+}
+
 /* Propagate chunking from input to output taking -c flags into account. */
 /* Subsumes old set_var_chunked */
 /* Must make sure we do not override the default chunking when input is classic */
@@ -1015,6 +1086,12 @@ copy_chunking(int igrp, int i_varid, int ogrp, int o_varid, int ndims, int inkin
             }
 	}
 
+	/* Chunk sizes advised from -a access patterns override -c dim/n,
+	   but not per-variable chunk specs */
+	if(!varchunkspec_exists(igrp,i_varid)
+	    && advise_chunking(igrp, ndims, dimids, dimlens, typesize, ochunkp))
+	    ocontig = NC_CHUNKED;
+
         /* Get the current default chunking on the output variable */
         /* Unfortunately, there is no way to get this info except by
            forcing chunking */
@@ -1586,39 +1663,28 @@ inq_nvals(int igrp, int varid, long long *nvalsp) {
     return stat;
 }
 
-/* Copy data from variable varid in group igrp to corresponding group
- * ogrp. */
+/* Get the variable ovarid in group ogrp corresponding to variable
+ * varid in group igrp, set its chunk cache for copying, and make sure
+ * the copy buffer holds at least a value and an input chunk of the
+ * variable. */
 static int
-copy_var_data(int igrp, int varid, int ogrp)
+setup_var_data(int igrp, int varid, int ogrp, int *ovaridp)
 {
     int stat = NC_NOERR;
-    nc_type vartype;
-    long long nvalues;		/* number of values for this variable */
-    size_t ntoget;		/* number of values to access this iteration */
     size_t value_size;		/* size of a single value of this variable */
-    static void *buf = 0;	/* buffer for the variable values */
     char varname[NC_MAX_NAME];
     int ovarid;
-    size_t *start;
-    size_t *count;
-    nciter_t *iterp;		/* opaque structure for iteration status */
-    int do_realloc = 0;
 #ifdef USE_NETCDF4
     int okind;
     size_t chunksize;
 #endif
 
-    NC_CHECK(inq_nvals(igrp, varid, &nvalues));
-    if(nvalues == 0)
-	return stat;
     /* get corresponding output variable */
     NC_CHECK(nc_inq_varname(igrp, varid, varname));
     NC_CHECK(nc_inq_varid(ogrp, varname, &ovarid));
-    NC_CHECK(nc_inq_vartype(igrp, varid, &vartype));
     value_size = val_size(igrp, varid);
     if(value_size > option_copy_buffer_size) {
 	option_copy_buffer_size = value_size;
-	do_realloc = 1;
     }
 #ifdef USE_NETCDF4
     NC_CHECK(nc_inq_format(ogrp, &okind));
@@ -1656,17 +1722,584 @@ copy_var_data(int igrp, int varid, int ogrp)
 	NC_CHECK(inq_var_chunksize(igrp, varid, &chunksize));
 	if(chunksize > option_copy_buffer_size) {
 	    option_copy_buffer_size = chunksize;
-	    do_realloc = 1;
 	}
     }
 #endif	/* USE_NETCDF4 */
-    if(buf && do_realloc) {
-	free(buf);
-	buf = 0;
+    *ovaridp = ovarid;
+    return stat;
+}
+
+#ifdef USE_NETCDF4
+/* Return 1 if the stored chunks of variable varid in group igrp can
+ * be copied as they are to the corresponding variable in output
+ * group ogrp, 0 otherwise.  The files must have the same format, and
+ * the variables the same fixed-size atomic type, chunk sizes,
+ * filters, byte order and quantization, so that their chunks are
+ * stored the same way. */
+static int
+chunks_copyable(int igrp, int varid, int ogrp) {
+    char varname[NC_MAX_NAME];
+    int ovarid;
+    int iformat, oformat;
+    nc_type itype, otype;
+    int ndims, ondims;
+    int icontig, ocontig;
+    size_t *ichunks = NULL, *ochunks = NULL;
+    size_t infilters, onfilters;
+    unsigned int *ifilters = NULL, *ofilters = NULL;
+    int iendian, oendian;
+    int iquantize, oquantize, insd, onsd;
+    int ok = 0;
+    int dim;
+    size_t f;
+
+    NC_CHECK(nc_inq_format_extended(igrp, &iformat, NULL));
+    NC_CHECK(nc_inq_format_extended(ogrp, &oformat, NULL));
+    if(iformat != oformat ||
+       (iformat != NC_FORMATX_NC_HDF5 && iformat != NC_FORMATX_NCZARR))
+	return 0;
+    NC_CHECK(nc_inq_varname(igrp, varid, varname));
+    NC_CHECK(nc_inq_varid(ogrp, varname, &ovarid));
+    NC_CHECK(nc_inq_vartype(igrp, varid, &itype));
+    NC_CHECK(nc_inq_vartype(ogrp, ovarid, &otype));
+    if(itype >= NC_STRING || itype != otype)
+	return 0;
+    NC_CHECK(nc_inq_varndims(igrp, varid, &ndims));
+    NC_CHECK(nc_inq_varndims(ogrp, ovarid, &ondims));
+    if(ndims == 0 || ndims != ondims)
+	return 0;
+
+    ichunks = (size_t *) emalloc((size_t)ndims * sizeof(size_t));
+    ochunks = (size_t *) emalloc((size_t)ndims * sizeof(size_t));
+    NC_CHECK(nc_inq_var_chunking(igrp, varid, &icontig, ichunks));
+    NC_CHECK(nc_inq_var_chunking(ogrp, ovarid, &ocontig, ochunks));
+    if(icontig != NC_CHUNKED || ocontig != NC_CHUNKED)
+	goto done;
+    for(dim = 0; dim < ndims; dim++)
+	if(ichunks[dim] != ochunks[dim])
+	    goto done;
+
+    NC_CHECK(nc_inq_var_endian(igrp, varid, &iendian));
+    NC_CHECK(nc_inq_var_endian(ogrp, ovarid, &oendian));
+    if(iendian != oendian)
+	goto done;
+    NC_CHECK(nc_inq_var_quantize(igrp, varid, &iquantize, &insd));
+    NC_CHECK(nc_inq_var_quantize(ogrp, ovarid, &oquantize, &onsd));
+    if(iquantize != oquantize || (iquantize != NC_NOQUANTIZE && insd != onsd))
+	goto done;
+
+    /* Same filters, with the same parameters, in the same order */
+    NC_CHECK(nc_inq_var_filter_ids(igrp, varid, &infilters, NULL));
+    NC_CHECK(nc_inq_var_filter_ids(ogrp, ovarid, &onfilters, NULL));
+    if(infilters != onfilters)
+	goto done;
+    if(infilters > 0) {
+	ifilters = (unsigned int *) emalloc(infilters * sizeof(unsigned int));
+	ofilters = (unsigned int *) emalloc(onfilters * sizeof(unsigned int));
+	NC_CHECK(nc_inq_var_filter_ids(igrp, varid, &infilters, ifilters));
+	NC_CHECK(nc_inq_var_filter_ids(ogrp, ovarid, &onfilters, ofilters));
+	for(f = 0; f < infilters; f++) {
+	    size_t inparams, onparams;
+	    unsigned int *iparams, *oparams;
+	    int same;
+	    if(ifilters[f] != ofilters[f])
+		goto done;
+	    NC_CHECK(nc_inq_var_filter_info(igrp, varid, ifilters[f], &inparams, NULL));
+	    NC_CHECK(nc_inq_var_filter_info(ogrp, ovarid, ofilters[f], &onparams, NULL));
+	    /* Filters such as shuffle get their parameters from the type
+	     * and chunk sizes, which match, when data are first written */
+	    if(onparams == 0)
+		continue;
+	    if(inparams != onparams)
+		goto done;
+	    iparams = (unsigned int *) emalloc((inparams + 1) * sizeof(unsigned int));
+	    oparams = (unsigned int *) emalloc((onparams + 1) * sizeof(unsigned int));
+	    NC_CHECK(nc_inq_var_filter_info(igrp, varid, ifilters[f], NULL, iparams));
+	    NC_CHECK(nc_inq_var_filter_info(ogrp, ovarid, ofilters[f], NULL, oparams));
+	    same = (memcmp(iparams, oparams, inparams * sizeof(unsigned int)) == 0);
+	    free(iparams);
+	    free(oparams);
+	    if(!same)
+		goto done;
+	}
+    }
+    ok = 1;
+done:
+    free(ichunks);
+    free(ochunks);
+    free(ifilters);
+    free(ofilters);
+    return ok;
+}
+
+/* Copy the data of variable varid in group igrp to variable ovarid in
+ * group ogrp a chunk at a time, as the chunks are stored, without
+ * decoding and encoding them.  The variables must pass
+ * chunks_copyable().  Sets *copiedp to 0, having copied nothing, if
+ * the library cannot read the stored chunks of the variable.  Chunks
+ * that were never written, or were written with a filter skipped,
+ * are copied as values. */
+static int
+copy_var_chunks(int igrp, int varid, int ogrp, int ovarid, int *copiedp) {
+    int stat = NC_NOERR;
+    int ndims;
+    int dim;
+    int *dimids, *odimids;
+    size_t *dimlens, *chunksizes, *start, *count;
+    size_t value_size;
+    size_t chunk_values = 1;	/* number of values in a chunk */
+    void *values;		/* buffer for values of a chunk */
+    void *chunk = NULL;		/* buffer for a stored chunk */
+    size_t chunkcap = 0;	/* allocated size of chunk */
+    size_t size;
+    int extend = 0;
+
+    *copiedp = 0;
+    NC_CHECK(nc_inq_varndims(igrp, varid, &ndims));
+    dimids = (int *) emalloc((size_t)ndims * sizeof(int));
+    odimids = (int *) emalloc((size_t)ndims * sizeof(int));
+    dimlens = (size_t *) emalloc((size_t)ndims * sizeof(size_t));
+    chunksizes = (size_t *) emalloc((size_t)ndims * sizeof(size_t));
+    start = (size_t *) emalloc((size_t)ndims * sizeof(size_t));
+    count = (size_t *) emalloc((size_t)ndims * sizeof(size_t));
+    NC_CHECK(nc_inq_vardimid(igrp, varid, dimids));
+    NC_CHECK(nc_inq_vardimid(ogrp, ovarid, odimids));
+    NC_CHECK(nc_inq_var_chunking(igrp, varid, NULL, chunksizes));
+    value_size = val_size(igrp, varid);
+    for(dim = 0; dim < ndims; dim++) {
+	size_t olen;
+	NC_CHECK(nc_inq_dimlen(igrp, dimids[dim], &dimlens[dim]));
+	NC_CHECK(nc_inq_dimlen(ogrp, odimids[dim], &olen));
+	if(olen < dimlens[dim])
+	    extend = 1;
+	chunk_values *= chunksizes[dim];
+	start[dim] = 0;
+    }
+    values = emalloc(chunk_values * value_size);
+
+    /* See if the stored chunks can be read at all */
+    if(nc_get_var_chunk_raw(igrp, varid, start, &size, NULL) != NC_NOERR)
+	goto done;
+    *copiedp = 1;
+
+    /* A stored chunk can only be written inside the extent of the
+     * output variable, so first write its last value to extend it
+     * along unlimited dimensions. */
+    if(extend) {
+	for(dim = 0; dim < ndims; dim++) {
+	    start[dim] = dimlens[dim] - 1;
+	    count[dim] = 1;
+	}
+	NC_CHECK(nc_get_vara(igrp, varid, start, count, values));
+	NC_CHECK(nc_put_vara(ogrp, ovarid, start, count, values));
+	for(dim = 0; dim < ndims; dim++)
+	    start[dim] = 0;
+    }
+
+    for(;;) {
+	for(dim = 0; dim < ndims; dim++) {
+	    count[dim] = dimlens[dim] - start[dim];
+	    if(count[dim] > chunksizes[dim])
+		count[dim] = chunksizes[dim];
+	}
+	NC_CHECK(nc_get_var_chunk_raw(igrp, varid, start, &size, NULL));
+	if(size > 0) {
+	    if(size > chunkcap) {
+		free(chunk);
+		chunk = emalloc(size);
+		chunkcap = size;
+	    }
+	    stat = nc_get_var_chunk_raw(igrp, varid, start, &size, chunk);
+	    if(stat == NC_EFILTER) {
+		stat = NC_NOERR;
+		size = 0;
+	    }
+	    NC_CHECK(stat);
+	}
+	if(size > 0) {
+	    NC_CHECK(nc_put_var_chunk_raw(ogrp, ovarid, start, size, chunk));
+	} else {
+	    NC_CHECK(nc_get_vara(igrp, varid, start, count, values));
+	    NC_CHECK(nc_put_vara(ogrp, ovarid, start, count, values));
+	}
+	/* Next chunk, last dimension varying fastest */
+	for(dim = ndims - 1; dim >= 0; dim--) {
+	    start[dim] += chunksizes[dim];
+	    if(start[dim] < dimlens[dim])
+		break;
+	    start[dim] = 0;
+	}
+	if(dim < 0)
+	    break;
+    }
+done:
+    free(dimids);
+    free(odimids);
+    free(dimlens);
+    free(chunksizes);
+    free(start);
+    free(count);
+    free(values);
+    free(chunk);
+    return stat;
+}
+#endif	/* USE_NETCDF4 */
+
+#ifdef USE_NETCDF4
+
+/* With -R n, a variable whose chunk shape changes is rechunked with
+ * at most about n bytes of memory for values, and each input chunk
+ * is read and decoded once.  A slab whose shape in each dimension is
+ * a multiple of both the input and output chunk size (or the whole
+ * dimension) covers whole input and whole output chunks, so copying
+ * the variable a slab at a time does not depend on chunk caches.  If
+ * the smallest such slab does not fit in n bytes, as when a
+ * variable chunked a time step at a time is rechunked into time
+ * series, the variable is first copied to an uncompressed variable
+ * in a temporary file, whose chunks fit evenly into both the input
+ * and the output chunks, and then from there to the output. */
+
+/* Return the greatest common divisor of a and b */
+static size_t
+gcd_size(size_t a, size_t b) {
+    while(b != 0) {
+	size_t r = a % b;
+	a = b;
+	b = r;
+    }
+    return a;
+}
+
+/* Return the least common multiple of a and b, or len if that is
+ * smaller */
+static size_t
+lcm_size(size_t a, size_t b, size_t len) {
+    size_t m = a / gcd_size(a, b);
+    if(m > len / b)
+	return len;
+    m *= b;
+    return m < len ? m : len;
+}
+
+/* Set slab to the smallest shape that covers whole chunks of both
+ * shapes a and b, and return its size in bytes */
+static size_t
+rechunk_slab(int rank, const size_t *dimlens, const size_t *a, const size_t *b,
+	     size_t value_size, size_t *slab) {
+    size_t bytes = value_size;
+    int dim;
+    for(dim = 0; dim < rank; dim++) {
+	slab[dim] = lcm_size(a[dim], b[dim], dimlens[dim]);
+	bytes *= slab[dim];
+    }
+    return bytes;
+}
+
+/* Return the size in bytes of a slab */
+static size_t
+slab_bytes(int rank, const size_t *slab, size_t value_size) {
+    size_t bytes = value_size;
+    int dim;
+    for(dim = 0; dim < rank; dim++)
+	bytes *= slab[dim];
+    return bytes;
+}
+
+/* Enlarge slab by multiples of its shape, innermost dimensions
+ * first, while it stays within limit bytes */
+static void
+grow_slab(int rank, const size_t *dimlens, size_t value_size, size_t limit,
+	  size_t *slab) {
+    size_t bytes = slab_bytes(rank, slab, value_size);
+    int dim;
+    for(dim = rank - 1; dim >= 0; dim--) {
+	size_t unit = slab[dim];
+	size_t other = bytes / slab[dim];
+	size_t len = (limit / other) / unit * unit;
+	if(len >= dimlens[dim])
+	    len = dimlens[dim];
+	if(len > slab[dim]) {
+	    bytes = other * len;
+	    slab[dim] = len;
+	}
+	if(slab[dim] < dimlens[dim])
+	    break;
+    }
+}
+
+/* Copy variable varid in group igrp to variable ovarid in group ogrp
+ * a slab at a time */
+static int
+copy_slabs(int igrp, int varid, int ogrp, int ovarid, int rank,
+	   const size_t *dimlens, const size_t *slab, void *buf) {
+    int stat = NC_NOERR;
+    size_t *start = (size_t *) emalloc((size_t)rank * sizeof(size_t));
+    size_t *count = (size_t *) emalloc((size_t)rank * sizeof(size_t));
+    int dim;
+
+    for(dim = 0; dim < rank; dim++)
+	start[dim] = 0;
+    for(;;) {
+	for(dim = 0; dim < rank; dim++) {
+	    count[dim] = dimlens[dim] - start[dim];
+	    if(count[dim] > slab[dim])
+		count[dim] = slab[dim];
+	}
+	NC_CHECK(nc_get_vara(igrp, varid, start, count, buf));
+	NC_CHECK(nc_put_vara(ogrp, ovarid, start, count, buf));
+	for(dim = rank - 1; dim >= 0; dim--) {
+	    start[dim] += slab[dim];
+	    if(start[dim] < dimlens[dim])
+		break;
+	    start[dim] = 0;
+	}
+	if(dim < 0)
+	    break;
     }
-    if(buf == 0) {		/* first time or needs to grow */
+    free(start);
+    free(count);
+    return stat;
+}
+
+/* Return 1 if variable varid in group igrp is to be copied to the
+ * corresponding variable in output group ogrp by rechunk_var(), 0
+ * otherwise: -R was given, the variable is of a fixed-size atomic
+ * type, and its output chunk shape differs from its input one. */
+static int
+rechunk_wanted(int igrp, int varid, int ogrp) {
+    char varname[NC_MAX_NAME];
+    int ovarid;
+    int iformat, oformat;
+    nc_type vartype;
+    int ndims;
+    int icontig = NC_CONTIGUOUS, ocontig;
+    size_t *ichunks, *ochunks;
+    int dim;
+    int wanted = 0;
+
+    if(option_rechunk_memory == 0)
+	return 0;
+    NC_CHECK(nc_inq_format(ogrp, &oformat));
+    if(oformat != NC_FORMAT_NETCDF4 && oformat != NC_FORMAT_NETCDF4_CLASSIC)
+	return 0;
+    NC_CHECK(nc_inq_vartype(igrp, varid, &vartype));
+    NC_CHECK(nc_inq_varndims(igrp, varid, &ndims));
+    if(vartype >= NC_STRING || ndims == 0)
+	return 0;
+    NC_CHECK(nc_inq_varname(igrp, varid, varname));
+    NC_CHECK(nc_inq_varid(ogrp, varname, &ovarid));
+    ichunks = (size_t *) emalloc((size_t)ndims * sizeof(size_t));
+    ochunks = (size_t *) emalloc((size_t)ndims * sizeof(size_t));
+    NC_CHECK(nc_inq_var_chunking(ogrp, ovarid, &ocontig, ochunks));
+    NC_CHECK(nc_inq_format(igrp, &iformat));
+    if(iformat == NC_FORMAT_NETCDF4 || iformat == NC_FORMAT_NETCDF4_CLASSIC)
+	NC_CHECK(nc_inq_var_chunking(igrp, varid, &icontig, ichunks));
+    if(ocontig == NC_CHUNKED) {
+	if(icontig != NC_CHUNKED)
+	    wanted = 1;
+	else
+	    for(dim = 0; dim < ndims; dim++)
+		if(ichunks[dim] != ochunks[dim])
+		    wanted = 1;
+    }
+    free(ichunks);
+    free(ochunks);
+    return wanted;
+}
+
+#ifdef USE_HDF5
+/* Create a temporary file with a variable like variable varid in
+ * group igrp, of fixed dimensions and with chunk shape midchunks,
+ * for rechunk_var().  Returns the file's ncid and name. */
+static int
+create_rechunk_file(int igrp, int varid, const size_t *dimlens, const size_t *midchunks,
+		    int *tmpidp, int *tmpvaridp, char **tmpnamep) {
+    int stat = NC_NOERR;
+    const char *tmpdir = getenv("TMPDIR");
+    char *base;
+    char *tmpname;
+    nc_type vartype;
+    int ndims;
+    int *dimids;
+    int dim;
+
+    if(tmpdir == NULL || *tmpdir == '\0')
+	tmpdir = ".";
+    base = (char *) emalloc(strlen(tmpdir) + strlen("/nccopy_rechunk_") + 1);
+    strcpy(base, tmpdir);
+    strcat(base, "/nccopy_rechunk_");
+    tmpname = NC_mktmp(base);
+    free(base);
+    if(tmpname == NULL)
+	error("cannot create temporary file in %s for rechunking", tmpdir);
+
+    NC_CHECK(nc_inq_vartype(igrp, varid, &vartype));
+    NC_CHECK(nc_inq_varndims(igrp, varid, &ndims));
+    dimids = (int *) emalloc((size_t)ndims * sizeof(int));
+    NC_CHECK(nc_create(tmpname, NC_NETCDF4 | NC_CLOBBER, tmpidp));
+    for(dim = 0; dim < ndims; dim++) {
+	char dimname[NC_MAX_NAME + 1];
+	snprintf(dimname, sizeof(dimname), "d%d", dim);
+	NC_CHECK(nc_def_dim(*tmpidp, dimname, dimlens[dim], &dimids[dim]));
+    }
+    NC_CHECK(nc_def_var(*tmpidp, "v", vartype, ndims, dimids, tmpvaridp));
+    NC_CHECK(nc_def_var_chunking(*tmpidp, *tmpvaridp, NC_CHUNKED, midchunks));
+    NC_CHECK(nc_def_var_fill(*tmpidp, *tmpvaridp, NC_NOFILL, NULL));
+    NC_CHECK(nc_set_var_chunk_cache(*tmpidp, *tmpvaridp, option_chunk_cache_size,
+				    option_chunk_cache_nelems, COPY_CHUNKCACHE_PREEMPTION));
+    NC_CHECK(nc_enddef(*tmpidp));
+    free(dimids);
+    *tmpnamep = tmpname;
+    return stat;
+}
+#endif	/* USE_HDF5 */
+
+/* Copy variable varid in group igrp to variable ovarid in group ogrp,
+ * which has a different chunk shape, with at most option_rechunk_memory
+ * bytes of values in memory (or one chunk, if that is bigger),
+ * reading each input chunk once. */
+static int
+rechunk_var(int igrp, int varid, int ogrp, int ovarid) {
+    int stat = NC_NOERR;
+    int rank;
+    int dim;
+    int *dimids;
+    size_t *dimlens, *inchunks, *outchunks, *midchunks, *slab1, *slab2;
+    int icontig = NC_CONTIGUOUS;
+    int iformat;
+    size_t value_size = val_size(igrp, varid);
+    size_t limit = option_rechunk_memory;
+    void *buf;
+
+    NC_CHECK(nc_inq_varndims(igrp, varid, &rank));
+    dimids = (int *) emalloc((size_t)rank * sizeof(int));
+    dimlens = (size_t *) emalloc((size_t)rank * sizeof(size_t));
+    inchunks = (size_t *) emalloc((size_t)rank * sizeof(size_t));
+    outchunks = (size_t *) emalloc((size_t)rank * sizeof(size_t));
+    midchunks = (size_t *) emalloc((size_t)rank * sizeof(size_t));
+    slab1 = (size_t *) emalloc((size_t)rank * sizeof(size_t));
+    slab2 = (size_t *) emalloc((size_t)rank * sizeof(size_t));
+    NC_CHECK(nc_inq_vardimid(igrp, varid, dimids));
+    for(dim = 0; dim < rank; dim++)
+	NC_CHECK(nc_inq_dimlen(igrp, dimids[dim], &dimlens[dim]));
+    NC_CHECK(nc_inq_format(igrp, &iformat));
+    if(iformat == NC_FORMAT_NETCDF4 || iformat == NC_FORMAT_NETCDF4_CLASSIC)
+	NC_CHECK(nc_inq_var_chunking(igrp, varid, &icontig, inchunks));
+    /* Any slab of an unchunked variable can be read without rereading */
+    if(icontig != NC_CHUNKED) {
+	for(dim = 0; dim < rank; dim++)
+	    inchunks[dim] = 1;
+    } else {
+	/* Slabs cover whole input chunks, so an input chunk cache
+	 * would only hold memory beyond the limit */
+	NC_CHECK(nc_set_var_chunk_cache(igrp, varid, 0, 0, 0.0f));
+    }
+    NC_CHECK(nc_inq_var_chunking(ogrp, ovarid, NULL, outchunks));
+
+    if(rechunk_slab(rank, dimlens, inchunks, outchunks, value_size, slab1) <= limit) {
+	/* One pass */
+	grow_slab(rank, dimlens, value_size, limit, slab1);
+	buf = emalloc(slab_bytes(rank, slab1, value_size));
+	NC_CHECK(copy_slabs(igrp, varid, ogrp, ovarid, rank, dimlens, slab1, buf));
+    } else {
+#ifdef USE_HDF5
+	/* Two passes through a temporary file.  Intermediate chunks that
+	 * divide both the input and the output chunks need only a chunk
+	 * in memory in each pass; make them as big as the limit allows,
+	 * up to the larger of the input and output chunks in each
+	 * dimension. */
+	int tmpid, tmpvarid;
+	char *tmpname;
+	size_t bytes1, bytes2;
+
+	for(dim = 0; dim < rank; dim++)
+	    midchunks[dim] = gcd_size(inchunks[dim], outchunks[dim]);
+	for(dim = rank - 1; dim >= 0; dim--) {
+	    size_t tries[2];
+	    int t;
+	    tries[0] = inchunks[dim] > outchunks[dim] ? inchunks[dim] : outchunks[dim];
+	    tries[1] = inchunks[dim] < outchunks[dim] ? inchunks[dim] : outchunks[dim];
+	    for(t = 0; t < 2; t++) {
+		size_t gcd = midchunks[dim];
+		midchunks[dim] = tries[t];
+		if(rechunk_slab(rank, dimlens, inchunks, midchunks, value_size, slab1) <= limit
+		   && rechunk_slab(rank, dimlens, midchunks, outchunks, value_size, slab2) <= limit)
+		    break;
+		midchunks[dim] = gcd;
+	    }
+	}
+	bytes1 = rechunk_slab(rank, dimlens, inchunks, midchunks, value_size, slab1);
+	bytes2 = rechunk_slab(rank, dimlens, midchunks, outchunks, value_size, slab2);
+	if(bytes1 < limit)
+	    grow_slab(rank, dimlens, value_size, limit, slab1);
+	if(bytes2 < limit)
+	    grow_slab(rank, dimlens, value_size, limit, slab2);
+	bytes1 = slab_bytes(rank, slab1, value_size);
+	bytes2 = slab_bytes(rank, slab2, value_size);
+	buf = emalloc(bytes1 > bytes2 ? bytes1 : bytes2);
+
+	NC_CHECK(create_rechunk_file(igrp, varid, dimlens, midchunks,
+				     &tmpid, &tmpvarid, &tmpname));
+	NC_CHECK(copy_slabs(igrp, varid, tmpid, tmpvarid, rank, dimlens, slab1, buf));
+	NC_CHECK(copy_slabs(tmpid, tmpvarid, ogrp, ovarid, rank, dimlens, slab2, buf));
+	NC_CHECK(nc_close(tmpid));
+	(void)NCremove(tmpname);
+	free(tmpname);
+#else
+	/* Without HDF5 there is no temporary file, so copy slabs that
+	 * cover whole input and output chunks, whatever their size. */
+	buf = emalloc(slab_bytes(rank, slab1, value_size));
+	NC_CHECK(copy_slabs(igrp, varid, ogrp, ovarid, rank, dimlens, slab1, buf));
+#endif	/* USE_HDF5 */
+    }
+    free(buf);
+    free(dimids);
+    free(dimlens);
+    free(inchunks);
+    free(outchunks);
+    free(midchunks);
+    free(slab1);
+    free(slab2);
+    return stat;
+}
+#endif	/* USE_NETCDF4 */
+
+/* Copy data from variable varid in group igrp to corresponding group
+ * ogrp. */
+static int
+copy_var_data(int igrp, int varid, int ogrp)
+{
+    int stat = NC_NOERR;
+    nc_type vartype;
+    long long nvalues;		/* number of values for this variable */
+    size_t ntoget;		/* number of values to access this iteration */
+    static void *buf = 0;	/* buffer for the variable values */
+    static size_t bufsize = 0;	/* allocated size of buf */
+    int ovarid;
+    size_t *start;
+    size_t *count;
+    nciter_t *iterp;		/* opaque structure for iteration status */
+
+    NC_CHECK(inq_nvals(igrp, varid, &nvalues));
+    if(nvalues == 0)
+	return stat;
+    NC_CHECK(nc_inq_vartype(igrp, varid, &vartype));
+    NC_CHECK(setup_var_data(igrp, varid, ogrp, &ovarid));
+#ifdef USE_NETCDF4
+    if(chunks_copyable(igrp, varid, ogrp)) {
+	int copied;
+	NC_CHECK(copy_var_chunks(igrp, varid, ogrp, ovarid, &copied));
+	if(copied)
+	    return stat;
+    }
+    if(rechunk_wanted(igrp, varid, ogrp))
+	return rechunk_var(igrp, varid, ogrp, ovarid);
+#endif	/* USE_NETCDF4 */
+    if(bufsize < option_copy_buffer_size) { /* first time or needs to grow */
+	free(buf);
 	buf = emalloc(option_copy_buffer_size);
 	memset((void*)buf,0,option_copy_buffer_size);
+	bufsize = option_copy_buffer_size;
     }
 
     /* initialize variable iteration */
@@ -1708,11 +2341,337 @@ copy_var_data(int igrp, int varid, int ogrp)
     return stat;
 }
 
+#ifdef HAVE_FORK
+
+/* With -j n, variable data is copied by n reader processes and the
+ * nccopy process, which writes the output.  The library cannot be
+ * used from more than one thread, so each reader opens the input
+ * itself and reads its share of the slabs of the copied variables,
+ * which are handed out round robin in the order the variables are
+ * copied.  Each slab goes to the writer through a pipe, as a
+ * CopyMsg followed by the start and count vectors and the values.
+ * A full pipe blocks its reader until the writer catches up, which
+ * bounds the memory used. Only variables whose values are
+ * fixed-size, and so can be sent as plain bytes, are copied this
+ * way; the rest are copied by the writer before the readers start. */
+
+/* A variable whose data are copied by the readers */
+typedef struct CopyJob {
+    char* grpname;		/* full name of input group, NULL if root */
+    int varid;			/* variable in input group */
+    int ogrp;			/* output group */
+    int ovarid;			/* variable in output group */
+    int rank;
+    size_t value_size;
+} CopyJob;
+
+/* Header of a message from a reader to the writer */
+typedef struct CopyMsg {
+    int job;			/* index of job, or COPY_DONE or COPY_FAILED */
+    int stat;			/* netCDF error status, for COPY_FAILED */
+    size_t nvalues;		/* number of values in slab */
+} CopyMsg;
+
+#define COPY_DONE (-1)		/* reader has read all its slabs */
+#define COPY_FAILED (-2)	/* reader failed to read a slab */
+
+/* Return 1 if values of variable varid in group igrp can be copied
+ * by a reader process, 0 otherwise */
+static int
+var_copyable(int igrp, int varid) {
+    nc_type vartype;
+    NC_CHECK(nc_inq_vartype(igrp, varid, &vartype));
+    if(vartype < NC_STRING)
+	return 1;
+#ifdef USE_NETCDF4
+    if(vartype > NC_STRING) {
+	int vclass;
+	NC_CHECK(nc_inq_user_type(igrp, vartype, NULL, NULL, NULL, NULL, &vclass));
+	return vclass == NC_ENUM || vclass == NC_OPAQUE;
+    }
+#endif	/* USE_NETCDF4 */
+    return 0;
+}
+
+/* Add variable varid in group igrp to the jobs of the readers */
+static int
+add_copy_job(int igrp, int varid, int ogrp, List* jobs)
+{
+    int stat = NC_NOERR;
+    long long nvalues;
+    int parid;
+    CopyJob* job;
+
+    NC_CHECK(inq_nvals(igrp, varid, &nvalues));
+    if(nvalues == 0)
+	return stat;
+    job = (CopyJob*) emalloc(sizeof(CopyJob));
+    memset(job,0,sizeof(CopyJob));
+    job->varid = varid;
+    job->ogrp = ogrp;
+    NC_CHECK(setup_var_data(igrp, varid, ogrp, &job->ovarid));
+    NC_CHECK(nc_inq_varndims(igrp, varid, &job->rank));
+    job->value_size = val_size(igrp, varid);
+    stat = nc_inq_grp_parent(igrp, &parid);
+    if(stat == NC_NOERR) {	/* not root group */
+	size_t len;
+	NC_CHECK(nc_inq_grpname_full(igrp, &len, NULL));
+	job->grpname = (char*) emalloc(len + 1);
+	NC_CHECK(nc_inq_grpname_full(igrp, NULL, job->grpname));
+    } else if(stat == NC_ENOGRP) {
+	stat = NC_NOERR;
+    } else {
+	NC_CHECK(stat);
+    }
+    listpush(jobs, job);
+    return stat;
+}
+
+/* Write nbytes from buf to fd, return 0 on success */
+static int
+write_all(int fd, const void* buf, size_t nbytes)
+{
+    const char* p = (const char*)buf;
+    while(nbytes > 0) {
+	ssize_t n = write(fd, p, nbytes);
+	if(n < 0) {
+	    if(errno == EINTR)
+		continue;
+	    return -1;
+	}
+	p += n;
+	nbytes -= (size_t)n;
+    }
+    return 0;
+}
+
+/* Read nbytes from fd into buf, return 0 on success, -1 on error or
+ * end of file */
+static int
+read_all(int fd, void* buf, size_t nbytes)
+{
+    char* p = (char*)buf;
+    while(nbytes > 0) {
+	ssize_t n = read(fd, p, nbytes);
+	if(n < 0 && errno == EINTR)
+	    continue;
+	if(n <= 0)
+	    return -1;
+	p += n;
+	nbytes -= (size_t)n;
+    }
+    return 0;
+}
+
+/* Body of reader process reader of nreaders: read every nreaders-th
+ * slab of the variables in jobs from infile, and send them to the
+ * writer on fd. Never returns. Must not call exit(), which would run
+ * the library's exit handlers on the output file inherited from the
+ * writer. */
+static void
+copy_reader(const char* infile, int open_mode, List* jobs, int reader,
+	    int nreaders, int fd)
+{
+    int stat = NC_NOERR;
+    int ncid;
+    void* buf = NULL;
+    size_t *start = NULL, *count = NULL;
+    size_t slab = 0;
+    int i;
+    CopyMsg msg;
+
+    buf = malloc(option_copy_buffer_size);
+    start = (size_t*) malloc(NC_MAX_VAR_DIMS * sizeof(size_t));
+    count = (size_t*) malloc(NC_MAX_VAR_DIMS * sizeof(size_t));
+    if(buf == NULL || start == NULL || count == NULL) {
+	stat = NC_ENOMEM;
+	goto done;
+    }
+    if((stat = nc_open(infile, open_mode, &ncid)))
+	goto done;
+    for(i = 0; i < listlength(jobs); i++) {
+	CopyJob* job = (CopyJob*) listget(jobs, (unsigned long)i);
+	int grp = ncid;
+	nciter_t *iterp;
+	size_t ntoget;
+
+	if(job->grpname && (stat = nc_inq_grp_full_ncid(ncid, job->grpname, &grp)))
+	    goto done;
+	if((stat = nc_get_iter(grp, job->varid, option_copy_buffer_size, &iterp)))
+	    goto done;
+	while((ntoget = nc_next_iter(iterp, start, count)) > 0) {
+	    size_t rankbytes = (size_t)job->rank * sizeof(size_t);
+	    if(slab++ % (size_t)nreaders != (size_t)reader)
+		continue;
+	    if((stat = nc_get_vara(grp, job->varid, start, count, buf)))
+		break;
+	    msg.job = i;
+	    msg.stat = NC_NOERR;
+	    msg.nvalues = ntoget;
+	    if(write_all(fd, &msg, sizeof(msg))
+	       || write_all(fd, start, rankbytes)
+	       || write_all(fd, count, rankbytes)
+	       || write_all(fd, buf, ntoget * job->value_size))
+		_exit(EXIT_FAILURE); /* writer is gone */
+	}
+	(void)nc_free_iter(iterp);
+	if(stat)
+	    goto done;
+    }
+done:
+    msg.job = (stat ? COPY_FAILED : COPY_DONE);
+    msg.stat = stat;
+    msg.nvalues = 0;
+    (void)write_all(fd, &msg, sizeof(msg));
+    _exit(stat ? EXIT_FAILURE : EXIT_SUCCESS);
+}
+
+/* Copy data of the variables in jobs from infile, using nreaders
+ * reader processes, and write them to the output. */
+static int
+copy_jobs(const char* infile, int open_mode, List* jobs, int nreaders)
+{
+    int stat = NC_NOERR;
+    pid_t* pids;
+    struct pollfd* fds;
+    void* buf;
+    size_t *start, *count;
+    int nopen = 0;
+    int r;
+
+    pids = (pid_t*) emalloc((size_t)nreaders * sizeof(pid_t));
+    fds = (struct pollfd*) emalloc((size_t)nreaders * sizeof(struct pollfd));
+    buf = emalloc(option_copy_buffer_size);
+    start = (size_t*) emalloc(NC_MAX_VAR_DIMS * sizeof(size_t));
+    count = (size_t*) emalloc(NC_MAX_VAR_DIMS * sizeof(size_t));
+
+    /* Don't let the readers inherit unwritten output */
+    fflush(stdout);
+    fflush(stderr);
+    for(r = 0; r < nreaders; r++) {
+	fds[r].fd = -1;
+	pids[r] = -1;
+    }
+    for(r = 0; r < nreaders; r++) {
+	int pfd[2];
+	if(pipe(pfd) != 0) {
+	    perror(progname);
+	    stat = NC_EIO;
+	    break;
+	}
+	pids[r] = fork();
+	if(pids[r] == 0) {
+	    int k;
+	    for(k = 0; k < r; k++)
+		close(fds[k].fd);
+	    close(pfd[0]);
+	    copy_reader(infile, open_mode, jobs, r, nreaders, pfd[1]);
+	}
+	close(pfd[1]);
+	if(pids[r] < 0) {
+	    perror(progname);
+	    close(pfd[0]);
+	    stat = NC_EIO;
+	    break;
+	}
+	fds[r].fd = pfd[0];
+	fds[r].events = POLLIN;
+	nopen++;
+    }
+    /* If not all readers could be started, the slabs of the missing
+     * ones won't be read. */
+    if(stat != NC_NOERR)
+	goto done;
+
+    while(nopen > 0) {
+	if(poll(fds, (nfds_t)nreaders, -1) < 0) {
+	    if(errno == EINTR)
+		continue;
+	    perror(progname);
+	    stat = NC_EIO;
+	    goto done;
+	}
+	for(r = 0; r < nreaders; r++) {
+	    CopyMsg msg;
+	    CopyJob* job;
+	    size_t rankbytes;
+
+	    if(fds[r].fd < 0 || fds[r].revents == 0)
+		continue;
+	    if(read_all(fds[r].fd, &msg, sizeof(msg)) != 0) {
+		fprintf(stderr, "%s: copy process %d ended unexpectedly\n", progname, r);
+		stat = NC_EIO;
+		goto done;
+	    }
+	    if(msg.job == COPY_DONE) {
+		close(fds[r].fd);
+		fds[r].fd = -1;
+		nopen--;
+		continue;
+	    }
+	    if(msg.job == COPY_FAILED) {
+		stat = msg.stat;
+		goto done;
+	    }
+	    if(msg.job < 0 || msg.job >= listlength(jobs)) {
+		stat = NC_EIO;
+		goto done;
+	    }
+	    job = (CopyJob*) listget(jobs, (unsigned long)msg.job);
+	    rankbytes = (size_t)job->rank * sizeof(size_t);
+	    if(msg.nvalues * job->value_size > option_copy_buffer_size
+	       || read_all(fds[r].fd, start, rankbytes)
+	       || read_all(fds[r].fd, count, rankbytes)
+	       || read_all(fds[r].fd, buf, msg.nvalues * job->value_size)) {
+		stat = NC_EIO;
+		goto done;
+	    }
+	    if((stat = nc_put_vara(job->ogrp, job->ovarid, start, count, buf)))
+		goto done;
+	}
+    }
+done:
+    for(r = 0; r < nreaders; r++) {
+	int status;
+	if(fds[r].fd >= 0)
+	    close(fds[r].fd);
+	if(pids[r] <= 0)
+	    continue;
+	if(stat != NC_NOERR)
+	    kill(pids[r], SIGTERM);
+	if(waitpid(pids[r], &status, 0) == pids[r] && stat == NC_NOERR
+	   && !(WIFEXITED(status) && WEXITSTATUS(status) == EXIT_SUCCESS))
+	    stat = NC_EIO;
+    }
+    free(pids);
+    free(fds);
+    free(buf);
+    free(start);
+    free(count);
+    return stat;
+}
+
+/* Free a list of CopyJobs */
+static void
+free_copy_jobs(List* jobs)
+{
+    int i;
+    for(i = 0; i < listlength(jobs); i++) {
+	CopyJob* job = (CopyJob*) listget(jobs, (unsigned long)i);
+	nullfree(job->grpname);
+	free(job);
+    }
+    listfree(jobs);
+}
+
+#endif	/* HAVE_FORK */
+
 /* Copy data from variables in group igrp to variables in
  * corresponding group with parent ogrp, and all subgroups
- * recursively  */
+ * recursively. If jobs is not NULL, variables that can be copied by
+ * reader processes are added to it instead of being copied. */
 static int
-copy_data(int igrp, int ogrp)
+copy_data(int igrp, int ogrp, List* jobs)
 {
     int stat = NC_NOERR;
     int ogid;
@@ -1751,6 +2710,18 @@ copy_data(int igrp, int ogrp)
             continue;
         if (!group_wanted(igrp, option_nlgrps, option_grpids))
             continue;
+#ifdef HAVE_FORK
+	/* Stored chunks are cheaper to copy than to send */
+	if (jobs != NULL && var_copyable(igrp, varid)
+#ifdef USE_NETCDF4
+	    && !chunks_copyable(igrp, varid, ogid)
+	    && !rechunk_wanted(igrp, varid, ogid)
+#endif
+	    ) {
+	    NC_CHECK(add_copy_job(igrp, varid, ogid, jobs));
+	    continue;
+	}
+#endif	/* HAVE_FORK */
 	NC_CHECK(copy_var_data(igrp, varid, ogid));
     }
 #ifdef USE_NETCDF4
@@ -1762,7 +2733,7 @@ copy_data(int igrp, int ogrp)
     for(i = 0; i < numgrps; i++) {
         if (!option_grpstruct && !group_wanted(grpids[i], option_nlgrps, option_grpids))
             continue;
-	NC_CHECK(copy_data(grpids[i], ogid));
+	NC_CHECK(copy_data(grpids[i], ogid, jobs));
     }
     free(grpids);
 #endif	/* USE_NETCDF4 */
@@ -2034,7 +3005,8 @@ copy(char* infile, char* outfile)
 	    || inkind == NC_FORMAT_CDF5) {
 	    if (option_deflate_level > 0 ||
 		option_shuffle_vars == NC_SHUFFLE ||
-		listlength(option_chunkspecs) > 0)
+		listlength(option_chunkspecs) > 0 ||
+		listlength(option_accessspecs) > 0)
 	    {
 		outkind = NC_FORMAT_NETCDF4_CLASSIC;
 	    }
@@ -2138,10 +3110,23 @@ copy(char* infile, char* outfile)
 	NC_CHECK(copy_fixed_size_data(igrp, ogrp, nfixed_vars, fixed_varids));
 	NC_CHECK(copy_record_data(igrp, ogrp, nrec_vars, rec_varids));
     } else {
-	NC_CHECK(copy_data(igrp, ogrp)); /* recursive, to handle nested groups */
-    }
-
-    NC_CHECK(nc_close(igrp));
+#ifdef HAVE_FORK
+	if(option_nprocs > 1) {
+	    /* Copy what the readers can't, and close the input so the
+	     * readers don't share its open file with the writer. */
+	    List* jobs = listnew();
+	    NC_CHECK(copy_data(igrp, ogrp, jobs)); /* recursive, to handle nested groups */
+	    NC_CHECK(nc_close(igrp));
+	    igrp = -1;
+	    NC_CHECK(copy_jobs(infile, open_mode, jobs, option_nprocs));
+	    free_copy_jobs(jobs);
+	} else
+#endif	/* HAVE_FORK */
+	NC_CHECK(copy_data(igrp, ogrp, NULL)); /* recursive, to handle nested groups */
+    }
+
+    if(igrp != -1)
+	NC_CHECK(nc_close(igrp));
     NC_CHECK(nc_close(ogrp));
     return stat;
 fail:
@@ -2187,6 +3172,55 @@ double_with_suffix(char *str) {
     return dval;
 }
 
+/*
+ * Parse an access pattern given with -a, of the form
+ * "dim1/n1,dim2/n2,...[:weight]", where a missing count means the
+ * whole dimension and the weight defaults to 1.  Returns NULL if the
+ * pattern is malformed.
+ */
+static AccessSpec*
+accessspec_parse(const char *str)
+{
+    AccessSpec *spec = (AccessSpec*)emalloc(sizeof(AccessSpec));
+    char *copy = strdup(str);
+    char *colon, *p, *next;
+
+    memset(spec, 0, sizeof(AccessSpec));
+    spec->weight = 1.0;
+    if((colon = strrchr(copy, ':')) != NULL) {
+	char *end;
+	*colon = '\0';
+	spec->weight = strtod(colon + 1, &end);
+	if(*end || end == colon + 1 || !(spec->weight >= 0))
+	    goto fail;
+    }
+    for(p = copy; p != NULL; p = next) {
+	char *slash;
+	if((next = strchr(p, ',')) != NULL)
+	    *next++ = '\0';
+	if((slash = strchr(p, '/')) == NULL || slash == p
+	   || spec->ndims == NC_MAX_VAR_DIMS)
+	    goto fail;
+	*slash++ = '\0';
+	if(*slash) {
+	    char *end;
+	    long long count = strtoll(slash, &end, 10);
+	    if(*end || count <= 0)
+		goto fail;
+	    spec->counts[spec->ndims] = (size_t)count;
+	}
+	spec->names[spec->ndims++] = strdup(p);
+    }
+    free(copy);
+    return spec;
+fail:
+    while(spec->ndims > 0)
+	free(spec->names[--spec->ndims]);
+    free(spec);
+    free(copy);
+    return NULL;
+}
+
 static void
 usage(void)
 {
@@ -2202,6 +3236,8 @@ usage(void)
   [-d n]    set output deflation compression level, default same as input (0=none 9=max)\n\
   [-s]      add shuffle option to deflation compression\n\
   [-c chunkspec] specify chunking for variable and dimensions, e.g. \"var:N1,N2,...\" or \"dim1/N1,dim2/N2,...\"\n\
+  [-a accessspec] advise chunking from an access pattern, e.g. \"time/,lat/1,lon/1:2\" (may be repeated)\n\
+  [-A n]    set size in bytes of chunks advised with -a\n\
   [-u]      convert unlimited dimensions to fixed-size dimensions in output copy\n\
   [-w]      write whole output file from diskless netCDF on close\n\
   [-v var1,...] include data for only listed variables, but definitions for all variables\n\
@@ -2215,6 +3251,8 @@ usage(void)
   [-F filterspec] specify a compression algorithm to apply to an output variable (may be repeated).\n\
   [-Ln]     set log level to n (>= 0); ignored if logging isn't enabled.\n\
   [-Mn]     set minimum chunk size to n bytes (n >= 0)\n\
+  [-j n]    copy variable data using n processes to read input (n >= 1)\n\
+  [-R n]    rechunk variables with at most about n bytes of memory, reading each input chunk once\n\
   infile    name of netCDF input file\n\
   outfile   name for netCDF output file\n"
 
@@ -2222,7 +3260,7 @@ usage(void)
     /* [-x]      use experimental computed estimates for variable-specific chunk caches\n\ */
 
 
-    error("%s [-k kind] [-[3|4|6|7]] [-d n] [-s] [-c chunkspec] [-u] [-w] [-[v|V] varlist] [-[g|G] grplist] [-m n] [-h n] [-e n] [-r] [-F filterspec] [-Ln] [-Mn] infile outfile\n%s\nnetCDF library version %s",
+    error("%s [-k kind] [-[3|4|6|7]] [-d n] [-s] [-c chunkspec] [-a accessspec] [-A n] [-u] [-w] [-[v|V] varlist] [-[g|G] grplist] [-m n] [-h n] [-e n] [-r] [-F filterspec] [-Ln] [-Mn] [-j n] [-R n] infile outfile\n%s\nnetCDF library version %s",
 	  progname, USAGE, nc_inq_libvers());
 
 }
@@ -2237,6 +3275,7 @@ main(int argc, char**argv)
 
     chunkspecinit();
     option_chunkspecs = listnew();
+    option_accessspecs = listnew();
 
     progname = argv[0];
 
@@ -2246,7 +3285,7 @@ main(int argc, char**argv)
     }
 
     opterr = 1;
-    while ((c = getopt(argc, argv, "k:3467d:sum:c:h:e:rwxg:G:v:V:F:L:M:")) != -1) {
+    while ((c = getopt(argc, argv, "k:3467d:sum:c:a:A:h:e:rwxg:G:v:V:F:L:M:j:R:")) != -1) {
 	switch(c) {
         case 'k': /* for specifying variant of netCDF format to be generated
                      Format names:
@@ -2313,6 +3352,14 @@ main(int argc, char**argv)
 	    option_copy_buffer_size = dval;
 	    break;
 	}
+	case 'R':		/* rechunk with bounded memory */
+	{
+	    double dval = double_with_suffix(optarg);	/* "K" for kilobytes. "M" for megabytes, ... */
+	    if(dval <= 0)
+		error("Suffix used for '-R' option value must be K, M, G, T, or P");
+	    option_rechunk_memory = (size_t)dval;
+	    break;
+	}
 	case 'h':		/* non-default size of chunk cache */
 	{
 	    double dval = double_with_suffix(optarg);	/* "K" for kilobytes. "M" for megabytes, ... */
@@ -2342,6 +3389,22 @@ main(int argc, char**argv)
 	    /* save chunkspec string for parsing later, once we know input ncid */
 	    listpush(option_chunkspecs,strdup(optarg));
 	    break;
+	case 'a':		/* access pattern to advise chunking from */
+	{
+	    AccessSpec *spec = accessspec_parse(optarg);
+	    if(spec == NULL)
+		error("Access pattern for '-a' must be dim1/n1,dim2/n2,...[:weight]");
+	    listpush(option_accessspecs,spec);
+	    break;
+	}
+	case 'A':		/* size of chunks advised with -a */
+	{
+	    double dval = double_with_suffix(optarg);	/* "K" for kilobytes. "M" for megabytes, ... */
+	    if(dval <= 0)
+		error("Suffix used for '-A' option value must be K, M, G, T, or P");
+	    option_advise_chunk_bytes = (size_t)dval;
+	    break;
+	}
 	case 'g':		/* group names */
 	    /* make list of names of groups specified */
 	    make_lgrps (optarg, &option_nlgrps, &option_lgrps, &option_grpids);
@@ -2389,6 +3452,16 @@ main(int argc, char**argv)
 	    }
 #else
 	    error("-F requires netcdf-4");
+#endif
+	    break;
+	case 'j': /* number of processes reading variable data */
+	    option_nprocs = (int)strtol(optarg, NULL, 10);
+	    if(option_nprocs < 1) {
+		error("invalid number of processes: %s", optarg);
+	    }
+#ifndef HAVE_FORK
+	    /* Can't start reader processes, so copy in this one */
+	    option_nprocs = 1;
 #endif
 	    break;
 	case 'M': /* set min chunk size */
@@ -2448,6 +3521,16 @@ main(int argc, char**argv)
     freefilteroptlist(filteroptions);
     filteroptions = NULL;
 #endif /*USE_NETCDF4*/
+    {
+	int i, k;
+	for(i = 0; i < listlength(option_accessspecs); i++) {
+	    AccessSpec *spec = (AccessSpec*)listget(option_accessspecs, (unsigned long)i);
+	    for(k = 0; k < spec->ndims; k++)
+		free(spec->names[k]);
+	    free(spec);
+	}
+	listfree(option_accessspecs);
+    }
 
     nc_finalize();
 
@@ -36,6 +36,7 @@ Research/Unidata. See \ref copyright file for more info.  */
 #include "dumplib.h"
 #include "ncdump.h"
 #include "vardata.h"
+#include "ncexport.h"
 #include "indent.h"
 #include "isnan.h"
 #include "cdl.h"
@@ -130,6 +131,7 @@ usage(void)
   [-g grp1[,...]]  Data and metadata for group(s) <grp1>,... only\n\
   [-w]             With client-side caching of variables for DAP URLs\n\
   [-x]             Output XML (NcML) instead of CDL\n\
+  [-E raw|npy]     Output data of selected variables as little-endian binary or NumPy arrays\n\
   [-F]             Output _Filter and _Codecs instead of _Fletcher32, _Shuffle, and _Deflate\n\
   [-Xp]            Unconditionally suppress output of the properties attribute\n\
   [-XF]            Unconditionally output the type of the _FillValue attribute\n\
@@ -137,7 +139,7 @@ usage(void)
   file             Name of netCDF file (or URL if DAP access enabled)\n"
 
     (void) fprintf(stderr,
-		   "%s [-c|-h] [-v ...] [[-b|-f] [c|f]] [-l len] [-n name] [-p n[,n]] [-k] [-x] [-s] [-t|-i] [-g ...] [-w] [-F] [-Ln] file\n%s",
+		   "%s [-c|-h] [-v ...] [[-b|-f] [c|f]] [-l len] [-n name] [-p n[,n]] [-k] [-x] [-E fmt] [-s] [-t|-i] [-g ...] [-w] [-F] [-Ln] file\n%s",
 		   progname,
 		   USAGE);
 
@@ -310,6 +312,9 @@ kind_string_extended(int kind, int mode)
     case NC_FORMATX_DAP4:
 	snprintf(text,sizeof(text),"%s mode=%08x", "DAP4",mode);
 	break;
+    case NC_FORMATX_NCAGG:
+	snprintf(text,sizeof(text),"%s mode=%08x", "aggregation",mode);
+	break;
     case NC_FORMATX_UNDEFINED:
 	snprintf(text,sizeof(text),"%s mode=%08x", "unknown",mode);
 	break;
@@ -2257,6 +2262,7 @@ main(int argc, char *argv[])
     int max_len = 80;		/* default maximum line length */
     int nameopt = 0;
     bool_t xml_out = false;    /* if true, output NcML instead of CDL */
+    export_t export_out = EXPORT_NONE; /* if set, output binary data instead of CDL */
     bool_t kind_out = false;	/* if true, just output kind of netCDF file */
     bool_t kind_out_extended = false;	/* output inq_format vs inq_format_extended */
     int Xp_flag = 0;    /* indicate that -Xp flag was set */
@@ -2282,7 +2288,7 @@ main(int argc, char *argv[])
     }
 
     opterr = 1;
-    while ((c = getopt(argc, argv, "b:cd:f:g:hikl:n:p:stv:xwFKL:X:")) != EOF)
+    while ((c = getopt(argc, argv, "b:cd:E:f:g:hikl:n:p:stv:xwFKL:X:")) != EOF)
       switch(c) {
 	case 'h':		/* dump header only, no data */
 	  formatting_specs.header_only = true;
@@ -2350,6 +2356,13 @@ main(int argc, char *argv[])
         case 'x':		/* XML output (NcML) */
 	  xml_out = true;
 	  break;
+	case 'E':		/* binary data instead of CDL */
+	  export_out = export_format(optarg);
+	  if(export_out == EXPORT_NONE) {
+	      snprintf(errmsg,sizeof(errmsg),"invalid value for -E option: %s", optarg);
+	      goto fail;
+	  }
+	  break;
         case 'k':	        /* just output what kind of netCDF file */
 	  kind_out = true;
 	  break;
@@ -2407,6 +2420,11 @@ main(int argc, char *argv[])
 	  exit(EXIT_FAILURE);
       }
 
+    if(export_out != EXPORT_NONE && (xml_out || formatting_specs.header_only)) {
+	snprintf(errmsg,sizeof(errmsg),"-E cannot be used with -x or -h");
+	goto fail;
+    }
+
     /* Decide xopt_props */
     if(formatting_specs.special_atts && Xp_flag == 1)
         formatting_specs.xopt_props = 0;
@@ -2495,7 +2513,9 @@ main(int argc, char *argv[])
 		    if(grp_matches(ncid, formatting_specs.nlgrps, formatting_specs.lgrps, formatting_specs.grpids) == 0)
 			goto fail;
 		}
-		if (xml_out) {
+		if (export_out != EXPORT_NONE) {
+		    do_ncexport(ncid, export_out);
+		} else if (xml_out) {
 		    if(formatting_specs.nc_kind == NC_FORMAT_NETCDF4) {
 			snprintf(errmsg,sizeof(errmsg),"NcML output (-x) currently only permitted for netCDF classic model");
 			goto fail;
@@ -0,0 +1,297 @@
+/*********************************************************************
+ *   Copyright 2018, University Corporation for Atmospheric Research
+ *   See netcdf/COPYRIGHT file for copying and redistribution conditions.
+ *********************************************************************/
+
+/* Export variable data as binary (ncdump -E), for programs that would
+ * otherwise parse the CDL data section back into numbers.  Values are
+ * read in large blocks and written without formatting, either as raw
+ * little-endian values or as NumPy .npy arrays. */
+
+#include "config.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#ifdef _WIN32
+#include <io.h>
+#include <fcntl.h>
+#endif
+#include <netcdf.h>
+#include "utils.h"
+#include "nccomps.h"
+#include "dumplib.h"
+#include "ncdump.h"
+#include "ncexport.h"
+
+extern fspec_t formatting_specs; /* set from command-line options */
+
+/* Read variables in blocks of at most this many bytes, unless a
+ * single value is larger.  The environment variable named by
+ * EXPORTBUFENV overrides it, so that tests can exercise the
+ * splitting of small variables into blocks. */
+#define EXPORTBUFSIZ 4194304
+#define EXPORTBUFENV "NCDUMP_EXPORTBUFSIZ"
+
+/* Longest NumPy dtype descriptor we write, e.g. "|V65536" */
+#define DESCR_LEN 32
+
+#define NPY_MAGIC "\x93NUMPY\x01\x00" /* version 1.0 */
+#define NPY_MAGIC_LEN 8
+#define NPY_ALIGN 64
+
+export_t
+export_format(const char *name)
+{
+    if(strcmp(name, "raw") == 0)
+	return EXPORT_RAW;
+    if(strcmp(name, "npy") == 0)
+	return EXPORT_NPY;
+    return EXPORT_NONE;
+}
+
+/* Get the size of a value of type, the size of the units to byte
+ * swap on big-endian hosts, and the NumPy dtype descriptor of the
+ * type.  Return false if values of the type can't be exported, as
+ * for strings, vlens, and compounds. */
+static bool_t
+export_type(int ncid, nc_type type, size_t *sizep, size_t *swapp, char *descr)
+{
+    const char* name = NULL;
+    switch(type) {
+    case NC_BYTE: name = "|i1"; break;
+    case NC_UBYTE: name = "|u1"; break;
+    case NC_CHAR: name = "|S1"; break;
+    case NC_SHORT: name = "<i2"; break;
+    case NC_USHORT: name = "<u2"; break;
+    case NC_INT: name = "<i4"; break;
+    case NC_UINT: name = "<u4"; break;
+    case NC_INT64: name = "<i8"; break;
+    case NC_UINT64: name = "<u8"; break;
+    case NC_FLOAT: name = "<f4"; break;
+    case NC_DOUBLE: name = "<f8"; break;
+    default: break;
+    }
+    if(name != NULL) {
+	NC_CHECK( nc_inq_type(ncid, type, NULL, sizep) );
+	*swapp = *sizep;
+	strcpy(descr, name);
+	return true;
+    }
+#ifdef USE_NETCDF4
+    if(type > NC_MAX_ATOMIC_TYPE) {
+	nc_type base_type;
+	int class;
+	NC_CHECK( nc_inq_user_type(ncid, type, NULL, sizep, &base_type, NULL, &class) );
+	switch(class) {
+	case NC_ENUM: /* values of the base type */
+	    return export_type(ncid, base_type, sizep, swapp, descr);
+	case NC_OPAQUE:
+	    *swapp = 1;
+	    snprintf(descr, DESCR_LEN, "|V%lu", (unsigned long)*sizep);
+	    return true;
+	default:
+	    break;
+	}
+    }
+#endif /* USE_NETCDF4 */
+    return false;
+}
+
+static void
+put_bytes(const void *buf, size_t size)
+{
+    if(size > 0 && fwrite(buf, 1, size, stdout) != size)
+	error("write error on standard output");
+}
+
+/* Write a NumPy .npy header for an array of values of type descr,
+ * with shape dimlens */
+static void
+put_npy_header(const char *descr, int ndims, const size_t *dimlens)
+{
+    size_t len, hlen;
+    char *header;
+    unsigned char hlenbytes[2];
+    int d;
+
+    len = strlen(descr) + (size_t)ndims * 24 + 64;
+    header = emalloc(len + NPY_ALIGN);
+    snprintf(header, len, "{'descr': '%s', 'fortran_order': False, 'shape': (", descr);
+    for(d = 0; d < ndims; d++) {
+	size_t hl = strlen(header);
+	snprintf(header + hl, len - hl, "%s%lu%s", (d > 0 ? " " : ""),
+		 (unsigned long)dimlens[d], (d < ndims - 1 || ndims == 1 ? "," : ""));
+    }
+    strlcat(header, "), }", len);
+    /* Pad with spaces and a newline, so the data is aligned */
+    hlen = strlen(header);
+    while((NPY_MAGIC_LEN + 2 + hlen + 1) % NPY_ALIGN != 0)
+	header[hlen++] = ' ';
+    header[hlen++] = '\n';
+    hlenbytes[0] = (unsigned char)(hlen & 0xff);
+    hlenbytes[1] = (unsigned char)((hlen >> 8) & 0xff);
+    put_bytes(NPY_MAGIC, NPY_MAGIC_LEN);
+    put_bytes(hlenbytes, 2);
+    put_bytes(header, hlen);
+    free(header);
+}
+
+/* Write nbytes of values of swapsize bytes each, little-endian */
+static void
+put_values(void *buf, size_t nbytes, size_t swapsize)
+{
+#ifdef WORDS_BIGENDIAN
+    if(swapsize > 1) {
+	unsigned char *p = (unsigned char *)buf;
+	size_t i, j;
+	for(i = 0; i < nbytes; i += swapsize) {
+	    for(j = 0; j < swapsize / 2; j++) {
+		unsigned char c = p[i + j];
+		p[i + j] = p[i + swapsize - 1 - j];
+		p[i + swapsize - 1 - j] = c;
+	    }
+	}
+    }
+#else
+    (void)swapsize;
+#endif
+    put_bytes(buf, nbytes);
+}
+
+/* Get the block size, from the environment if it is set there */
+static size_t
+export_bufsize(void)
+{
+    const char *env = getenv(EXPORTBUFENV);
+    if(env != NULL) {
+	long n = atol(env);
+	if(n > 0)
+	    return (size_t)n;
+    }
+    return EXPORTBUFSIZ;
+}
+
+/* Export the data of a variable.  The innermost dimensions that fit
+ * in a block are read whole, and the next dimension out in as many
+ * slices as fit, so each read is of up to bufsize bytes. */
+static void
+export_var(int ncid, int varid, export_t format)
+{
+    char name[NC_MAX_NAME + 1];
+    char descr[DESCR_LEN];
+    nc_type type;
+    int ndims, d, split;
+    int dimids[NC_MAX_VAR_DIMS];
+    size_t dimlens[NC_MAX_VAR_DIMS];
+    size_t start[NC_MAX_VAR_DIMS];
+    size_t count[NC_MAX_VAR_DIMS];
+    size_t typesize, swapsize, inner, slices, nvals = 1;
+    size_t bufsize = export_bufsize();
+    void *buf;
+
+    NC_CHECK( nc_inq_var(ncid, varid, name, &type, &ndims, dimids, NULL) );
+    if(!export_type(ncid, type, &typesize, &swapsize, descr)) {
+	fprintf(stderr, "%s: variable %s not exported: its type is not supported by -E\n",
+		progname, name);
+	return;
+    }
+    for(d = 0; d < ndims; d++) {
+	NC_CHECK( nc_inq_dimlen(ncid, dimids[d], &dimlens[d]) );
+	nvals *= dimlens[d];
+    }
+    if(format == EXPORT_NPY)
+	put_npy_header(descr, ndims, dimlens);
+    if(nvals == 0)
+	return;
+
+    inner = typesize;
+    for(split = ndims; split > 0 && dimlens[split - 1] <= bufsize / inner; split--)
+	inner *= dimlens[split - 1];
+    if(split == 0) { /* the whole variable fits */
+	buf = emalloc(inner);
+	NC_CHECK( nc_get_var(ncid, varid, buf) );
+	put_values(buf, inner, swapsize);
+	free(buf);
+	return;
+    }
+
+    /* Read dimension split-1 in slices of the inner dimensions */
+    slices = bufsize / inner;
+    if(slices == 0)
+	slices = 1;
+    buf = emalloc(slices * inner);
+    for(d = 0; d < ndims; d++) {
+	start[d] = 0;
+	count[d] = (d < split - 1 ? 1 : dimlens[d]);
+    }
+    for(;;) {
+	size_t n = dimlens[split - 1];
+	for(start[split - 1] = 0; start[split - 1] < n; start[split - 1] += count[split - 1]) {
+	    count[split - 1] = (n - start[split - 1] < slices ? n - start[split - 1] : slices);
+	    NC_CHECK( nc_get_vara(ncid, varid, start, count, buf) );
+	    put_values(buf, count[split - 1] * inner, swapsize);
+	}
+	start[split - 1] = 0;
+	/* Step to the next index of the outer dimensions */
+	for(d = split - 2; d >= 0; d--) {
+	    if(++start[d] < dimlens[d])
+		break;
+	    start[d] = 0;
+	}
+	if(d < 0)
+	    break;
+    }
+    free(buf);
+}
+
+/* Export the selected variables of a group, then of its subgroups,
+ * in the order ncdump outputs their data */
+static void
+export_group(int ncid, export_t format)
+{
+    idnode_t* vlist = NULL;
+    int nvars, varid, iv;
+
+    if (formatting_specs.nlvars > 0) {
+	vlist = newidlist();
+	for (iv = 0; iv < formatting_specs.nlvars; iv++) {
+	    if(nc_inq_gvarid(ncid, formatting_specs.lvars[iv], &varid) == NC_NOERR)
+		idadd(vlist, varid);
+	}
+    }
+    if (group_wanted(ncid, formatting_specs.nlgrps, formatting_specs.grpids)) {
+	NC_CHECK( nc_inq_nvars(ncid, &nvars) );
+	for (varid = 0; varid < nvars; varid++) {
+	    if (formatting_specs.nlvars > 0 && ! idmember(vlist, varid))
+		continue;
+	    if (formatting_specs.coord_vals && !iscoordvar(ncid, varid))
+		continue;
+	    export_var(ncid, varid, format);
+	}
+    }
+    if (vlist)
+	freeidlist(vlist);
+
+#ifdef USE_NETCDF4
+    {
+	int g, numgrps, *ncids;
+	NC_CHECK( nc_inq_grps(ncid, &numgrps, NULL) );
+	ncids = emalloc((size_t)(numgrps + 1) * sizeof(int));
+	NC_CHECK( nc_inq_grps(ncid, NULL, ncids) );
+	for (g = 0; g < numgrps; g++)
+	    export_group(ncids[g], format);
+	free(ncids);
+    }
+#endif /* USE_NETCDF4 */
+}
+
+void
+do_ncexport(int ncid, export_t format)
+{
+#ifdef _WIN32
+    _setmode(_fileno(stdout), _O_BINARY);
+#endif
+    export_group(ncid, format);
+    if(fflush(stdout) != 0)
+	error("write error on standard output");
+}
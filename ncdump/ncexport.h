@@ -0,0 +1,31 @@
+/*********************************************************************
+ *   Copyright 2018, University Corporation for Atmospheric Research
+ *   See netcdf/COPYRIGHT file for copying and redistribution conditions.
+ *********************************************************************/
+#ifndef _NCEXPORT_H
+#define _NCEXPORT_H
+
+/* Formats for variable data exported with ncdump -E */
+typedef enum {
+    EXPORT_NONE = 0,		/* output CDL or NcML */
+    EXPORT_RAW = 1,		/* values as little-endian binary */
+    EXPORT_NPY = 2		/* one NumPy .npy array per variable */
+} export_t;
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Get the export format named by the -E option, or EXPORT_NONE if
+ * there is no such format. */
+extern export_t export_format ( const char *name );
+
+/* Write the data of the variables selected by the -v, -g, and -c
+ * options to stdout, in the export format, instead of CDL. */
+extern void do_ncexport ( int ncid, export_t format );
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif	/*_NCEXPORT_H */
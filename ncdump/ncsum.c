@@ -0,0 +1,489 @@
+/*********************************************************************
+ *   Copyright 2018, University Corporation for Atmospheric Research
+ *   See netcdf/COPYRIGHT file for copying and redistribution conditions.
+ *********************************************************************/
+
+/* ncsum computes checksums of the contents of the variables of a
+ * netCDF file, stores them in attributes of the variables, or checks
+ * the variables against stored checksums, for scanning archives for
+ * corruption.  With -j, the variables are checksummed by several
+ * processes at once. */
+
+#include "config.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#ifdef HAVE_GETOPT_H
+#include <getopt.h>
+#endif
+#if defined(_WIN32) && !defined(__MINGW32__)
+#include "XGetopt.h"
+#endif
+#ifdef HAVE_UNISTD_H
+#include <unistd.h>
+#endif
+#ifdef HAVE_FORK
+#include <errno.h>
+#include <signal.h>
+#include <sys/types.h>
+#include <sys/wait.h>
+#endif
+#include "netcdf.h"
+#include "netcdf_aux.h"
+#include "utils.h"
+#include "ncpathmgr.h"
+
+char *progname;
+
+static int option_chunks = 0;	/* also checksum the stored chunks */
+static int option_store = 0;	/* store checksums in attributes */
+static int option_verify = 0;	/* check against stored checksums */
+static int option_nprocs = 1;	/* processes checksumming variables */
+static int option_nlvars = 0;	/* number of variables named with -v */
+static char** option_lvars = NULL; /* variables named with -v */
+
+/* A variable to checksum */
+typedef struct SumVar {
+    char* grpname;		/* full name of group, NULL if root */
+    int varid;
+    char* path;			/* full name of variable */
+} SumVar;
+
+/* The checksums of a variable, or the result of checking them.  In
+ * the pipe from a checksum process, nchunks chunk checksums follow
+ * when they are computed. */
+typedef struct SumResult {
+    int stat;			/* netCDF error status */
+    int status;			/* NC_CHECKSUM_* when verifying */
+    unsigned long long crc;
+    size_t nchunks;
+    size_t badchunk;
+    unsigned int* crcs;		/* chunk checksums */
+} SumResult;
+
+/* badchunk of a variable whose values failed their check */
+#define NO_BAD_CHUNK ((size_t)-1)
+
+static void
+usage(void)
+{
+#define USAGE   "\
+  [-k]      also checksum each stored chunk of chunked variables, as stored\n\
+  [-a]      store the checksums in attributes of the variables\n\
+  [-c]      check variables against checksums stored with -a\n\
+  [-v var1,...] checksum only the listed variables\n\
+  [-j n]    checksum variables in n processes (n >= 1)\n\
+  file      name of netCDF file\n"
+
+    error("%s [-k] [-a|-c] [-v var1,...] [-j n] file\n%s\nnetCDF library version %s",
+	  progname, USAGE, nc_inq_libvers());
+}
+
+/* Return true if the variable was named with -v, by name or by full
+ * name, or if -v was not used */
+static bool_t
+var_wanted(const char* name, const char* path)
+{
+    int i;
+    if(option_nlvars == 0)
+	return true;
+    for(i = 0; i < option_nlvars; i++) {
+	const char* lvar = option_lvars[i];
+	if(strcmp(lvar, name) == 0 || strcmp(lvar, path) == 0
+	   || (lvar[0] != '/' && strcmp(lvar, path + 1) == 0))
+	    return true;
+    }
+    return false;
+}
+
+/* Add the variables of group grpid and its subgroups to vars */
+static void
+collect_vars(int grpid, SumVar** varsp, int* nvarsp)
+{
+    char* grpname = NULL;
+    size_t grplen = 0;
+    int nvars, varid, parid;
+
+    if(nc_inq_grp_parent(grpid, &parid) == NC_NOERR) {
+	NC_CHECK(nc_inq_grpname_full(grpid, &grplen, NULL));
+	grpname = (char*) emalloc(grplen + 1);
+	NC_CHECK(nc_inq_grpname_full(grpid, NULL, grpname));
+    }
+    NC_CHECK(nc_inq_nvars(grpid, &nvars));
+    for(varid = 0; varid < nvars; varid++) {
+	char name[NC_MAX_NAME + 1];
+	size_t len;
+	SumVar* v;
+
+	NC_CHECK(nc_inq_varname(grpid, varid, name));
+	len = grplen + strlen(name) + 2;
+	*varsp = (SumVar*) erealloc(*varsp, (size_t)(*nvarsp + 1) * sizeof(SumVar));
+	v = &(*varsp)[*nvarsp];
+	v->path = (char*) emalloc(len);
+	snprintf(v->path, len, "%s/%s", (grpname ? grpname : ""), name);
+	if(!var_wanted(name, v->path)) {
+	    free(v->path);
+	    continue;
+	}
+	v->grpname = (grpname ? strdup(grpname) : NULL);
+	v->varid = varid;
+	(*nvarsp)++;
+    }
+    nullfree(grpname);
+
+#ifdef USE_NETCDF4
+    {
+	int g, numgrps, *ncids;
+	NC_CHECK( nc_inq_grps(grpid, &numgrps, NULL) );
+	ncids = emalloc((size_t)(numgrps + 1) * sizeof(int));
+	NC_CHECK( nc_inq_grps(grpid, NULL, ncids) );
+	for (g = 0; g < numgrps; g++)
+	    collect_vars(ncids[g], varsp, nvarsp);
+	free(ncids);
+    }
+#endif /* USE_NETCDF4 */
+}
+
+/* Get the id of the group of a variable in file ncid */
+static int
+var_grp(int ncid, const SumVar* v, int* grpp)
+{
+    if(v->grpname == NULL) {
+	*grpp = ncid;
+	return NC_NOERR;
+    }
+    return nc_inq_grp_full_ncid(ncid, v->grpname, grpp);
+}
+
+/* Checksum variable v of file ncid, or check it against its stored
+ * checksums */
+static void
+sum_var(int ncid, const SumVar* v, SumResult* r)
+{
+    int grp;
+
+    memset(r, 0, sizeof(SumResult));
+    if((r->stat = var_grp(ncid, v, &grp)))
+	return;
+    if(option_verify) {
+	r->badchunk = NO_BAD_CHUNK;
+	r->stat = ncaux_verify_checksums(grp, v->varid, &r->status, &r->badchunk);
+	return;
+    }
+    if((r->stat = ncaux_var_checksum(grp, v->varid, &r->crc)))
+	return;
+    if(option_chunks) {
+	if((r->stat = ncaux_var_chunk_checksums(grp, v->varid, &r->nchunks, NULL)))
+	    return;
+	if(r->nchunks > 0) {
+	    r->crcs = (unsigned int*) emalloc(r->nchunks * sizeof(unsigned int));
+	    r->stat = ncaux_var_chunk_checksums(grp, v->varid, &r->nchunks, r->crcs);
+	}
+    }
+}
+
+/* Print the checksum of a variable, or the result of checking it.
+ * Return 1 if the variable failed its check or could not be read. */
+static int
+report(const SumVar* v, const SumResult* r)
+{
+    if(r->stat == NC_EBADTYPE) {
+	fprintf(stderr, "%s: %s: not checksummed, type not supported\n", progname, v->path);
+	return 0;
+    }
+    if(r->stat != NC_NOERR) {
+	fprintf(stderr, "%s: %s: %s\n", progname, v->path, nc_strerror(r->stat));
+	return 1;
+    }
+    if(option_verify) {
+	switch(r->status) {
+	case NC_CHECKSUM_OK:
+	    printf("%s: OK\n", v->path);
+	    return 0;
+	case NC_CHECKSUM_NONE:
+	    printf("%s: no checksum\n", v->path);
+	    return 0;
+	default:
+	    if(r->badchunk != NO_BAD_CHUNK)
+		printf("%s: FAILED (chunk %lu)\n", v->path, (unsigned long)r->badchunk);
+	    else
+		printf("%s: FAILED\n", v->path);
+	    return 1;
+	}
+    }
+    printf("%016llx  %s", r->crc, v->path);
+    if(r->nchunks > 0)
+	printf("  (%lu chunks)", (unsigned long)r->nchunks);
+    printf("\n");
+    return 0;
+}
+
+/* Store the checksums of the variables in their attributes */
+static int
+store_sums(const char* path, const SumVar* vars, const SumResult* results, int nvars)
+{
+    int stat = NC_NOERR;
+    int ncid, grp, i;
+
+    if((stat = nc_open(path, NC_WRITE, &ncid)))
+	return stat;
+    /* Write the header of a classic file once */
+    (void)nc_redef(ncid);
+    for(i = 0; i < nvars; i++) {
+	if(results[i].stat != NC_NOERR)
+	    continue;
+	if((stat = var_grp(ncid, &vars[i], &grp)))
+	    break;
+	if((stat = ncaux_put_checksums(grp, vars[i].varid, results[i].crc,
+				       results[i].nchunks, results[i].crcs)))
+	    break;
+    }
+    if(stat == NC_NOERR)
+	stat = nc_close(ncid);
+    else
+	(void)nc_close(ncid);
+    return stat;
+}
+
+#ifdef HAVE_FORK
+
+/* With -j n, n processes each open the file and checksum every n-th
+ * variable, and send the SumResults, in order, through a pipe to the
+ * ncsum process, which reports them in the order of the variables.
+ * The library cannot be used from more than one thread, so these are
+ * processes rather than threads. */
+
+/* Write nbytes from buf to fd, return 0 on success */
+static int
+write_all(int fd, const void* buf, size_t nbytes)
+{
+    const char* p = (const char*)buf;
+    while(nbytes > 0) {
+	ssize_t n = write(fd, p, nbytes);
+	if(n < 0) {
+	    if(errno == EINTR)
+		continue;
+	    return -1;
+	}
+	p += n;
+	nbytes -= (size_t)n;
+    }
+    return 0;
+}
+
+/* Read nbytes from fd into buf, return 0 on success, -1 on error or
+ * end of file */
+static int
+read_all(int fd, void* buf, size_t nbytes)
+{
+    char* p = (char*)buf;
+    while(nbytes > 0) {
+	ssize_t n = read(fd, p, nbytes);
+	if(n < 0 && errno == EINTR)
+	    continue;
+	if(n <= 0)
+	    return -1;
+	p += n;
+	nbytes -= (size_t)n;
+    }
+    return 0;
+}
+
+/* Body of checksum process proc of nprocs: checksum every nprocs-th
+ * variable of the file, and send the results on fd. Never
+ * returns. */
+static void
+sum_proc(const char* path, const SumVar* vars, int nvars, int proc, int nprocs, int fd)
+{
+    int ncid, i;
+    int stat = nc_open(path, NC_NOWRITE, &ncid);
+
+    for(i = proc; i < nvars; i += nprocs) {
+	SumResult r;
+	if(stat == NC_NOERR)
+	    sum_var(ncid, &vars[i], &r);
+	else {
+	    memset(&r, 0, sizeof(r));
+	    r.stat = stat;
+	}
+	if(write_all(fd, &r, sizeof(r))
+	   || (r.nchunks > 0 && r.crcs != NULL
+	       && write_all(fd, r.crcs, r.nchunks * sizeof(unsigned int))))
+	    _exit(EXIT_FAILURE); /* ncsum is gone */
+	nullfree(r.crcs);
+    }
+    if(stat == NC_NOERR)
+	(void)nc_close(ncid);
+    _exit(EXIT_SUCCESS);
+}
+
+/* Checksum the variables in nprocs processes, reporting each as its
+ * result arrives. Keep the results if keep is not NULL. Return the
+ * number of variables that failed. */
+static int
+sum_parallel(const char* path, const SumVar* vars, int nvars, int nprocs, SumResult* keep)
+{
+    pid_t* pids;
+    int* fds;
+    int failed = 0;
+    int p, i;
+
+    if(nprocs > nvars)
+	nprocs = nvars;
+    pids = (pid_t*) emalloc((size_t)nprocs * sizeof(pid_t));
+    fds = (int*) emalloc((size_t)nprocs * sizeof(int));
+
+    fflush(stdout);
+    fflush(stderr);
+    for(p = 0; p < nprocs; p++) {
+	int pfd[2];
+	if(pipe(pfd) != 0)
+	    error("cannot create pipe: %s", strerror(errno));
+	pids[p] = fork();
+	if(pids[p] == 0) {
+	    int k;
+	    for(k = 0; k < p; k++)
+		close(fds[k]);
+	    close(pfd[0]);
+	    sum_proc(path, vars, nvars, p, nprocs, pfd[1]);
+	}
+	close(pfd[1]);
+	if(pids[p] < 0)
+	    error("cannot start process: %s", strerror(errno));
+	fds[p] = pfd[0];
+    }
+
+    /* Variable i comes from process i % nprocs, which does its
+     * variables in order */
+    for(i = 0; i < nvars; i++) {
+	SumResult r;
+	int fd = fds[i % nprocs];
+	if(read_all(fd, &r, sizeof(r)) != 0)
+	    error("checksum process %d ended unexpectedly", i % nprocs);
+	r.crcs = NULL;
+	if(!option_verify && r.nchunks > 0) {
+	    r.crcs = (unsigned int*) emalloc(r.nchunks * sizeof(unsigned int));
+	    if(read_all(fd, r.crcs, r.nchunks * sizeof(unsigned int)) != 0)
+		error("checksum process %d ended unexpectedly", i % nprocs);
+	}
+	failed += report(&vars[i], &r);
+	if(keep)
+	    keep[i] = r;
+	else
+	    nullfree(r.crcs);
+    }
+
+    for(p = 0; p < nprocs; p++) {
+	int status;
+	close(fds[p]);
+	if(waitpid(pids[p], &status, 0) != pids[p]
+	   || !(WIFEXITED(status) && WEXITSTATUS(status) == EXIT_SUCCESS))
+	    failed++;
+    }
+    free(pids);
+    free(fds);
+    return failed;
+}
+
+#endif	/* HAVE_FORK */
+
+int
+main(int argc, char** argv)
+{
+    int ncid, nvars = 0, failed = 0, c, i;
+    SumVar* vars = NULL;
+    SumResult* results = NULL;
+    char* path = NULL;
+
+    progname = argv[0];
+    opterr = 1;
+    while ((c = getopt(argc, argv, "kacv:j:")) != -1) {
+	switch(c) {
+	case 'k':
+	    option_chunks = 1;
+	    break;
+	case 'a':
+	    option_store = 1;
+	    break;
+	case 'c':
+	    option_verify = 1;
+	    break;
+	case 'v':
+	    {
+		char* list = strdup(optarg);
+		char* name;
+		for(name = strtok(list, ","); name != NULL; name = strtok(NULL, ",")) {
+		    option_lvars = (char**) erealloc(option_lvars, (size_t)(option_nlvars + 1) * sizeof(char*));
+		    option_lvars[option_nlvars++] = strdup(name);
+		}
+		free(list);
+	    }
+	    break;
+	case 'j':
+	    option_nprocs = (int)strtol(optarg, NULL, 10);
+	    if(option_nprocs < 1)
+		error("invalid number of processes: %s", optarg);
+#ifndef HAVE_FORK
+	    /* Can't start processes, so checksum in this one */
+	    option_nprocs = 1;
+#endif
+	    break;
+	default:
+	    usage();
+	}
+    }
+    argc -= optind;
+    argv += optind;
+    if(argc != 1)
+	usage();
+    if(option_store && option_verify)
+	error("-a and -c cannot be used together");
+    path = NC_shellUnescape(argv[0]);
+
+    NC_CHECK(nc_open(path, NC_NOWRITE, &ncid));
+    collect_vars(ncid, &vars, &nvars);
+    if(option_store)
+	results = (SumResult*) emalloc((size_t)(nvars + 1) * sizeof(SumResult));
+
+#ifdef HAVE_FORK
+    if(option_nprocs > 1 && nvars > 1) {
+	/* Each process opens the file itself */
+	NC_CHECK(nc_close(ncid));
+	failed = sum_parallel(path, vars, nvars, option_nprocs, results);
+    } else
+#endif
+    {
+	for(i = 0; i < nvars; i++) {
+	    SumResult r;
+	    sum_var(ncid, &vars[i], &r);
+	    failed += report(&vars[i], &r);
+	    if(results)
+		results[i] = r;
+	    else
+		nullfree(r.crcs);
+	}
+	NC_CHECK(nc_close(ncid));
+    }
+
+    if(option_store) {
+	int stat = store_sums(path, vars, results, nvars);
+	if(stat != NC_NOERR) {
+	    fprintf(stderr, "%s: cannot store checksums: %s\n", progname, nc_strerror(stat));
+	    failed++;
+	}
+	for(i = 0; i < nvars; i++)
+	    nullfree(results[i].crcs);
+	free(results);
+    }
+
+    for(i = 0; i < nvars; i++) {
+	nullfree(vars[i].grpname);
+	free(vars[i].path);
+    }
+    nullfree(vars);
+    for(i = 0; i < option_nlvars; i++)
+	free(option_lvars[i]);
+    nullfree(option_lvars);
+    nullfree(path);
+    return failed ? EXIT_FAILURE : EXIT_SUCCESS;
+}
@@ -0,0 +1,95 @@
+#!/bin/sh
+
+if test "x$srcdir" = x ; then srcdir=`pwd`; fi 
+. ../test_common.sh
+
+# This shell script tests ncdump -E, which outputs variable data as
+# binary instead of CDL.
+set -e
+echo ""
+echo "*** Testing ncdump -E binary export."
+
+rm -f tst_export.nc tmp_export.txt
+cat > tmp_export.cdl <<CDL
+netcdf tst_export {
+dimensions:
+	t = UNLIMITED ;
+	x = 3 ;
+variables:
+	int i(t, x) ;
+	double d(x) ;
+	char c(x) ;
+	short s ;
+data:
+ i = 1, 2, 3, -1, -2, -3 ;
+ d = 0.5, 1, -2 ;
+ c = "abc" ;
+ s = 7 ;
+}
+CDL
+${NCGEN} -b -o tst_export.nc tmp_export.cdl
+
+echo "*** Testing -E raw outputs little-endian values of the -v variables..."
+${NCDUMP} -E raw -v i,c,s tst_export.nc | od -An -tx1 | tr -d ' \n' > tmp_export.txt
+echo "010000000200000003000000fffffffffeffffff fdffffff6162630700" | tr -d ' ' > tmp_export_ref.txt
+diff -b tmp_export.txt tmp_export_ref.txt
+
+echo "*** Testing -E npy outputs one array per variable..."
+${NCDUMP} -E npy -v d tst_export.nc > tmp_export.npy
+test `wc -c < tmp_export.npy` = 152
+head -c 128 tmp_export.npy | grep -F "{'descr': '<f8', 'fortran_order': False, 'shape': (3,), }" > /dev/null
+${NCDUMP} -E npy -v i tst_export.nc | head -c 128 | grep -F "'descr': '<i4', 'fortran_order': False, 'shape': (2, 3), }" > /dev/null
+${NCDUMP} -E npy -v s tst_export.nc | head -c 128 | grep -F "'shape': (), }" > /dev/null
+
+echo "*** Testing -E splits variables into blocks..."
+# A small block size makes the record variable i2 be read in runs of
+# 4 and 1 along x for each record, and v in runs of 2, 2 and 1 along
+# its middle dimension for each index of the first.
+cat > tmp_export_blocks.cdl <<CDL
+netcdf tst_export_blocks {
+dimensions:
+	t = UNLIMITED ;
+	x = 5 ;
+	y = 2 ;
+	z = 5 ;
+	w = 3 ;
+variables:
+	int i2(t, x) ;
+	short v(y, z, w) ;
+	double d(x) ;
+data:
+ i2 = 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15 ;
+ v = 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15,
+     16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30 ;
+ d = 0.5, 1.5, 2.5, 3.5, 4.5 ;
+}
+CDL
+${NCGEN} -b -o tst_export.nc tmp_export_blocks.cdl
+for f in raw npy ; do
+    ${NCDUMP} -E $f tst_export.nc > tmp_export_whole.bin
+    for n in 16 1 ; do
+        NCDUMP_EXPORTBUFSIZ=$n ${NCDUMP} -E $f tst_export.nc > tmp_export_blocks.bin
+        if ! cmp tmp_export_whole.bin tmp_export_blocks.bin ; then
+            echo "*** -E $f with $n byte blocks differs"
+            exit 1
+        fi
+    done
+done
+NCDUMP_EXPORTBUFSIZ=16 ${NCDUMP} -E raw -v i2 tst_export.nc | od -An -tx1 | tr -d ' \n' > tmp_export.txt
+i=1
+while test $i -le 15 ; do
+    printf '%02x000000' $i
+    i=`expr $i + 1`
+done > tmp_export_ref.txt
+diff -b tmp_export.txt tmp_export_ref.txt
+
+echo "*** Testing -E with -h fails..."
+if ${NCDUMP} -E raw -h tst_export.nc > /dev/null 2>&1 ; then
+    echo "*** -E -h should have failed"
+    exit 1
+fi
+
+rm -f tst_export.nc tmp_export.cdl tmp_export.txt tmp_export_ref.txt tmp_export.npy
+rm -f tmp_export_blocks.cdl tmp_export_whole.bin tmp_export_blocks.bin
+echo "*** All ncdump -E tests passed!"
+exit 0
@@ -42,6 +42,16 @@ for i in $TESTFILES ; do
     rm copy_of_$i.nc copy_of_$i.cdl tmp_$i.cdl
 done
 
+echo "*** Testing nccopy -j on ncdump/*.nc files"
+for i in $TESTFILES ; do
+    echo "*** Test nccopy -j 3 $i.nc copy_of_$i.nc ..."
+    ${NCCOPY} -j 3 $i.nc copy_of_$i.nc
+    ${NCDUMP} -n copy_of_$i $i.nc > tmp_$i.cdl
+    ${NCDUMP} copy_of_$i.nc > copy_of_$i.cdl
+    diff copy_of_$i.cdl tmp_$i.cdl
+    rm copy_of_$i.nc copy_of_$i.cdl tmp_$i.cdl
+done
+
 # echo "*** Testing compression of deflatable files ..."
 ${execdir}/tst_compress
 echo "*** Test nccopy -d1 can compress a classic format file ..."
@@ -73,7 +83,38 @@ fi
 if fgrep '_Shuffle' < tmp_ncc4.cdl ; then
     exit 1
 fi
-rm tst_deflated.nc tst_inflated.nc tst_inflated4.nc tmp_ncc4.nc tmp_ncc4.cdl
+echo "*** Test nccopy -j 4 -d1 -s copies a netCDF-4 file a slab at a time ..."
+${NCCOPY} -j 4 -m 1000 -d1 -s tst_inflated4.nc tmp_ncc4.nc
+${NCDUMP} -n tmp_ncc4 tst_inflated4.nc > tmp_ncc4.cdl
+${NCDUMP} tmp_ncc4.nc > tmp_ncc4j.cdl
+diff tmp_ncc4.cdl tmp_ncc4j.cdl
+echo "*** Test nccopy copies the stored chunks of a compressed netCDF-4 file ..."
+${NCCOPY} tmp_ncc4.nc tmp_ncc4r.nc
+${NCDUMP} -n tmp_ncc4 tmp_ncc4r.nc > tmp_ncc4r.cdl
+diff tmp_ncc4j.cdl tmp_ncc4r.cdl
+rm tst_deflated.nc tst_inflated.nc tst_inflated4.nc tmp_ncc4.nc tmp_ncc4.cdl tmp_ncc4j.cdl
+rm tmp_ncc4r.nc tmp_ncc4r.cdl
+${execdir}/tst_rawchunks
+if test -f tst_rawchunks.nc ; then
+echo "*** Test nccopy copies stored chunks without recompressing them ..."
+# The chunks of tst_rawchunks.nc hold level 9 streams in a level 1
+# variable, so their checksums hold only for a copy of the stored bytes.
+${NCSUM} -k -a tst_rawchunks.nc > /dev/null
+${NCCOPY} tst_rawchunks.nc tmp_rawchunks.nc
+${NCSUM} -c tmp_rawchunks.nc > tmp_rawchunks.txt
+grep '^/v: OK$' tmp_rawchunks.txt > /dev/null
+${NCDUMP} -hs tmp_rawchunks.nc | grep 'v:_DeflateLevel = 1 ;' > /dev/null
+echo "*** Test nccopy -d9 recompresses them ..."
+${NCCOPY} -d9 tst_rawchunks.nc tmp_rawchunks.nc
+${NCSUM} -c tmp_rawchunks.nc > tmp_rawchunks.txt
+grep '^/v: OK$' tmp_rawchunks.txt > /dev/null
+${NCCOPY} -d1 tmp_rawchunks.nc tmp_rawchunks1.nc
+if ${NCSUM} -c tmp_rawchunks1.nc > tmp_rawchunks.txt ; then
+    echo "*** a value copy should not keep the stored chunks"
+    exit 1
+fi
+rm tst_rawchunks.nc tmp_rawchunks.nc tmp_rawchunks1.nc tmp_rawchunks.txt
+fi
 
 echo "*** Testing nccopy -d1 -s on ncdump/*.nc files"
 for i in $TESTFILES0 ; do
@@ -251,12 +251,110 @@ checkfvar tmp_chunking_omit.cdl
 
 } # T5
 
+testcase6() {
+zext=$1
+buildfile ${zext} 6
+
+rm -fr tmp6${zext}.dir
+mkdir tmp6${zext}.dir
+cd tmp6${zext}.dir
+
+${CHUNKTEST} ${file} deflate
+
+# Save a .cdl version
+${NCDUMP} -n tmp_nc5_base ${file} > tmp_nc5.cdl
+
+echo "*** Test nccopy -R rechunks with bounded memory; enhanced ->enhanced"
+# Chunk ivar across the last dimension, then along it
+${NCCOPY} -M100 -c ivar:1,4,2,3,5,6,1 $file tmp_nc5_map.nc
+BASELINE='ivar:_ChunkSizes = 7, 1, 1, 1, 1, 1, 9 ;'
+# 1K needs a temporary file, 1M does not
+for mem in 1K 1M ; do
+    mkdir tmpdir_$mem
+    TMPDIR=`pwd`/tmpdir_$mem ${NCCOPY} -M100 -R $mem -c ivar:7,1,1,1,1,1,9 tmp_nc5_map.nc tmp_nc5_$mem.nc
+    ${NCDUMP} -n tmp_nc5_base tmp_nc5_$mem.nc > tmp_nc5_$mem.cdl
+    diff tmp_nc5.cdl tmp_nc5_$mem.cdl
+    ${NCDUMP} -hs -n tmp_nc5_base tmp_nc5_$mem.nc > tmp_chunking.cdl
+    TESTLINE=`sed -e '/ivar:_ChunkSizes/p' -e d <tmp_chunking.cdl`
+    verifychunkline "$TESTLINE" "$BASELINE"
+    # The temporary file is removed
+    if test "x`ls tmpdir_$mem`" != x ; then
+	echo "***Fail: temporary file left in tmpdir_$mem"
+	exit 1
+    fi
+done
+
+# The 2880 byte input chunks do not fit in 1K, so a temporary file is
+# needed, and nccopy fails if it cannot be created; 1M needs none.
+if TMPDIR=`pwd`/nosuchdir ${NCCOPY} -M100 -R 1K -c ivar:7,1,1,1,1,1,9 tmp_nc5_map.nc tmp_nc5_nodir.nc 2>/dev/null ; then
+    echo "***Fail: -R 1K did not use a temporary file"
+    exit 1
+fi
+TMPDIR=`pwd`/nosuchdir ${NCCOPY} -M100 -R 1M -c ivar:7,1,1,1,1,1,9 tmp_nc5_map.nc tmp_nc5_nodir.nc
+
+if test "x$FEATURE_FILTERTESTS" = xyes ; then
+echo "*** Test nccopy -R decodes each input chunk once"
+# The noop filter prints a line each time it decodes a chunk
+. ${top_builddir}/nc_test4/findplugin.sh
+findplugin h5noop
+export HDF5_PLUGIN_PATH="${HDF5_PLUGIN_DIR}"
+${NCCOPY} -M100 -F ivar,none tmp_nc5_map.nc tmp_nc5_plain.nc
+${NCCOPY} -M100 -F ivar,40000 tmp_nc5_plain.nc tmp_nc5_noop.nc > /dev/null
+# ivar has 7*9 input chunks
+for mem in 1K 1M ; do
+    ${NCCOPY} -M100 -R $mem -c ivar:7,1,1,1,1,1,9 -F ivar,none tmp_nc5_noop.nc tmp_nc5_$mem.nc > tmp_nc5_noop.txt
+    NDECODES=`grep -c 'direction=decompress' tmp_nc5_noop.txt || true`
+    if test "x$NDECODES" != x63 ; then
+	echo "***Fail: -R $mem decoded $NDECODES input chunks, not 63"
+	exit 1
+    fi
+    ${NCDUMP} -n tmp_nc5_base tmp_nc5_$mem.nc > tmp_nc5_$mem.cdl
+    diff tmp_nc5.cdl tmp_nc5_$mem.cdl
+done
+unset HDF5_PLUGIN_PATH
+fi
+
+} # T6
+
+testcase7() {
+zext=$1
+buildfile ${zext} 7
+
+rm -fr tmp7${zext}.dir
+mkdir tmp7${zext}.dir
+cd tmp7${zext}.dir
+
+${CHUNKTEST} ${file}
+
+# Save a .cdl version
+${NCDUMP} -n tmp_nc5_base ${file} > tmp_nc5.cdl
+
+echo "*** Test nccopy -a advises chunking from access patterns; enhanced ->enhanced"
+# Series along dim0 and dim6 are read from one chunk
+${NCCOPY} -M100 -A 1K -a dim0/,dim6/ $file tmp_nc5_series.nc
+${NCDUMP} -n tmp_nc5_base tmp_nc5_series.nc > tmp_nc5_series.cdl
+diff tmp_nc5.cdl tmp_nc5_series.cdl
+${NCDUMP} -hs -n tmp_nc5_base tmp_nc5_series.nc > tmp_chunking.cdl
+TESTLINE=`sed -e '/ivar:_ChunkSizes/p' -e d <tmp_chunking.cdl`
+BASELINE='ivar:_ChunkSizes = 7, 1, 1, 1, 1, 3, 9 ;'
+verifychunkline "$TESTLINE" "$BASELINE"
+# A per-variable chunk spec overrides the advice
+${NCCOPY} -M100 -A 1K -a dim0/,dim6/ -c ivar:7,1,2,1,5,1,9 $file tmp_nc5_series.nc
+${NCDUMP} -hs -n tmp_nc5_base tmp_nc5_series.nc > tmp_chunking.cdl
+TESTLINE=`sed -e '/ivar:_ChunkSizes/p' -e d <tmp_chunking.cdl`
+BASELINE='ivar:_ChunkSizes = 7, 1, 2, 1, 5, 1, 9 ;'
+verifychunkline "$TESTLINE" "$BASELINE"
+
+} # T7
+
 testcases() {
     testcase1 $1
     testcase2 $1
     testcase3 $1
     testcase4 $1
     testcase5 $1
+    testcase6 $1
+    testcase7 $1
 }
 
 if test "x$TESTNCZARR" != x ; then
@@ -0,0 +1,158 @@
+#!/bin/sh
+
+if test "x$srcdir" = x ; then srcdir=`pwd`; fi
+. ../test_common.sh
+
+# This shell script tests ncgen writing the data of a file as it is
+# parsed, which it does when no groups can follow the data section.
+# The file must be the same as when the whole CDL is parsed first,
+# which ncgen does when the CDL is read from standard input and the
+# format is not given, the data of a large variable must be written
+# in blocks, and no file may be left after an error in the data
+# section.
+set -e
+echo ""
+echo "*** Testing ncgen writing data as it is parsed."
+
+rm -f tst_ncgen_stream_*.nc tmp_ncgen_stream*
+
+echo "*** Testing files are the same as when the CDL is parsed first..."
+for t in c0 example_good fills n3time nc_enddef pres_temp_4D ref_keyword \
+         ref_nctst ref_tst_chardata ref_tst_long_charconst ref_tst_nul3 \
+         ref_tst_small sfc_pres_temp simple_xy small small2 \
+         test0 tst_chararray unlimtest1 ; do
+    ${NCGEN} -b -o tst_ncgen_stream_whole.nc < ${srcdir}/cdl/$t.cdl
+    for k in "" "-k nc3" ; do
+        ${NCGEN} $k -b -o tst_ncgen_stream_out.nc ${srcdir}/cdl/$t.cdl
+        if ! cmp tst_ncgen_stream_whole.nc tst_ncgen_stream_out.nc ; then
+            echo "*** $t.cdl $k: files differ"
+            exit 1
+        fi
+    done
+done
+
+echo "*** Testing record variables with different numbers of records..."
+cat > tmp_ncgen_stream.cdl <<CDL
+netcdf tmp_ncgen_stream {
+dimensions:
+	t = UNLIMITED ;
+	x = 2 ;
+variables:
+	int a(t) ;
+	short b(t, x) ;
+	double c(t) ;
+	char d(t, x) ;
+	int s ;
+data:
+ a = 1, 2, 3 ;
+ b = 1, 2, 3, 4, 5, 6, 7, 8, 9, 10 ;
+ c = 0.5 ;
+ d = "ab" ;
+ s = 7 ;
+}
+CDL
+${NCGEN} -b -o tst_ncgen_stream_whole.nc < tmp_ncgen_stream.cdl
+${NCGEN} -k nc3 -b -o tst_ncgen_stream_out.nc tmp_ncgen_stream.cdl
+cmp tst_ncgen_stream_whole.nc tst_ncgen_stream_out.nc
+${NCDUMP} -v a,c tst_ncgen_stream_out.nc > tmp_ncgen_stream.txt
+grep -F 'a = 1, 2, 3, _, _ ;' tmp_ncgen_stream.txt > /dev/null
+grep -F 'c = 0.5, _, _, _, _ ;' tmp_ncgen_stream.txt > /dev/null
+
+echo "*** Testing the same without fill..."
+${NCGEN} -x -b -o tst_ncgen_stream_whole.nc < tmp_ncgen_stream.cdl
+${NCGEN} -x -b -o tst_ncgen_stream_out.nc tmp_ncgen_stream.cdl
+cmp tst_ncgen_stream_whole.nc tst_ncgen_stream_out.nc
+
+echo "*** Testing a large variable is written in blocks..."
+# 25000 records of 10 values, written at least 65536 values at a time
+awk 'BEGIN {
+    print "netcdf tmp_ncgen_stream_big {"
+    print "dimensions:\n\tt = UNLIMITED ;\n\tx = 10 ;\n\tn = 70001 ;"
+    print "variables:\n\tint v(t, x) ;\n\tdouble w(n) ;\n\tshort s(t) ;"
+    print "data:"
+    printf " v = 0"
+    for(i = 1; i < 250000; i++) printf(", %d", i)
+    printf " ;\n w = 0.5"
+    for(i = 1; i < 70000; i++) printf(", %d.5", i)
+    print ", _ ;\n s = 1, 2 ;\n}"
+}' > tmp_ncgen_stream_big.cdl
+${NCGEN} -b -o tst_ncgen_stream_whole.nc < tmp_ncgen_stream_big.cdl
+${NCGEN} -D1 -b -o tst_ncgen_stream_out.nc tmp_ncgen_stream_big.cdl 2> tmp_ncgen_stream_trace.txt
+cmp tst_ncgen_stream_whole.nc tst_ncgen_stream_out.nc
+cat tmp_ncgen_stream_trace.txt
+# v: three blocks of 6554 records, with the rest written at the end
+test `grep -c '^v: wrote records' tmp_ncgen_stream_trace.txt` = 3
+grep -F 'v: wrote records 13108..19661 (65540 values)' tmp_ncgen_stream_trace.txt > /dev/null
+test `grep -c '^w: wrote records' tmp_ncgen_stream_trace.txt` = 1
+if grep '^s: ' tmp_ncgen_stream_trace.txt ; then
+    echo "*** s should have been written as a whole"
+    exit 1
+fi
+
+echo "*** Testing groups after the data section give a netCDF-4 file..."
+cat > tmp_ncgen_stream_grp.cdl <<CDL
+netcdf tmp_ncgen_stream_grp {
+variables:
+	int v ; // group: in a comment
+	string s ;
+data:
+ v = 1 ;
+ s = "group: in a string" ;
+group: g {
+variables:
+	int w ;
+data:
+ w = 2 ;
+}
+}
+CDL
+if test "x$FEATURE_HDF5" = xyes ; then
+${NCGEN} -b -o tst_ncgen_stream_grp.nc tmp_ncgen_stream_grp.cdl
+test "`${NCDUMP} -k tst_ncgen_stream_grp.nc`" = "netCDF-4"
+${NCDUMP} tst_ncgen_stream_grp.nc > tmp_ncgen_stream.txt
+grep -F 'w = 2 ;' tmp_ncgen_stream.txt > /dev/null
+
+echo "*** Testing netCDF-4 data written in blocks..."
+awk 'BEGIN {
+    print "netcdf tmp_ncgen_stream_nc4 {"
+    print "types:\n\tbyte enum e_t {a = 1, b = 2} ;"
+    print "dimensions:\n\tn = 70000 ;"
+    print "variables:\n\te_t e(n) ;\n\tstring s(n) ;"
+    print "data:"
+    printf " e = a"
+    for(i = 1; i < 70000; i++) printf(", %s", (i % 3 ? "a" : "b"))
+    printf " ;\n s = \"s0\""
+    for(i = 1; i < 70000; i++) printf(", \"s%d\"", i)
+    print " ;\n}"
+}' > tmp_ncgen_stream_nc4.cdl
+${NCGEN} -b -o tst_ncgen_stream_whole.nc < tmp_ncgen_stream_nc4.cdl
+${NCGEN} -D1 -b -o tst_ncgen_stream_out.nc tmp_ncgen_stream_nc4.cdl 2> tmp_ncgen_stream_trace.txt
+test `grep -c 'wrote records 0..65535' tmp_ncgen_stream_trace.txt` = 2
+${NCDUMP} -n x tst_ncgen_stream_whole.nc > tmp_ncgen_stream_whole.txt
+${NCDUMP} -n x tst_ncgen_stream_out.nc > tmp_ncgen_stream_out.txt
+diff tmp_ncgen_stream_whole.txt tmp_ncgen_stream_out.txt
+fi
+
+echo "*** Testing no file is left after a syntax error in the data..."
+sed -e 's/ c = 0.5 ;/ c = 0.5 0.6 ;/' tmp_ncgen_stream.cdl > tmp_ncgen_stream_bad.cdl
+if ${NCGEN} -k nc3 -b -o tst_ncgen_stream_bad.nc tmp_ncgen_stream_bad.cdl ; then
+    echo "*** ncgen should have failed"
+    exit 1
+fi
+if test -f tst_ncgen_stream_bad.nc ; then
+    echo "*** ncgen left tst_ncgen_stream_bad.nc"
+    exit 1
+fi
+
+echo "*** Testing no file is left for a group after the data..."
+sed -e '$d' tmp_ncgen_stream.cdl > tmp_ncgen_stream_bad.cdl
+printf 'group: g {\n}\n}\n' >> tmp_ncgen_stream_bad.cdl
+${NCGEN} -k nc3 -b -o tst_ncgen_stream_bad.nc tmp_ncgen_stream_bad.cdl || true
+if test -f tst_ncgen_stream_bad.nc ; then
+    echo "*** ncgen left tst_ncgen_stream_bad.nc"
+    exit 1
+fi
+
+rm -f tst_ncgen_stream_*.nc tmp_ncgen_stream*
+echo "*** All ncgen streaming tests passed!"
+exit 0
@@ -0,0 +1,101 @@
+#!/bin/sh
+
+if test "x$srcdir" = x ; then srcdir=`pwd`; fi
+. ../test_common.sh
+
+# This shell script tests ncsum, which computes checksums of the
+# variables of a file, stores them, and checks them.
+set -e
+echo ""
+echo "*** Testing ncsum."
+
+rm -f tst_ncsum*.nc tmp_ncsum*
+cat > tmp_ncsum.cdl <<CDL
+netcdf tst_ncsum {
+dimensions:
+	t = UNLIMITED ;
+	x = 3 ;
+variables:
+	int i(t, x) ;
+	double d(x) ;
+	char c(x) ;
+	short s ;
+data:
+ i = 1, 2, 3, -1, -2, -3 ;
+ d = 0.5, 1, -2 ;
+ c = "abc" ;
+ s = 7 ;
+}
+CDL
+${NCGEN} -b -o tst_ncsum.nc tmp_ncsum.cdl
+
+echo "*** Testing checksums of all and of listed variables..."
+${NCSUM} tst_ncsum.nc > tmp_ncsum.txt
+test `wc -l < tmp_ncsum.txt` = 4
+grep -E '^[0-9a-f]{16}  /i$' tmp_ncsum.txt > /dev/null
+${NCSUM} -v d,/s tst_ncsum.nc > tmp_ncsum_v.txt
+grep -v '/i$' tmp_ncsum.txt | grep -v '/c$' | diff - tmp_ncsum_v.txt
+
+echo "*** Testing -j gives the same checksums..."
+${NCSUM} -j 3 tst_ncsum.nc | diff - tmp_ncsum.txt
+
+echo "*** Testing checksums stored with -a check OK with -c..."
+if ${NCSUM} -c tst_ncsum.nc | grep -v 'no checksum$' ; then
+    echo "*** no variable should have a checksum yet"
+    exit 1
+fi
+${NCSUM} -a tst_ncsum.nc > /dev/null
+${NCDUMP} -h tst_ncsum.nc | grep 'i:checksum_crc64 = "' > /dev/null
+${NCSUM} -c -j 2 tst_ncsum.nc > tmp_ncsum_c.txt
+test `grep -c ': OK$' tmp_ncsum_c.txt` = 4
+
+echo "*** Testing -c finds a changed value..."
+${NCDUMP} tst_ncsum.nc | sed -e 's/0.5, 1, -2/0.5, 1, -3/' > tmp_ncsum_bad.cdl
+${NCGEN} -b -o tst_ncsum_bad.nc tmp_ncsum_bad.cdl
+if ${NCSUM} -c tst_ncsum_bad.nc > tmp_ncsum_c.txt ; then
+    echo "*** -c should have failed"
+    exit 1
+fi
+grep '^/d: FAILED$' tmp_ncsum_c.txt > /dev/null
+test `grep -c ': OK$' tmp_ncsum_c.txt` = 3
+
+if test "x$FEATURE_HDF5" = xyes ; then
+echo "*** Testing checksums do not depend on format or compression..."
+${NCCOPY} -4 -d 5 -c i:1,2 tst_ncsum.nc tst_ncsum4.nc
+${NCSUM} tst_ncsum4.nc | diff - tmp_ncsum.txt
+${NCSUM} -c tst_ncsum4.nc > /dev/null
+
+echo "*** Testing chunk checksums are checked..."
+${NCSUM} -k -a tst_ncsum4.nc > tmp_ncsum_k.txt
+grep '/i  (4 chunks)$' tmp_ncsum_k.txt > /dev/null
+${NCDUMP} -h tst_ncsum4.nc | grep 'i:chunk_checksums_crc32 = ' > /dev/null
+${NCSUM} -c tst_ncsum4.nc > /dev/null
+${NCDUMP} tst_ncsum4.nc | sed -e 's/1, 2, 3,/1, 2, 4,/' > tmp_ncsum_bad.cdl
+${NCGEN} -k nc4 -b -o tst_ncsum4_bad.nc tmp_ncsum_bad.cdl
+${NCCOPY} -d 5 -c i:1,2 tst_ncsum4_bad.nc tst_ncsum4_bad2.nc
+if ${NCSUM} -c tst_ncsum4_bad2.nc > tmp_ncsum_c.txt ; then
+    echo "*** -c should have failed"
+    exit 1
+fi
+grep '^/i: FAILED (chunk 1)$' tmp_ncsum_c.txt > /dev/null
+
+echo "*** Testing chunk checksums in a netCDF-4 classic model file..."
+${NCCOPY} -7 -d 5 -c i:1,2 tst_ncsum.nc tst_ncsum7.nc
+${NCSUM} -k -a tst_ncsum7.nc > /dev/null
+${NCDUMP} -h tst_ncsum7.nc | grep 'i:chunk_checksums_crc32 = ' > /dev/null
+${NCDUMP} -h tst_ncsum7.nc | grep 'i:checksum_crc64 = "' > /dev/null
+${NCSUM} -c tst_ncsum7.nc > tmp_ncsum_c.txt
+test `grep -c ': OK$' tmp_ncsum_c.txt` = 4
+${NCDUMP} tst_ncsum7.nc | sed -e 's/1, 2, 3,/1, 2, 4,/' > tmp_ncsum_bad.cdl
+${NCGEN} -k nc7 -b -o tst_ncsum7_bad.nc tmp_ncsum_bad.cdl
+${NCCOPY} -d 5 -c i:1,2 tst_ncsum7_bad.nc tst_ncsum7_bad2.nc
+if ${NCSUM} -c tst_ncsum7_bad2.nc > tmp_ncsum_c.txt ; then
+    echo "*** -c should have failed"
+    exit 1
+fi
+grep '^/i: FAILED (chunk 1)$' tmp_ncsum_c.txt > /dev/null
+fi
+
+rm -f tst_ncsum*.nc tmp_ncsum*
+echo "*** All ncsum tests passed!"
+exit 0
@@ -0,0 +1,117 @@
+/* This is part of the netCDF package. Copyright 2018 University
+   Corporation for Atmospheric Research/Unidata.  See COPYRIGHT file for
+   conditions of use. See www.unidata.ucar.edu for more info.
+
+   Create a test file for nccopy whose stored chunks are not what
+   decompressing and recompressing them would give: the variable
+   declares deflate level 1, but its chunks hold level 9 streams. A
+   copy of the stored chunks keeps those bytes, a copy of the values
+   does not.
+*/
+
+#include "config.h"
+#include <nc_tests.h>
+#include "err_macros.h"
+#include <stdlib.h>
+#include <string.h>
+#include <netcdf.h>
+#include <netcdf_filter.h>
+
+#define FILENAME "tst_rawchunks.nc"
+#define TMPNAME "tst_rawchunks_tmp.nc"
+#define NDIMS 2
+#define DIM0_LEN 100
+#define DIM1_LEN 200
+#define CHUNK0 50
+#define CHUNK1 100
+#define VAR_NAME "v"
+
+/* Create var VAR_NAME in a new file, compressed at level, and write
+ * data to it. */
+static int
+create_var(const char *path, int level, const int *data, int *ncidp, int *varidp)
+{
+    int dimids[NDIMS];
+    size_t chunks[NDIMS] = {CHUNK0, CHUNK1};
+
+    if (nc_create(path, NC_CLOBBER|NC_NETCDF4, ncidp)) ERR;
+    if (nc_def_dim(*ncidp, "x", DIM0_LEN, &dimids[0])) ERR;
+    if (nc_def_dim(*ncidp, "y", DIM1_LEN, &dimids[1])) ERR;
+    if (nc_def_var(*ncidp, VAR_NAME, NC_INT, NDIMS, dimids, varidp)) ERR;
+    if (nc_def_var_chunking(*ncidp, *varidp, NC_CHUNKED, chunks)) ERR;
+    if (nc_def_var_deflate(*ncidp, *varidp, 0, 1, level)) ERR;
+    if (nc_enddef(*ncidp)) ERR;
+    if (nc_put_var_int(*ncidp, *varidp, data)) ERR;
+    return 0;
+}
+
+int
+main(int argc, char **argv)
+{
+    int ncid, varid, tmpid, tmpvarid;
+    int *data;
+    size_t start[NDIMS];
+    size_t size1, size9;
+    char *buf1, *buf9;
+    int ndiffer = 0;
+    int i, stat;
+
+    printf("*** Creating test file %s with level 9 chunks in a level 1 variable...", FILENAME);
+    if (!(data = malloc(DIM0_LEN * DIM1_LEN * sizeof(int)))) ERR;
+    for (i = 0; i < DIM0_LEN * DIM1_LEN; i++)
+	data[i] = (i * 7919) % 251 + (i / 97);
+
+    if (create_var(TMPNAME, 9, data, &tmpid, &tmpvarid)) ERR;
+    if (nc_sync(tmpid)) ERR;
+    if (create_var(FILENAME, 1, data, &ncid, &varid)) ERR;
+    if (nc_sync(ncid)) ERR;
+
+    /* Without raw chunk access there is nothing to test. */
+    start[0] = start[1] = 0;
+    if ((stat = nc_get_var_chunk_raw(ncid, varid, start, &size1, NULL)) == NC_ENOTBUILT) {
+	printf("skipped, no raw chunk access\n");
+	if (nc_close(ncid)) ERR;
+	if (nc_close(tmpid)) ERR;
+	remove(FILENAME);
+	remove(TMPNAME);
+	free(data);
+	FINAL_RESULTS;
+    }
+    if (stat) ERR;
+
+    for (start[0] = 0; start[0] < DIM0_LEN; start[0] += CHUNK0) {
+	for (start[1] = 0; start[1] < DIM1_LEN; start[1] += CHUNK1) {
+	    if (nc_get_var_chunk_raw(ncid, varid, start, &size1, NULL)) ERR;
+	    if (nc_get_var_chunk_raw(tmpid, tmpvarid, start, &size9, NULL)) ERR;
+	    if (!(buf1 = malloc(size1))) ERR;
+	    if (!(buf9 = malloc(size9))) ERR;
+	    if (nc_get_var_chunk_raw(ncid, varid, start, &size1, buf1)) ERR;
+	    if (nc_get_var_chunk_raw(tmpid, tmpvarid, start, &size9, buf9)) ERR;
+	    if (size1 != size9 || memcmp(buf1, buf9, size1))
+		ndiffer++;
+	    if (nc_put_var_chunk_raw(ncid, varid, start, size9, buf9)) ERR;
+	    free(buf1);
+	    free(buf9);
+	}
+    }
+    /* Level 1 and level 9 must give different chunks, or a value
+     * copy could not be told from a chunk copy. */
+    if (ndiffer == 0) ERR;
+    if (nc_close(tmpid)) ERR;
+    if (nc_close(ncid)) ERR;
+    remove(TMPNAME);
+
+    /* The values are the same. */
+    {
+	int *back;
+	if (!(back = malloc(DIM0_LEN * DIM1_LEN * sizeof(int)))) ERR;
+	if (nc_open(FILENAME, NC_NOWRITE, &ncid)) ERR;
+	if (nc_get_var_int(ncid, varid, back)) ERR;
+	if (memcmp(back, data, DIM0_LEN * DIM1_LEN * sizeof(int))) ERR;
+	if (nc_close(ncid)) ERR;
+	free(back);
+    }
+    free(data);
+    SUMMARIZE_ERR;
+    FINAL_RESULTS;
+}
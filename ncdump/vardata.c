@@ -34,6 +34,10 @@ extern fspec_t formatting_specs; /* set from command-line options */
   than this */
 #define VALBUFSIZ 10000
 
+/* Read rows of values along the last dimension in blocks of up to
+  this many bytes */
+#define ROWBUFSIZ 1048576
+
 static int linep;		/* line position, not counting global indent */
 static int max_line_len;	/* max chars per line, not counting global indent */
 
@@ -76,6 +80,68 @@ lput(const char *cp) {
 }
 
 
+/*
+ * Like lput(), but append the nn chars of cp to the line buffer lb
+ * instead of writing them out, so that a row of values is written
+ * out at once with lflush().
+ */
+static void
+lbput(safebuf_t *lb, const char *cp, size_t nn) {
+    if (nn + (size_t)linep > (size_t)max_line_len && nn > 2) {
+	static const char blanks[] = "        ";
+	int ind = indent_get();
+	sbuf_catn(lb, "\n", 1);
+	for(; ind > 0; ind -= (int)strlen(blanks))
+	    sbuf_catn(lb, blanks, (size_t)ind < strlen(blanks) ? (size_t)ind : strlen(blanks));
+	sbuf_catn(lb, LINEPIND, strlen(LINEPIND));
+	linep = (int)strlen(LINEPIND) + indent_get();
+    }
+    sbuf_catn(lb, cp, nn);
+    if (nn > 0 && cp[nn - 1] == '\n') {
+	linep = indent_get();
+    } else
+	linep += (int)nn;
+}
+
+/* Write out and empty the line buffer lb */
+static void
+lflush(safebuf_t *lb) {
+    (void) fwrite(sbuf_str(lb), 1, sbuf_len(lb), stdout);
+    sbuf_clear(lb);
+}
+
+/* Line buffer of the row being printed, if any.  If ncdump exits on
+ * an error part way through a row, e.g. for a bad enum value, the
+ * values before the error are still written out, as lput() would. */
+static safebuf_t *pending_lb = NULL;
+
+static void
+lflush_pending(void) {
+    if (pending_lb != NULL)
+	lflush(pending_lb);
+}
+
+/* Return a new line buffer, which is written out at exit */
+static safebuf_t *
+lbnew(void) {
+    static bool_t registered = false;
+    if (!registered) {
+	(void) atexit(lflush_pending);
+	registered = true;
+    }
+    pending_lb = sbuf_new();
+    return pending_lb;
+}
+
+/* Free a line buffer from lbnew() */
+static void
+lbfree(safebuf_t *lb) {
+    if (lb == pending_lb)
+	pending_lb = NULL;
+    sbuf_free(lb);
+}
+
+
 /*--------------------------------------------------------------------------*/
 
 /* Support function for print_att_times.
@@ -414,6 +480,74 @@ upcorner(
     return ret;
 }
 
+/*
+ * Print a row of values along the last dimension of a variable, or
+ * the value of a scalar variable, already read into vals, followed by
+ * marks_pending closing "}" record markers.
+ */
+static void
+print_row(
+    const ncvar_t *vp,	/* variable */
+    size_t vdims[],    	/* variable dimension sizes */
+    size_t cor[],      	/* corner coordinates of the row */
+    void *vals,   	/* values in the row */
+    int marks_pending,	/* number of pending closing "}" record markers */
+    safebuf_t *sb,	/* for formatting a value */
+    safebuf_t *lb	/* line buffer */
+    )
+{
+    int rank = vp->ndims;
+    size_t ncols = rank > 0 ? vdims[rank - 1] : 1; /* number of values in a row */
+    int d0 = rank > 0 ? (int)vdims[rank - 1] : 0;
+    char *valp = vals;
+    bool_t lastrow;
+    int i, j;
+
+    if(formatting_specs.brief_data_cmnts && rank > 1 && ncols > 0) {
+	annotate_brief(vp, cor, vdims);
+    }
+
+    /* Test if we should treat array of chars as strings along last dimension  */
+    if(vp->type == NC_CHAR && (vp->fmt == 0 || NCSTREQ(vp->fmt,"%s") || NCSTREQ(vp->fmt,""))) {
+	pr_tvals(vp, ncols, vals, cor);
+	sbuf_cpy(sb, "");
+    } else {			/* for non-text variables */
+	for(i=0; i < d0 - 1; i++) {
+	    print_any_val(sb, vp, (void *)valp);
+	    valp += vp->tinfo->size; /* next value according to type */
+	    if (formatting_specs.full_data_cmnts) {
+		printf("%s, ", sb->buf);
+		annotate (vp, cor, i);
+	    } else {
+		sbuf_catn(sb, ", ", 2);
+		lbput(lb, sbuf_str(sb), sbuf_len(sb));
+	    }
+	}
+	print_any_val(sb, vp, (void *)valp);
+    }
+
+    /* determine if this is the last row */
+    lastrow = true;
+    for(j = 0; j < rank - 1; j++) {
+	if (cor[j] != vdims[j] - 1) {
+	    lastrow = false;
+	    break;
+	}
+    }
+    for (j = 0; j < marks_pending; j++) {
+	sbuf_cat(sb, RBRACE);
+    }
+    if (formatting_specs.full_data_cmnts) {
+	printf("%s", sbuf_str(sb));
+	lastdelim (0, lastrow);
+	annotate (vp, cor, (d0 > 0 ? d0-1 : d0));
+    } else {
+	lbput(lb, sbuf_str(sb), sbuf_len(sb));
+	lflush(lb);
+	lastdelim2 (0, lastrow);
+    }
+}
+
 /*  Print data values for variable varid.
  *
  * Recursive to handle possibility of variables with multiple
@@ -430,22 +564,18 @@ print_rows(
     size_t vdims[],    	/* variable dimension sizes */
     size_t cor[],      	/* corner coordinates */
     size_t edg[],      	/* edges of hypercube */
-    void *vals,   	/* allocated buffer for ncols values in a row */
+    void *vals,   	/* allocated buffer for maxrows rows of values */
+    size_t maxrows,	/* number of rows read at a time */
     int marks_pending	/* number of pending closing "}" record markers */
     )
 {
     int rank = vp->ndims;
     size_t ncols = rank > 0 ? vdims[rank - 1] : 1; /* number of values in a row */
     int d0 = 0;
-    size_t inc = 1;
     int i;
     bool_t mark_record = (level > 0 && is_unlim_dim(ncid, vp->dims[level]));
-    safebuf_t *sb = sbuf_new();
     if (rank > 0)
 	d0 = vdims[level];
-    for(i = level + 1; i < rank; i++) {
-	inc *= vdims[i];
-    }
     if(mark_record) { /* the whole point of this recursion is printing these "{}" */
 	lput(LBRACE);
 	marks_pending++;	/* matching "}"s to emit after last "row" */
@@ -459,68 +589,53 @@ print_rows(
 	}
 	local_cor[level] = 0;
 	local_edg[level] = 1;
-	for(i = 0; i < d0 - 1; i++) {
+	if(rank - level > 2) {
+	    for(i = 0; i < d0 - 1; i++) {
+		print_rows(level + 1, ncid, varid, vp, vdims,
+			   local_cor, local_edg, vals, maxrows, 0);
+		local_cor[level] += 1;
+	    }
 	    print_rows(level + 1, ncid, varid, vp, vdims,
-		       local_cor, local_edg, vals, 0);
-	    local_cor[level] += 1;
+		       local_cor, local_edg, vals, maxrows, marks_pending);
+	} else {		/* the next level is rows, read maxrows at a time */
+	    bool_t mark_row = is_unlim_dim(ncid, vp->dims[level + 1]);
+	    safebuf_t *sb = sbuf_new();
+	    safebuf_t *lb = lbnew();
+	    size_t row, nrows, k;
+	    for(row = 0; row < (size_t)d0; row += nrows) {
+		nrows = (size_t)d0 - row < maxrows ? (size_t)d0 - row : maxrows;
+		local_cor[level] = row;
+		local_edg[level] = nrows;
+		NC_CHECK(nc_get_vara(ncid, varid, local_cor, local_edg, vals));
+		for(k = 0; k < nrows; k++) {
+		    int marks = (row + k == (size_t)d0 - 1) ? marks_pending : 0;
+		    local_cor[level] = row + k;
+		    if(mark_row) {
+			lput(LBRACE);
+			marks++;
+		    }
+		    print_row(vp, vdims, local_cor,
+			      (char *)vals + k * ncols * vp->tinfo->size,
+			      marks, sb, lb);
+		}
+		/* In case vals has memory hanging off e.g. vlen or string, make sure to reclaim it */
+		NC_CHECK(nc_reclaim_data(ncid,vp->type,vals,nrows * ncols));
+	    }
+	    lbfree(lb);
+	    sbuf_free(sb);
 	}
-	print_rows(level + 1, ncid, varid, vp, vdims,
-		   local_cor, local_edg, vals, marks_pending);
 	free(local_edg);
 	free(local_cor);
     } else {			/* bottom out of recursion */
-	char *valp = vals;
-	bool_t lastrow;
-	int j;
-	if(formatting_specs.brief_data_cmnts && rank > 1 && ncols > 0) {
-	    annotate_brief(vp, cor, vdims);
-	}
-	NC_CHECK(nc_get_vara(ncid, varid, cor, edg, (void *)valp));
-
-	/* Test if we should treat array of chars as strings along last dimension  */
-	if(vp->type == NC_CHAR && (vp->fmt == 0 || NCSTREQ(vp->fmt,"%s") || NCSTREQ(vp->fmt,""))) {
-	    pr_tvals(vp, ncols, vals, cor);
-	} else {			/* for non-text variables */
-	    for(i=0; i < d0 - 1; i++) {
-		print_any_val(sb, vp, (void *)valp);
-		valp += vp->tinfo->size; /* next value according to type */
-		if (formatting_specs.full_data_cmnts) {
-		    printf("%s, ", sb->buf);
-		    annotate (vp, cor, i);
-		} else {
-		    sbuf_cat(sb, ", ");
-		    lput(sbuf_str(sb));
-		}
-	    }
-	    print_any_val(sb, vp, (void *)valp);
-	}
+	safebuf_t *sb = sbuf_new();
+	safebuf_t *lb = lbnew();
+	NC_CHECK(nc_get_vara(ncid, varid, cor, edg, vals));
+	print_row(vp, vdims, cor, vals, marks_pending, sb, lb);
         /* In case vals has memory hanging off e.g. vlen or string, make sure to reclaim it */
         NC_CHECK(nc_reclaim_data(ncid,vp->type,vals,ncols));
-
-	/* determine if this is the last row */
-	lastrow = true;
-	for(j = 0; j < rank - 1; j++) {
-            if (cor[j] != vdims[j] - 1) {
-		lastrow = false;
-		break;
-            }
-	}
-	if (formatting_specs.full_data_cmnts) {
-      for (j = 0; j < marks_pending; j++) {
-		sbuf_cat(sb, RBRACE);
-      }
-      printf("%s", sbuf_str(sb));
-      lastdelim (0, lastrow);
-      annotate (vp, cor, (d0 > 0 ? d0-1 : d0));
-	} else {
-            for (j = 0; j < marks_pending; j++) {
-		sbuf_cat(sb, RBRACE);
-            }
-      	    lput(sbuf_str(sb));
-            lastdelim2 (0, lastrow);
-	}
+	lbfree(lb);
+	sbuf_free(sb);
     }
-    sbuf_free(sb);
     return NC_NOERR;
 }
 
@@ -541,6 +656,7 @@ vardata(
     int id;
     size_t nels;
     size_t ncols;
+    size_t maxrows = 1;	     /* rows read at a time */
     int vrank = vp->ndims;
 
     int level = 0;
@@ -583,9 +699,14 @@ vardata(
 	if (vrank > 1)
 	  add[vrank-2] = 1;
     }
-    vals = emalloc(ncols * vp->tinfo->size);
+    if (vrank > 1 && ncols * vp->tinfo->size < ROWBUFSIZ) {
+	maxrows = ROWBUFSIZ / (ncols * vp->tinfo->size);
+	if (maxrows > vdims[vrank-2])
+	    maxrows = vdims[vrank-2];
+    }
+    vals = emalloc(maxrows * ncols * vp->tinfo->size);
 
-    NC_CHECK(print_rows(level, ncid, varid, vp, vdims, cor, edg, vals, marks_pending));
+    NC_CHECK(print_rows(level, ncid, varid, vp, vdims, cor, edg, vals, maxrows, marks_pending));
     free(vals);
     free(cor);
     free(edg);
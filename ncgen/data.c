@@ -690,6 +690,24 @@ builddatasubset(Datalist* dl, size_t start, size_t count)
     return subset;
 }
 
+/* Remove the first count constants of a datalist
+   and return them as a datalist of their own */
+Datalist*
+dlshift(Datalist* dl, size_t count)
+{
+    Datalist* head;
+
+    if(dl->readonly) abort();
+    if(count > datalistlen(dl))
+        count = datalistlen(dl);
+    head = builddatalist((int)count);
+    memcpy(head->data,dl->data,count*sizeof(NCConstant*));
+    head->length = count;
+    memmove(dl->data,&dl->data[count],(dl->length - count)*sizeof(NCConstant*));
+    dl->length -= count;
+    return head;
+}
+
 /* Deep copy */
 Datalist*
 clonedatalist(Datalist* dl)
@@ -77,6 +77,7 @@ extern void dlset(Datalist*, size_t, NCConstant*);
 extern NCConstant* dlremove(Datalist*, size_t);
 extern NCConstant* builddatasublist(Datalist* dl);
 extern Datalist* builddatasubset(Datalist* dl, size_t start, size_t count);
+extern Datalist* dlshift(Datalist* dl, size_t count);
 extern void dlextend(Datalist* dl);
 extern void dlsetalloc(Datalist* dl,size_t);
 extern Datalist* clonedatalist(Datalist* dl);
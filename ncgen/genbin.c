@@ -13,9 +13,18 @@
 
 #undef TRACE
 
+/* The data of a variable being parsed is written once its whole
+   records hold at least this many values (see genbin_streamvarblock) */
+#define STREAMBLOCK (1<<16)
+
+static Symbol* streamvar = NULL; /* variable whose data is being parsed */
+static List* streamedvars = NULL; /* variables whose data was written */
+
 /* Forward*/
 static int genbin_defineattr(int ncid, Symbol* asym);
 static int genbin_definevardata(int ncid, Symbol* vsym);
+static int genbin_writerecords(Symbol* vsym, size_t first, size_t count);
+static int genbin_fillrecords(Symbol* vsym, size_t first, size_t count);
 static int genbin_write(Generator*,Symbol*,Bytebuffer*,int,size_t*,size_t*);
 static int genbin_writevar(Generator*,Symbol*,Bytebuffer*,int,size_t*,size_t*);
 static int genbin_writeattr(Generator*,Symbol*,Bytebuffer*,int,size_t*,size_t*);
@@ -285,6 +294,17 @@ genbin_close(void)
     CHECK_ERR(stat);
 }
 
+/* Abort a file that was defined while parsing (see startdata in
+   main.c) after an error, and remove it, so that no file is left
+   with only part of its data, as none is left when the whole CDL is
+   parsed first. */
+void
+genbin_abort(void)
+{
+    (void)nc_abort(rootgroup->nc_id);
+    (void)remove(rootgroup->file.filename);
+}
+
 #ifdef USE_NETCDF4
 /*
 Generate type definitions
@@ -391,6 +411,157 @@ genbin_defineattr(int ncid, Symbol* asym)
 }
 
 
+/* Called by the parser before the data of a variable */
+void
+genbin_startvardata(Symbol* vsym)
+{
+    streamvar = vsym;
+    vsym->var.nrecs = 0;
+}
+
+/* Called by the parser after each value of the data of a variable
+   (data) that is not enclosed in {...}. Once the whole records parsed
+   hold at least STREAMBLOCK values, they are written and freed, so
+   that the data held in memory is bounded even for a single large
+   variable. This needs each value to be one element of the variable,
+   so char variables, whose strings fill many elements, and variables
+   with an unlimited dimension other than the first, whose sizes are
+   only known at the end, are written as a whole.
+*/
+void
+genbin_streamvarblock(Datalist* data)
+{
+    Symbol* vsym = streamvar;
+    Dimset* dimset;
+    Symbol* dim;
+    size_t recsize, count;
+
+    if(vsym == NULL || error_count > 0 || vsym->container != rootgroup)
+        return;
+    dimset = &vsym->typ.dimset;
+    if(dimset->ndims == 0 || vsym->typ.basetype->typ.typecode == NC_CHAR
+       || findunlimited(dimset,1) < dimset->ndims)
+        return;
+    recsize = crossproduct(dimset,1,dimset->ndims);
+    count = datalistlen(data) / recsize;
+    if(count * recsize < STREAMBLOCK)
+        return;
+    dim = dimset->dimsyms[0];
+    if(!dim->dim.isunlimited) {
+        /* Values beyond the end are ignored, as when written as a whole */
+        if(vsym->var.nrecs + count > dim->dim.declsize)
+            count = dim->dim.declsize - vsym->var.nrecs;
+        if(count == 0)
+            return;
+    }
+    vsym->data = dlshift(data,count*recsize);
+    processstreamedvardata(vsym,vsym->var.nrecs);
+    genbin_writerecords(vsym,vsym->var.nrecs,count);
+    reclaimdatalist(vsym->data);
+    vsym->data = NULL;
+    vsym->var.nrecs += count;
+    if(debug > 0)
+        fdebug("%s: wrote records %lu..%lu (%lu values)\n",vsym->name,
+               (unsigned long)(vsym->var.nrecs - count),
+               (unsigned long)(vsym->var.nrecs - 1),
+               (unsigned long)(count * recsize));
+}
+
+/* Write the rest of the data of a variable as soon as it is parsed,
+   and free it (see startdata in main.c). Records of the variables
+   written earlier that lie beyond their data are left to the fill mode
+   of the file, or are written by genbin_streamfinish.
+*/
+void
+genbin_streamvardata(Symbol* vsym)
+{
+    Symbol* dim;
+
+    streamvar = NULL;
+    /* Data for a group that followed is an error, reported at the end */
+    if(error_count > 0 || vsym->container != rootgroup || vsym->data == NULL)
+        return;
+    processstreamedvardata(vsym,vsym->var.nrecs);
+    if(vsym->var.nrecs == 0)
+        genbin_definevardata(rootgroup->nc_id,vsym);
+    else {
+        dim = vsym->typ.dimset.dimsyms[0];
+        genbin_writerecords(vsym,vsym->var.nrecs,dim->dim.declsize - vsym->var.nrecs);
+    }
+    reclaimdatalist(vsym->data);
+    vsym->data = NULL;
+    if(vsym->typ.dimset.ndims > 0)
+        vsym->var.nrecs = vsym->typ.dimset.dimsyms[0]->dim.declsize;
+    if(streamedvars == NULL) streamedvars = listnew();
+    listpush(streamedvars,vsym);
+}
+
+/* Called before closing a file whose data was written as it was
+   parsed. Without fill, the records beyond the data of a variable
+   that were added by the variables that followed are written with
+   the fill value, as they are when the whole CDL is parsed first.
+*/
+void
+genbin_streamfinish(void)
+{
+    int i;
+    for(i=0;i<listlength(streamedvars);i++) {
+        Symbol* vsym = (Symbol*)listget(streamedvars,(unsigned long)i);
+        Specialdata* special = &vsym->var.special;
+        Symbol* dim;
+        if(vsym->typ.dimset.ndims == 0) continue;
+        if(!nofill_flag && !((special->flags & _NOFILL_FLAG) && !special->_Fill))
+            continue;
+        dim = vsym->typ.dimset.dimsyms[0];
+        if(dim->dim.isunlimited && vsym->var.nrecs < dim->dim.declsize)
+            genbin_fillrecords(vsym,vsym->var.nrecs,dim->dim.declsize - vsym->var.nrecs);
+    }
+    listfree(streamedvars);
+    streamedvars = NULL;
+}
+
+/* Write count records of a variable from its data, starting at first */
+static int
+genbin_writerecords(Symbol* vsym, size_t first, size_t count)
+{
+    Bytebuffer* databuf = bbNew();
+    generator_reset(bin_generator,rootgroup);
+    generate_vardata_records(vsym,first,count,bin_generator,(Writer)genbin_write,databuf);
+    bbFree(databuf);
+    return NC_NOERR;
+}
+
+/* Write count records of a variable with its fill value, starting at first */
+static int
+genbin_fillrecords(Symbol* vsym, size_t first, size_t count)
+{
+    int stat = NC_NOERR;
+    Dimset* dimset = &vsym->typ.dimset;
+    Symbol* basetype = vsym->typ.basetype;
+    Bytebuffer* databuf = bbNew();
+    size_t start[NC_MAX_VAR_DIMS];
+    size_t edges[NC_MAX_VAR_DIMS];
+    size_t recsize = crossproduct(dimset,1,dimset->ndims);
+    size_t i;
+    int j;
+
+    generator_reset(bin_generator,rootgroup);
+    for(i=0;i<recsize;i++)
+        generate_basetype(basetype,NULL,databuf,getfiller(vsym),bin_generator);
+    for(j=0;j<dimset->ndims;j++) {
+        start[j] = 0;
+        edges[j] = (j == 0 ? 1 : dimset->dimsyms[j]->dim.declsize);
+    }
+    for(i=0;i<count;i++) {
+        start[0] = first + i;
+        stat = nc_put_vara(rootgroup->nc_id,vsym->nc_id,start,edges,bbContents(databuf));
+        CHECK_ERR(stat);
+    }
+    stat = nc_reclaim_data(rootgroup->nc_id,basetype->nc_id,bbContents(databuf),recsize);
+    bbFree(databuf);
+    return stat;
+}
+
 /* Following is patterned after the walk functions in semantics.c */
 static int
 genbin_definevardata(int ncid, Symbol* vsym)
@@ -401,7 +572,6 @@ genbin_definevardata(int ncid, Symbol* vsym)
     databuf = bbNew();
     generator_reset(bin_generator,rootgroup);
     generate_vardata(vsym,bin_generator,(Writer)genbin_write,databuf);
-    stat = nc_reclaim_data(ncid,vsym->typ.basetype->nc_id,bbContents(databuf),datalistlen(vsym->data));
 done:
     bbFree(databuf);
     return stat;
@@ -455,6 +625,9 @@ genbin_writevar(Generator* generator, Symbol* vsym, Bytebuffer* memory,
         stat = nc_put_vara(vsym->container->nc_id, vsym->nc_id, start, count, data);
     }
     CHECK_ERR(stat);
+    /* Reclaim the written data */
+    stat = nc_reclaim_data(vsym->container->nc_id,vsym->typ.basetype->nc_id,data,nelems);
+    CHECK_ERR(stat);
     return stat;
 }
 
@@ -13,7 +13,7 @@
 /* For datalist constant rules: see the rules on the man page */
 
 /* Forward*/
-static void generate_array(Symbol*,Bytebuffer*,Datalist*,Generator*,Writer);
+static void generate_array(Symbol*,Bytebuffer*,Datalist*,Generator*,Writer,size_t,size_t);
 static void generate_primdata(Symbol*, NCConstant*, Bytebuffer*, Datalist* fillsrc, Generator*);
 static void generate_fieldarray(Symbol*, NCConstant*, Dimset*, Bytebuffer*, Datalist* fillsrc, Generator*);
 
@@ -87,10 +87,22 @@ generate_vardata(Symbol* vsym, Generator* generator, Writer writer, Bytebuffer*
         generate_basetype(basetype,c0,code,filler,generator);
         writer(generator,vsym,code,0,NULL,NULL);
     } else {/*rank > 0*/
-	generate_array(vsym,code,filler,generator,writer);
+	generate_array(vsym,code,filler,generator,writer,0,dimset->dimsyms[0]->dim.declsize);
     }
 }
 
+/* Generate count records of a var, starting at record first of its
+   first dimension, from a datalist (vsym->data) holding only those
+   records; used to write the data of a var in blocks as it is parsed. */
+void
+generate_vardata_records(Symbol* vsym, size_t first, size_t count,
+                         Generator* generator, Writer writer, Bytebuffer* code)
+{
+    if(vsym->data == NULL || count == 0) return;
+    ASSERT(vsym->typ.dimset.ndims > 0);
+    generate_array(vsym,code,getfiller(vsym),generator,writer,first,count);
+}
+
 /* Generate an instance of the basetype using the value of con*/
 void
 generate_basetype(Symbol* tsym, NCConstant* con, Bytebuffer* codebuf, Datalist* filler, Generator* generator)
@@ -366,6 +378,7 @@ struct Args {
     Writer writer;
     Bytebuffer* code;
     Datalist* filler;
+    size_t first; /* first record of the first dimension */
     size_t dimsizes[NC_MAX_VAR_DIMS];
     size_t chunksizes[NC_MAX_VAR_DIMS];
 };
@@ -414,14 +427,16 @@ generate_arrayR(struct Args* args, int dimindex, size_t* index, Datalist* data)
 	        ASSERT(islistconst(con));
 	        if(islistconst(con)) subdata = compoundfor(con);
 	    }
-            index[dimindex] = counter;
+            index[dimindex] = (dimindex == 0 ? args->first : 0) + counter;
             generate_arrayR(args,dimindex+1,index,subdata); /* recurse */
         }
     }
 }
 
+/* Generate records first..first+count-1 of the first dimension */
 static void
-generate_array(Symbol* vsym, Bytebuffer* code, Datalist* filler, Generator* generator, Writer writer)
+generate_array(Symbol* vsym, Bytebuffer* code, Datalist* filler, Generator* generator, Writer writer,
+               size_t first, size_t count)
 {
     int i;
     size_t index[NC_MAX_VAR_DIMS];
@@ -440,12 +455,13 @@ generate_array(Symbol* vsym, Bytebuffer* code, Datalist* filler, Generator* gene
     args.rank = args.dimset->ndims;
     args.storage = vsym->var.special._Storage;
     args.typecode = vsym->typ.basetype->typ.typecode;
+    args.first = first;
 
     assert(args.rank > 0);
 
     totalsize = 1; /* total # elements in the array */
     for(i=0;i<args.rank;i++) {
-        args.dimsizes[i] = args.dimset->dimsyms[i]->dim.declsize;
+        args.dimsizes[i] = (i == 0 ? count : args.dimset->dimsyms[i]->dim.declsize);
 	totalsize *= args.dimsizes[i];
     }
     nunlimited = countunlimited(args.dimset);
@@ -456,9 +472,11 @@ generate_array(Symbol* vsym, Bytebuffer* code, Datalist* filler, Generator* gene
     }	
 
     memset(index,0,sizeof(index));
+    index[0] = first;
 
     /* Special case for NC_CHAR */
     if(args.typecode == NC_CHAR) {
+        ASSERT(first == 0);
         size_t start[NC_MAX_VAR_DIMS];
         size_t count[NC_MAX_VAR_DIMS];
         Bytebuffer* charbuf = bbNew();
@@ -474,7 +492,7 @@ generate_array(Symbol* vsym, Bytebuffer* code, Datalist* filler, Generator* gene
 
     /* If the total no. of elements is less than some max and no unlimited,
        then generate a single vara that covers the whole array */
-    if(totalsize <= wholevarsize && nunlimited == 0) {
+    if(totalsize <= wholevarsize && nunlimited == 0 && first == 0) {
 	Symbol* basetype = args.vsym->typ.basetype;
 	size_t counter;
 	int uid;
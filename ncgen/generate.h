@@ -56,6 +56,7 @@ typedef int (*Writer)(Generator*,struct Symbol*,Bytebuffer*,int,const size_t*,co
 
 extern void generate_attrdata(struct Symbol*, Generator*, Writer writer, Bytebuffer*);
 extern void generate_vardata(struct Symbol*, Generator*, Writer writer, Bytebuffer*);
+extern void generate_vardata_records(struct Symbol*, size_t, size_t, Generator*, Writer writer, Bytebuffer*);
 extern void generate_basetype(struct Symbol*,NCConstant*,Bytebuffer*,Datalist*,Generator*);
 
 #endif /*DATA_H*/
@@ -95,6 +95,7 @@ extern unsigned int convertFilterID(const char* id);
 
 /* from: semantic.c */
 extern  void processsemantics(void);
+extern  void processstreamedvardata(Symbol* vsym, size_t nrecs);
 extern  size_t nctypesize(nc_type);
 extern  Symbol* locate(Symbol* refsym);
 extern  Symbol* lookup(nc_class objectclass, Symbol* pattern);
@@ -117,6 +118,11 @@ extern char* indented(int n);
 extern Generator* bin_generator;
 extern void genbin_netcdf(void);
 extern void genbin_close(void);
+extern void genbin_abort(void);
+extern void genbin_startvardata(Symbol* vsym);
+extern void genbin_streamvarblock(Datalist* data);
+extern void genbin_streamvardata(Symbol* vsym);
+extern void genbin_streamfinish(void);
 /* from: bindata.c */
 extern int binary_generate_data(Datalist* data, Symbol* tsym, Datalist* fillvalue, Bytebuffer* databuf);
 extern int binary_reclaim_data(Symbol* tsym, void* memory, size_t count);
@@ -166,6 +172,7 @@ extern int usingclassic;   /* 1 => k_flag == 1|2|5 */
 extern int k_flag;
 extern int ncloglevel;
 extern int wholevarsize;
+extern int streaming;
 extern GlobalSpecialData globalspecials;
 
 /* Global data */
@@ -207,6 +214,7 @@ extern const char* specialname(int tag);
 
 extern void init_netcdf(void);
 extern void finalize_netcdf(int);
+extern void startdata(void);
 extern void parse_init(void);
 extern int ncgparse(void);
 
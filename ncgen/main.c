@@ -44,6 +44,9 @@ int cmode_modifier;
 int diskless;
 int ncloglevel;
 int wholevarsize;
+int streaming; /* 1 => var data is written as it is parsed */
+static int semanticsdone; /* 1 => semantics processed before the end of the parse */
+static char* inputpath; /* CDL input file; NULL => stdin */
 
 GlobalSpecialData globalspecials;
 
@@ -61,6 +64,9 @@ extern FILE *ncgin;
 
 /* Forward */
 static char* ubasename(char*);
+static int chooseformat(void);
+static int cdlhasgroups(void);
+static void abort_netcdf(void);
 void usage( void );
 
 int main( int argc, char** argv );
@@ -206,9 +212,11 @@ main(
     opterr = 1;			/* print error message if bad option */
     progname = nulldup(ubasename(argv[0]));
     cdlname = NULL;
+    inputpath = NULL;
     netcdf_name = NULL;
     datasetname = NULL;
     l_flag = 0;
+    streaming = 0;
     nofill_flag = 0;
     syntax_only = 0;
     header_only = 0;
@@ -436,6 +444,7 @@ main(
 	    perror("");
 	    return(7);
 	}
+	inputpath = argv[0];
    	/* Check the leading bytes for an occurrence of a BOM */
         /* re: http://www.unicode.org/faq/utf_bom.html#BOM */
 	/* Attempt to read the first four bytes */
@@ -469,11 +478,44 @@ main(
     parse_init();
     ncgin = fp;
     if(debug >= 2) {ncgdebug=1;}
-    if(ncgparse() != 0)
+    if(ncgparse() != 0) {
+        if(streaming) abort_netcdf();
         return 1;
+    }
 
-    /* Compute the k_flag (1st pass) using rules in the man page (ncgen.1).*/
+    if(!semanticsdone) {
+        if(!chooseformat())
+            return 0;
+        processsemantics();
+        if(!syntax_only && error_count == 0)
+            define_netcdf();
+    } else {
+        /* The file was defined, and its data written, while parsing */
+        if(streaming) {
+            /* complain of any groups that followed */
+            if(!chooseformat() || error_count > 0)
+                abort_netcdf();
+            else {
+                genbin_streamfinish();
+                close_netcdf();
+            }
+        }
+        cleanup();
+    }
 
+done:
+    nullfree(netcdf_name);
+    nullfree(datasetname);
+    finalize_netcdf(code);
+    return code;
+}
+
+/* Compute the k_flag, usingclassic and cmode_modifier
+   using rules in the man page (ncgen.1).
+   Return 0 if the -k flag conflicts with the CDL input. */
+static int
+chooseformat(void)
+{
 #ifndef ENABLE_CDF5
     if(k_flag == NC_FORMAT_CDF5) {
       derror("Output format CDF5 requested, but netcdf was built without cdf5 support.");
@@ -553,15 +595,123 @@ main(
     if(diskless)
 	cmode_modifier |= (NC_DISKLESS|NC_NOCLOBBER);
 
+    return 1;
+}
+
+/* Called by the parser on reaching the data section of the root group.
+   If a binary file is being generated, and no groups can follow, the
+   file is defined now and the data of each variable is written as it
+   is parsed (see genbin_streamvardata), instead of holding the whole
+   data section in memory. Groups can only follow if the format
+   (-k or _Format) is netCDF-4 or is to be inferred from the CDL, and
+   the input declares a group. Without fill (-x or _NoFill) the records
+   of a variable beyond its own data are written with the fill value
+   at the end (see genbin_streamfinish), which is not done for
+   unlimited dimensions other than the first.
+*/
+void
+startdata(void)
+{
+#ifdef ENABLE_BINARY
+    int i;
+    int format = (k_flag != 0 ? k_flag : globalspecials._Format);
+
+    if(semanticsdone || l_flag != L_BINARY || syntax_only || header_only)
+        return;
+    if(error_count > 0)
+        return;
+    switch (format) {
+    case NC_FORMAT_CLASSIC:
+    case NC_FORMAT_64BIT_OFFSET:
+    case NC_FORMAT_64BIT_DATA:
+    case NC_FORMAT_NETCDF4_CLASSIC:
+	/* a conflict is reported at the end */
+	if(enhanced_flag) return;
+	break;
+    default: /* netCDF-4 or inferred: groups may follow */
+	if(cdlhasgroups()) return;
+	break;
+    }
+    for(i=0;i<listlength(vardefs);i++) {
+	Symbol* vsym = (Symbol*)listget(vardefs,(unsigned long)i);
+	Dimset* dimset = &vsym->typ.dimset;
+	Specialdata* special = &vsym->var.special;
+	int nofill = (nofill_flag || ((special->flags & _NOFILL_FLAG) && !special->_Fill));
+	if(nofill && dimset->ndims > 1 && findunlimited(dimset,1) < dimset->ndims)
+	    return;
+    }
+    semanticsdone = 1;
+    if(!chooseformat())
+        return;
     processsemantics();
-    if(!syntax_only && error_count == 0)
-        define_netcdf();
+    if(error_count > 0)
+        return;
+    genbin_netcdf(); /* no data yet, so this only defines the file */
+    streaming = 1;
+#endif
+}
 
-done:
-    nullfree(netcdf_name);
-    nullfree(datasetname);
-    finalize_netcdf(code);
-    return code;
+/* Return 1 if the CDL input may declare groups, else 0.
+   Groups are declared only by the keyword "group:", so the input
+   is scanned for it outside of comments, strings and character
+   constants. Standard input cannot be read twice, so it is assumed
+   to declare groups. */
+static int
+cdlhasgroups(void)
+{
+    static const char keyword[] = "group:";
+    FILE* f;
+    int c, c1, c2;
+    int pending = EOF; /* character read ahead */
+    size_t matched = 0;
+    int found = 0;
+
+    if(inputpath == NULL || (f = NCfopen(inputpath,"r")) == NULL)
+        return 1;
+    while(!found) {
+	if(pending != EOF) {
+	    c = pending;
+	    pending = EOF;
+	} else if((c = getc(f)) == EOF)
+	    break;
+	switch (c) {
+	case '\\': /* escaped character in a name */
+	    (void)getc(f);
+	    matched = 0;
+	    break;
+	case '"': /* string */
+	    while((c = getc(f)) != EOF && c != '"') {
+		if(c == '\\') (void)getc(f);
+	    }
+	    matched = 0;
+	    break;
+	case '\'': /* character constant: 'c' or '\...' */
+	    if((c1 = getc(f)) == '\\') {
+		(void)getc(f);
+		while((c = getc(f)) != EOF && c != '\'' && c != '\n');
+	    } else if(c1 != EOF && (c2 = getc(f)) != '\'') {
+		if(c2 != EOF) ungetc(c2,f);
+		pending = c1;
+	    }
+	    matched = 0;
+	    break;
+	case '/':
+	    if((c = getc(f)) == '/') { /* comment */
+		while((c = getc(f)) != EOF && c != '\n');
+	    } else if(c != EOF)
+		ungetc(c,f);
+	    matched = 0;
+	    break;
+	default:
+	    if(c == keyword[matched]) {
+		if(keyword[++matched] == '\0') found = 1;
+	    } else
+		matched = (c == keyword[0] ? 1 : 0);
+	    break;
+	}
+    }
+    fclose(f);
+    return found;
 }
 
 void
@@ -585,9 +735,23 @@ init_netcdf(void) /* initialize global counts, flags */
 
 }
 
+/* Remove a file being written while parsing, after an error */
+static void
+abort_netcdf(void)
+{
+#ifdef ENABLE_BINARY
+    if(streaming) {
+        streaming = 0;
+        genbin_abort();
+    }
+#endif
+}
+
 void
 finalize_netcdf(int retcode)
 {
+    if(retcode != 0)
+        abort_netcdf(); /* e.g. from check_err while writing data */
     nc_finalize();
     exit(retcode);
 }
@@ -188,6 +188,7 @@ typedef struct Varinfo {
     int		nattributes; /* |attributes|*/
     List*       attributes;  /* List<Symbol*>*/
     Specialdata special;
+    size_t      nrecs;       /* records written as the data was parsed */
 } Varinfo;
 
 typedef struct Groupinfo {
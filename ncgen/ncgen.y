@@ -70,6 +70,7 @@ static int stackbase;
 static int stacklen;
 static int count;
 static int opaqueid; /* counter for opaque constants*/
+static int datadepth; /* nesting of {...} in a datalist */
 static int arrayuid; /* counter for pseudo-array types*/
 
 char* primtypenames[PRIMNO] = {
@@ -805,16 +806,23 @@ path:
 	;
 
 datasection:    /* empty */
-                | DATA {}
-                | DATA datadecls {}
+                | datastart {}
+                | datastart datadecls {}
+                ;
+
+datastart:      DATA
+                   {if(currentgroup() == rootgroup) startdata();}
                 ;
 
 datadecls:      datadecl ';'
                 | datadecls datadecl ';'
                 ;
 
-datadecl:       varref '=' datalist
-                   {$1->data = $3;}
+datadecl:       varref '='
+                   {if(streaming) genbin_startvardata($1);}
+                datalist
+                   {$1->data = $4;
+                    if(streaming) genbin_streamvardata($1);}
                 ;
 datalist:
 	  datalist0 {$$ = $1;}
@@ -828,12 +836,13 @@ datalist0:
 datalist1: /* Must have at least 1 element */
 	  dataitem {$$ = const2list($1);}
 	| datalist ',' dataitem
-	    {dlappend($1,($3)); $$=$1; }
+	    {dlappend($1,($3)); $$=$1;
+	     if(streaming && datadepth == 0) genbin_streamvarblock($1);}
 	;
 
 dataitem:
 	  constdata {$$=$1;}
-	| '{' datalist '}' {$$=builddatasublist($2);}
+	| '{' {datadepth++;} datalist '}' {datadepth--; $$=builddatasublist($3);}
 	;
 
 constdata:
@@ -951,6 +960,7 @@ parse_init(void)
     int i;
     opaqueid = 0;
     arrayuid = 0;
+    datadepth = 0;
     symlist = listnew();
     stack = listnew();
     groupstack = listnew();
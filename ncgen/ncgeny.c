@@ -137,6 +137,7 @@ static int stackbase;
 static int stacklen;
 static int count;
 static int opaqueid; /* counter for opaque constants*/
+static int datadepth; /* nesting of {...} in a datalist */
 static int arrayuid; /* counter for pseudo-array types*/
 
 char* primtypenames[PRIMNO] = {
@@ -217,7 +218,7 @@ static void yyerror(fmt,va_alist) const char* fmt; va_dcl;
 extern int lex_init(void);
 
 
-#line 221 "ncgeny.c"
+#line 222 "ncgeny.c"
 
 # ifndef YY_CAST
 #  ifdef __cplusplus
@@ -365,23 +366,26 @@ enum yysymbol_kind_t
   YYSYMBOL_attrdecl = 117,                 /* attrdecl  */
   YYSYMBOL_path = 118,                     /* path  */
   YYSYMBOL_datasection = 119,              /* datasection  */
-  YYSYMBOL_datadecls = 120,                /* datadecls  */
-  YYSYMBOL_datadecl = 121,                 /* datadecl  */
-  YYSYMBOL_datalist = 122,                 /* datalist  */
-  YYSYMBOL_datalist0 = 123,                /* datalist0  */
-  YYSYMBOL_datalist1 = 124,                /* datalist1  */
-  YYSYMBOL_dataitem = 125,                 /* dataitem  */
-  YYSYMBOL_constdata = 126,                /* constdata  */
-  YYSYMBOL_econstref = 127,                /* econstref  */
-  YYSYMBOL_function = 128,                 /* function  */
-  YYSYMBOL_arglist = 129,                  /* arglist  */
-  YYSYMBOL_simpleconstant = 130,           /* simpleconstant  */
-  YYSYMBOL_intlist = 131,                  /* intlist  */
-  YYSYMBOL_constint = 132,                 /* constint  */
-  YYSYMBOL_conststring = 133,              /* conststring  */
-  YYSYMBOL_constbool = 134,                /* constbool  */
-  YYSYMBOL_varident = 135,                 /* varident  */
-  YYSYMBOL_ident = 136                     /* ident  */
+  YYSYMBOL_datastart = 120,                /* datastart  */
+  YYSYMBOL_datadecls = 121,                /* datadecls  */
+  YYSYMBOL_datadecl = 122,                 /* datadecl  */
+  YYSYMBOL_123_3 = 123,                    /* $@3  */
+  YYSYMBOL_datalist = 124,                 /* datalist  */
+  YYSYMBOL_datalist0 = 125,                /* datalist0  */
+  YYSYMBOL_datalist1 = 126,                /* datalist1  */
+  YYSYMBOL_dataitem = 127,                 /* dataitem  */
+  YYSYMBOL_128_4 = 128,                    /* $@4  */
+  YYSYMBOL_constdata = 129,                /* constdata  */
+  YYSYMBOL_econstref = 130,                /* econstref  */
+  YYSYMBOL_function = 131,                 /* function  */
+  YYSYMBOL_arglist = 132,                  /* arglist  */
+  YYSYMBOL_simpleconstant = 133,           /* simpleconstant  */
+  YYSYMBOL_intlist = 134,                  /* intlist  */
+  YYSYMBOL_constint = 135,                 /* constint  */
+  YYSYMBOL_conststring = 136,              /* conststring  */
+  YYSYMBOL_constbool = 137,                /* constbool  */
+  YYSYMBOL_varident = 138,                 /* varident  */
+  YYSYMBOL_ident = 139                     /* ident  */
 };
 typedef enum yysymbol_kind_t yysymbol_kind_t;
 
@@ -709,16 +713,16 @@ union yyalloc
 /* YYFINAL -- State number of the termination state.  */
 #define YYFINAL  5
 /* YYLAST -- Last index in YYTABLE.  */
-#define YYLAST   420
+#define YYLAST   433
 
 /* YYNTOKENS -- Number of terminals.  */
 #define YYNTOKENS  69
 /* YYNNTS -- Number of nonterminals.  */
-#define YYNNTS  68
+#define YYNNTS  71
 /* YYNRULES -- Number of rules.  */
-#define YYNRULES  159
+#define YYNRULES  162
 /* YYNSTATES -- Number of states.  */
-#define YYNSTATES  276
+#define YYNSTATES  279
 
 /* YYMAXUTOK -- Last valid token kind.  */
 #define YYMAXUTOK   314
@@ -773,22 +777,23 @@ static const yytype_int8 yytranslate[] =
 /* YYRLINE[YYN] -- Source line where rule number YYN was defined.  */
 static const yytype_int16 yyrline[] =
 {
-       0,   243,   243,   249,   251,   258,   265,   265,   268,   277,
-     267,   282,   283,   284,   288,   288,   290,   300,   300,   303,
-     304,   305,   306,   309,   309,   312,   342,   344,   361,   370,
-     382,   396,   429,   430,   433,   447,   448,   449,   450,   451,
-     452,   453,   454,   455,   456,   457,   458,   461,   462,   463,
-     466,   467,   470,   470,   472,   473,   477,   485,   495,   507,
-     508,   509,   512,   513,   516,   516,   518,   540,   544,   548,
-     577,   578,   581,   582,   586,   600,   604,   609,   638,   639,
-     643,   644,   649,   659,   679,   690,   701,   720,   727,   727,
-     730,   732,   734,   736,   738,   747,   758,   760,   762,   764,
-     766,   768,   770,   772,   774,   776,   778,   780,   782,   784,
-     786,   791,   798,   807,   808,   809,   812,   813,   816,   820,
-     821,   825,   829,   830,   835,   836,   840,   841,   842,   843,
-     844,   845,   849,   853,   857,   859,   864,   865,   866,   867,
-     868,   869,   870,   871,   872,   873,   874,   875,   879,   880,
-     884,   886,   888,   890,   895,   899,   900,   908,   909,   913
+       0,   244,   244,   250,   252,   259,   266,   266,   269,   278,
+     268,   283,   284,   285,   289,   289,   291,   301,   301,   304,
+     305,   306,   307,   310,   310,   313,   343,   345,   362,   371,
+     383,   397,   430,   431,   434,   448,   449,   450,   451,   452,
+     453,   454,   455,   456,   457,   458,   459,   462,   463,   464,
+     467,   468,   471,   471,   473,   474,   478,   486,   496,   508,
+     509,   510,   513,   514,   517,   517,   519,   541,   545,   549,
+     578,   579,   582,   583,   587,   601,   605,   610,   639,   640,
+     644,   645,   650,   660,   680,   691,   702,   721,   728,   728,
+     731,   733,   735,   737,   739,   748,   759,   761,   763,   765,
+     767,   769,   771,   773,   775,   777,   779,   781,   783,   785,
+     787,   792,   799,   808,   809,   810,   813,   817,   818,   822,
+     821,   828,   829,   833,   837,   838,   844,   845,   845,   849,
+     850,   851,   852,   853,   854,   858,   862,   866,   868,   873,
+     874,   875,   876,   877,   878,   879,   880,   881,   882,   883,
+     884,   888,   889,   893,   895,   897,   899,   904,   908,   909,
+     917,   918,   922
 };
 #endif
 
@@ -825,10 +830,11 @@ static const char *const yytname[] =
   "vadecls", "vadecl_or_attr", "vardecl", "varlist", "varspec", "dimspec",
   "dimlist", "dimref", "fieldlist", "fieldspec", "fielddimspec",
   "fielddimlist", "fielddim", "varref", "typeref", "ambiguous_ref",
-  "attrdecllist", "attrdecl", "path", "datasection", "datadecls",
-  "datadecl", "datalist", "datalist0", "datalist1", "dataitem",
-  "constdata", "econstref", "function", "arglist", "simpleconstant",
-  "intlist", "constint", "conststring", "constbool", "varident", "ident", YY_NULLPTR
+  "attrdecllist", "attrdecl", "path", "datasection", "datastart",
+  "datadecls", "datadecl", "$@3", "datalist", "datalist0", "datalist1",
+  "dataitem", "$@4", "constdata", "econstref", "function", "arglist",
+  "simpleconstant", "intlist", "constint", "conststring", "constbool",
+  "varident", "ident", YY_NULLPTR
 };
 
 static const char *
@@ -838,12 +844,12 @@ yysymbol_name (yysymbol_kind_t yysymbol)
 }
 #endif
 
-#define YYPACT_NINF (-153)
+#define YYPACT_NINF (-155)
 
 #define yypact_value_is_default(Yyn) \
   ((Yyn) == YYPACT_NINF)
 
-#define YYTABLE_NINF (-160)
+#define YYTABLE_NINF (-163)
 
 #define yytable_value_is_error(Yyn) \
   0
@@ -852,34 +858,34 @@ yysymbol_name (yysymbol_kind_t yysymbol)
    STATE-NUM.  */
 static const yytype_int16 yypact[] =
 {
-     -10,   -24,    30,  -153,   -18,  -153,   233,  -153,  -153,  -153,
-    -153,  -153,  -153,  -153,  -153,  -153,  -153,  -153,  -153,  -153,
-    -153,  -153,    20,  -153,  -153,   381,    -4,     5,   -16,  -153,
-    -153,     4,    23,    45,    46,    50,   -28,    51,     3,   197,
-      89,   233,    74,    74,    80,    82,   307,   106,  -153,  -153,
-      -1,    63,    66,    67,    68,    69,    71,    72,    75,    77,
-      78,    79,    81,    85,    86,   106,    87,   197,  -153,  -153,
-      91,    91,    91,    91,   109,   246,    92,   233,   126,  -153,
-    -153,  -153,  -153,  -153,  -153,  -153,  -153,  -153,  -153,  -153,
-    -153,  -153,  -153,  -153,  -153,  -153,  -153,  -153,  -153,  -153,
-    -153,  -153,  -153,  -153,  -153,  -153,   307,  -153,    94,  -153,
-    -153,  -153,  -153,  -153,  -153,  -153,    93,    99,    98,   100,
-     307,    74,    82,    82,    80,    74,    80,    80,    74,    74,
-      82,    82,    82,   307,   105,  -153,   146,  -153,  -153,  -153,
-    -153,  -153,  -153,   106,   102,  -153,   233,   108,   110,  -153,
-     107,  -153,   111,   233,   140,    27,   307,   256,  -153,   307,
-     307,    94,  -153,   113,  -153,  -153,  -153,  -153,  -153,  -153,
-    -153,  -153,  -153,  -153,  -153,    94,   381,   114,   117,   118,
-     112,  -153,   106,    53,   233,   123,  -153,   345,  -153,   381,
-    -153,  -153,  -153,   -43,  -153,   233,    94,    94,    82,   282,
-     124,   106,  -153,   106,   106,   106,  -153,  -153,  -153,  -153,
-    -153,   125,  -153,   120,  -153,   127,  -153,   128,   130,  -153,
-     381,   129,   256,  -153,  -153,  -153,  -153,   134,  -153,   135,
-    -153,   149,  -153,    62,  -153,   136,  -153,  -153,    -5,     1,
-    -153,   307,   154,  -153,  -153,   151,  -153,   106,    -3,  -153,
-    -153,   106,    82,  -153,  -153,   -34,  -153,  -153,    94,  -153,
-     131,  -153,  -153,  -153,    14,  -153,  -153,  -153,     1,  -153,
-     233,    -3,  -153,  -153,  -153,  -153
+     -11,   -47,    21,  -155,   -28,  -155,   246,  -155,  -155,  -155,
+    -155,  -155,  -155,  -155,  -155,  -155,  -155,  -155,  -155,  -155,
+    -155,  -155,    -1,  -155,  -155,   394,   -30,     1,   -15,  -155,
+    -155,   -10,    -4,    12,    26,    33,   -21,    -3,   271,   181,
+      24,   246,    60,    60,    42,     5,   320,    67,  -155,  -155,
+      -5,    43,    44,    45,    46,    48,    52,    56,    59,    61,
+      62,    63,    64,    65,    66,    67,    70,   181,  -155,  -155,
+      69,    69,    69,    69,    51,   259,    74,   246,    75,  -155,
+    -155,  -155,  -155,  -155,  -155,  -155,  -155,  -155,  -155,  -155,
+    -155,  -155,  -155,  -155,  -155,  -155,  -155,  -155,  -155,  -155,
+    -155,  -155,  -155,  -155,  -155,  -155,  -155,  -155,    76,  -155,
+    -155,  -155,  -155,  -155,  -155,  -155,    78,    72,    77,    80,
+     320,    60,     5,     5,    42,    60,    42,    42,    60,    60,
+       5,     5,     5,   320,    85,  -155,   125,  -155,  -155,  -155,
+    -155,  -155,  -155,    67,    39,  -155,   246,    86,    84,  -155,
+      87,  -155,    88,   246,   122,   320,   320,   395,  -155,   320,
+     320,    76,  -155,    92,  -155,  -155,  -155,  -155,  -155,  -155,
+    -155,  -155,  -155,  -155,  -155,    76,   394,    93,    98,    95,
+     100,  -155,    67,    36,   246,   101,  -155,   358,  -155,  -155,
+    -155,   394,    40,  -155,     3,  -155,   246,    76,    76,     5,
+     295,   102,    67,  -155,    67,    67,    67,  -155,  -155,  -155,
+    -155,  -155,   103,  -155,    99,  -155,   106,  -155,   105,   107,
+    -155,   394,   111,  -155,   395,  -155,  -155,  -155,  -155,   112,
+    -155,   113,  -155,   110,  -155,    41,  -155,   114,  -155,  -155,
+      13,     2,  -155,  -155,   115,  -155,  -155,   141,  -155,    67,
+      -2,  -155,  -155,    67,     5,  -155,  -155,    18,  -155,  -155,
+     320,  -155,   137,  -155,  -155,  -155,    19,  -155,  -155,  -155,
+       2,  -155,    76,   246,    -2,  -155,  -155,  -155,  -155
 };
 
 /* YYDEFACT[STATE-NUM] -- Default reduction number in state STATE-NUM.
@@ -889,56 +895,58 @@ static const yytype_uint8 yydefact[] =
 {
        0,     0,     0,     3,     0,     1,    88,     2,    35,    36,
       37,    38,    39,    40,    41,    42,    43,    44,    45,    46,
-     159,   112,     0,     6,    87,     0,    85,    11,     0,    86,
+     162,   112,     0,     6,    87,     0,    85,    11,     0,    86,
      111,     0,     0,     0,     0,     0,     0,     0,     0,    12,
-      47,    88,     0,     0,     0,     0,   121,     0,     4,     7,
+      47,    88,     0,     0,     0,     0,   123,     0,     4,     7,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,    13,    14,    17,
       23,    23,    23,    23,    87,     0,     0,    48,    59,    89,
-     154,   110,    90,   150,   152,   151,   153,   156,   155,    91,
-      92,   147,   136,   137,   138,   139,   140,   141,   142,   143,
-     144,   145,   146,   127,   128,   129,   121,   132,    93,   119,
-     120,   122,   124,   130,   131,   126,   111,     0,     0,     0,
-     121,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,   121,     0,    16,     0,    15,    24,    19,
+     157,   110,    90,   153,   155,   154,   156,   159,   158,    91,
+      92,   150,   139,   140,   141,   142,   143,   144,   145,   146,
+     147,   148,   149,   130,   131,   132,   127,   135,    93,   121,
+     122,   124,   126,   133,   134,   129,   111,     0,     0,     0,
+     123,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,   123,     0,    16,     0,    15,    24,    19,
       22,    21,    20,     0,     0,    18,    49,     0,    52,    54,
-       0,    53,   111,    60,   113,     0,     0,     0,     8,   121,
-     121,    96,    98,    99,   148,   101,   102,   103,   109,   100,
+       0,    53,   111,    60,   113,   123,     0,     0,     8,   123,
+     123,    96,    98,    99,   151,   101,   102,   103,   109,   100,
      104,   105,   106,   107,   108,    95,     0,     0,     0,     0,
-       0,    50,     0,     0,    61,     0,    64,     0,    65,   114,
-       5,   125,   123,     0,   134,    88,    97,    94,     0,     0,
-       0,     0,    85,     0,     0,     0,    51,    55,    58,    57,
-      56,     0,    62,   157,   158,    66,    67,    70,     0,    84,
-     115,     0,     0,   133,     6,   149,    31,     0,    32,    34,
-      75,    78,    29,     0,    26,     0,    30,    63,     0,     0,
-      69,   121,     0,   116,   135,     9,    33,     0,     0,    77,
-      25,     0,     0,   157,    68,     0,    72,    74,   118,   117,
-       0,    76,    83,    82,     0,    80,    27,    28,     0,    71,
-      88,     0,    79,    73,    10,    81
+       0,    50,     0,     0,    61,     0,    64,     0,    65,   116,
+       5,   114,     0,   125,     0,   137,    88,    97,    94,     0,
+       0,     0,     0,    85,     0,     0,     0,    51,    55,    58,
+      57,    56,     0,    62,   160,   161,    66,    67,    70,     0,
+      84,   115,     0,   128,     0,   136,     6,   152,    31,     0,
+      32,    34,    75,    78,    29,     0,    26,     0,    30,    63,
+       0,     0,    69,   119,     0,   117,   138,     9,    33,     0,
+       0,    77,    25,     0,     0,   160,    68,     0,    72,    74,
+     123,   118,     0,    76,    83,    82,     0,    80,    27,    28,
+       0,    71,   120,    88,     0,    79,    73,    10,    81
 };
 
 /* YYPGOTO[NTERM-NUM].  */
 static const yytype_int16 yypgoto[] =
 {
-    -153,  -153,  -153,  -153,    22,    -6,  -153,  -153,  -153,  -153,
-    -153,  -136,   153,  -153,    10,  -153,  -153,   -25,  -153,  -153,
-    -153,  -153,    24,   -30,  -153,  -153,    76,  -153,    39,  -153,
-    -153,  -153,    43,  -153,  -153,    25,  -153,  -153,    -2,  -153,
-     -19,  -153,  -153,   -39,  -153,   -36,   -21,   -40,   -33,   -44,
-    -153,  -153,    15,   -94,  -153,  -153,   115,  -153,  -153,  -153,
-    -153,  -152,  -153,   -37,   -29,     2,  -153,   -22
+    -155,  -155,  -155,  -155,     4,   -25,  -155,  -155,  -155,  -155,
+    -155,  -133,   136,  -155,    22,  -155,  -155,   -49,  -155,  -155,
+    -155,  -155,     6,   -32,  -155,  -155,    68,  -155,    23,  -155,
+    -155,  -155,    25,  -155,  -155,   -33,  -155,  -155,   -62,  -155,
+     -39,  -155,  -155,   -61,  -155,   -34,   -19,   -40,   -31,   -42,
+    -155,  -155,  -155,    -9,  -155,  -111,  -155,  -155,    73,  -155,
+    -155,  -155,  -155,  -155,  -154,  -155,   -43,   -29,   -52,  -155,
+     -22
 };
 
 /* YYDEFGOTO[NTERM-NUM].  */
 static const yytype_int16 yydefgoto[] =
 {
-       0,     2,     4,     7,    23,    36,    49,   195,   260,    40,
-      67,   134,    68,    69,   139,    70,   233,   234,    71,    72,
-      73,   199,   200,    24,    78,   146,   147,   148,   149,   150,
-     154,   184,   185,   186,   215,   216,   240,   255,   256,   229,
-     230,   249,   264,   265,   218,    25,    26,    27,    28,    29,
-     190,   220,   221,   108,   109,   110,   111,   112,   113,   114,
-     193,   115,   163,    87,    88,    89,   217,    30
+       0,     2,     4,     7,    23,    36,    49,   196,   262,    40,
+      67,   134,    68,    69,   139,    70,   235,   236,    71,    72,
+      73,   200,   201,    24,    78,   146,   147,   148,   149,   150,
+     154,   184,   185,   186,   216,   217,   242,   257,   258,   231,
+     232,   251,   266,   267,   219,    25,    26,    27,    28,    29,
+     190,   191,   221,   222,   260,   108,   109,   110,   111,   155,
+     112,   113,   114,   194,   115,   163,    87,    88,    89,   218,
+      30
 };
 
 /* YYTABLE[YYPACT[STATE-NUM]] -- What to do in state STATE-NUM.  If
@@ -946,96 +954,98 @@ static const yytype_int16 yydefgoto[] =
    number is the opposite.  If YYTABLE_NINF, syntax error.  */
 static const yytype_int16 yytable[] =
 {
-      35,    79,   107,    75,    37,   194,    76,   178,    90,    74,
-      47,   253,   155,    81,    82,    20,    64,    20,   262,    20,
-     222,     1,   263,   223,   116,   117,   161,   214,   119,   268,
-       5,    75,   269,    48,    76,     3,    20,    74,    39,   175,
-      21,   118,     6,   135,   151,    51,    41,    52,    53,    54,
-      55,    56,    57,    58,    37,   152,   209,    59,    60,    61,
-      62,    63,   107,    31,    38,   196,   197,   232,    42,   236,
-     244,    32,    33,    34,    83,    84,   107,   271,    85,    86,
-     272,   140,   141,   142,   116,   164,   165,    43,   191,   107,
-     156,    80,   162,   172,   173,   174,   167,    80,   116,   170,
-     171,    83,    84,    83,    84,    85,    86,    85,    86,    44,
-      45,   116,   107,   151,    46,   107,   107,   187,    77,    50,
-     188,   135,    20,   250,   152,   251,   166,   120,   168,   169,
-     121,   122,   123,   124,   116,   125,   126,   116,   116,   127,
-     201,   128,   129,   130,   143,   131,   210,   258,   187,   132,
-     133,   188,   136,   138,   145,   202,   153,   156,   157,   158,
-     208,   225,   159,   201,   160,   176,    37,   177,   219,   179,
-     181,   183,   189,   182,   206,   -58,   198,   204,   202,   231,
-     203,   135,   235,   135,   205,   212,   228,   237,  -159,    47,
-     238,   243,   270,   239,   241,   257,   246,   107,   247,   219,
-     252,     8,     9,    10,    11,    12,    13,    14,    15,    16,
-      17,    18,    19,    20,   248,   267,   259,   224,   245,   116,
-     137,   207,   180,   227,   257,   231,   266,   211,   261,   235,
-     274,    65,   275,    66,     0,   242,    21,     8,     9,    10,
-      11,    12,    13,    14,    15,    16,    17,    18,    19,    20,
+      35,    79,    90,   195,   107,    75,    37,    74,    76,   161,
+     178,    20,     3,    81,    82,    20,    64,    47,    20,   264,
+       1,     5,   175,   265,   116,   117,    83,    84,   119,   255,
+      85,    86,     6,    75,    39,    74,    76,   118,    38,   210,
+      48,    21,    31,   135,   192,   215,   151,    41,   197,   198,
+      32,    33,    34,    77,    42,   152,    37,    83,    84,    80,
+      43,    85,    86,    83,    84,    50,   224,    85,    86,   225,
+     246,   234,   166,   238,   168,   169,    44,    80,   107,   164,
+     165,   270,   274,    20,   271,   275,   143,   172,   173,   174,
+      45,   107,   162,   140,   141,   142,   167,    46,   116,   170,
+     171,   223,   252,   156,   253,   153,   179,   120,   121,   122,
+     123,   116,   124,   107,   107,   151,   125,   107,   107,   187,
+     126,   135,   188,   127,   152,   128,   129,   130,   131,   132,
+     133,   138,   158,   116,   116,   136,   145,   116,   116,   156,
+     211,   159,   202,   157,   160,   176,   177,   182,   181,   272,
+     187,   183,   -58,   188,   189,   199,   227,   203,   205,   204,
+     209,   206,   207,   213,   230,   239,   202,  -162,    37,   240,
+     241,   243,   220,   245,   248,   250,   249,   261,   254,    47,
+     233,   203,   135,   237,   135,     8,     9,    10,    11,    12,
+      13,    14,    15,    16,    17,    18,    19,    20,   273,   259,
+     226,   247,   220,   137,   268,   208,   229,   256,   276,   212,
+     263,   269,   244,   278,   180,    65,     0,    66,   107,     0,
+      21,     0,     0,     0,     0,     0,     0,   233,   259,   193,
+       0,   237,     0,   277,     0,     0,     0,     0,   116,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,    22,
        8,     9,    10,    11,    12,    13,    14,    15,    16,    17,
-      18,    19,    20,   254,     0,    22,   273,     0,     0,     0,
-       0,   192,    21,    91,    92,    93,    94,    95,    96,    97,
-      98,    99,   100,   101,   102,    21,     8,     9,    10,    11,
-      12,    13,    14,    15,    16,    17,    18,    19,    20,     0,
-       0,    22,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,   144,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,    21,     0,    20,    91,    92,    93,    94,    95,    96,
-      97,    98,    99,   100,   101,   102,     0,     0,     0,     0,
-       0,     0,     0,   226,   103,     0,    21,   104,   105,     8,
+      18,    19,    20,     8,     9,    10,    11,    12,    13,    14,
+      15,    16,    17,    18,    19,    20,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,    21,     0,    20,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,    21,     8,
        9,    10,    11,    12,    13,    14,    15,    16,    17,    18,
-      19,   213,     0,     0,     0,     0,     0,   106,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,   214,     0,     0,
-       0,     0,     0,     0,    21,     8,     9,    10,    11,    12,
-      13,    14,    15,    16,    17,    18,    19,    20,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-      21
+      19,    20,     0,    51,    22,    52,    53,    54,    55,    56,
+      57,    58,     0,     0,   144,    59,    60,    61,    62,    63,
+       0,     0,     0,     0,    21,     0,    20,    91,    92,    93,
+      94,    95,    96,    97,    98,    99,   100,   101,   102,     0,
+       0,     0,     0,     0,     0,     0,   228,   103,     0,    21,
+     104,   105,     8,     9,    10,    11,    12,    13,    14,    15,
+      16,    17,    18,    19,   214,     0,     0,     0,     0,     0,
+     106,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+     215,     0,     0,     0,     0,     0,     0,    21,     8,     9,
+      10,    11,    12,    13,    14,    15,    16,    17,    18,    19,
+      20,     0,    91,    92,    93,    94,    95,    96,    97,    98,
+      99,   100,   101,   102,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,    21
 };
 
 static const yytype_int16 yycheck[] =
 {
-      22,    41,    46,    39,    25,   157,    39,   143,    45,    39,
-      38,    16,   106,    42,    43,    16,    38,    16,    21,    16,
-      63,    31,    25,    66,    46,    47,   120,    32,    50,    63,
-       0,    67,    66,    61,    67,    59,    16,    67,    33,   133,
-      39,    42,    60,    65,    77,    42,    62,    44,    45,    46,
-      47,    48,    49,    50,    75,    77,     3,    54,    55,    56,
-      57,    58,   106,    43,    68,   159,   160,   203,    64,   205,
-     222,    51,    52,    53,    21,    22,   120,    63,    25,    26,
-      66,    71,    72,    73,   106,   122,   123,    64,    61,   133,
-      63,    17,   121,   130,   131,   132,   125,    17,   120,   128,
-     129,    21,    22,    21,    22,    25,    26,    25,    26,    64,
-      64,   133,   156,   146,    64,   159,   160,   153,    29,    68,
-     153,   143,    16,    61,   146,    63,   124,    64,   126,   127,
-      64,    64,    64,    64,   156,    64,    64,   159,   160,    64,
-     176,    64,    64,    64,    35,    64,   183,   241,   184,    64,
-      64,   184,    65,    62,    62,   176,    30,    63,    65,    60,
-     182,   198,    64,   199,    64,    60,   187,    21,   189,    67,
-      62,    64,    32,    63,    62,    64,    63,    60,   199,   201,
-      66,   203,   204,   205,    66,    62,    62,    62,    68,    38,
-      63,    62,    61,    65,    64,   239,    62,   241,    63,   220,
-      64,     4,     5,     6,     7,     8,     9,    10,    11,    12,
-      13,    14,    15,    16,    65,   252,    62,   195,   224,   241,
-      67,   182,   146,   199,   268,   247,   251,   184,   247,   251,
-     270,    34,   271,    36,    -1,   220,    39,     4,     5,     6,
-       7,     8,     9,    10,    11,    12,    13,    14,    15,    16,
+      22,    41,    45,   157,    46,    39,    25,    39,    39,   120,
+     143,    16,    59,    42,    43,    16,    38,    38,    16,    21,
+      31,     0,   133,    25,    46,    47,    21,    22,    50,    16,
+      25,    26,    60,    67,    33,    67,    67,    42,    68,     3,
+      61,    39,    43,    65,   155,    32,    77,    62,   159,   160,
+      51,    52,    53,    29,    64,    77,    75,    21,    22,    17,
+      64,    25,    26,    21,    22,    68,    63,    25,    26,    66,
+     224,   204,   124,   206,   126,   127,    64,    17,   120,   122,
+     123,    63,    63,    16,    66,    66,    35,   130,   131,   132,
+      64,   133,   121,    71,    72,    73,   125,    64,   120,   128,
+     129,    61,    61,    63,    63,    30,    67,    64,    64,    64,
+      64,   133,    64,   155,   156,   146,    64,   159,   160,   153,
+      64,   143,   153,    64,   146,    64,    64,    64,    64,    64,
+      64,    62,    60,   155,   156,    65,    62,   159,   160,    63,
+     183,    64,   176,    65,    64,    60,    21,    63,    62,   260,
+     184,    64,    64,   184,    32,    63,   199,   176,    60,    66,
+     182,    66,    62,    62,    62,    62,   200,    68,   187,    63,
+      65,    64,   191,    62,    62,    65,    63,    62,    64,    38,
+     202,   200,   204,   205,   206,     4,     5,     6,     7,     8,
+       9,    10,    11,    12,    13,    14,    15,    16,    61,   241,
+     196,   226,   221,    67,   253,   182,   200,   240,   270,   184,
+     249,   254,   221,   274,   146,    34,    -1,    36,   260,    -1,
+      39,    -1,    -1,    -1,    -1,    -1,    -1,   249,   270,   156,
+      -1,   253,    -1,   273,    -1,    -1,    -1,    -1,   260,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    68,
        4,     5,     6,     7,     8,     9,    10,    11,    12,    13,
-      14,    15,    16,   238,    -1,    68,   268,    -1,    -1,    -1,
-      -1,   156,    39,    17,    18,    19,    20,    21,    22,    23,
-      24,    25,    26,    27,    28,    39,     4,     5,     6,     7,
-       8,     9,    10,    11,    12,    13,    14,    15,    16,    -1,
-      -1,    68,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    65,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    39,    -1,    16,    17,    18,    19,    20,    21,    22,
-      23,    24,    25,    26,    27,    28,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    61,    37,    -1,    39,    40,    41,     4,
+      14,    15,    16,     4,     5,     6,     7,     8,     9,    10,
+      11,    12,    13,    14,    15,    16,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    39,    -1,    16,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    39,     4,
        5,     6,     7,     8,     9,    10,    11,    12,    13,    14,
-      15,    16,    -1,    -1,    -1,    -1,    -1,    60,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    32,    -1,    -1,
-      -1,    -1,    -1,    -1,    39,     4,     5,     6,     7,     8,
-       9,    10,    11,    12,    13,    14,    15,    16,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      39
+      15,    16,    -1,    42,    68,    44,    45,    46,    47,    48,
+      49,    50,    -1,    -1,    65,    54,    55,    56,    57,    58,
+      -1,    -1,    -1,    -1,    39,    -1,    16,    17,    18,    19,
+      20,    21,    22,    23,    24,    25,    26,    27,    28,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    61,    37,    -1,    39,
+      40,    41,     4,     5,     6,     7,     8,     9,    10,    11,
+      12,    13,    14,    15,    16,    -1,    -1,    -1,    -1,    -1,
+      60,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      32,    -1,    -1,    -1,    -1,    -1,    -1,    39,     4,     5,
+       6,     7,     8,     9,    10,    11,    12,    13,    14,    15,
+      16,    -1,    17,    18,    19,    20,    21,    22,    23,    24,
+      25,    26,    27,    28,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    39
 };
 
 /* YYSTOS[STATE-NUM] -- The symbol kind of the accessing symbol of
@@ -1045,31 +1055,31 @@ static const yytype_uint8 yystos[] =
        0,    31,    70,    59,    71,     0,    60,    72,     4,     5,
        6,     7,     8,     9,    10,    11,    12,    13,    14,    15,
       16,    39,    68,    73,    92,   114,   115,   116,   117,   118,
-     136,    43,    51,    52,    53,   136,    74,   115,    68,    33,
+     139,    43,    51,    52,    53,   139,    74,   115,    68,    33,
       78,    62,    64,    64,    64,    64,    64,    38,    61,    75,
       68,    42,    44,    45,    46,    47,    48,    49,    50,    54,
-      55,    56,    57,    58,   136,    34,    36,    79,    81,    82,
+      55,    56,    57,    58,   139,    34,    36,    79,    81,    82,
       84,    87,    88,    89,    92,   114,   117,    29,    93,   116,
-      17,   133,   133,    21,    22,    25,    26,   132,   133,   134,
-     132,    17,    18,    19,    20,    21,    22,    23,    24,    25,
-      26,    27,    28,    37,    40,    41,    60,   118,   122,   123,
-     124,   125,   126,   127,   128,   130,   136,   136,    42,   136,
+      17,   136,   136,    21,    22,    25,    26,   135,   136,   137,
+     135,    17,    18,    19,    20,    21,    22,    23,    24,    25,
+      26,    27,    28,    37,    40,    41,    60,   118,   124,   125,
+     126,   127,   129,   130,   131,   133,   139,   139,    42,   139,
       64,    64,    64,    64,    64,    64,    64,    64,    64,    64,
-      64,    64,    64,    64,    80,   136,    65,    81,    62,    83,
+      64,    64,    64,    64,    80,   139,    65,    81,    62,    83,
       83,    83,    83,    35,    65,    62,    94,    95,    96,    97,
-      98,   117,   136,    30,    99,   122,    63,    65,    60,    64,
-      64,   122,   133,   131,   132,   132,   134,   133,   134,   134,
-     133,   133,   132,   132,   132,   122,    60,    21,    80,    67,
+      98,   117,   139,    30,    99,   128,    63,    65,    60,    64,
+      64,   124,   136,   134,   135,   135,   137,   136,   137,   137,
+     136,   136,   135,   135,   135,   124,    60,    21,    80,    67,
       95,    62,    63,    64,   100,   101,   102,   114,   117,    32,
-     119,    61,   125,   129,   130,    76,   122,   122,    63,    90,
-      91,   114,   115,    66,    60,    66,    62,    97,   136,     3,
-     132,   101,    62,    16,    32,   103,   104,   135,   113,   115,
-     120,   121,    63,    66,    73,   132,    61,    91,    62,   108,
-     109,   136,    80,    85,    86,   136,    80,    62,    63,    65,
-     105,    64,   121,    62,   130,    74,    62,    63,    65,   110,
-      61,    63,    64,    16,   104,   106,   107,   118,   122,    62,
-      77,   109,    21,    25,   111,   112,    86,   132,    63,    66,
-      61,    63,    66,   107,   116,   112
+     119,   120,   124,   127,   132,   133,    76,   124,   124,    63,
+      90,    91,   114,   115,    66,    60,    66,    62,    97,   139,
+       3,   135,   101,    62,    16,    32,   103,   104,   138,   113,
+     115,   121,   122,    61,    63,    66,    73,   135,    61,    91,
+      62,   108,   109,   139,    80,    85,    86,   139,    80,    62,
+      63,    65,   105,    64,   122,    62,   133,    74,    62,    63,
+      65,   110,    61,    63,    64,    16,   104,   106,   107,   118,
+     123,    62,    77,   109,    21,    25,   111,   112,    86,   135,
+      63,    66,   124,    61,    63,    66,   107,   116,   112
 };
 
 /* YYR1[RULE-NUM] -- Symbol kind of the left-hand side of rule RULE-NUM.  */
@@ -1086,11 +1096,12 @@ static const yytype_uint8 yyr1[] =
      111,   111,   112,   112,   113,   114,   115,   115,   116,   116,
      117,   117,   117,   117,   117,   117,   117,   117,   117,   117,
      117,   117,   117,   117,   117,   117,   117,   117,   117,   117,
-     117,   118,   118,   119,   119,   119,   120,   120,   121,   122,
-     122,   123,   124,   124,   125,   125,   126,   126,   126,   126,
-     126,   126,   127,   128,   129,   129,   130,   130,   130,   130,
-     130,   130,   130,   130,   130,   130,   130,   130,   131,   131,
-     132,   132,   132,   132,   133,   134,   134,   135,   135,   136
+     117,   118,   118,   119,   119,   119,   120,   121,   121,   123,
+     122,   124,   124,   125,   126,   126,   127,   128,   127,   129,
+     129,   129,   129,   129,   129,   130,   131,   132,   132,   133,
+     133,   133,   133,   133,   133,   133,   133,   133,   133,   133,
+     133,   134,   134,   135,   135,   135,   135,   136,   137,   137,
+     138,   138,   139
 };
 
 /* YYR2[RULE-NUM] -- Number of symbols on the right-hand side of rule RULE-NUM.  */
@@ -1107,11 +1118,12 @@ static const yytype_int8 yyr2[] =
        1,     3,     1,     1,     1,     1,     1,     1,     0,     3,
        4,     4,     4,     4,     6,     5,     5,     6,     5,     5,
        5,     5,     5,     5,     5,     5,     5,     5,     5,     5,
-       4,     1,     1,     0,     1,     2,     2,     3,     3,     1,
-       1,     0,     1,     3,     1,     3,     1,     1,     1,     1,
-       1,     1,     1,     4,     1,     3,     1,     1,     1,     1,
-       1,     1,     1,     1,     1,     1,     1,     1,     1,     3,
-       1,     1,     1,     1,     1,     1,     1,     1,     1,     1
+       4,     1,     1,     0,     1,     2,     1,     2,     3,     0,
+       4,     1,     1,     0,     1,     3,     1,     0,     4,     1,
+       1,     1,     1,     1,     1,     1,     4,     1,     3,     1,
+       1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
+       1,     1,     3,     1,     1,     1,     1,     1,     1,     1,
+       1,     1,     1
 };
 
 
@@ -1845,19 +1857,19 @@ yyreduce:
   switch (yyn)
     {
   case 2: /* ncdesc: NETCDF datasetid rootgroup  */
-#line 246 "ncgen.y"
+#line 247 "ncgen.y"
         {if (error_count > 0) YYABORT;}
-#line 1851 "ncgeny.c"
+#line 1863 "ncgeny.c"
     break;
 
   case 3: /* datasetid: DATASETID  */
-#line 249 "ncgen.y"
+#line 250 "ncgen.y"
                      {createrootgroup(datasetname);}
-#line 1857 "ncgeny.c"
+#line 1869 "ncgeny.c"
     break;
 
   case 8: /* $@1: %empty  */
-#line 268 "ncgen.y"
+#line 269 "ncgen.y"
             {
 		Symbol* id = (yyvsp[-1].sym);
                 markcdf4("Group specification");
@@ -1865,29 +1877,29 @@ yyreduce:
                     yyerror("duplicate group declaration within parent group for %s",
                                 id->name);
             }
-#line 1869 "ncgeny.c"
+#line 1881 "ncgeny.c"
     break;
 
   case 9: /* $@2: %empty  */
-#line 277 "ncgen.y"
+#line 278 "ncgen.y"
             {listpop(groupstack);}
-#line 1875 "ncgeny.c"
+#line 1887 "ncgeny.c"
     break;
 
   case 12: /* typesection: TYPES  */
-#line 283 "ncgen.y"
+#line 284 "ncgen.y"
                         {}
-#line 1881 "ncgeny.c"
+#line 1893 "ncgeny.c"
     break;
 
   case 13: /* typesection: TYPES typedecls  */
-#line 285 "ncgen.y"
+#line 286 "ncgen.y"
                         {markcdf4("Type specification");}
-#line 1887 "ncgeny.c"
+#line 1899 "ncgeny.c"
     break;
 
   case 16: /* typename: ident  */
-#line 291 "ncgen.y"
+#line 292 "ncgen.y"
             { /* Use when defining a type */
               (yyvsp[0].sym)->objectclass = NC_TYPE;
               if(dupobjectcheck(NC_TYPE,(yyvsp[0].sym)))
@@ -1895,23 +1907,23 @@ yyreduce:
                             (yyvsp[0].sym)->name);
               listpush(typdefs,(void*)(yyvsp[0].sym));
 	    }
-#line 1899 "ncgeny.c"
+#line 1911 "ncgeny.c"
     break;
 
   case 17: /* type_or_attr_decl: typedecl  */
-#line 300 "ncgen.y"
+#line 301 "ncgen.y"
                             {}
-#line 1905 "ncgeny.c"
+#line 1917 "ncgeny.c"
     break;
 
   case 18: /* type_or_attr_decl: attrdecl ';'  */
-#line 300 "ncgen.y"
+#line 301 "ncgen.y"
                                               {}
-#line 1911 "ncgeny.c"
+#line 1923 "ncgeny.c"
     break;
 
   case 25: /* enumdecl: primtype ENUM typename '{' enumidlist '}'  */
-#line 314 "ncgen.y"
+#line 315 "ncgen.y"
               {
 		int i;
                 addtogroup((yyvsp[-3].sym)); /* sets prefix*/
@@ -1938,17 +1950,17 @@ yyreduce:
                 }
                 listsetlength(stack,stackbase);/* remove stack nodes*/
               }
-#line 1942 "ncgeny.c"
+#line 1954 "ncgeny.c"
     break;
 
   case 26: /* enumidlist: enumid  */
-#line 343 "ncgen.y"
+#line 344 "ncgen.y"
                 {(yyval.mark)=listlength(stack); listpush(stack,(void*)(yyvsp[0].sym));}
-#line 1948 "ncgeny.c"
+#line 1960 "ncgeny.c"
     break;
 
   case 27: /* enumidlist: enumidlist ',' enumid  */
-#line 345 "ncgen.y"
+#line 346 "ncgen.y"
                 {
 		    int i;
 		    (yyval.mark)=(yyvsp[-2].mark);
@@ -1963,22 +1975,22 @@ yyreduce:
 		    }
 		    listpush(stack,(void*)(yyvsp[0].sym));
 		}
-#line 1967 "ncgeny.c"
+#line 1979 "ncgeny.c"
     break;
 
   case 28: /* enumid: ident '=' constint  */
-#line 362 "ncgen.y"
+#line 363 "ncgen.y"
         {
             (yyvsp[-2].sym)->objectclass=NC_TYPE;
             (yyvsp[-2].sym)->subclass=NC_ECONST;
             (yyvsp[-2].sym)->typ.econst=(yyvsp[0].constant);
 	    (yyval.sym)=(yyvsp[-2].sym);
         }
-#line 1978 "ncgeny.c"
+#line 1990 "ncgeny.c"
     break;
 
   case 29: /* opaquedecl: OPAQUE_ '(' INT_CONST ')' typename  */
-#line 371 "ncgen.y"
+#line 372 "ncgen.y"
                 {
 		    vercheck(NC_OPAQUE);
                     addtogroup((yyvsp[0].sym)); /*sets prefix*/
@@ -1988,11 +2000,11 @@ yyreduce:
                     (yyvsp[0].sym)->typ.size=int32_val;
                     (void)ncaux_class_alignment(NC_OPAQUE,&(yyvsp[0].sym)->typ.alignment);
                 }
-#line 1992 "ncgeny.c"
+#line 2004 "ncgeny.c"
     break;
 
   case 30: /* vlendecl: typeref '(' '*' ')' typename  */
-#line 383 "ncgen.y"
+#line 384 "ncgen.y"
                 {
                     Symbol* basetype = (yyvsp[-4].sym);
 		    vercheck(NC_VLEN);
@@ -2004,11 +2016,11 @@ yyreduce:
                     (yyvsp[0].sym)->typ.size=VLENSIZE;
                     (void)ncaux_class_alignment(NC_VLEN,&(yyvsp[0].sym)->typ.alignment);
                 }
-#line 2008 "ncgeny.c"
+#line 2020 "ncgeny.c"
     break;
 
   case 31: /* compounddecl: COMPOUND typename '{' fields '}'  */
-#line 397 "ncgen.y"
+#line 398 "ncgen.y"
           {
 	    int i,j;
 	    vercheck(NC_COMPOUND);
@@ -2038,23 +2050,23 @@ yyreduce:
 	    }
 	    listsetlength(stack,stackbase);/* remove stack nodes*/
           }
-#line 2042 "ncgeny.c"
+#line 2054 "ncgeny.c"
     break;
 
   case 32: /* fields: field ';'  */
-#line 429 "ncgen.y"
+#line 430 "ncgen.y"
                     {(yyval.mark)=(yyvsp[-1].mark);}
-#line 2048 "ncgeny.c"
+#line 2060 "ncgeny.c"
     break;
 
   case 33: /* fields: fields field ';'  */
-#line 430 "ncgen.y"
+#line 431 "ncgen.y"
                               {(yyval.mark)=(yyvsp[-2].mark);}
-#line 2054 "ncgeny.c"
+#line 2066 "ncgeny.c"
     break;
 
   case 34: /* field: typeref fieldlist  */
-#line 434 "ncgen.y"
+#line 435 "ncgen.y"
         {
 	    int i;
 	    (yyval.mark)=(yyvsp[0].mark);
@@ -2066,107 +2078,107 @@ yyreduce:
 		f->typ.basetype = (yyvsp[-1].sym);
             }
         }
-#line 2070 "ncgeny.c"
+#line 2082 "ncgeny.c"
     break;
 
   case 35: /* primtype: CHAR_K  */
-#line 447 "ncgen.y"
+#line 448 "ncgen.y"
                           { (yyval.sym) = primsymbols[NC_CHAR]; }
-#line 2076 "ncgeny.c"
+#line 2088 "ncgeny.c"
     break;
 
   case 36: /* primtype: BYTE_K  */
-#line 448 "ncgen.y"
+#line 449 "ncgen.y"
                           { (yyval.sym) = primsymbols[NC_BYTE]; }
-#line 2082 "ncgeny.c"
+#line 2094 "ncgeny.c"
     break;
 
   case 37: /* primtype: SHORT_K  */
-#line 449 "ncgen.y"
+#line 450 "ncgen.y"
                           { (yyval.sym) = primsymbols[NC_SHORT]; }
-#line 2088 "ncgeny.c"
+#line 2100 "ncgeny.c"
     break;
 
   case 38: /* primtype: INT_K  */
-#line 450 "ncgen.y"
+#line 451 "ncgen.y"
                           { (yyval.sym) = primsymbols[NC_INT]; }
-#line 2094 "ncgeny.c"
+#line 2106 "ncgeny.c"
     break;
 
   case 39: /* primtype: FLOAT_K  */
-#line 451 "ncgen.y"
+#line 452 "ncgen.y"
                           { (yyval.sym) = primsymbols[NC_FLOAT]; }
-#line 2100 "ncgeny.c"
+#line 2112 "ncgeny.c"
     break;
 
   case 40: /* primtype: DOUBLE_K  */
-#line 452 "ncgen.y"
+#line 453 "ncgen.y"
                           { (yyval.sym) = primsymbols[NC_DOUBLE]; }
-#line 2106 "ncgeny.c"
+#line 2118 "ncgeny.c"
     break;
 
   case 41: /* primtype: UBYTE_K  */
-#line 453 "ncgen.y"
+#line 454 "ncgen.y"
                            { vercheck(NC_UBYTE); (yyval.sym) = primsymbols[NC_UBYTE]; }
-#line 2112 "ncgeny.c"
+#line 2124 "ncgeny.c"
     break;
 
   case 42: /* primtype: USHORT_K  */
-#line 454 "ncgen.y"
+#line 455 "ncgen.y"
                            { vercheck(NC_USHORT); (yyval.sym) = primsymbols[NC_USHORT]; }
-#line 2118 "ncgeny.c"
+#line 2130 "ncgeny.c"
     break;
 
   case 43: /* primtype: UINT_K  */
-#line 455 "ncgen.y"
+#line 456 "ncgen.y"
                            { vercheck(NC_UINT); (yyval.sym) = primsymbols[NC_UINT]; }
-#line 2124 "ncgeny.c"
+#line 2136 "ncgeny.c"
     break;
 
   case 44: /* primtype: INT64_K  */
-#line 456 "ncgen.y"
+#line 457 "ncgen.y"
                             { vercheck(NC_INT64); (yyval.sym) = primsymbols[NC_INT64]; }
-#line 2130 "ncgeny.c"
+#line 2142 "ncgeny.c"
     break;
 
   case 45: /* primtype: UINT64_K  */
-#line 457 "ncgen.y"
+#line 458 "ncgen.y"
                              { vercheck(NC_UINT64); (yyval.sym) = primsymbols[NC_UINT64]; }
-#line 2136 "ncgeny.c"
+#line 2148 "ncgeny.c"
     break;
 
   case 46: /* primtype: STRING_K  */
-#line 458 "ncgen.y"
+#line 459 "ncgen.y"
                              { vercheck(NC_STRING); (yyval.sym) = primsymbols[NC_STRING]; }
-#line 2142 "ncgeny.c"
+#line 2154 "ncgeny.c"
     break;
 
   case 48: /* dimsection: DIMENSIONS  */
-#line 462 "ncgen.y"
+#line 463 "ncgen.y"
                              {}
-#line 2148 "ncgeny.c"
+#line 2160 "ncgeny.c"
     break;
 
   case 49: /* dimsection: DIMENSIONS dimdecls  */
-#line 463 "ncgen.y"
+#line 464 "ncgen.y"
                                       {}
-#line 2154 "ncgeny.c"
+#line 2166 "ncgeny.c"
     break;
 
   case 52: /* dim_or_attr_decl: dimdeclist  */
-#line 470 "ncgen.y"
+#line 471 "ncgen.y"
                              {}
-#line 2160 "ncgeny.c"
+#line 2172 "ncgeny.c"
     break;
 
   case 53: /* dim_or_attr_decl: attrdecl  */
-#line 470 "ncgen.y"
+#line 471 "ncgen.y"
                                            {}
-#line 2166 "ncgeny.c"
+#line 2178 "ncgeny.c"
     break;
 
   case 56: /* dimdecl: dimd '=' constint  */
-#line 478 "ncgen.y"
+#line 479 "ncgen.y"
               {
 		(yyvsp[-2].sym)->dim.declsize = (size_t)extractint((yyvsp[0].constant));
 #ifdef GENDEBUG1
@@ -2174,11 +2186,11 @@ fprintf(stderr,"dimension: %s = %llu\n",(yyvsp[-2].sym)->name,(unsigned long lon
 #endif
 		reclaimconstant((yyvsp[0].constant));
 	      }
-#line 2178 "ncgeny.c"
+#line 2190 "ncgeny.c"
     break;
 
   case 57: /* dimdecl: dimd '=' NC_UNLIMITED_K  */
-#line 486 "ncgen.y"
+#line 487 "ncgen.y"
                    {
 		        (yyvsp[-2].sym)->dim.declsize = NC_UNLIMITED;
 		        (yyvsp[-2].sym)->dim.isunlimited = 1;
@@ -2186,11 +2198,11 @@ fprintf(stderr,"dimension: %s = %llu\n",(yyvsp[-2].sym)->name,(unsigned long lon
 fprintf(stderr,"dimension: %s = UNLIMITED\n",(yyvsp[-2].sym)->name);
 #endif
 		   }
-#line 2190 "ncgeny.c"
+#line 2202 "ncgeny.c"
     break;
 
   case 58: /* dimd: ident  */
-#line 496 "ncgen.y"
+#line 497 "ncgen.y"
                    {
                      (yyvsp[0].sym)->objectclass=NC_DIM;
                      if(dupobjectcheck(NC_DIM,(yyvsp[0].sym)))
@@ -2200,35 +2212,35 @@ fprintf(stderr,"dimension: %s = UNLIMITED\n",(yyvsp[-2].sym)->name);
 		     (yyval.sym)=(yyvsp[0].sym);
 		     listpush(dimdefs,(void*)(yyvsp[0].sym));
                    }
-#line 2204 "ncgeny.c"
+#line 2216 "ncgeny.c"
     break;
 
   case 60: /* vasection: VARIABLES  */
-#line 508 "ncgen.y"
+#line 509 "ncgen.y"
                             {}
-#line 2210 "ncgeny.c"
+#line 2222 "ncgeny.c"
     break;
 
   case 61: /* vasection: VARIABLES vadecls  */
-#line 509 "ncgen.y"
+#line 510 "ncgen.y"
                                     {}
-#line 2216 "ncgeny.c"
+#line 2228 "ncgeny.c"
     break;
 
   case 64: /* vadecl_or_attr: vardecl  */
-#line 516 "ncgen.y"
+#line 517 "ncgen.y"
                         {}
-#line 2222 "ncgeny.c"
+#line 2234 "ncgeny.c"
     break;
 
   case 65: /* vadecl_or_attr: attrdecl  */
-#line 516 "ncgen.y"
+#line 517 "ncgen.y"
                                       {}
-#line 2228 "ncgeny.c"
+#line 2240 "ncgeny.c"
     break;
 
   case 66: /* vardecl: typeref varlist  */
-#line 519 "ncgen.y"
+#line 520 "ncgen.y"
                 {
 		    int i;
 		    stackbase=(yyvsp[0].mark);
@@ -2248,25 +2260,25 @@ fprintf(stderr,"dimension: %s = UNLIMITED\n",(yyvsp[-2].sym)->name);
 		    }
 		    listsetlength(stack,stackbase);/* remove stack nodes*/
 		}
-#line 2252 "ncgeny.c"
+#line 2264 "ncgeny.c"
     break;
 
   case 67: /* varlist: varspec  */
-#line 541 "ncgen.y"
+#line 542 "ncgen.y"
                 {(yyval.mark)=listlength(stack);
                  listpush(stack,(void*)(yyvsp[0].sym));
 		}
-#line 2260 "ncgeny.c"
+#line 2272 "ncgeny.c"
     break;
 
   case 68: /* varlist: varlist ',' varspec  */
-#line 545 "ncgen.y"
+#line 546 "ncgen.y"
                 {(yyval.mark)=(yyvsp[-2].mark); listpush(stack,(void*)(yyvsp[0].sym));}
-#line 2266 "ncgeny.c"
+#line 2278 "ncgeny.c"
     break;
 
   case 69: /* varspec: varident dimspec  */
-#line 549 "ncgen.y"
+#line 550 "ncgen.y"
                     {
 		    int i;
 		    Dimset dimset;
@@ -2293,35 +2305,35 @@ fprintf(stderr,"dimension: %s = UNLIMITED\n",(yyvsp[-2].sym)->name);
 		    listsetlength(stack,stackbase);/* remove stack nodes*/
 		    (yyval.sym) = var;
 		    }
-#line 2297 "ncgeny.c"
+#line 2309 "ncgeny.c"
     break;
 
   case 70: /* dimspec: %empty  */
-#line 577 "ncgen.y"
+#line 578 "ncgen.y"
                             {(yyval.mark)=listlength(stack);}
-#line 2303 "ncgeny.c"
+#line 2315 "ncgeny.c"
     break;
 
   case 71: /* dimspec: '(' dimlist ')'  */
-#line 578 "ncgen.y"
+#line 579 "ncgen.y"
                                   {(yyval.mark)=(yyvsp[-1].mark);}
-#line 2309 "ncgeny.c"
+#line 2321 "ncgeny.c"
     break;
 
   case 72: /* dimlist: dimref  */
-#line 581 "ncgen.y"
+#line 582 "ncgen.y"
                        {(yyval.mark)=listlength(stack); listpush(stack,(void*)(yyvsp[0].sym));}
-#line 2315 "ncgeny.c"
+#line 2327 "ncgeny.c"
     break;
 
   case 73: /* dimlist: dimlist ',' dimref  */
-#line 583 "ncgen.y"
+#line 584 "ncgen.y"
                     {(yyval.mark)=(yyvsp[-2].mark); listpush(stack,(void*)(yyvsp[0].sym));}
-#line 2321 "ncgeny.c"
+#line 2333 "ncgeny.c"
     break;
 
   case 74: /* dimref: path  */
-#line 587 "ncgen.y"
+#line 588 "ncgen.y"
             {Symbol* dimsym = (yyvsp[0].sym);
 		dimsym->objectclass = NC_DIM;
 		/* Find the actual dimension*/
@@ -2332,25 +2344,25 @@ fprintf(stderr,"dimension: %s = UNLIMITED\n",(yyvsp[-2].sym)->name);
 		}
 		(yyval.sym)=dimsym;
 	    }
-#line 2336 "ncgeny.c"
+#line 2348 "ncgeny.c"
     break;
 
   case 75: /* fieldlist: fieldspec  */
-#line 601 "ncgen.y"
+#line 602 "ncgen.y"
             {(yyval.mark)=listlength(stack);
              listpush(stack,(void*)(yyvsp[0].sym));
 	    }
-#line 2344 "ncgeny.c"
+#line 2356 "ncgeny.c"
     break;
 
   case 76: /* fieldlist: fieldlist ',' fieldspec  */
-#line 605 "ncgen.y"
+#line 606 "ncgen.y"
             {(yyval.mark)=(yyvsp[-2].mark); listpush(stack,(void*)(yyvsp[0].sym));}
-#line 2350 "ncgeny.c"
+#line 2362 "ncgeny.c"
     break;
 
   case 77: /* fieldspec: ident fielddimspec  */
-#line 610 "ncgen.y"
+#line 611 "ncgen.y"
             {
 		int i;
 		Dimset dimset;
@@ -2377,35 +2389,35 @@ fprintf(stderr,"dimension: %s = UNLIMITED\n",(yyvsp[-2].sym)->name);
 		listsetlength(stack,stackbase);/* remove stack nodes*/
 		(yyval.sym) = (yyvsp[-1].sym);
 	    }
-#line 2381 "ncgeny.c"
+#line 2393 "ncgeny.c"
     break;
 
   case 78: /* fielddimspec: %empty  */
-#line 638 "ncgen.y"
+#line 639 "ncgen.y"
                                  {(yyval.mark)=listlength(stack);}
-#line 2387 "ncgeny.c"
+#line 2399 "ncgeny.c"
     break;
 
   case 79: /* fielddimspec: '(' fielddimlist ')'  */
-#line 639 "ncgen.y"
+#line 640 "ncgen.y"
                                        {(yyval.mark)=(yyvsp[-1].mark);}
-#line 2393 "ncgeny.c"
+#line 2405 "ncgeny.c"
     break;
 
   case 80: /* fielddimlist: fielddim  */
-#line 643 "ncgen.y"
+#line 644 "ncgen.y"
                    {(yyval.mark)=listlength(stack); listpush(stack,(void*)(yyvsp[0].sym));}
-#line 2399 "ncgeny.c"
+#line 2411 "ncgeny.c"
     break;
 
   case 81: /* fielddimlist: fielddimlist ',' fielddim  */
-#line 645 "ncgen.y"
+#line 646 "ncgen.y"
             {(yyval.mark)=(yyvsp[-2].mark); listpush(stack,(void*)(yyvsp[0].sym));}
-#line 2405 "ncgeny.c"
+#line 2417 "ncgeny.c"
     break;
 
   case 82: /* fielddim: UINT_CONST  */
-#line 650 "ncgen.y"
+#line 651 "ncgen.y"
             {  /* Anonymous integer dimension.
 	         Can only occur in type definitions*/
 	     char anon[32];
@@ -2415,11 +2427,11 @@ fprintf(stderr,"dimension: %s = UNLIMITED\n",(yyvsp[-2].sym)->name);
 	     (yyval.sym)->dim.isconstant = 1;
 	     (yyval.sym)->dim.declsize = uint32_val;
 	    }
-#line 2419 "ncgeny.c"
+#line 2431 "ncgeny.c"
     break;
 
   case 83: /* fielddim: INT_CONST  */
-#line 660 "ncgen.y"
+#line 661 "ncgen.y"
             {  /* Anonymous integer dimension.
 	         Can only occur in type definitions*/
 	     char anon[32];
@@ -2433,11 +2445,11 @@ fprintf(stderr,"dimension: %s = UNLIMITED\n",(yyvsp[-2].sym)->name);
 	     (yyval.sym)->dim.isconstant = 1;
 	     (yyval.sym)->dim.declsize = int32_val;
 	    }
-#line 2437 "ncgeny.c"
+#line 2449 "ncgeny.c"
     break;
 
   case 84: /* varref: ambiguous_ref  */
-#line 680 "ncgen.y"
+#line 681 "ncgen.y"
             {Symbol* vsym = (yyvsp[0].sym);
 		if(vsym->objectclass != NC_VAR) {
 		    derror("Undefined or forward referenced variable: %s",vsym->name);
@@ -2445,11 +2457,11 @@ fprintf(stderr,"dimension: %s = UNLIMITED\n",(yyvsp[-2].sym)->name);
 		}
 		(yyval.sym)=vsym;
 	    }
-#line 2449 "ncgeny.c"
+#line 2461 "ncgeny.c"
     break;
 
   case 85: /* typeref: ambiguous_ref  */
-#line 691 "ncgen.y"
+#line 692 "ncgen.y"
             {Symbol* tsym = (yyvsp[0].sym);
 		if(tsym->objectclass != NC_TYPE) {
 		    derror("Undefined or forward referenced type: %s",tsym->name);
@@ -2457,11 +2469,11 @@ fprintf(stderr,"dimension: %s = UNLIMITED\n",(yyvsp[-2].sym)->name);
 		}
 		(yyval.sym)=tsym;
 	    }
-#line 2461 "ncgeny.c"
+#line 2473 "ncgeny.c"
     break;
 
   case 86: /* ambiguous_ref: path  */
-#line 702 "ncgen.y"
+#line 703 "ncgen.y"
             {Symbol* tvsym = (yyvsp[0].sym); Symbol* sym;
 		/* disambiguate*/
 		tvsym->objectclass = NC_VAR;
@@ -2480,53 +2492,53 @@ fprintf(stderr,"dimension: %s = UNLIMITED\n",(yyvsp[-2].sym)->name);
 		}
 		(yyval.sym)=tvsym;
 	    }
-#line 2484 "ncgeny.c"
+#line 2496 "ncgeny.c"
     break;
 
   case 87: /* ambiguous_ref: primtype  */
-#line 720 "ncgen.y"
+#line 721 "ncgen.y"
                    {(yyval.sym)=(yyvsp[0].sym);}
-#line 2490 "ncgeny.c"
+#line 2502 "ncgeny.c"
     break;
 
   case 88: /* attrdecllist: %empty  */
-#line 727 "ncgen.y"
+#line 728 "ncgen.y"
                         {}
-#line 2496 "ncgeny.c"
+#line 2508 "ncgeny.c"
     break;
 
   case 89: /* attrdecllist: attrdecl ';' attrdecllist  */
-#line 727 "ncgen.y"
+#line 728 "ncgen.y"
                                                        {}
-#line 2502 "ncgeny.c"
+#line 2514 "ncgeny.c"
     break;
 
   case 90: /* attrdecl: ':' _NCPROPS '=' conststring  */
-#line 731 "ncgen.y"
+#line 732 "ncgen.y"
             {(yyval.sym) = makespecial(_NCPROPS_FLAG,NULL,NULL,(void*)(yyvsp[0].constant),ISCONST);}
-#line 2508 "ncgeny.c"
+#line 2520 "ncgeny.c"
     break;
 
   case 91: /* attrdecl: ':' _ISNETCDF4 '=' constbool  */
-#line 733 "ncgen.y"
+#line 734 "ncgen.y"
             {(yyval.sym) = makespecial(_ISNETCDF4_FLAG,NULL,NULL,(void*)(yyvsp[0].constant),ISCONST);}
-#line 2514 "ncgeny.c"
+#line 2526 "ncgeny.c"
     break;
 
   case 92: /* attrdecl: ':' _SUPERBLOCK '=' constint  */
-#line 735 "ncgen.y"
+#line 736 "ncgen.y"
             {(yyval.sym) = makespecial(_SUPERBLOCK_FLAG,NULL,NULL,(void*)(yyvsp[0].constant),ISCONST);}
-#line 2520 "ncgeny.c"
+#line 2532 "ncgeny.c"
     break;
 
   case 93: /* attrdecl: ':' ident '=' datalist  */
-#line 737 "ncgen.y"
+#line 738 "ncgen.y"
             { (yyval.sym)=makeattribute((yyvsp[-2].sym),NULL,NULL,(yyvsp[0].datalist),ATTRGLOBAL);}
-#line 2526 "ncgeny.c"
+#line 2538 "ncgeny.c"
     break;
 
   case 94: /* attrdecl: typeref ambiguous_ref ':' ident '=' datalist  */
-#line 739 "ncgen.y"
+#line 740 "ncgen.y"
             {Symbol* tsym = (yyvsp[-5].sym); Symbol* vsym = (yyvsp[-4].sym); Symbol* asym = (yyvsp[-2].sym);
 		if(vsym->objectclass == NC_VAR) {
 		    (yyval.sym)=makeattribute(asym,vsym,tsym,(yyvsp[0].datalist),ATTRVAR);
@@ -2535,11 +2547,11 @@ fprintf(stderr,"dimension: %s = UNLIMITED\n",(yyvsp[-2].sym)->name);
 		    YYABORT;
 		}
 	    }
-#line 2539 "ncgeny.c"
+#line 2551 "ncgeny.c"
     break;
 
   case 95: /* attrdecl: ambiguous_ref ':' ident '=' datalist  */
-#line 748 "ncgen.y"
+#line 749 "ncgen.y"
             {Symbol* sym = (yyvsp[-4].sym); Symbol* asym = (yyvsp[-2].sym);
 		if(sym->objectclass == NC_VAR) {
 		    (yyval.sym)=makeattribute(asym,sym,NULL,(yyvsp[0].datalist),ATTRVAR);
@@ -2550,381 +2562,401 @@ fprintf(stderr,"dimension: %s = UNLIMITED\n",(yyvsp[-2].sym)->name);
 		    YYABORT;
 		}
 	    }
-#line 2554 "ncgeny.c"
+#line 2566 "ncgeny.c"
     break;
 
   case 96: /* attrdecl: ambiguous_ref ':' _FILLVALUE '=' datalist  */
-#line 759 "ncgen.y"
+#line 760 "ncgen.y"
             {(yyval.sym) = makespecial(_FILLVALUE_FLAG,(yyvsp[-4].sym),NULL,(void*)(yyvsp[0].datalist),ISLIST);}
-#line 2560 "ncgeny.c"
+#line 2572 "ncgeny.c"
     break;
 
   case 97: /* attrdecl: typeref ambiguous_ref ':' _FILLVALUE '=' datalist  */
-#line 761 "ncgen.y"
+#line 762 "ncgen.y"
             {(yyval.sym) = makespecial(_FILLVALUE_FLAG,(yyvsp[-4].sym),(yyvsp[-5].sym),(void*)(yyvsp[0].datalist),ISLIST);}
-#line 2566 "ncgeny.c"
+#line 2578 "ncgeny.c"
     break;
 
   case 98: /* attrdecl: ambiguous_ref ':' _STORAGE '=' conststring  */
-#line 763 "ncgen.y"
+#line 764 "ncgen.y"
             {(yyval.sym) = makespecial(_STORAGE_FLAG,(yyvsp[-4].sym),NULL,(void*)(yyvsp[0].constant),ISCONST);}
-#line 2572 "ncgeny.c"
+#line 2584 "ncgeny.c"
     break;
 
   case 99: /* attrdecl: ambiguous_ref ':' _CHUNKSIZES '=' intlist  */
-#line 765 "ncgen.y"
+#line 766 "ncgen.y"
             {(yyval.sym) = makespecial(_CHUNKSIZES_FLAG,(yyvsp[-4].sym),NULL,(void*)(yyvsp[0].datalist),ISLIST);}
-#line 2578 "ncgeny.c"
+#line 2590 "ncgeny.c"
     break;
 
   case 100: /* attrdecl: ambiguous_ref ':' _FLETCHER32 '=' constbool  */
-#line 767 "ncgen.y"
+#line 768 "ncgen.y"
             {(yyval.sym) = makespecial(_FLETCHER32_FLAG,(yyvsp[-4].sym),NULL,(void*)(yyvsp[0].constant),ISCONST);}
-#line 2584 "ncgeny.c"
+#line 2596 "ncgeny.c"
     break;
 
   case 101: /* attrdecl: ambiguous_ref ':' _DEFLATELEVEL '=' constint  */
-#line 769 "ncgen.y"
+#line 770 "ncgen.y"
             {(yyval.sym) = makespecial(_DEFLATE_FLAG,(yyvsp[-4].sym),NULL,(void*)(yyvsp[0].constant),ISCONST);}
-#line 2590 "ncgeny.c"
+#line 2602 "ncgeny.c"
     break;
 
   case 102: /* attrdecl: ambiguous_ref ':' _SHUFFLE '=' constbool  */
-#line 771 "ncgen.y"
+#line 772 "ncgen.y"
             {(yyval.sym) = makespecial(_SHUFFLE_FLAG,(yyvsp[-4].sym),NULL,(void*)(yyvsp[0].constant),ISCONST);}
-#line 2596 "ncgeny.c"
+#line 2608 "ncgeny.c"
     break;
 
   case 103: /* attrdecl: ambiguous_ref ':' _ENDIANNESS '=' conststring  */
-#line 773 "ncgen.y"
+#line 774 "ncgen.y"
             {(yyval.sym) = makespecial(_ENDIAN_FLAG,(yyvsp[-4].sym),NULL,(void*)(yyvsp[0].constant),ISCONST);}
-#line 2602 "ncgeny.c"
+#line 2614 "ncgeny.c"
     break;
 
   case 104: /* attrdecl: ambiguous_ref ':' _FILTER '=' conststring  */
-#line 775 "ncgen.y"
+#line 776 "ncgen.y"
             {(yyval.sym) = makespecial(_FILTER_FLAG,(yyvsp[-4].sym),NULL,(void*)(yyvsp[0].constant),ISCONST);}
-#line 2608 "ncgeny.c"
+#line 2620 "ncgeny.c"
     break;
 
   case 105: /* attrdecl: ambiguous_ref ':' _CODECS '=' conststring  */
-#line 777 "ncgen.y"
+#line 778 "ncgen.y"
             {(yyval.sym) = makespecial(_CODECS_FLAG,(yyvsp[-4].sym),NULL,(void*)(yyvsp[0].constant),ISCONST);}
-#line 2614 "ncgeny.c"
+#line 2626 "ncgeny.c"
     break;
 
   case 106: /* attrdecl: ambiguous_ref ':' _QUANTIZEBG '=' constint  */
-#line 779 "ncgen.y"
+#line 780 "ncgen.y"
             {(yyval.sym) = makespecial(_QUANTIZEBG_FLAG,(yyvsp[-4].sym),NULL,(void*)(yyvsp[0].constant),ISCONST);}
-#line 2620 "ncgeny.c"
+#line 2632 "ncgeny.c"
     break;
 
   case 107: /* attrdecl: ambiguous_ref ':' _QUANTIZEGBR '=' constint  */
-#line 781 "ncgen.y"
+#line 782 "ncgen.y"
             {(yyval.sym) = makespecial(_QUANTIZEGBR_FLAG,(yyvsp[-4].sym),NULL,(void*)(yyvsp[0].constant),ISCONST);}
-#line 2626 "ncgeny.c"
+#line 2638 "ncgeny.c"
     break;
 
   case 108: /* attrdecl: ambiguous_ref ':' _QUANTIZEBR '=' constint  */
-#line 783 "ncgen.y"
+#line 784 "ncgen.y"
             {(yyval.sym) = makespecial(_QUANTIZEBR_FLAG,(yyvsp[-4].sym),NULL,(void*)(yyvsp[0].constant),ISCONST);}
-#line 2632 "ncgeny.c"
+#line 2644 "ncgeny.c"
     break;
 
   case 109: /* attrdecl: ambiguous_ref ':' _NOFILL '=' constbool  */
-#line 785 "ncgen.y"
+#line 786 "ncgen.y"
             {(yyval.sym) = makespecial(_NOFILL_FLAG,(yyvsp[-4].sym),NULL,(void*)(yyvsp[0].constant),ISCONST);}
-#line 2638 "ncgeny.c"
+#line 2650 "ncgeny.c"
     break;
 
   case 110: /* attrdecl: ':' _FORMAT '=' conststring  */
-#line 787 "ncgen.y"
+#line 788 "ncgen.y"
             {(yyval.sym) = makespecial(_FORMAT_FLAG,NULL,NULL,(void*)(yyvsp[0].constant),ISCONST);}
-#line 2644 "ncgeny.c"
+#line 2656 "ncgeny.c"
     break;
 
   case 111: /* path: ident  */
-#line 792 "ncgen.y"
+#line 793 "ncgen.y"
             {
 	        (yyval.sym)=(yyvsp[0].sym);
                 (yyvsp[0].sym)->ref.is_ref=1;
                 (yyvsp[0].sym)->is_prefixed=0;
                 setpathcurrent((yyvsp[0].sym));
 	    }
-#line 2655 "ncgeny.c"
+#line 2667 "ncgeny.c"
     break;
 
   case 112: /* path: PATH  */
-#line 799 "ncgen.y"
+#line 800 "ncgen.y"
             {
 	        (yyval.sym)=(yyvsp[0].sym);
                 (yyvsp[0].sym)->ref.is_ref=1;
                 (yyvsp[0].sym)->is_prefixed=1;
 	        /* path is set in ncgen.l*/
 	    }
-#line 2666 "ncgeny.c"
+#line 2678 "ncgeny.c"
     break;
 
-  case 114: /* datasection: DATA  */
-#line 808 "ncgen.y"
-                       {}
-#line 2672 "ncgeny.c"
+  case 114: /* datasection: datastart  */
+#line 809 "ncgen.y"
+                            {}
+#line 2684 "ncgeny.c"
     break;
 
-  case 115: /* datasection: DATA datadecls  */
-#line 809 "ncgen.y"
-                                 {}
-#line 2678 "ncgeny.c"
+  case 115: /* datasection: datastart datadecls  */
+#line 810 "ncgen.y"
+                                      {}
+#line 2690 "ncgeny.c"
     break;
 
-  case 118: /* datadecl: varref '=' datalist  */
-#line 817 "ncgen.y"
-                   {(yyvsp[-2].sym)->data = (yyvsp[0].datalist);}
-#line 2684 "ncgeny.c"
+  case 116: /* datastart: DATA  */
+#line 814 "ncgen.y"
+                   {if(currentgroup() == rootgroup) startdata();}
+#line 2696 "ncgeny.c"
     break;
 
-  case 119: /* datalist: datalist0  */
-#line 820 "ncgen.y"
+  case 119: /* $@3: %empty  */
+#line 822 "ncgen.y"
+                   {if(streaming) genbin_startvardata((yyvsp[-1].sym));}
+#line 2702 "ncgeny.c"
+    break;
+
+  case 120: /* datadecl: varref '=' $@3 datalist  */
+#line 824 "ncgen.y"
+                   {(yyvsp[-3].sym)->data = (yyvsp[0].datalist);
+                    if(streaming) genbin_streamvardata((yyvsp[-3].sym));}
+#line 2709 "ncgeny.c"
+    break;
+
+  case 121: /* datalist: datalist0  */
+#line 828 "ncgen.y"
                     {(yyval.datalist) = (yyvsp[0].datalist);}
-#line 2690 "ncgeny.c"
+#line 2715 "ncgeny.c"
     break;
 
-  case 120: /* datalist: datalist1  */
-#line 821 "ncgen.y"
+  case 122: /* datalist: datalist1  */
+#line 829 "ncgen.y"
                     {(yyval.datalist) = (yyvsp[0].datalist);}
-#line 2696 "ncgeny.c"
+#line 2721 "ncgeny.c"
     break;
 
-  case 121: /* datalist0: %empty  */
-#line 825 "ncgen.y"
+  case 123: /* datalist0: %empty  */
+#line 833 "ncgen.y"
                   {(yyval.datalist) = builddatalist(0);}
-#line 2702 "ncgeny.c"
+#line 2727 "ncgeny.c"
     break;
 
-  case 122: /* datalist1: dataitem  */
-#line 829 "ncgen.y"
+  case 124: /* datalist1: dataitem  */
+#line 837 "ncgen.y"
                    {(yyval.datalist) = const2list((yyvsp[0].constant));}
-#line 2708 "ncgeny.c"
+#line 2733 "ncgeny.c"
     break;
 
-  case 123: /* datalist1: datalist ',' dataitem  */
-#line 831 "ncgen.y"
-            {dlappend((yyvsp[-2].datalist),((yyvsp[0].constant))); (yyval.datalist)=(yyvsp[-2].datalist); }
-#line 2714 "ncgeny.c"
+  case 125: /* datalist1: datalist ',' dataitem  */
+#line 839 "ncgen.y"
+            {dlappend((yyvsp[-2].datalist),((yyvsp[0].constant))); (yyval.datalist)=(yyvsp[-2].datalist);
+	     if(streaming && datadepth == 0) genbin_streamvarblock((yyvsp[-2].datalist));}
+#line 2740 "ncgeny.c"
     break;
 
-  case 124: /* dataitem: constdata  */
-#line 835 "ncgen.y"
+  case 126: /* dataitem: constdata  */
+#line 844 "ncgen.y"
                     {(yyval.constant)=(yyvsp[0].constant);}
-#line 2720 "ncgeny.c"
+#line 2746 "ncgeny.c"
+    break;
+
+  case 127: /* $@4: %empty  */
+#line 845 "ncgen.y"
+              {datadepth++;}
+#line 2752 "ncgeny.c"
     break;
 
-  case 125: /* dataitem: '{' datalist '}'  */
-#line 836 "ncgen.y"
-                           {(yyval.constant)=builddatasublist((yyvsp[-1].datalist));}
-#line 2726 "ncgeny.c"
+  case 128: /* dataitem: '{' $@4 datalist '}'  */
+#line 845 "ncgen.y"
+                                          {datadepth--; (yyval.constant)=builddatasublist((yyvsp[-1].datalist));}
+#line 2758 "ncgeny.c"
     break;
 
-  case 126: /* constdata: simpleconstant  */
-#line 840 "ncgen.y"
+  case 129: /* constdata: simpleconstant  */
+#line 849 "ncgen.y"
                               {(yyval.constant)=(yyvsp[0].constant);}
-#line 2732 "ncgeny.c"
+#line 2764 "ncgeny.c"
     break;
 
-  case 127: /* constdata: OPAQUESTRING  */
-#line 841 "ncgen.y"
+  case 130: /* constdata: OPAQUESTRING  */
+#line 850 "ncgen.y"
                         {(yyval.constant)=makeconstdata(NC_OPAQUE);}
-#line 2738 "ncgeny.c"
+#line 2770 "ncgeny.c"
     break;
 
-  case 128: /* constdata: FILLMARKER  */
-#line 842 "ncgen.y"
+  case 131: /* constdata: FILLMARKER  */
+#line 851 "ncgen.y"
                         {(yyval.constant)=makeconstdata(NC_FILLVALUE);}
-#line 2744 "ncgeny.c"
+#line 2776 "ncgeny.c"
     break;
 
-  case 129: /* constdata: NIL  */
-#line 843 "ncgen.y"
+  case 132: /* constdata: NIL  */
+#line 852 "ncgen.y"
                         {(yyval.constant)=makeconstdata(NC_NIL);}
-#line 2750 "ncgeny.c"
+#line 2782 "ncgeny.c"
     break;
 
-  case 130: /* constdata: econstref  */
-#line 844 "ncgen.y"
+  case 133: /* constdata: econstref  */
+#line 853 "ncgen.y"
                         {(yyval.constant)=(yyvsp[0].constant);}
-#line 2756 "ncgeny.c"
+#line 2788 "ncgeny.c"
     break;
 
-  case 132: /* econstref: path  */
-#line 849 "ncgen.y"
+  case 135: /* econstref: path  */
+#line 858 "ncgen.y"
              {(yyval.constant) = makeenumconstref((yyvsp[0].sym));}
-#line 2762 "ncgeny.c"
+#line 2794 "ncgeny.c"
     break;
 
-  case 133: /* function: ident '(' arglist ')'  */
-#line 853 "ncgen.y"
+  case 136: /* function: ident '(' arglist ')'  */
+#line 862 "ncgen.y"
                               {(yyval.constant)=evaluate((yyvsp[-3].sym),(yyvsp[-1].datalist));}
-#line 2768 "ncgeny.c"
+#line 2800 "ncgeny.c"
     break;
 
-  case 134: /* arglist: simpleconstant  */
-#line 858 "ncgen.y"
+  case 137: /* arglist: simpleconstant  */
+#line 867 "ncgen.y"
             {(yyval.datalist) = const2list((yyvsp[0].constant));}
-#line 2774 "ncgeny.c"
+#line 2806 "ncgeny.c"
     break;
 
-  case 135: /* arglist: arglist ',' simpleconstant  */
-#line 860 "ncgen.y"
+  case 138: /* arglist: arglist ',' simpleconstant  */
+#line 869 "ncgen.y"
             {dlappend((yyvsp[-2].datalist),((yyvsp[0].constant))); (yyval.datalist)=(yyvsp[-2].datalist);}
-#line 2780 "ncgeny.c"
+#line 2812 "ncgeny.c"
     break;
 
-  case 136: /* simpleconstant: CHAR_CONST  */
-#line 864 "ncgen.y"
+  case 139: /* simpleconstant: CHAR_CONST  */
+#line 873 "ncgen.y"
                         {(yyval.constant)=makeconstdata(NC_CHAR);}
-#line 2786 "ncgeny.c"
+#line 2818 "ncgeny.c"
     break;
 
-  case 137: /* simpleconstant: BYTE_CONST  */
-#line 865 "ncgen.y"
+  case 140: /* simpleconstant: BYTE_CONST  */
+#line 874 "ncgen.y"
                         {(yyval.constant)=makeconstdata(NC_BYTE);}
-#line 2792 "ncgeny.c"
+#line 2824 "ncgeny.c"
     break;
 
-  case 138: /* simpleconstant: SHORT_CONST  */
-#line 866 "ncgen.y"
+  case 141: /* simpleconstant: SHORT_CONST  */
+#line 875 "ncgen.y"
                         {(yyval.constant)=makeconstdata(NC_SHORT);}
-#line 2798 "ncgeny.c"
+#line 2830 "ncgeny.c"
     break;
 
-  case 139: /* simpleconstant: INT_CONST  */
-#line 867 "ncgen.y"
+  case 142: /* simpleconstant: INT_CONST  */
+#line 876 "ncgen.y"
                         {(yyval.constant)=makeconstdata(NC_INT);}
-#line 2804 "ncgeny.c"
+#line 2836 "ncgeny.c"
     break;
 
-  case 140: /* simpleconstant: INT64_CONST  */
-#line 868 "ncgen.y"
+  case 143: /* simpleconstant: INT64_CONST  */
+#line 877 "ncgen.y"
                         {(yyval.constant)=makeconstdata(NC_INT64);}
-#line 2810 "ncgeny.c"
+#line 2842 "ncgeny.c"
     break;
 
-  case 141: /* simpleconstant: UBYTE_CONST  */
-#line 869 "ncgen.y"
+  case 144: /* simpleconstant: UBYTE_CONST  */
+#line 878 "ncgen.y"
                         {(yyval.constant)=makeconstdata(NC_UBYTE);}
-#line 2816 "ncgeny.c"
+#line 2848 "ncgeny.c"
     break;
 
-  case 142: /* simpleconstant: USHORT_CONST  */
-#line 870 "ncgen.y"
+  case 145: /* simpleconstant: USHORT_CONST  */
+#line 879 "ncgen.y"
                         {(yyval.constant)=makeconstdata(NC_USHORT);}
-#line 2822 "ncgeny.c"
+#line 2854 "ncgeny.c"
     break;
 
-  case 143: /* simpleconstant: UINT_CONST  */
-#line 871 "ncgen.y"
+  case 146: /* simpleconstant: UINT_CONST  */
+#line 880 "ncgen.y"
                         {(yyval.constant)=makeconstdata(NC_UINT);}
-#line 2828 "ncgeny.c"
+#line 2860 "ncgeny.c"
     break;
 
-  case 144: /* simpleconstant: UINT64_CONST  */
-#line 872 "ncgen.y"
+  case 147: /* simpleconstant: UINT64_CONST  */
+#line 881 "ncgen.y"
                         {(yyval.constant)=makeconstdata(NC_UINT64);}
-#line 2834 "ncgeny.c"
+#line 2866 "ncgeny.c"
     break;
 
-  case 145: /* simpleconstant: FLOAT_CONST  */
-#line 873 "ncgen.y"
+  case 148: /* simpleconstant: FLOAT_CONST  */
+#line 882 "ncgen.y"
                         {(yyval.constant)=makeconstdata(NC_FLOAT);}
-#line 2840 "ncgeny.c"
+#line 2872 "ncgeny.c"
     break;
 
-  case 146: /* simpleconstant: DOUBLE_CONST  */
-#line 874 "ncgen.y"
+  case 149: /* simpleconstant: DOUBLE_CONST  */
+#line 883 "ncgen.y"
                         {(yyval.constant)=makeconstdata(NC_DOUBLE);}
-#line 2846 "ncgeny.c"
+#line 2878 "ncgeny.c"
     break;
 
-  case 147: /* simpleconstant: TERMSTRING  */
-#line 875 "ncgen.y"
+  case 150: /* simpleconstant: TERMSTRING  */
+#line 884 "ncgen.y"
                         {(yyval.constant)=makeconstdata(NC_STRING);}
-#line 2852 "ncgeny.c"
+#line 2884 "ncgeny.c"
     break;
 
-  case 148: /* intlist: constint  */
-#line 879 "ncgen.y"
+  case 151: /* intlist: constint  */
+#line 888 "ncgen.y"
                    {(yyval.datalist) = const2list((yyvsp[0].constant));}
-#line 2858 "ncgeny.c"
+#line 2890 "ncgeny.c"
     break;
 
-  case 149: /* intlist: intlist ',' constint  */
-#line 880 "ncgen.y"
+  case 152: /* intlist: intlist ',' constint  */
+#line 889 "ncgen.y"
                                {(yyval.datalist)=(yyvsp[-2].datalist); dlappend((yyvsp[-2].datalist),((yyvsp[0].constant)));}
-#line 2864 "ncgeny.c"
+#line 2896 "ncgeny.c"
     break;
 
-  case 150: /* constint: INT_CONST  */
-#line 885 "ncgen.y"
+  case 153: /* constint: INT_CONST  */
+#line 894 "ncgen.y"
                 {(yyval.constant)=makeconstdata(NC_INT);}
-#line 2870 "ncgeny.c"
+#line 2902 "ncgeny.c"
     break;
 
-  case 151: /* constint: UINT_CONST  */
-#line 887 "ncgen.y"
+  case 154: /* constint: UINT_CONST  */
+#line 896 "ncgen.y"
                 {(yyval.constant)=makeconstdata(NC_UINT);}
-#line 2876 "ncgeny.c"
+#line 2908 "ncgeny.c"
     break;
 
-  case 152: /* constint: INT64_CONST  */
-#line 889 "ncgen.y"
+  case 155: /* constint: INT64_CONST  */
+#line 898 "ncgen.y"
                 {(yyval.constant)=makeconstdata(NC_INT64);}
-#line 2882 "ncgeny.c"
+#line 2914 "ncgeny.c"
     break;
 
-  case 153: /* constint: UINT64_CONST  */
-#line 891 "ncgen.y"
+  case 156: /* constint: UINT64_CONST  */
+#line 900 "ncgen.y"
                 {(yyval.constant)=makeconstdata(NC_UINT64);}
-#line 2888 "ncgeny.c"
+#line 2920 "ncgeny.c"
     break;
 
-  case 154: /* conststring: TERMSTRING  */
-#line 895 "ncgen.y"
+  case 157: /* conststring: TERMSTRING  */
+#line 904 "ncgen.y"
                         {(yyval.constant)=makeconstdata(NC_STRING);}
-#line 2894 "ncgeny.c"
+#line 2926 "ncgeny.c"
     break;
 
-  case 155: /* constbool: conststring  */
-#line 899 "ncgen.y"
+  case 158: /* constbool: conststring  */
+#line 908 "ncgen.y"
                       {(yyval.constant)=(yyvsp[0].constant);}
-#line 2900 "ncgeny.c"
+#line 2932 "ncgeny.c"
     break;
 
-  case 156: /* constbool: constint  */
-#line 900 "ncgen.y"
+  case 159: /* constbool: constint  */
+#line 909 "ncgen.y"
                    {(yyval.constant)=(yyvsp[0].constant);}
-#line 2906 "ncgeny.c"
+#line 2938 "ncgeny.c"
     break;
 
-  case 157: /* varident: IDENT  */
-#line 908 "ncgen.y"
+  case 160: /* varident: IDENT  */
+#line 917 "ncgen.y"
                 {(yyval.sym)=(yyvsp[0].sym);}
-#line 2912 "ncgeny.c"
+#line 2944 "ncgeny.c"
     break;
 
-  case 158: /* varident: DATA  */
-#line 909 "ncgen.y"
+  case 161: /* varident: DATA  */
+#line 918 "ncgen.y"
                {(yyval.sym)=identkeyword((yyvsp[0].sym));}
-#line 2918 "ncgeny.c"
+#line 2950 "ncgeny.c"
     break;
 
-  case 159: /* ident: IDENT  */
-#line 913 "ncgen.y"
+  case 162: /* ident: IDENT  */
+#line 922 "ncgen.y"
               {(yyval.sym)=(yyvsp[0].sym);}
-#line 2924 "ncgeny.c"
+#line 2956 "ncgeny.c"
     break;
 
 
-#line 2928 "ncgeny.c"
+#line 2960 "ncgeny.c"
 
       default: break;
     }
@@ -3148,7 +3180,7 @@ yyreturnlab:
   return yyresult;
 }
 
-#line 916 "ncgen.y"
+#line 925 "ncgen.y"
 
 
 #ifndef NO_STDARG
@@ -3187,6 +3219,7 @@ parse_init(void)
     int i;
     opaqueid = 0;
     arrayuid = 0;
+    datadepth = 0;
     symlist = listnew();
     stack = listnew();
     groupstack = listnew();
@@ -27,6 +27,8 @@ static void processeconstrefs(void);
 static void processeconstrefsR(Symbol*,Datalist*);
 static void processroot(void);
 static void processvardata(void);
+static void listifyvardata(Symbol* vsym);
+static void computevarunlimitedsizes(Symbol* var);
 
 static void computefqns(void);
 static void fixeconstref(Symbol*,NCConstant* con);
@@ -1147,6 +1149,31 @@ thisunlim->name,
     }
 }
 
+/* Grow the unlimited dims of var to hold its data */
+static void
+computevarunlimitedsizes(Symbol* var)
+{
+    int first,ischar;
+    Dimset* dimset = &var->typ.dimset;
+    if(dimset->ndims == 0) return; /* ignore scalars */
+    if(var->data == NULL) return; /* no data list to walk */
+    ischar = (var->typ.basetype->typ.typecode == NC_CHAR);
+    first = findunlimited(dimset,0);
+    if(first == dimset->ndims) return; /* no unlimited dims */
+    if(first == 0) {
+	computeunlimitedsizes(dimset,first,var->data,ischar);
+    } else {
+	int j;
+	for(j=0;j<var->data->length;j++) {
+	    NCConstant* con = var->data->data[j];
+	    if(con->nctype != NC_COMPOUND)
+		semerror(con->lineno,"UNLIMITED dimension (other than first) must be enclosed in {}");
+	    else
+		computeunlimitedsizes(dimset,first,con->value.compoundv,ischar);
+	}
+    }
+}
+
 static void
 processunlimiteddims(void)
 {
@@ -1160,25 +1187,7 @@ processunlimiteddims(void)
     /* Walk all variables */
     for(i=0;i<listlength(vardefs);i++) {
 	Symbol* var = (Symbol*)listget(vardefs,i);
-	int first,ischar;
-	Dimset* dimset = &var->typ.dimset;
-	if(dimset->ndims == 0) continue; /* ignore scalars */
-	if(var->data == NULL) continue; /* no data list to walk */
-	ischar = (var->typ.basetype->typ.typecode == NC_CHAR);
-	first = findunlimited(dimset,0);
-	if(first == dimset->ndims) continue; /* no unlimited dims */
-	if(first == 0) {
-	    computeunlimitedsizes(dimset,first,var->data,ischar);
-	} else {
-	    int j;
-	    for(j=0;j<var->data->length;j++) {
-	        NCConstant* con = var->data->data[j];
-	        if(con->nctype != NC_COMPOUND)
-		    semerror(con->lineno,"UNLIMITED dimension (other than first) must be enclosed in {}");
-		else
-	            computeunlimitedsizes(dimset,first,con->value.compoundv,ischar);
-	    }
-	}
+	computevarunlimitedsizes(var);
     }
 #ifdef GENDEBUG1
     /* print unlimited dim size */
@@ -1306,6 +1315,22 @@ done:
     return result;
 }
 
+/* listify the n-dimensional data list of one var */
+static void
+listifyvardata(Symbol* vsym)
+{
+    NCConstant* con;
+    if(vsym->data == NULL || datalistlen(vsym->data) == 0) return;
+    /* Let char typed vars be handled by genchararray */
+    if(vsym->typ.basetype->typ.typecode == NC_CHAR) return;
+    con = processvardataR(vsym,&vsym->typ.dimset,vsym->data,0);
+    reclaimdatalist(vsym->data);
+    ASSERT((islistconst(con)));
+    vsym->data = compoundfor(con);
+    clearconstant(con);
+    freeconst(con);
+}
+
 /* listify n-dimensional data lists */
 static void
 processvardata(void)
@@ -1313,17 +1338,30 @@ processvardata(void)
     int i;
     for(i=0;i<listlength(vardefs);i++) {
         Symbol* vsym = (Symbol*)listget(vardefs,i);
-	NCConstant* con;
-        if(vsym->data == NULL) continue;
-	/* Let char typed vars be handled by genchararray */
-	if(vsym->typ.basetype->typ.typecode == NC_CHAR) continue;
-	con = processvardataR(vsym,&vsym->typ.dimset,vsym->data,0);
-	reclaimdatalist(vsym->data);
-	ASSERT((islistconst(con)));
-	vsym->data = compoundfor(con);
-	clearconstant(con);
-	freeconst(con);
+	listifyvardata(vsym);
+    }
+}
+
+/* Process the data of one variable of a file whose data is written
+   as it is parsed; the rest of the semantics were processed on
+   reaching the data section. The data follows the first nrecs
+   records of the first dimension, which were written already.
+*/
+void
+processstreamedvardata(Symbol* vsym, size_t nrecs)
+{
+    Dimset* dimset = &vsym->typ.dimset;
+    if(vsym->data == NULL) return;
+    processeconstrefsR(vsym,vsym->data);
+    computevarunlimitedsizes(vsym);
+    if(nrecs > 0 && dimset->dimsyms[0]->dim.isunlimited) {
+	Symbol* dim = dimset->dimsyms[0];
+	size_t recsize = crossproduct(dimset,1,dimset->ndims);
+	size_t size = nrecs + (datalistlen(vsym->data) + recsize - 1) / recsize;
+	if(dim->dim.declsize < size)
+	    dim->dim.declsize = size;
     }
+    listifyvardata(vsym);
 }
 
 /* Convert char strings to 'x''... form */
@@ -0,0 +1,58 @@
+#!/bin/sh
+
+if test "x$srcdir" = x ; then srcdir=`pwd`; fi
+. ../test_common.sh
+
+. "$srcdir/test_nczarr.sh"
+
+set -e
+
+s3isolate "testdir_consolidated"
+THISDIR=`pwd`
+cd $ISOPATH
+
+# This shell script tests support for consolidated metadata (/.zmetadata):
+# 1. nczarr write with consolidation then read
+# 2. pure zarr write with consolidation then read
+# 3. reading uses /.zmetadata in place of the per-object metadata
+
+testcase() {
+zext=$1
+
+echo "*** Test: nczarr write consolidated then read; format=$zext"
+fileargs tmp_consolidated "mode=nczarr,consolidated,$zext"
+deletemap $zext $file
+${NCGEN} -4 -b -o "$fileurl" $srcdir/ref_oldformat.cdl
+${NCDUMP} -n ref_oldformat $fileurl > tmp_consolidated_${zext}.cdl
+diff -b ${srcdir}/ref_oldformat.cdl tmp_consolidated_${zext}.cdl
+
+echo "*** Test: pure zarr write consolidated then read; format=$zext"
+fileargs tmp_consolidated_xarray "mode=zarr,consolidated,$zext"
+deletemap $zext $file
+${NCGEN} -4 -b -o "$fileurl" $srcdir/ref_purezarr_base.cdl
+${NCDUMP} -n tmp_xarray $fileurl > tmp_consolidated_xarray_${zext}.cdl
+diff -b ${srcdir}/ref_xarray.cdl tmp_consolidated_xarray_${zext}.cdl
+}
+
+testcasefile() {
+zext=file
+echo "*** Test: read metadata only from /.zmetadata; format=$zext"
+fileargs tmp_consolidated "mode=nczarr,consolidated,$zext"
+test -f ${file}/.zmetadata
+# Remove the per-variable metadata; consolidated reads must not need it
+rm -f ${file}/g1/pos/.zarray ${file}/g1/pos/.zattrs
+fileargs tmp_consolidated "mode=nczarr,$zext"
+${NCDUMP} -n ref_oldformat $fileurl > tmp_consolidated_only_${zext}.cdl
+diff -b ${srcdir}/ref_oldformat.cdl tmp_consolidated_only_${zext}.cdl
+# Without consolidation, the open must now fail
+fileargs tmp_consolidated "mode=nczarr,noconsolidated,$zext"
+if ${NCDUMP} -h $fileurl > /dev/null 2>&1 ; then
+    echo "*** FAIL: noconsolidated open succeeded"
+    exit 1
+fi
+}
+
+testcase file
+testcasefile
+if test "x$FEATURE_NCZARR_ZIP" = xyes ; then testcase zip; fi
+if test "x$FEATURE_S3TESTS" = xyes ; then testcase s3; fi
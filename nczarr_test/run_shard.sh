@@ -0,0 +1,68 @@
+#!/bin/sh
+
+if test "x$srcdir" = x ; then srcdir=`pwd`; fi
+. ../test_common.sh
+
+. "$srcdir/test_nczarr.sh"
+
+set -e
+
+s3isolate "testdir_shard"
+THISDIR=`pwd`
+cd $ISOPATH
+
+# This shell script tests support for sharded chunk storage
+
+cleanup() {
+    resetrc
+}
+
+# Setup the .rc files
+
+createrc() {
+  RCP="${ISOPATH}/.ncrc"
+  echo "Creating rc file $RCP"
+  echo "ZARR.SHARD_CHUNKS=4" >>$RCP
+}
+
+# The reference output omits the special attributes
+sed -e '/_ChunkSizes/d' -e 's/^netcdf ref_shard/netcdf tmp_shard/' < ${srcdir}/ref_shard.cdl > tmp_shard_ref.cdl
+# The same data, filtered
+sed -e 's/^\(.*\)v:_ChunkSizes = 2, 2 ;/&\
+\1v:_DeflateLevel = 1 ;\
+\1v:_Shuffle = "true" ;/' < ${srcdir}/ref_shard.cdl > tmp_shard_filter.cdl
+
+testcase() {
+zext=$1
+src=$2
+echo "*** Test: write sharded chunks then read; format=$zext source=$src"
+fileargs tmp_shard "mode=nczarr,$zext"
+deletemap $zext $file
+cleanup
+createrc
+${NCGEN} -4 -b -o "$fileurl" $src
+# Reading must not depend on the rc file
+cleanup
+${NCDUMP} -n tmp_shard $fileurl > tmp_shard_$zext.cdl
+diff -b tmp_shard_ref.cdl tmp_shard_$zext.cdl
+if test "x$zext" = xfile ; then testcasefile; fi
+echo "*** Test: partially rewrite the shards; format=$zext source=$src"
+${execdir}/test_shard $fileurl
+}
+
+testcasefile() {
+echo "*** Test: all chunks of a shard are stored in one object; format=$zext"
+# v has 4x3 chunks, all of which fit in a single 4x3 shard
+test "`ls ${file}/v | wc -l`" = 1
+test -f ${file}/v/s.0.0
+# u has 3x2 chunks and shards of 4x2 chunks along its unlimited dimension
+test "`ls ${file}/u | wc -l`" = 1
+test -f ${file}/u/s.0.0
+# Readers that do not support shards must see the shard codec
+grep -F '"_nczarr_shard"' ${file}/v/.zarray > /dev/null
+}
+
+testcase file ${srcdir}/ref_shard.cdl
+if test "x$FEATURE_FILTERTESTS" = xyes ; then testcase file tmp_shard_filter.cdl; fi
+if test "x$FEATURE_NCZARR_ZIP" = xyes ; then testcase zip ${srcdir}/ref_shard.cdl; fi
+if test "x$FEATURE_S3TESTS" = xyes ; then testcase s3 ${srcdir}/ref_shard.cdl; fi
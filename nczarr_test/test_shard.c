@@ -0,0 +1,95 @@
+/* This is part of the netCDF package.
+   Copyright 2018 University Corporation for Atmospheric Research/Unidata
+   See COPYRIGHT file for conditions of use.
+
+   Test partially rewriting the shards of an existing sharded dataset
+   created from ref_shard.cdl, with a chunk cache too small to hold
+   a shard, and reading the data back both before and after closing.
+*/
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "netcdf.h"
+
+#define ERR(r) {fprintf(stderr,"fail: line %d: (%d) %s\n",__LINE__,(r),nc_strerror((r))); exit(1);}
+#define FAIL(msg) {fprintf(stderr,"fail: line %d: %s\n",__LINE__,(msg)); exit(1);}
+
+#define NX 8
+#define NY 6
+
+/* The region of v that is rewritten */
+static const size_t vstart[2] = {1,1};
+static const size_t vcount[2] = {4,3};
+
+static int
+inregion(size_t i, size_t j)
+{
+    return (i >= vstart[0] && i < vstart[0]+vcount[0]
+            && j >= vstart[1] && j < vstart[1]+vcount[1]);
+}
+
+/* Check all of v and the new record of u */
+static void
+check(int ncid)
+{
+    int ret, vid, uid, i, j;
+    int v[NX][NY];
+    float u[NX];
+    size_t ustart[2] = {3,0};
+    size_t ucount[2] = {1,NX};
+
+    if((ret = nc_inq_varid(ncid,"v",&vid))) ERR(ret);
+    if((ret = nc_get_var_int(ncid,vid,&v[0][0]))) ERR(ret);
+    for(i=0;i<NX;i++) {
+        for(j=0;j<NY;j++) {
+            int expected = (inregion((size_t)i,(size_t)j) ? -(i*NY+j) : (i*NY+j));
+            if(v[i][j] != expected) FAIL("v has wrong data");
+        }
+    }
+    if((ret = nc_inq_varid(ncid,"u",&uid))) ERR(ret);
+    if((ret = nc_get_vara_float(ncid,uid,ustart,ucount,u))) ERR(ret);
+    for(i=0;i<NX;i++) {
+        float expected = (i < 4 ? (float)(30+i) : NC_FILL_FLOAT);
+        if(u[i] != expected) FAIL("u has wrong data");
+    }
+}
+
+int
+main(int argc, char **argv)
+{
+    int ret, ncid, vid, uid;
+    size_t i, j;
+    int v[4][3];
+    float u[4] = {30,31,32,33};
+    size_t ustart[2] = {3,0};
+    size_t ucount[2] = {1,4};
+
+    if(argc < 2) {
+	fprintf(stderr,"Usage: test_shard <url>\n");
+	exit(1);
+    }
+
+    if((ret = nc_open(argv[1],NC_WRITE,&ncid))) ERR(ret);
+    if((ret = nc_inq_varid(ncid,"v",&vid))) ERR(ret);
+    if((ret = nc_inq_varid(ncid,"u",&uid))) ERR(ret);
+    /* Room for one chunk only, so every modified chunk is evicted */
+    if((ret = nc_set_var_chunk_cache(ncid,vid,2*2*sizeof(int),1,0.0))) ERR(ret);
+    if((ret = nc_set_var_chunk_cache(ncid,uid,4*sizeof(float),1,0.0))) ERR(ret);
+    for(i=0;i<vcount[0];i++)
+        for(j=0;j<vcount[1];j++)
+            v[i][j] = -(int)((vstart[0]+i)*NY+(vstart[1]+j));
+    if((ret = nc_put_vara_int(ncid,vid,vstart,vcount,&v[0][0]))) ERR(ret);
+    /* Extend u by a record, which lies in an existing shard */
+    if((ret = nc_put_vara_float(ncid,uid,ustart,ucount,u))) ERR(ret);
+    /* Read back before the modified chunks are written */
+    check(ncid);
+    if((ret = nc_close(ncid))) ERR(ret);
+
+    if((ret = nc_open(argv[1],NC_NOWRITE,&ncid))) ERR(ret);
+    check(ncid);
+    if((ret = nc_close(ncid))) ERR(ret);
+    printf("*** test_shard passed\n");
+    exit(0);
+}
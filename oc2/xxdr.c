@@ -506,6 +506,63 @@ xxdrntohdouble(char* c8, double* dp)
     if(dp) memcpy(dp, ii, sizeof(double));
 }
 
+/* Bulk conversion of arrays from network order, in place.
+   The loops are written using shifts on whole words (rather than
+   the byte-at-a-time swapinline macros) so that the compiler
+   can vectorize them.
+*/
+void
+xxdr_swap32array(void* mem, size_t count)
+{
+    size_t i;
+    unsigned int* ip = (unsigned int*)mem;
+    if(xxdr_network_order) return;
+    for(i=0;i<count;i++) {
+	unsigned int v = ip[i];
+	ip[i] = ((v & 0x000000FFU) << 24)
+	      | ((v & 0x0000FF00U) << 8)
+	      | ((v & 0x00FF0000U) >> 8)
+	      | ((v & 0xFF000000U) >> 24);
+    }
+}
+
+void
+xxdr_swap64array(void* mem, size_t count)
+{
+    size_t i;
+    unsigned long long* llp = (unsigned long long*)mem;
+    if(xxdr_network_order) return;
+    for(i=0;i<count;i++) {
+	unsigned long long v = llp[i];
+	v = ((v & 0x00000000FFFFFFFFULL) << 32) | ((v & 0xFFFFFFFF00000000ULL) >> 32);
+	v = ((v & 0x0000FFFF0000FFFFULL) << 16) | ((v & 0xFFFF0000FFFF0000ULL) >> 16);
+	v = ((v & 0x00FF00FF00FF00FFULL) << 8)  | ((v & 0xFF00FF00FF00FF00ULL) >> 8);
+	llp[i] = v;
+    }
+}
+
+/* get count unpacked shorts from underlying stream;
+   each short occupies a full XDRUNIT, so read them in blocks */
+#define USHORTBLOCK 1024
+int
+xxdr_ushortarray(XXDR* xdr, unsigned short* sp, size_t count)
+{
+    unsigned int block[USHORTBLOCK];
+    if(!sp) return 0;
+    while(count > 0) {
+	size_t i;
+	size_t n = (count < USHORTBLOCK ? count : USHORTBLOCK);
+	if(!xdr->getbytes(xdr,(char*)block,(off_t)(n*XDRUNIT)))
+	    return 0;
+	xxdr_swap32array(block,n);
+	for(i=0;i<n;i++)
+	    sp[i] = (unsigned short)block[i];
+	sp += n;
+	count -= n;
+    }
+    return 1;
+}
+
 void
 xxdr_init()
 {
@@ -151,6 +151,9 @@ extern int xxdr_uint(XXDR* , unsigned int*);
 /* get an int from underlying stream*/
 extern int xxdr_ulonglong(XXDR* , unsigned long long*);
 
+/* get count unpacked shorts from underlying stream*/
+extern int xxdr_ushortarray(XXDR*, unsigned short*, size_t count);
+
 /* get a float from underlying stream*/
 extern int xxdr_float(XXDR* , float*);
 
@@ -189,6 +192,10 @@ extern int xxdr_skip_strings(XXDR* xdrs, off_t n);
 
 extern unsigned int xxdr_roundup(off_t n); /* procedural version of RNDUP macro */
 
+/* Convert arrays of 4 and 8 byte values from network order in place */
+extern void xxdr_swap32array(void* mem, size_t count);
+extern void xxdr_swap64array(void* mem, size_t count);
+
 extern void xxdr_init(void);
 
 /* Define some inlines */
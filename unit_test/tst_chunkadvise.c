@@ -0,0 +1,150 @@
+/* This is part of the netCDF package. Copyright 2018 University
+   Corporation for Atmospheric Research/Unidata. See COPYRIGHT file
+   for conditions of use.
+
+   Test the chunk sizes advised by ncaux_advise_chunking().
+*/
+
+#include "config.h"
+#include <nc_tests.h>
+#include <math.h>
+#include "netcdf_aux.h"
+#include "err_macros.h"
+
+#define NDIMS 3
+#define NTIME 1000
+#define NLAT 180
+#define NLON 360
+#define TARGET 4194304
+
+static const size_t dimlens[NDIMS] = {NTIME, NLAT, NLON};
+static const size_t series[NDIMS] = {NTIME, 1, 1};
+static const size_t map[NDIMS] = {1, NLAT, NLON};
+static const size_t cube[NDIMS] = {10, 10, 10};
+
+/* Count the chunks read by reading every slab of shape counts, on a
+ * grid of slabs, with chunks of shape chunks. */
+static double
+chunks_read(const size_t *counts, const size_t *chunks)
+{
+    double total = 1;
+    int d;
+
+    for (d = 0; d < NDIMS; d++)
+    {
+        size_t start, n = 0, nslabs = 0;
+        for (start = 0; start + counts[d] <= dimlens[d]; start += counts[d], nslabs++)
+            n += (start + counts[d] - 1) / chunks[d] - start / chunks[d] + 1;
+        total *= (double)n / (double)nslabs;
+    }
+    return total;
+}
+
+/* Check that chunks fit the dims and the target. */
+static int
+check_fits(const size_t *lens, const size_t *chunks, size_t typesize, size_t target)
+{
+    size_t bytes = typesize;
+    int d;
+
+    for (d = 0; d < NDIMS; d++)
+    {
+        if (chunks[d] < 1) ERR;
+        if (lens[d] && chunks[d] > lens[d]) ERR;
+        bytes *= chunks[d];
+    }
+    if (bytes > target && bytes > typesize) ERR;
+    return 0;
+}
+
+int
+main(int argc, char **argv)
+{
+    printf("\n*** Testing chunk size advice.\n");
+    printf("*** checking bad parameters...");
+    {
+        NC_Access_Pattern pattern = {1.0, series};
+        size_t zero[NDIMS] = {0, 1, 1};
+        size_t chunks[NDIMS];
+
+        if (ncaux_advise_chunking(0, dimlens, 4, 0, 1, &pattern, chunks) != NC_EINVAL) ERR;
+        if (ncaux_advise_chunking(NDIMS, dimlens, 0, 0, 1, &pattern, chunks) != NC_EINVAL) ERR;
+        if (ncaux_advise_chunking(NDIMS, dimlens, 4, 0, 0, &pattern, chunks) != NC_EINVAL) ERR;
+        if (ncaux_advise_chunking(NDIMS, dimlens, 4, 0, 1, &pattern, NULL) != NC_EINVAL) ERR;
+        pattern.weight = -1;
+        if (ncaux_advise_chunking(NDIMS, dimlens, 4, 0, 1, &pattern, chunks) != NC_EINVAL) ERR;
+        pattern.weight = 1;
+        pattern.counts = zero;
+        if (ncaux_advise_chunking(NDIMS, dimlens, 4, 0, 1, &pattern, chunks) != NC_EINVAL) ERR;
+    }
+    SUMMARIZE_ERR;
+
+    printf("*** checking advice for one access pattern...");
+    {
+        NC_Access_Pattern pattern = {1.0, series};
+        size_t chunks[NDIMS];
+
+        /* A time series is read from one chunk. */
+        if (ncaux_advise_chunking(NDIMS, dimlens, 4, TARGET, 1, &pattern, chunks)) ERR;
+        if (check_fits(dimlens, chunks, 4, TARGET)) ERR;
+        if (chunks[0] != NTIME) ERR;
+        if (chunks_read(series, chunks) != 1) ERR;
+
+        /* So is a map, and the chunks are filled out with time. */
+        pattern.counts = map;
+        if (ncaux_advise_chunking(NDIMS, dimlens, 4, TARGET, 1, &pattern, chunks)) ERR;
+        if (check_fits(dimlens, chunks, 4, TARGET)) ERR;
+        if (chunks[1] != NLAT || chunks[2] != NLON) ERR;
+        if (chunks[0] != TARGET / 4 / (NLAT * NLON)) ERR;
+
+        /* Chunks smaller than a value hold a value. */
+        if (ncaux_advise_chunking(NDIMS, dimlens, 8, 4, 1, &pattern, chunks)) ERR;
+        if (chunks[0] != 1 || chunks[1] != 1 || chunks[2] != 1) ERR;
+    }
+    SUMMARIZE_ERR;
+
+    printf("*** checking advice for mixed access patterns...");
+    {
+        NC_Access_Pattern patterns[3] = {{1.0, series}, {1.0, map}, {1.0, cube}};
+        size_t chunks[NDIMS], series_chunks[NDIMS], map_chunks[NDIMS];
+        double cost, series_cost, map_cost;
+
+        if (ncaux_advise_chunking(NDIMS, dimlens, 4, TARGET, 1, &patterns[0], series_chunks)) ERR;
+        if (ncaux_advise_chunking(NDIMS, dimlens, 4, TARGET, 1, &patterns[1], map_chunks)) ERR;
+
+        /* Reading both time series and maps, the advice beats chunks
+         * shaped for either. */
+        if (ncaux_advise_chunking(NDIMS, dimlens, 4, TARGET, 2, patterns, chunks)) ERR;
+        if (check_fits(dimlens, chunks, 4, TARGET)) ERR;
+        cost = chunks_read(series, chunks) + chunks_read(map, chunks);
+        series_cost = chunks_read(series, series_chunks) + chunks_read(map, series_chunks);
+        map_cost = chunks_read(series, map_chunks) + chunks_read(map, map_chunks);
+        if (cost >= series_cost || cost >= map_cost) ERR;
+
+        /* Weighting time series more makes chunks longer in time. */
+        patterns[0].weight = 100;
+        if (ncaux_advise_chunking(NDIMS, dimlens, 4, TARGET, 2, patterns, series_chunks)) ERR;
+        if (check_fits(dimlens, series_chunks, 4, TARGET)) ERR;
+        if (series_chunks[0] <= chunks[0]) ERR;
+
+        /* Cubes too. */
+        patterns[0].weight = 1;
+        if (ncaux_advise_chunking(NDIMS, dimlens, 4, TARGET, 3, patterns, chunks)) ERR;
+        if (check_fits(dimlens, chunks, 4, TARGET)) ERR;
+    }
+    SUMMARIZE_ERR;
+
+    printf("*** checking advice for an unlimited dimension...");
+    {
+        size_t lens[NDIMS] = {0, NLAT, NLON};
+        NC_Access_Pattern pattern = {1.0, map};
+        size_t chunks[NDIMS];
+
+        /* With the default target. */
+        if (ncaux_advise_chunking(NDIMS, lens, 8, 0, 1, &pattern, chunks)) ERR;
+        if (check_fits(lens, chunks, 8, DEFAULT_CHUNK_SIZE)) ERR;
+        if (chunks[1] != NLAT || chunks[2] != NLON) ERR;
+    }
+    SUMMARIZE_ERR;
+    FINAL_RESULTS;
+}
@@ -0,0 +1,109 @@
+/* This is part of the netCDF package. Copyright 2018 University
+   Corporation for Atmospheric Research/Unidata. See COPYRIGHT file
+   for conditions of use.
+
+   Test that NC_crc32() and NC_crc64() give the same CRCs with the
+   CPU's CRC instructions as with tables.
+*/
+
+#include "config.h"
+#include <nc_tests.h>
+#include "nccrc.h"
+#include "err_macros.h"
+
+#define MAXLEN 5000
+#define CHECK "123456789"
+#define CHECK32 0xcbf43926U
+#define CHECK64 0x995dc9bbdf1939faULL
+
+static unsigned char data[MAXLEN + 16];
+
+/* Bitwise CRC-32 of zlib, for the tests. */
+static unsigned int
+crc32_bits(unsigned int crc, const unsigned char *buf, size_t len)
+{
+    int b;
+
+    crc = ~crc;
+    while (len--)
+    {
+        crc ^= *buf++;
+        for (b = 0; b < 8; b++)
+            crc = (crc >> 1) ^ (0xedb88320U & (0U - (crc & 1)));
+    }
+    return ~crc;
+}
+
+/* Bitwise CRC-64 of xz, for the tests. */
+static unsigned long long
+crc64_bits(unsigned long long crc, const unsigned char *buf, size_t len)
+{
+    int b;
+
+    crc = ~crc;
+    while (len--)
+    {
+        crc ^= *buf++;
+        for (b = 0; b < 8; b++)
+            crc = (crc >> 1) ^ (0xc96c5795d7870f42ULL & (0ULL - (crc & 1)));
+    }
+    return ~crc;
+}
+
+int
+main(int argc, char **argv)
+{
+    unsigned int seed = 1;
+    size_t i, len, off;
+
+    printf("\n*** Testing CRCs with %s instructions.\n", NC_crc_hwname());
+    for (i = 0; i < sizeof(data); i++)
+    {
+        seed = seed * 1103515245U + 12345U;
+        data[i] = (unsigned char)(seed >> 16);
+    }
+
+    printf("*** testing check values...");
+    if (NC_crc32(0, CHECK, 9) != CHECK32) ERR;
+    if (NC_crc64(0, (void *)CHECK, 9) != CHECK64) ERR;
+    if (NC_crc32(0, NULL, 0) != 0) ERR;
+    SUMMARIZE_ERR;
+
+    printf("*** testing CRCs of all lengths and alignments...");
+    for (len = 0; len <= MAXLEN; len += (len < 600 ? 1 : 37))
+    {
+        for (off = 0; off < 16; off += (len < 600 ? 15 : 1))
+        {
+            unsigned char *p = data + off;
+            if (NC_crc32(0, p, (unsigned int)len) != crc32_bits(0, p, len)) ERR;
+            if (NC_crc64(0, p, (unsigned int)len) != crc64_bits(0, p, len)) ERR;
+        }
+    }
+    SUMMARIZE_ERR;
+
+    printf("*** testing CRCs continued from other CRCs...");
+    for (len = 0; len <= MAXLEN; len += 97)
+    {
+        unsigned int c32 = crc32_bits(0, data, 100);
+        unsigned long long c64 = crc64_bits(0, data, 100);
+        if (NC_crc32(c32, data + 100, (unsigned int)len) != crc32_bits(0, data, len + 100)) ERR;
+        if (NC_crc64(c64, data + 100, (unsigned int)len) != crc64_bits(0, data, len + 100)) ERR;
+        if (NC_crc32(0xffffffffU, data, (unsigned int)len) != crc32_bits(0xffffffffU, data, len)) ERR;
+        if (NC_crc64(~0ULL, data, (unsigned int)len) != crc64_bits(~0ULL, data, len)) ERR;
+    }
+    SUMMARIZE_ERR;
+
+    printf("*** testing CRCs with tables only...");
+    {
+        int old = NC_crc_usehardware(0);
+        if (strcmp(NC_crc_hwname(), "none")) ERR;
+        for (len = 0; len <= MAXLEN; len += 251)
+        {
+            if (NC_crc32(0, data + 3, (unsigned int)len) != crc32_bits(0, data + 3, len)) ERR;
+            if (NC_crc64(0, data + 3, (unsigned int)len) != crc64_bits(0, data + 3, len)) ERR;
+        }
+        NC_crc_usehardware(old);
+    }
+    SUMMARIZE_ERR;
+    FINAL_RESULTS;
+}
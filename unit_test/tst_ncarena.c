@@ -0,0 +1,75 @@
+/* This is part of the netCDF package. Copyright 2018 University
+   Corporation for Atmospheric Research/Unidata. See COPYRIGHT file
+   for conditions of use.
+
+   Test the arena allocator in ncarena.c.
+*/
+
+#include "config.h"
+#include <nc_tests.h>
+#include "ncarena.h"
+#include "err_macros.h"
+
+#define NOBJS 10000
+#define SMALLBLOCK 256
+
+int
+main(int argc, char **argv)
+{
+    printf("\n*** Testing netcdf internal arena functions.\n");
+    printf("Testing empty arena...");
+    {
+        NCarena *arena;
+
+        if (!(arena = ncarenanew(0))) ERR;
+        ncarenafree(arena);
+        ncarenafree(NULL);
+        if (ncarenaalloc(NULL, 8)) ERR;
+    }
+    SUMMARIZE_ERR;
+    printf("Testing many small allocations...");
+    {
+        NCarena *arena;
+        long long *objs[NOBJS];
+        int i;
+
+        if (!(arena = ncarenanew(SMALLBLOCK))) ERR;
+        for (i = 0; i < NOBJS; i++)
+        {
+            size_t size = sizeof(long long) * (size_t)(1 + i % 5);
+            size_t j;
+            if (!(objs[i] = ncarenaalloc(arena, size))) ERR;
+            /* Memory is zeroed and aligned. */
+            if ((size_t)objs[i] % sizeof(long long)) ERR;
+            for (j = 0; j < size / sizeof(long long); j++)
+                if (objs[i][j]) ERR;
+            objs[i][0] = i;
+        }
+        /* Nothing was overwritten. */
+        for (i = 0; i < NOBJS; i++)
+            if (objs[i][0] != i) ERR;
+        ncarenafree(arena);
+    }
+    SUMMARIZE_ERR;
+    printf("Testing large allocations and strings...");
+    {
+        NCarena *arena;
+        char *small, *big, *str;
+
+        if (!(arena = ncarenanew(SMALLBLOCK))) ERR;
+        if (!(small = ncarenaalloc(arena, 10))) ERR;
+        strcpy(small, "small");
+        /* Larger than a block; gets a block of its own. */
+        if (!(big = ncarenaalloc(arena, SMALLBLOCK * 10))) ERR;
+        memset(big, 'x', SMALLBLOCK * 10);
+        if (!(str = ncarenastrdup(arena, "a name"))) ERR;
+        if (strcmp(str, "a name")) ERR;
+        if (strcmp(small, "small")) ERR;
+        if (ncarenastrdup(arena, NULL)) ERR;
+        if (!(str = ncarenastrdup(arena, ""))) ERR;
+        if (str[0]) ERR;
+        ncarenafree(arena);
+    }
+    SUMMARIZE_ERR;
+    FINAL_RESULTS;
+}
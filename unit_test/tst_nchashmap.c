@@ -0,0 +1,124 @@
+/* This is part of the netCDF package. Copyright 2018 University
+   Corporation for Atmospheric Research/Unidata. See COPYRIGHT file
+   for conditions of use.
+
+   Test the hashmap in nchashmap.c.
+*/
+
+#include "config.h"
+#include <nc_tests.h>
+#include "nchashmap.h"
+#include "err_macros.h"
+
+#define NKEYS 5000
+#define MAXKEY 64
+
+/* Make key i; every 3rd key is too long to be stored in the entry. */
+static size_t
+makekey(int i, char *key)
+{
+    if (i % 3 == 0)
+        snprintf(key, MAXKEY, "a_rather_long_variable_name_%d", i);
+    else
+        snprintf(key, MAXKEY, "v%d", i);
+    return strlen(key);
+}
+
+int
+main(int argc, char **argv)
+{
+    printf("\n*** Testing netcdf internal hashmap functions.\n");
+    printf("Testing empty hashmap...");
+    {
+        NC_hashmap *map;
+        uintptr_t data;
+
+        if (!(map = NC_hashmapnew(0))) ERR;
+        if (NC_hashmapcount(map)) ERR;
+        if (NC_hashmapget(map, "x", 1, &data)) ERR;
+        if (NC_hashmapremove(map, "x", 1, &data)) ERR;
+        if (NC_hashmapsetdata(map, "x", 1, 1)) ERR;
+        /* Empty keys are not allowed. */
+        if (NC_hashmapadd(map, 1, "", 0)) ERR;
+        NC_hashmapfree(map);
+    }
+    SUMMARIZE_ERR;
+    printf("Testing add, get and remove...");
+    {
+        NC_hashmap *map;
+        char key[MAXKEY];
+        uintptr_t data;
+        size_t len, i, nactive;
+        int k;
+
+        if (!(map = NC_hashmapnew(0))) ERR;
+        for (k = 0; k < NKEYS; k++)
+        {
+            len = makekey(k, key);
+            if (!NC_hashmapadd(map, (uintptr_t)k, key, len)) ERR;
+        }
+        if (NC_hashmapcount(map) != NKEYS) ERR;
+        for (k = 0; k < NKEYS; k++)
+        {
+            len = makekey(k, key);
+            if (!NC_hashmapget(map, key, len, &data)) ERR;
+            if (data != (uintptr_t)k) ERR;
+        }
+        /* A prefix of a key is a different key. */
+        if (NC_hashmapget(map, "v1", 1, &data)) ERR;
+
+        /* Adding an existing key replaces its data. */
+        if (!NC_hashmapadd(map, 42, "v1", 2)) ERR;
+        if (NC_hashmapcount(map) != NKEYS) ERR;
+        if (!NC_hashmapget(map, "v1", 2, &data) || data != 42) ERR;
+        if (!NC_hashmapsetdata(map, "v1", 2, 1)) ERR;
+        if (!NC_hashmapget(map, "v1", 2, &data) || data != 1) ERR;
+
+        /* Remove the odd keys. */
+        for (k = 1; k < NKEYS; k += 2)
+        {
+            len = makekey(k, key);
+            if (!NC_hashmapremove(map, key, len, &data)) ERR;
+            if (data != (uintptr_t)k) ERR;
+            if (NC_hashmapremove(map, key, len, &data)) ERR;
+        }
+        if (NC_hashmapcount(map) != NKEYS / 2) ERR;
+        for (k = 0; k < NKEYS; k++)
+        {
+            len = makekey(k, key);
+            if (NC_hashmapget(map, key, len, &data) != !(k % 2)) ERR;
+        }
+
+        /* Iterating finds the keys that remain. */
+        for (nactive = 0, i = 0; i < map->alloc; i++)
+        {
+            const char *ikey;
+            if (NC_hashmapith(map, i, &data, &ikey)) ERR;
+            if (ikey == NULL) continue;
+            nactive++;
+            makekey((int)data, key);
+            if (strcmp(ikey, key)) ERR;
+        }
+        if (nactive != NKEYS / 2) ERR;
+        if (NC_hashmapith(map, i, &data, NULL) != NC_EINVAL) ERR;
+
+        /* Add and remove many times, so that the table is filled
+         * with deleted entries. */
+        for (k = 0; k < 10 * NKEYS; k++)
+        {
+            snprintf(key, MAXKEY, "tmp%d", k);
+            if (!NC_hashmapadd(map, (uintptr_t)k, key, strlen(key))) ERR;
+            if (!NC_hashmapremove(map, key, strlen(key), NULL)) ERR;
+        }
+        if (NC_hashmapcount(map) != NKEYS / 2) ERR;
+        for (k = 0; k < NKEYS; k += 2)
+        {
+            len = makekey(k, key);
+            if (!NC_hashmapgetkey(map, key, len, NC_hashmapkey(key, len), &data)) ERR;
+            if (data != (uintptr_t)k) ERR;
+        }
+        NC_hashmapfree(map);
+    }
+    SUMMARIZE_ERR;
+    FINAL_RESULTS;
+}